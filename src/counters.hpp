@@ -0,0 +1,42 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Result counters kept in per-thread, cache line aligned blocks, so that
+    MsQuic worker threads never write to the same cache line. The blocks are
+    only summed up when read, for the summary or CSV output.
+
+--*/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+#define COUNTER_BLOCKS              64          // Number of per-thread counter blocks
+#define CACHE_LINE_SIZE             64
+
+// A set of 64-bit counters, identified by the values of an enum that ends in Count.
+template<typename Id>
+struct ReachCounters {
+    struct alignas(CACHE_LINE_SIZE) Block {
+        std::atomic<uint64_t> Values[(size_t)Id::Count] {};
+    };
+    Block Blocks[COUNTER_BLOCKS];
+    static uint32_t ThreadBlock() {
+        static std::atomic<uint32_t> NextBlock {0};
+        thread_local uint32_t Index = NextBlock++ % COUNTER_BLOCKS;
+        return Index;
+    }
+    void Add(Id Counter, uint64_t Value = 1) {
+        Blocks[ThreadBlock()].Values[(size_t)Counter].fetch_add(Value, std::memory_order_relaxed);
+    }
+    uint64_t Get(Id Counter) const {
+        uint64_t Sum = 0;
+        for (const auto& Block : Blocks) Sum += Block.Values[(size_t)Counter].load(std::memory_order_relaxed);
+        return Sum;
+    }
+};
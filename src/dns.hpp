@@ -0,0 +1,408 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Asynchronous stub DNS resolver. A and AAAA queries for many host names are
+    pipelined from a single thread over a few UDP sockets to one recursive
+    name server, and responses are matched back to their queries by ID and
+    question. Lost queries are retried, so thousands of names per second can
+    be resolved without a thread per outstanding lookup.
+
+--*/
+
+#pragma once
+
+#include <stdio.h>
+#include <ctype.h>
+#include <string.h>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "resolve.hpp"
+#ifdef _WIN32
+typedef SOCKET ReachSocket;
+#define REACH_INVALID_SOCKET INVALID_SOCKET
+#define ReachPoll WSAPoll
+#define ReachCloseSocket closesocket
+inline bool ReachSetNonBlocking(ReachSocket Socket) { u_long Value = 1; return ioctlsocket(Socket, FIONBIO, &Value) == 0; }
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+typedef int ReachSocket;
+#define REACH_INVALID_SOCKET (-1)
+#define ReachPoll poll
+#define ReachCloseSocket close
+inline bool ReachSetNonBlocking(ReachSocket Socket) { return fcntl(Socket, F_SETFL, fcntl(Socket, F_GETFL) | O_NONBLOCK) == 0; }
+#endif
+
+#define DNS_PORT                53
+#define DNS_SOCKETS             4           // UDP sockets (source ports) queries are spread across
+#define DNS_RETRY_MS            500         // Time to wait for a response before resending a query
+#define DNS_ATTEMPTS            3           // Sends per query before giving up on it
+#define DNS_MAX_PACKET          1232        // Largest response read (the EDNS-recommended UDP size)
+#define DNS_MAX_LOOKUPS         16384u      // Outstanding lookups, so at most half of the query IDs are in use
+#define DNS_TYPE_A              1
+#define DNS_TYPE_AAAA           28
+#define DNS_CLASS_IN            1
+
+class ReachDnsResolver : public ReachResolver {
+public:
+    ReachDnsResolver(_In_ const QuicAddr& Server, uint32_t MaxLookups) :
+        Server(Server), MaxLookups(MaxLookups < DNS_MAX_LOOKUPS ? MaxLookups : DNS_MAX_LOOKUPS), Random(std::random_device()()) {
+        if (this->Server.GetPort() == 0) this->Server.SetPort(DNS_PORT);
+        for (auto& Socket : Sockets) {
+            Socket = socket(Server.GetFamily() == QUIC_ADDRESS_FAMILY_INET6 ? AF_INET6 : AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            if (Socket == REACH_INVALID_SOCKET || !ReachSetNonBlocking(Socket)) return;
+        }
+        // Loopback socket used only to wake the resolver thread up.
+        QuicAddr Loopback(QUIC_ADDRESS_FAMILY_INET);
+        Loopback.SockAddr.Ipv4.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t Length = sizeof(Loopback.SockAddr.Ipv4);
+        WakeSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (WakeSocket == REACH_INVALID_SOCKET || !ReachSetNonBlocking(WakeSocket) ||
+            bind(WakeSocket, &Loopback.SockAddr.Ip, Length) != 0 ||
+            getsockname(WakeSocket, &Loopback.SockAddr.Ip, &Length) != 0) {
+            return;
+        }
+        WakeAddress = Loopback;
+        Valid = true;
+        Thread = std::thread([this]() { Run(); });
+    }
+    ~ReachDnsResolver() {
+        if (Thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                Stopping = true;
+            }
+            Wake();
+            Thread.join();
+        }
+        for (auto Socket : Sockets) if (Socket != REACH_INVALID_SOCKET) ReachCloseSocket(Socket);
+        if (WakeSocket != REACH_INVALID_SOCKET) ReachCloseSocket(WakeSocket);
+    }
+    bool IsValid() const { return Valid; }
+    uint32_t Concurrency() const override { return MaxLookups; }
+    void Start(_In_ ReachLookup* Lookup) override {
+        bool WasEmpty;
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            WasEmpty = Incoming.empty();
+            Incoming.push_back(Lookup);
+        }
+        if (WasEmpty) Wake();
+    }
+
+    // Reads the first name server from the system configuration.
+    static bool GetSystemServer(_Out_ QuicAddr& Server) {
+#ifdef _WIN32
+        (void)Server;
+        return false; // Not read from the registry; use --dns on Windows
+#else
+        FILE* File = fopen("/etc/resolv.conf", "r");
+        if (!File) return false;
+        char Line[256], Address[64];
+        bool Found = false;
+        while (!Found && fgets(Line, sizeof(Line), File)) {
+            Found = sscanf(Line, " nameserver %63s", Address) == 1 && QuicAddrFromString(Address, DNS_PORT, &Server.SockAddr);
+        }
+        fclose(File);
+        return Found;
+#endif
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    struct Pending;
+    struct Query {
+        Pending* Owner;
+        uint16_t Type;
+        uint16_t Id {0};
+        uint32_t Attempts {0};
+        uint32_t Generation {0}; // Distinguishes retry deadlines of earlier sends
+        bool Done {false};
+        uint32_t Length {0};
+        uint8_t Packet[12 + 256 + 4];
+    };
+    struct Pending {
+        ReachLookup* Lookup;
+        Clock::time_point Start;
+        Query Queries[2]; // A, AAAA
+        ReachResolution Found[2]; // Addresses of each query, as they come in
+        ReachResolution Resolution; // The result, with the lowest TTL of all the answers
+    };
+    struct Deadline {
+        Clock::time_point Time;
+        Query* Target;
+        uint32_t Generation;
+    };
+
+    void Wake() {
+        uint8_t Byte = 0;
+        sendto(WakeSocket, (const char*)&Byte, 1, 0, &WakeAddress.SockAddr.Ip, sizeof(WakeAddress.SockAddr.Ipv4));
+    }
+
+    // Encodes a standard recursive query for the name. Fails for names that
+    // can't be encoded (e.g. empty or overlong labels).
+    static bool Encode(_Inout_ Query& Query, _In_z_ const char* HostName) {
+        auto Packet = Query.Packet;
+        const uint8_t Header[12] = {0, 0, 0x01, 0x00, 0, 1, 0, 0, 0, 0, 0, 0}; // RD, QDCOUNT=1
+        memcpy(Packet, Header, sizeof(Header));
+        uint32_t Offset = sizeof(Header);
+        auto Label = HostName;
+        while (*Label) {
+            auto End = strchr(Label, '.');
+            auto LabelLength = End ? (size_t)(End - Label) : strlen(Label);
+            if (LabelLength == 0 || LabelLength > 63 || Offset + 1 + LabelLength > 12 + 254) return false;
+            Packet[Offset++] = (uint8_t)LabelLength;
+            memcpy(Packet + Offset, Label, LabelLength);
+            Offset += (uint32_t)LabelLength;
+            if (!End) break;
+            Label = End + 1; // A trailing dot ends the name
+        }
+        if (Offset == sizeof(Header)) return false;
+        Packet[Offset++] = 0;
+        Packet[Offset++] = (uint8_t)(Query.Type >> 8);
+        Packet[Offset++] = (uint8_t)Query.Type;
+        Packet[Offset++] = 0;
+        Packet[Offset++] = DNS_CLASS_IN;
+        Query.Length = Offset;
+        return true;
+    }
+
+    // Host names that are already IP addresses don't need a query.
+    static bool ParseLiteral(_In_z_ const char* HostName, _Out_ QuicAddr& Address) {
+        if (inet_pton(AF_INET, HostName, &Address.SockAddr.Ipv4.sin_addr) == 1) {
+            Address.SetFamily(QUIC_ADDRESS_FAMILY_INET);
+            return true;
+        }
+        if (inet_pton(AF_INET6, HostName, &Address.SockAddr.Ipv6.sin6_addr) == 1) {
+            Address.SetFamily(QUIC_ADDRESS_FAMILY_INET6);
+            return true;
+        }
+        return false;
+    }
+
+    void Begin(_In_ ReachLookup* Lookup) {
+        ReachResolution Resolution;
+        Resolution.Attempted = true;
+        QuicAddr Literal;
+        if (ParseLiteral(Lookup->HostName.c_str(), Literal)) {
+            Resolution.Add(Literal);
+            Lookup->Resolution = Resolution;
+            Lookup->Complete();
+            return;
+        }
+        auto State = new Pending;
+        State->Lookup = Lookup;
+        State->Start = Clock::now();
+        State->Resolution.Attempted = true;
+        State->Resolution.Ttl = UINT32_MAX;
+        State->Queries[0].Type = DNS_TYPE_A;
+        State->Queries[1].Type = DNS_TYPE_AAAA;
+        for (auto& Query : State->Queries) {
+            Query.Owner = State;
+            if (!Encode(Query, Lookup->HostName.c_str())) {
+                delete State;
+                Lookup->Resolution = Resolution;
+                Lookup->Complete();
+                return;
+            }
+        }
+        ++Outstanding;
+        for (auto& Query : State->Queries) Send(Query);
+    }
+
+    void Send(_Inout_ Query& Query) {
+        // Each (re)send gets a new random, unused ID. With at most two queries
+        // per lookup, at least half of the IDs are always free.
+        if (Query.Attempts) Ids[Query.Id] = nullptr;
+        do { Query.Id = (uint16_t)Random(); } while (Ids[Query.Id]);
+        Ids[Query.Id] = &Query;
+        Query.Packet[0] = (uint8_t)(Query.Id >> 8);
+        Query.Packet[1] = (uint8_t)Query.Id;
+        ++Query.Attempts;
+        ++Query.Generation;
+        auto Socket = Sockets[NextSocket++ % DNS_SOCKETS];
+        sendto(Socket, (const char*)Query.Packet, Query.Length, 0, &Server.SockAddr.Ip,
+            Server.GetFamily() == QUIC_ADDRESS_FAMILY_INET6 ? sizeof(Server.SockAddr.Ipv6) : sizeof(Server.SockAddr.Ipv4));
+        Deadlines.push_back({Clock::now() + std::chrono::milliseconds(DNS_RETRY_MS), &Query, Query.Generation});
+    }
+
+    // Completes a query, and the lookup once both of its queries are complete.
+    void Finish(_Inout_ Query& Query) {
+        Ids[Query.Id] = nullptr;
+        Query.Done = true;
+        auto State = Query.Owner;
+        if (!State->Queries[0].Done || !State->Queries[1].Done) return;
+
+        // The answers arrive in any order, and without the system resolver's
+        // sorting, IPv4 is preferred as the more widely reachable family.
+        auto& Resolution = State->Resolution;
+        for (const auto& Found : State->Found) {
+            for (uint32_t i = 0; i < Found.AddressCount; ++i) Resolution.Add(Found.Addresses[i]);
+        }
+        if (!Resolution.Resolved) Resolution.Ttl = 0;
+        Resolution.TimeUs = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - State->Start).count();
+        State->Lookup->Resolution = Resolution;
+        State->Lookup->Complete();
+        // Deadlines may still point at the queries, so the state is only freed once they've expired.
+        Retired.push_back({Clock::now() + std::chrono::milliseconds(DNS_RETRY_MS), State});
+        --Outstanding;
+    }
+
+    static const uint8_t* SkipName(_In_ const uint8_t* Data, _In_ const uint8_t* End) {
+        while (Data < End) {
+            if (*Data == 0) return Data + 1;
+            if ((*Data & 0xC0) == 0xC0) return Data + 2 <= End ? Data + 2 : nullptr; // Compression pointer
+            Data += 1 + *Data;
+        }
+        return nullptr;
+    }
+
+    void OnResponse(_In_reads_(Length) const uint8_t* Packet, size_t Length) {
+        if (Length < 12) return;
+        auto Query = Ids[(uint16_t)(Packet[0] << 8 | Packet[1])];
+        if (!Query || !(Packet[2] & 0x80)) return; // Unknown ID or not a response
+        // The question must match too, so stray or spoofed responses are ignored.
+        if (Length < Query->Length || Packet[5] != 1) return;
+        for (uint32_t i = 12; i < Query->Length; ++i) {
+            if (tolower(Packet[i]) != tolower(Query->Packet[i])) return;
+        }
+        auto RCode = Packet[3] & 0x0F;
+        if (RCode != 0 || (Packet[2] & 0x02)) { // Error (e.g. NXDOMAIN), or truncated
+            Finish(*Query);
+            return;
+        }
+        auto State = Query->Owner;
+        auto& Resolution = State->Resolution;
+        auto Answers = (uint16_t)(Packet[6] << 8 | Packet[7]);
+        auto Data = Packet + Query->Length;
+        auto End = Packet + Length;
+        uint32_t Ttl = UINT32_MAX; // The lowest TTL so far, including any CNAMEs
+        for (uint16_t i = 0; i < Answers && Data; ++i) {
+            Data = SkipName(Data, End);
+            if (!Data || Data + 10 > End) break;
+            auto Type = (uint16_t)(Data[0] << 8 | Data[1]);
+            auto Class = (uint16_t)(Data[2] << 8 | Data[3]);
+            auto RecordTtl = (uint32_t)Data[4] << 24 | (uint32_t)Data[5] << 16 | (uint32_t)Data[6] << 8 | Data[7];
+            auto RdLength = (uint16_t)(Data[8] << 8 | Data[9]);
+            if (RecordTtl < Ttl) Ttl = RecordTtl;
+            Data += 10;
+            if (Data + RdLength > End) break;
+            if (Type == Query->Type && Class == DNS_CLASS_IN) { // Any CNAMEs are skipped over
+                QuicAddr Address;
+                if (Type == DNS_TYPE_A && RdLength == 4) {
+                    Address.SetFamily(QUIC_ADDRESS_FAMILY_INET);
+                    memcpy(&Address.SockAddr.Ipv4.sin_addr, Data, 4);
+                } else if (Type == DNS_TYPE_AAAA && RdLength == 16) {
+                    Address.SetFamily(QUIC_ADDRESS_FAMILY_INET6);
+                    memcpy(&Address.SockAddr.Ipv6.sin6_addr, Data, 16);
+                }
+                if (Address.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC) {
+                    State->Found[Query - State->Queries].Add(Address);
+                    if (Ttl < Resolution.Ttl) Resolution.Ttl = Ttl;
+                }
+            }
+            Data += RdLength;
+        }
+        Finish(*Query);
+    }
+
+    void OnTimeouts() {
+        auto Now = Clock::now();
+        // Deadlines are all the same distance from their send, so they expire in order.
+        while (!Deadlines.empty() && Deadlines.front().Time <= Now) {
+            auto Entry = Deadlines.front();
+            Deadlines.pop_front();
+            auto Query = Entry.Target;
+            if (Query->Done || Query->Generation != Entry.Generation) continue;
+            if (Query->Attempts < DNS_ATTEMPTS) {
+                Send(*Query);
+            } else {
+                Finish(*Query);
+            }
+        }
+        while (!Retired.empty() && Retired.front().first <= Now) {
+            delete Retired.front().second;
+            Retired.pop_front();
+        }
+    }
+
+    void Run() {
+        std::vector<ReachLookup*> Batch;
+        pollfd Fds[DNS_SOCKETS + 1];
+        for (uint32_t i = 0; i < DNS_SOCKETS; ++i) Fds[i] = {Sockets[i], POLLIN, 0};
+        Fds[DNS_SOCKETS] = {WakeSocket, POLLIN, 0};
+        uint8_t Packet[DNS_MAX_PACKET];
+        while (true) {
+            {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                if (Stopping && Incoming.empty() && !Outstanding) break;
+                while (!Incoming.empty() && Outstanding + Batch.size() < MaxLookups) {
+                    Batch.push_back(Incoming.front());
+                    Incoming.pop_front();
+                }
+            }
+            for (auto Lookup : Batch) Begin(Lookup);
+            Batch.clear();
+
+            int Timeout = -1;
+            if (!Deadlines.empty()) {
+                auto Wait = std::chrono::duration_cast<std::chrono::milliseconds>(Deadlines.front().Time - Clock::now()).count();
+                Timeout = Wait > 0 ? (int)Wait + 1 : 0;
+            }
+            if (ReachPoll(Fds, DNS_SOCKETS + 1, Timeout) > 0) {
+                for (auto& Fd : Fds) {
+                    if (!(Fd.revents & POLLIN)) continue;
+                    // Drain everything already received on the socket.
+                    while (true) {
+                        QuicAddr From;
+                        socklen_t FromLength = sizeof(From.SockAddr);
+                        auto Length = recvfrom(Fd.fd, (char*)Packet, sizeof(Packet), 0, &From.SockAddr.Ip, &FromLength);
+                        if (Length <= 0) break;
+                        if (Fd.fd != WakeSocket && IsServer(From)) OnResponse(Packet, (size_t)Length);
+                    }
+                }
+            }
+            OnTimeouts();
+        }
+        while (!Retired.empty()) {
+            delete Retired.front().second;
+            Retired.pop_front();
+        }
+    }
+
+    bool IsServer(_In_ const QuicAddr& From) const {
+        if (From.GetFamily() != Server.GetFamily() || From.GetPort() != Server.GetPort()) return false;
+        return From.GetFamily() == QUIC_ADDRESS_FAMILY_INET6 ?
+            !memcmp(&From.SockAddr.Ipv6.sin6_addr, &Server.SockAddr.Ipv6.sin6_addr, 16) :
+            From.SockAddr.Ipv4.sin_addr.s_addr == Server.SockAddr.Ipv4.sin_addr.s_addr;
+    }
+
+    QuicAddr Server;
+    uint32_t MaxLookups;
+    bool Valid {false};
+    ReachSocket Sockets[DNS_SOCKETS] = {REACH_INVALID_SOCKET, REACH_INVALID_SOCKET, REACH_INVALID_SOCKET, REACH_INVALID_SOCKET};
+    ReachSocket WakeSocket {REACH_INVALID_SOCKET};
+    QuicAddr WakeAddress;
+    std::thread Thread;
+    std::mutex Mutex;
+    std::deque<ReachLookup*> Incoming;
+    bool Stopping {false};
+    // Everything below is only used on the resolver thread.
+    std::mt19937 Random;
+    uint32_t NextSocket {0};
+    uint32_t Outstanding {0};
+    Query* Ids[65536] = {};
+    std::deque<Deadline> Deadlines;
+    std::deque<std::pair<Clock::time_point, Pending*>> Retired;
+};
@@ -3,5011 +3,5346 @@
     Copyright (c) Microsoft Corporation.
     Licensed under the MIT License.
 
+Abstract:
+
+    Top-level domains - found on https://majestic.com/reports/majestic-million?s=0
+    data are processed such that root domains appear only once.
+
+    Generated by domains.py from domains.txt, so don't edit. The names are
+    packed back to back, each null terminated, with the offset of each one
+    in a separate index.
+
 --*/
 
-const char* TopDomains[] =
-{
-    // Top-level domains - found on https://majestic.com/reports/majestic-million?s=0
-    // data are processed such that root domains appear only once
-    "google.com",
-    "facebook.com",
-    "youtube.com",
-    "twitter.com",
-    "instagram.com",
-    "linkedin.com",
-    "apple.com",
-    "microsoft.com",
-    "wikipedia.org",
-    "wordpress.org",
-    "googletagmanager.com",
-    "youtu.be",
-    "pinterest.com",
-    "vimeo.com",
-    "github.com",
-    "goo.gl",
-    "bit.ly",
-    "adobe.com",
-    "blogspot.com",
-    "amazon.com",
-    "macromedia.com",
-    "mozilla.org",
-    "yahoo.com",
-    "tumblr.com",
-    "whatsapp.com",
-    "europa.eu",
-    "flickr.com",
-    "gravatar.com",
-    "reddit.com",
-    "qq.com",
-    "nih.gov",
-    "nytimes.com",
-    "apache.org",
-    "amazonaws.com",
-    "soundcloud.com",
-    "w3.org",
-    "medium.com",
-    "forbes.com",
-    "t.co",
-    "zoom.us",
-    "forms.gle",
-    "baidu.com",
-    "spotify.com",
-    "miit.gov.cn",
-    "theguardian.com",
-    "archive.org",
-    "sourceforge.net",
-    "creativecommons.org",
-    "cnn.com",
-    "dropbox.com",
-    "who.int",
-    "wixsite.com",
-    "bbc.co.uk",
-    "paypal.com",
-    "issuu.com",
-    "cloudflare.com",
-    "cdc.gov",
-    "weebly.com",
-    "wa.me",
-    "bbc.com",
-    "vk.com",
-    "sciencedirect.com",
-    "tinyurl.com",
-    "reuters.com",
-    "washingtonpost.com",
-    "opera.com",
-    "youtube-nocookie.com",
-    "oracle.com",
-    "office.com",
-    "outlook.office.com", // Extra variant known to support HTTP/3
-    "bloomberg.com",
-    "harvard.edu",
-    "imdb.com",
-    "php.net",
-    "wsj.com",
-    "wikimedia.org",
-    "nginx.org",
-    "mit.edu",
-    "weibo.com",
-    "bing.com",
-    "businessinsider.com",
-    "wiley.com",
-    "msn.com",
-    "doi.org",
-    "wp.com",
-    "gnu.org",
-    "nature.com",
-    "un.org",
-    "tiktok.com",
-    "stanford.edu",
-    "ibm.com",
-    "list-manage.com",
-    "live.com",
-    "slideshare.net",
-    "researchgate.net",
-    "springer.com",
-    "nasa.gov",
-    "wix.com",
-    "go.com",
-    "cpanel.net",
-    "cnbc.com",
-    "time.com",
-    "eventbrite.com",
-    "usatoday.com",
-    "cnet.com",
-    "npr.org",
-    "ted.com",
-    "outlook.com",
-    "addtoany.com",
-    "surveymonkey.com",
-    "cloudfront.net",
-    "ebay.com",
-    "wired.com",
-    "g.page",
-    "aol.com",
-    "myspace.com",
-    "blogger.com",
-    "mysql.com",
-    "amzn.to",
-    "hp.com",
-    "huffingtonpost.com",
-    "loc.gov",
-    "googleusercontent.com",
-    "berkeley.edu",
-    "techcrunch.com",
-    "unsplash.com",
-    "gc.ca",
-    "etsy.com",
-    "statista.com",
-    "debian.org",
-    "ft.com",
-    "latimes.com",
-    "imgur.com",
-    "behance.net",
-    "yelp.com",
-    "themeforest.net",
-    "washington.edu",
-    "ietf.org",
-    "prnewswire.com",
-    "free.fr",
-    "twitch.tv",
-    "webmd.com",
-    "theverge.com",
-    "dailymotion.com",
-    "shopify.com",
-    "nationalgeographic.com",
-    "cbsnews.com",
-    "cornell.edu",
-    "sina.com.cn",
-    "ca.gov",
-    "fda.gov",
-    "stackoverflow.com",
-    "theatlantic.com",
-    "mailchimp.com",
-    "goodreads.com",
-    "oup.com",
-    "aboutads.info",
-    "youku.com",
-    "sitemaps.org",
-    "tandfonline.com",
-    "bitly.com",
-    "squarespace.com",
-    "huffpost.com",
-    "kickstarter.com",
-    "tripadvisor.com",
-    "samsung.com",
-    "princeton.edu",
-    "scribd.com",
-    "livejournal.com",
-    "arnebrachhold.de",
-    "mailchi.mp",
-    "launchpad.net",
-    "in.ua",
-    "sagepub.com",
-    "fb.com",
-    "skype.com",
-    "hbr.org",
-    "hubspot.com",
-    "statcounter.com",
-    "unesco.org",
-    "line.me",
-    "nbcnews.com",
-    "business.site",
-    "myshopify.com",
-    "telegram.me",
-    "whitehouse.gov",
-    "usda.gov",
-    "akismet.com",
-    "allaboutcookies.org",
-    "bandcamp.com",
-    "jimdo.com",
-    "networkadvertising.org",
-    "change.org",
-    "businesswire.com",
-    "usnews.com",
-    "marriott.com",
-    "taobao.com",
-    "economist.com",
-    "netflix.com",
-    "163.com",
-    "epa.gov",
-    "linktr.ee",
-    "pixabay.com",
-    "foxnews.com",
-    "about.com",
-    "digg.com",
-    "typepad.com",
-    "investopedia.com",
-    "quora.com",
-    "britannica.com",
-    "sciencemag.org",
-    "xinhuanet.com",
-    "iso.org",
-    "pbs.org",
-    "redhat.com",
-    "booking.com",
-    "cambridge.org",
-    "worldbank.org",
-    "eepurl.com",
-    "buzzfeed.com",
-    "columbia.edu",
-    "umich.edu",
-    "hugedomains.com",
-    "indiatimes.com",
-    "healthline.com",
-    "domainmarket.com",
-    "zdnet.com",
-    "state.gov",
-    "deviantart.com",
-    "sciencedaily.com",
-    "mayoclinic.org",
-    "yale.edu",
-    "marketwatch.com",
-    "feedburner.com",
-    "vice.com",
-    "noaa.gov",
-    "cisco.com",
-    "psu.edu",
-    "mashable.com",
-    "giphy.com",
-    "zendesk.com",
-    "arcgis.com",
-    "bmj.com",
-    "cbc.ca",
-    "plos.org",
-    "vox.com",
-    "discord.gg",
-    "gouv.fr",
-    "upenn.edu",
-    "psychologytoday.com",
-    "academia.edu",
-    "dribbble.com",
-    "ptinews.com",
-    "weforum.org",
-    "fortune.com",
-    "ox.ac.uk",
-    "deloitte.com",
-    "theconversation.com",
-    "sohu.com",
-    "wikihow.com",
-    "intel.com",
-    "nypost.com",
-    "stumbleupon.com",
-    "yandex.ru",
-    "abc.net.au",
-    "sun.com",
-    "fastcompany.com",
-    "addthis.com",
-    "sharepoint.com",
-    "biomedcentral.com",
-    "gofundme.com",
-    "ieee.org",
-    "newyorker.com",
-    "wpengine.com",
-    "android.com",
-    "fandom.com",
-    "wisc.edu",
-    "disqus.com",
-    "example.com",
-    "inc.com",
-    "tripod.com",
-    "youronlinechoices.com",
-    "umn.edu",
-    "webs.com",
-    "mckinsey.com",
-    "alibaba.com",
-    "plesk.com",
-    "oreilly.com",
-    "geocities.com",
-    "uci.edu",
-    "apa.org",
-    "engadget.com",
-    "or.kr",
-    "constantcontact.com",
-    "oecd.org",
-    "apnews.com",
-    "elsevier.com",
-    "godaddy.com",
-    "entrepreneur.com",
-    "arxiv.org",
-    "jotform.com",
-    "gizmodo.com",
-    "calendly.com",
-    "jhu.edu",
-    "typeform.com",
-    "newsweek.com",
-    "pewresearch.org",
-    "ubuntu.com",
-    "steampowered.com",
-    "scientificamerican.com",
-    "dell.com",
-    "indeed.com",
-    "trustpilot.com",
-    "merriam-webster.com",
-    "ucla.edu",
-    "meetup.com",
-    "dw.com",
-    "canva.com",
-    "thelancet.com",
-    "ftc.gov",
-    "patreon.com",
-    "elegantthemes.com",
-    "utexas.edu",
-    "nps.gov",
-    "intuit.com",
-    "fao.org",
-    "cmu.edu",
-    "irs.gov",
-    "uk.com",
-    "pnas.org",
-    "aboutcookies.org",
-    "xing.com",
-    "doubleclick.net",
-    "ed.gov",
-    "salesforce.com",
-    "uchicago.edu",
-    "azurewebsites.net",
-    "photobucket.com",
-    "mdpi.com",
-    "openstreetmap.org",
-    "python.org",
-    "si.edu",
-    "pexels.com",
-    "bbb.org",
-    "aliyun.com",
-    "readthedocs.io",
-    "arstechnica.com",
-    "slate.com",
-    "house.gov",
-    "trello.com",
-    "chicagotribune.com",
-    "bizjournals.com",
-    "sfgate.com",
-    "indiegogo.com",
-    "frontiersin.org",
-    "walmart.com",
-    "vkontakte.ru",
-    "jstor.org",
-    "docker.com",
-    "wiktionary.org",
-    "anchor.fm",
-    "gitlab.com",
-    "jamanetwork.com",
-    "qz.com",
-    "gotowebinar.com",
-    "wikia.com",
-    "fc2.com",
-    "googleapis.com",
-    "ikea.com",
-    "bilibili.com",
-    "box.com",
-    "science.org",
-    "census.gov",
-    "uiuc.edu",
-    "bls.gov",
-    "gartner.com",
-    "hilton.com",
-    "livescience.com",
-    "medicalnewstoday.com",
-    "acs.org",
-    "stripe.com",
-    "huawei.com",
-    "appspot.com",
-    "senate.gov",
-    "getpocket.com",
-    "usgs.gov",
-    "howstuffworks.com",
-    "aliexpress.com",
-    "hhs.gov",
-    "usc.edu",
-    "unicef.org",
-    "force.com",
-    "kiev.ua",
-    "barnesandnoble.com",
-    "purdue.edu",
-    "withgoogle.com",
-    "qc.ca",
-    "nyu.edu",
-    "cbslocal.com",
-    "nist.gov",
-    "gob.mx",
-    "on.ca",
-    "rt.com",
-    "variety.com",
-    "microsoftonline.com",
-    "altervista.org",
-    "aljazeera.com",
-    "globenewswire.com",
-    "teamviewer.com",
-    "govt.nz",
-    "politico.com",
-    "rollingstone.com",
-    "nejm.org",
-    "googleblog.com",
-    "coursera.org",
-    "eff.org",
-    "sec.gov",
-    "netscape.com",
-    "stackexchange.com",
-    "evernote.com",
-    "elpais.com",
-    "dan.com",
-    "spiegel.de",
-    "postgresql.org",
-    "nvidia.com",
-    "m.me",
-    "pcmag.com",
-    "freepik.com",
-    "slack.com",
-    "matterport.com",
-    "espn.com",
-    "mitre.org",
-    "shutterstock.com",
-    "venturebeat.com",
-    "w3schools.com",
-    "itu.int",
-    "msu.edu",
-    "bitnami.com",
-    "duke.edu",
-    "ucsd.edu",
-    "canada.ca",
-    "enable-javascript.com",
-    "www.nhs.uk",
-    "so.com",
-    "mystrikingly.com",
-    "airbnb.com",
-    "history.com",
-    "scmp.com",
-    "ufl.edu",
-    "vmware.com",
-    "proofpoint.com",
-    "mediafire.com",
-    "nydailynews.com",
-    "perfectdomain.com",
-    "timeanddate.com",
-    "ssrn.com",
-    "jd.com",
-    "kernel.org",
-    "sky.com",
-    "theglobeandmail.com",
-    "newscientist.com",
-    "umd.edu",
-    "earthlink.net",
-    "hatena.ne.jp",
-    "mixcloud.com",
-    "moodle.org",
-    "ny.gov",
-    "hollywoodreporter.com",
-    "techtarget.com",
-    "unc.edu",
-    "slashdot.org",
-    "thehill.com",
-    "dot.gov",
-    "windows.net",
-    "thoughtco.com",
-    "arizona.edu",
-    "us.com",
-    "illinois.edu",
-    "archives.gov",
-    "automattic.com",
-    "ning.com",
-    "openssl.org",
-    "justice.gov",
-    "cutt.ly",
-    "drupal.org",
-    "utoronto.ca",
-    "admin.ch",
-    "gallup.com",
-    "northwestern.edu",
-    "ok.ru",
-    "amazon-adsystem.com",
-    "chron.com",
-    "themeisle.com",
-    "java.com",
-    "pwc.com",
-    "parallels.com",
-    "freebsd.org",
-    "instructables.com",
-    "weather.com",
-    "today.com",
-    "getbootstrap.com",
-    "privacyshield.gov",
-    "smithsonianmag.com",
-    "nike.com",
-    "lifehacker.com",
-    "asu.edu",
-    "siemens.com",
-    "ucdavis.edu",
-    "acm.org",
-    "techradar.com",
-    "phys.org",
-    "naver.com",
-    "iana.org",
-    "webex.com",
-    "joomla.org",
-    "nikkei.com",
-    "lww.com",
-    "fcc.gov",
-    "udemy.com",
-    "libsyn.com",
-    "angelfire.com",
-    "fbcdn.net",
-    "apachefriends.org",
-    "nymag.com",
-    "congress.gov",
-    "thedailybeast.com",
-    "jquery.com",
-    "playstation.com",
-    "technologyreview.com",
-    "prezi.com",
-    "woocommerce.com",
-    "foursquare.com",
-    "substack.com",
-    "fool.com",
-    "lemonde.fr",
-    "treasury.gov",
-    "over-blog.com",
-    "imageshack.us",
-    "atlassian.com",
-    "ign.com",
-    "boston.com",
-    "usa.gov",
-    "digitaltrends.com",
-    "euronews.com",
-    "dictionary.com",
-    "ow.ly",
-    "thenai.org",
-    "yolasite.com",
-    "snapchat.com",
-    "energy.gov",
-    "telegra.ph",
-    "bigcartel.com",
-    "fbi.gov",
-    "virginia.edu",
-    "rutgers.edu",
-    "qualtrics.com",
-    "office365.com",
-    "bc.ca",
-    "imf.org",
-    "ico.org.uk",
-    "prweb.com",
-    "dmoz.org",
-    "uspto.gov",
-    "opensource.org",
-    "brookings.edu",
-    "osu.edu",
-    "mail.ru",
-    "cancer.org",
-    "colorado.edu",
-    "herokuapp.com",
-    "target.com",
-    "wufoo.com",
-    "ubc.ca",
-    "zend.com",
-    "podbean.com",
-    "moz.com",
-    "people.com",
-    "kde.org",
-    "bostonglobe.com",
-    "khanacademy.org",
-    "nasdaq.com",
-    "theregister.com",
-    "army.mil",
-    "uber.com",
-    "twimg.com",
-    "urbandictionary.com",
-    "thefreedictionary.com",
-    "sap.com",
-    "is.gd",
-    "zhihu.com",
-    "gutenberg.org",
-    "tamu.edu",
-    "faqs.org",
-    "perl.org",
-    "tmall.com",
-    "bu.edu",
-    "va.gov",
-    "verisign.com",
-    "icio.us",
-    "medscape.com",
-    "att.com",
-    "lonelyplanet.com",
-    "dropcatch.com",
-    "fedoraproject.org",
-    "bund.de",
-    "fiverr.com",
-    "usembassy.gov",
-    "dol.gov",
-    "symantec.com",
-    "themegrill.com",
-    "dhs.gov",
-    "mlb.com",
-    "thenextweb.com",
-    "heart.org",
-    "semanticscholar.org",
-    "thestar.com",
-    "adweek.com",
-    "salon.com",
-    "mapquest.com",
-    "rs6.net",
-    "rfc-editor.org",
-    "livestream.com",
-    "nba.com",
-    "undp.org",
-    "gamespot.com",
-    "cell.com",
-    "icann.org",
-    "microfocus.com",
-    "ndtv.com",
-    "spb.ru",
-    "crunchbase.com",
-    "blog.google",
-    "medlineplus.gov",
-    "houzz.com",
-    "wustl.edu",
-    "autodesk.com",
-    "netdna-ssl.com",
-    "alexa.com",
-    "eurekalert.org",
-    "consumerreports.org",
-    "schneier.com",
-    "vanityfair.com",
-    "accenture.com",
-    "xbox.com",
-    "ey.com",
-    "iheart.com",
-    "ustream.tv",
-    "hootsuite.com",
-    "digital.com",
-    "discovery.com",
-    "last.fm",
-    "verizon.com",
-    "ncsu.edu",
-    "gmail.com",
-    "lenovo.com",
-    "indiana.edu",
-    "steamcommunity.com",
-    "flic.kr",
-    "ethz.ch",
-    "mercurynews.com",
-    "lnkd.in",
-    "jimdofree.com",
-    "greenpeace.org",
-    "texas.gov",
-    "feedly.com",
-    "voanews.com",
-    "cpan.org",
-    "nyc.gov",
-    "oxfordjournals.org",
-    "irishtimes.com",
-    "pcworld.com",
-    "smugmug.com",
-    "tufts.edu",
-    "ea.com",
-    "coe.int",
-    "navy.mil",
-    "sba.gov",
-    "nokia.com",
-    "utah.edu",
-    "novell.com",
-    "iop.org",
-    "ilo.org",
-    "letsencrypt.org",
-    "cctv.com",
-    "web.dev",
-    "broadcom.com",
-    "accuweather.com",
-    "pitt.edu",
-    "billboard.com",
-    "ihg.com",
-    "france24.com",
-    "seattletimes.com",
-    "pastebin.com",
-    "1688.com",
-    "insider.com",
-    "globo.com",
-    "globalnews.ca",
-    "pbase.com",
-    "hyatt.com",
-    "cookiedatabase.org",
-    "usps.com",
-    "bitbucket.org",
-    "businessweek.com",
-    "wunderground.com",
-    "zoho.com",
-    "computerworld.com",
-    "colorlib.com",
-    "aarp.org",
-    "craigslist.org",
-    "ucsb.edu",
-    "cygwin.com",
-    "glassdoor.com",
-    "garmin.com",
-    "frontier.com",
-    "bestbuy.com",
-    "haxx.se",
-    "patch.com",
-    "lego.com",
-    "asus.com",
-    "nobelprize.org",
-    "duckduckgo.com",
-    "fifa.com",
-    "ameblo.jp",
-    "zillow.com",
-    "georgetown.edu",
-    "hrw.org",
-    "cia.gov",
-    "curl.se",
-    "visualstudio.com",
-    "nic.in",
-    "phpbb.com",
-    "deadline.com",
-    "ctvnews.ca",
-    "vogue.com",
-    "git-scm.com",
-    "seekingalpha.com",
-    "udel.edu",
-    "osha.gov",
-    "fema.gov",
-    "washingtontimes.com",
-    "gumroad.com",
-    "fedex.com",
-    "snopes.com",
-    "lefigaro.fr",
-    "istockphoto.com",
-    "gettyimages.com",
-    "list-manage1.com",
-    "disney.com",
-    "sony.com",
-    "foodnetwork.com",
-    "vt.edu",
-    "miamiherald.com",
-    "americanexpress.com",
-    "openldap.org",
-    "douban.com",
-    "ibtimes.com",
-    "ups.com",
-    "neilpatel.com",
-    "hubpages.com",
-    "prestashop.com",
-    "worldometers.info",
-    "foxbusiness.com",
-    "ipcc.ch",
-    "findlaw.com",
-    "360.cn",
-    "500px.com",
-    "techrepublic.com",
-    "brown.edu",
-    "stitcher.com",
-    "ohchr.org",
-    "clevelandclinic.org",
-    "ap.org",
-    "speedtest.net",
-    "hawaii.edu",
-    "reference.com",
-    "redcross.org",
-    "nielsen.com",
-    "thebalance.com",
-    "jpost.com",
-    "answers.com",
-    "narod.ru",
-    "ccc.de",
-    "cuny.edu",
-    "tencent.com",
-    "indianexpress.com",
-    "clinicaltrials.gov",
-    "space.com",
-    "spreaker.com",
-    "caltech.edu",
-    "accor.com",
-    "gv.at",
-    "panasonic.com",
-    "hindustantimes.com",
-    "yumpu.com",
-    "securityfocus.com",
-    "redbull.com",
-    "amd.com",
-    "eu.com",
-    "unl.edu",
-    "1drv.ms",
-    "tx.us",
-    "liveinternet.ru",
-    "timeout.com",
-    "orcid.org",
-    "axios.com",
-    "vanderbilt.edu",
-    "metmuseum.org",
-    "oregonstate.edu",
-    "startribune.com",
-    "mpg.de",
-    "vatican.va",
-    "ibb.co",
-    "kaspersky.com",
-    "esquire.com",
-    "olympics.com",
-    "worldcat.org",
-    "mediawiki.org",
-    "akamaihd.net",
-    "diigo.com",
-    "ssa.gov",
-    "hopkinsmedicine.org",
-    "caniuse.com",
-    "ehow.com",
-    "msnbc.com",
-    "athemes.com",
-    "goodhousekeeping.com",
-    "wipo.int",
-    "hatenablog.com",
-    "elsevierhealth.com",
-    "esa.int",
-    "gatech.edu",
-    "rottentomatoes.com",
-    "howtogeek.com",
-    "cosmopolitan.com",
-    "popsci.com",
-    "lg.com",
-    "wikisource.org",
-    "trendmicro.com",
-    "dropboxusercontent.com",
-    "denverpost.com",
-    "isc.org",
-    "csmonitor.com",
-    "iastate.edu",
-    "ycombinator.com",
-    "thehindu.com",
-    "deezer.com",
-    "buzzfeednews.com",
-    "csdn.net",
-    "philips.com",
-    "upwork.com",
-    "foreignpolicy.com",
-    "mn.us",
-    "tableau.com",
-    "uga.edu",
-    "elle.com",
-    "verywellmind.com",
-    "mcgill.ca",
-    "msdn.com",
-    "asahi.com",
-    "flipboard.com",
-    "atlasobscura.com",
-    "uiowa.edu",
-    "mtv.com",
-    "calameo.com",
-    "wikibooks.org",
-    "gimp.org",
-    "colostate.edu",
-    "ourworldindata.org",
-    "rochester.edu",
-    "biblegateway.com",
-    "observer.com",
-    "wikidot.com",
-    "thomsonreuters.com",
-    "homedepot.com",
-    "generatepress.com",
-    "openoffice.org",
-    "mcafee.com",
-    "popularmechanics.com",
-    "squareup.com",
-    "umass.edu",
-    "ucsf.edu",
-    "amnesty.org",
-    "nj.com",
-    "envato.market",
-    "bustle.com",
-    "allrecipes.com",
-    "wetransfer.com",
-    "fliphtml5.com",
-    "bell-labs.com",
-    "lua.org",
-    "welt.de",
-    "sfu.ca",
-    "filesusr.com",
-    "tinypic.com",
-    "dallasnews.com",
-    "nodejs.org",
-    "edx.org",
-    "af.mil",
-    "usf.edu",
-    "reverbnation.com",
-    "justia.com",
-    "treehugger.com",
-    "linksynergy.com",
-    "genius.com",
-    "upi.com",
-    "man7.org",
-    "ew.com",
-    "defense.gov",
-    "azcentral.com",
-    "searchengineland.com",
-    "discogs.com",
-    "rsc.org",
-    "hindawi.com",
-    "yp.to",
-    "uscourts.gov",
-    "repubblica.it",
-    "staticflickr.com",
-    "wsu.edu",
-    "coindesk.com",
-    "tmz.com",
-    "cvent.com",
-    "shutterfly.com",
-    "tesla.com",
-    "lifewire.com",
-    "000webhostapp.com",
-    "instructure.com",
-    "semrush.com",
-    "timeweb.ru",
-    "xkcd.com",
-    "digitalocean.com",
-    "thawte.com",
-    "wpastra.com",
-    "delicious.com",
-    "homestead.com",
-    "gwu.edu",
-    "mentalfloss.com",
-    "scoop.it",
-    "nationalpost.com",
-    "timesofisrael.com",
-    "federalregister.gov",
-    "wireshark.org",
-    "straitstimes.com",
-    "iubenda.com",
-    "asso.fr",
-    "nfl.com",
-    "hbs.edu",
-    "square.site",
-    "eia.gov",
-    "pinimg.com",
-    "tiny.cc",
-    "mac.com",
-    "videolan.org",
-    "cdninstagram.com",
-    "gpo.gov",
-    "boutell.com",
-    "inquirer.com",
-    "eater.com",
-    "npmjs.com",
-    "boredpanda.com",
-    "blackberry.com",
-    "nap.edu",
-    "squid-cache.org",
-    "campaign-archive.com",
-    "federalreserve.gov",
-    "ama-assn.org",
-    "ntp.org",
-    "toutiao.com",
-    "flipsnack.com",
-    "baltimoresun.com",
-    "warnerbros.com",
-    "searchenginejournal.com",
-    "cwi.nl",
-    "brightcove.net",
-    "macrumors.com",
-    "sophos.com",
-    "penguinrandomhouse.com",
-    "wampserver.com",
-    "ampproject.org",
-    "raspberrypi.org",
-    "nbc.com",
-    "unhcr.org",
-    "purl.org",
-    "sketchfab.com",
-    "olympic.org",
-    "medicinenet.com",
-    "knowyourmeme.com",
-    "gmu.edu",
-    "suntimes.com",
-    "chinanews.com",
-    "oregonlive.com",
-    "popsugar.com",
-    "buffer.com",
-    "itv.com",
-    "fsu.edu",
-    "channel4.com",
-    "thespruce.com",
-    "justgiving.com",
-    "thingiverse.com",
-    "xe.com",
-    "ford.com",
-    "freep.com",
-    "softpedia.com",
-    "rice.edu",
-    "mega.nz",
-    "lifehack.org",
-    "byu.edu",
-    "avast.com",
-    "heise.de",
-    "ahajournals.org",
-    "faa.gov",
-    "mass.gov",
-    "eonline.com",
-    "waw.pl",
-    "refinery29.com",
-    "news.cn",
-    "polygon.com",
-    "unfccc.int",
-    "zlib.net",
-    "investing.com",
-    "boingboing.net",
-    "unep.org",
-    "smashingmagazine.com",
-    "thinkwithgoogle.com",
-    "routledge.com",
-    "redbubble.com",
-    "wikiquote.org",
-    "livechatinc.com",
-    "doxygen.org",
-    "epicgames.com",
-    "anu.edu.au",
-    "uwaterloo.ca",
-    "biography.com",
-    "flaticon.com",
-    "ajc.com",
-    "business-standard.com",
-    "libpng.org",
-    "ria.ru",
-    "travelandleisure.com",
-    "nd.edu",
-    "bankrate.com",
-    "dartmouth.edu",
-    "hexun.com",
-    "norton.com",
-    "wattpad.com",
-    "4shared.com",
-    "coinbase.com",
-    "hardened-php.net",
-    "webnode.com",
-    "emarketer.com",
-    "hpe.com",
-    "hulu.com",
-    "examiner.com",
-    "thestreet.com",
-    "sueddeutsche.de",
-    "nintendo.com",
-    "jiathis.com",
-    "home.blog",
-    "fujitsu.com",
-    "pcre.org",
-    "hm.com",
-    "missouri.edu",
-    "nber.org",
-    "gzip.org",
-    "adage.com",
-    "unam.mx",
-    "nsf.gov",
-    "mi.com",
-    "memcached.org",
-    "urldefense.com",
-    "fl.us",
-    "cms.gov",
-    "webflow.io",
-    "sandiegouniontribune.com",
-    "binance.com",
-    "marthastewart.com",
-    "verywellhealth.com",
-    "britishcouncil.org",
-    "fas.org",
-    "motherjones.com",
-    "githubusercontent.com",
-    "ec-lyon.fr",
-    "ticketmaster.com",
-    "hbo.com",
-    "moma.org",
-    "everydayhealth.com",
-    "zeit.de",
-    "nifty.com",
-    "michigan.gov",
-    "iea.org",
-    "sch.id",
-    "sputniknews.com",
-    "logitech.com",
-    "scholastic.com",
-    "netlify.app",
-    "elmundo.es",
-    "cern.ch",
-    "onlamp.com",
-    "nhl.com",
-    "centos.org",
-    "custhelp.com",
-    "starbucks.com",
-    "dhl.com",
-    "gstatic.com",
-    "iqiyi.com",
-    "buffalo.edu",
-    "uefa.com",
-    "peatix.com",
-    "apachelounge.com",
-    "livestrong.com",
-    "aclu.org",
-    "coinmarketcap.com",
-    "gq.com",
-    "onelink.me",
-    "nerdwallet.com",
-    "page.link",
-    "propublica.org",
-    "freetype.org",
-    "haaretz.com",
-    "xmlsoft.org",
-    "arduino.cc",
-    "realtor.com",
-    "audible.com",
-    "uoregon.edu",
-    "lulu.com",
-    "mlive.com",
-    "barrons.com",
-    "freewebs.com",
-    "post-gazette.com",
-    "webdav.org",
-    "softonic.com",
-    "fastcgi.com",
-    "ualberta.ca",
-    "matomo.org",
-    "kotaku.com",
-    "digitaljournal.com",
-    "hotjar.com",
-    "xda-developers.com",
-    "jetbrains.com",
-    "itch.io",
-    "tunein.com",
-    "enlightenment.org",
-    "bluehost.com",
-    "modsecurity.org",
-    "technorati.com",
-    "uky.edu",
-    "uic.edu",
-    "abc.com",
-    "serverwatch.com",
-    "livemint.com",
-    "strava.com",
-    "pa.us",
-    "coub.com",
-    "corriere.it",
-    "rsasecurity.com",
-    "blogs.com",
-    "lnk.to",
-    "self.com",
-    "hotels.com",
-    "counterpane.com",
-    "ct.gov",
-    "sleepycat.com",
-    "royalsocietypublishing.org",
-    "bloglovin.com",
-    "codepen.io",
-    "rd.com",
-    "proquest.com",
-    "cafepress.com",
-    "cleveland.com",
-    "faz.net",
-    "wixstatic.com",
-    "medrxiv.org",
-    "catchthemes.com",
-    "buzzsprout.com",
-    "vulture.com",
-    "harpersbazaar.com",
-    "domaintools.com",
-    "ijg.org",
-    "chinaz.com",
-    "mastercard.com",
-    "secureserver.net",
-    "ubisoft.com",
-    "scotsman.com",
-    "emory.edu",
-    "makeuseof.com",
-    "site123.me",
-    "infogram.com",
-    "shareasale.com",
-    "xrea.com",
-    "hwg.org",
-    "theintercept.com",
-    "discordapp.com",
-    "wassenaar.org",
-    "washingtonexaminer.com",
-    "archdaily.com",
-    "codecademy.com",
-    "padlet.com",
-    "3m.com",
-    "monster.com",
-    "cbssports.com",
-    "visa.com",
-    "alicdn.com",
-    "shrm.org",
-    "eclipse.org",
-    "dedecms.com",
-    "tass.ru",
-    "dmca.com",
-    "pdflib.com",
-    "sbnation.com",
-    "tomshardware.com",
-    "lin.ee",
-    "pp.ua",
-    "freetds.org",
-    "sciencealert.com",
-    "ora.com",
-    "breitbart.com",
-    "documentcloud.org",
-    "hud.gov",
-    "independent.ie",
-    "duolingo.com",
-    "ucsc.edu",
-    "iu.edu",
-    "apache-ssl.org",
-    "sfchronicle.com",
-    "pressreader.com",
-    "legacy.com",
-    "uh.edu",
-    "9to5mac.com",
-    "fontawesome.com",
-    "dyndns.org",
-    "ohio.gov",
-    "webthing.com",
-    "t-online.de",
-    "bleacherreport.com",
-    "twitpic.com",
-    "codeplex.com",
-    "thenation.com",
-    "newsday.com",
-    "kr.ua",
-    "alipay.com",
-    "dezeen.com",
-    "specbench.org",
-    "lothar.com",
-    "psychcentral.com",
-    "collegeboard.org",
-    "iplanet.com",
-    "uscis.gov",
-    "sacbee.com",
-    "my.id",
-    "mimecast.com",
-    "fivethirtyeight.com",
-    "mo.gov",
-    "cronolog.org",
-    "menshealth.com",
-    "health.com",
-    "bt.com",
-    "ebscohost.com",
-    "avg.com",
-    "tutsplus.com",
-    "rand.org",
-    "tampabay.com",
-    "uconn.edu",
-    "golux.com",
-    "kidshealth.org",
-    "fws.gov",
-    "chromium.org",
-    "discovermagazine.com",
-    "lastpass.com",
-    "bild.de",
-    "aappublications.org",
-    "mcdonalds.com",
-    "newatlas.com",
-    "apachetutor.org",
-    "visual.ly",
-    "gfycat.com",
-    "edublogs.org",
-    "usmagazine.com",
-    "hgtv.com",
-    "gingerall.com",
-    "wto.org",
-    "brainyquote.com",
-    "biorxiv.org",
-    "strikingly.com",
-    "samhsa.gov",
-    "awin1.com",
-    "ahrefs.com",
-    "nationalreview.com",
-    "wistia.com",
-    "aka.ms",
-    "zazzle.com",
-    "encyclopedia.com",
-    "apachehaus.com",
-    "vine.co",
-    "nme.com",
-    "guinnessworldrecords.com",
-    "opaque.net",
-    "theepochtimes.com",
-    "nhtsa.gov",
-    "ovh.com",
-    "cbs.com",
-    "channelnewsasia.com",
-    "ovhcloud.com",
-    "storify.com",
-    "artstation.com",
-    "cio.com",
-    "dp.ua",
-    "uu.nl",
-    "livedoor.jp",
-    "honeywell.com",
-    "ezinearticles.com",
-    "youradchoices.com",
-    "comcast.net",
-    "000webhost.com",
-    "ucr.edu",
-    "liebertpub.com",
-    "netperf.org",
-    "americanbar.org",
-    "ocregister.com",
-    "cointelegraph.com",
-    "qcloud.com",
-    "theknot.com",
-    "rbc.ru",
-    "news-medical.net",
-    "lycos.com",
-    "odoo.com",
-    "medicalxpress.com",
-    "bleepingcomputer.com",
-    "bankofamerica.com",
-    "altavista.com",
-    "thebalancecareers.com",
-    "rfi.fr",
-    "spglobal.com",
-    "lowes.com",
-    "asos.com",
-    "forrester.com",
-    "imagemagick.com",
-    "kremlin.ru",
-    "francetvinfo.fr",
-    "business2community.com",
-    "expedia.com",
-    "opensea.io",
-    "maryland.gov",
-    "filezilla-project.org",
-    "wbur.org",
-    "copyright.gov",
-    "bufferapp.com",
-    "ge.com",
-    "aps.org",
-    "military.com",
-    "leparisien.fr",
-    "notion.so",
-    "wikispaces.com",
-    "unity.com",
-    "grammarly.com",
-    "vrbo.com",
-    "delta.com",
-    "utk.edu",
-    "windowsphone.com",
-    "idc.com",
-    "informer.com",
-    "campaign-archive1.com",
-    "cnil.fr",
-    "apachetoday.com",
-    "curbed.com",
-    "al.com",
-    "syr.edu",
-    "orlandosentinel.com",
-    "aaa.com",
-    "laweekly.com",
-    "cc.com",
-    "sav.com",
-    "exblog.jp",
-    "bcg.com",
-    "thebalancesmb.com",
-    "unicode.org",
-    "newegg.com",
-    "instapaper.com",
-    "orange.fr",
-    "theme-fusion.com",
-    "googlepages.com",
-    "jsonline.com",
-    "lavanguardia.com",
-    "anrdoezrs.net",
-    "unm.edu",
-    "gulfnews.com",
-    "appleinsider.com",
-    "nbcsports.com",
-    "statnews.com",
-    "livechat.com",
-    "aap.org",
-    "ask.com",
-    "oregon.gov",
-    "newrepublic.com",
-    "abb.com",
-    "campaign-archive2.com",
-    "gsu.edu",
-    "list-manage2.com",
-    "realsimple.com",
-    "kriesi.at",
-    "goethe.de",
-    "gnome.org",
-    "ancestry.com",
-    "cri.cn",
-    "sleepfoundation.org",
-    "ku.edu",
-    "pcgamer.com",
-    "timeshighereducation.com",
-    "pearltrees.com",
-    "sun-sentinel.com",
-    "uw.edu",
-    "supremecourt.gov",
-    "groupon.com",
-    "threebit.net",
-    "unixtools.org",
-    "fraunhofer.de",
-    "pypi.org",
-    "cntv.cn",
-    "codecanyon.net",
-    "messenger.com",
-    "cbp.gov",
-    "pewinternet.org",
-    "speakerdeck.com",
-    "theonion.com",
-    "app.link",
-    "mariadb.org",
-    "ytimg.com",
-    "dreamstime.com",
-    "screenrant.com",
-    "aliyuncs.com",
-    "whiterabbitpress.com",
-    "thrillist.com",
-    "indiewire.com",
-    "virtualbox.org",
-    "ncsl.org",
-    "gao.gov",
-    "icloud.com",
-    "louvre.fr",
-    "c-span.org",
-    "tomsguide.com",
-    "complex.com",
-    "chronicle.com",
-    "gotomeeting.com",
-    "rackcdn.com",
-    "formstack.com",
-    "infoworld.com",
-    "ibiblio.org",
-    "rit.edu",
-    "msk.ru",
-    "freshdesk.com",
-    "artnet.com",
-    "detroitnews.com",
-    "blurb.com",
-    "dreamhost.com",
-    "drugs.com",
-    "allmusic.com",
-    "miami.edu",
-    "myftpupload.com",
-    "sportingnews.com",
-    "fitbit.com",
-    "metacafe.com",
-    "bhg.com",
-    "e-recht24.de",
-    "zapier.com",
-    "gawker.com",
-    "wolfram.com",
-    "alz.org",
-    "ab.ca",
-    "chaturbate.com",
-    "51.la",
-    "rpi.edu",
-    "ti.com",
-    "teachable.com",
-    "tradingview.com",
-    "bitcoin.org",
-    "womenshealthmag.com",
-    "temple.edu",
-    "cnrs.fr",
-    "benzinga.com",
-    "waze.com",
-    "we.tl",
-    "videojs.com",
-    "xs4all.nl",
-    "t-mobile.com",
-    "news24.com",
-    "adidas.com",
-    "splashthat.com",
-    "macworld.com",
-    "insidehighered.com",
-    "poetryfoundation.org",
-    "cfr.org",
-    "liveleak.com",
-    "tradedoubler.com",
-    "kff.org",
-    "zippyshare.com",
-    "handle.net",
-    "gmw.cn",
-    "gamesradar.com",
-    "rambler.ru",
-    "thecut.com",
-    "azureedge.net",
-    "cnblogs.com",
-    "northeastern.edu",
-    "indiatoday.in",
-    "safety.google",
-    "qodeinteractive.com",
-    "asm.org",
-    "helpguide.org",
-    "c212.net",
-    "marvel.com",
-    "financialpost.com",
-    "ultimate-guitar.com",
-    "hackernoon.com",
-    "rtve.es",
-    "posterous.com",
-    "bartleby.com",
-    "ucalgary.ca",
-    "glamour.com",
-    "blender.org",
-    "wildapricot.org",
-    "cnki.net",
-    "fed.us",
-    "nola.com",
-    "igvita.com",
-    "maine.gov",
-    "philly.com",
-    "reliefweb.int",
-    "stltoday.com",
-    "rte.ie",
-    "mcusercontent.com",
-    "starwars.com",
-    "drugabuse.gov",
-    "7-zip.org",
-    "nfpa.org",
-    "foxsports.com",
-    "marca.com",
-    "angel.co",
-    "iata.org",
-    "bhphotovideo.com",
-    "cargocollective.com",
-    "govdelivery.com",
-    "nrdc.org",
-    "gamestop.com",
-    "nato.int",
-    "rei.com",
-    "wordstream.com",
-    "skysports.com",
-    "ewg.org",
-    "kqzyfj.com",
-    "autoblog.com",
-    "ky.gov",
-    "citrix.com",
-    "jimdosite.com",
-    "drexel.edu",
-    "blogtalkradio.com",
-    "wakelet.com",
-    "lbl.gov",
-    "emerald.com",
-    "bp.com",
-    "huanqiu.com",
-    "lsu.edu",
-    "thespruceeats.com",
-    "cryoutcreations.eu",
-    "bravesites.com",
-    "tudou.com",
-    "thewrap.com",
-    "simplesite.com",
-    "clickbank.net",
-    "usaid.gov",
-    "oculus.com",
-    "torproject.org",
-    "afr.com",
-    "intensedebate.com",
-    "minecraft.net",
-    "kansascity.com",
-    "china.com",
-    "cdbaby.com",
-    "dpreview.com",
-    "apartmenttherapy.com",
-    "theculturetrip.com",
-    "doodle.com",
-    "arte.tv",
-    "helsinki.fi",
-    "aafp.org",
-    "diabetes.org",
-    "tvtropes.org",
-    "unwomen.org",
-    "yorku.ca",
-    "ucoz.ru",
-    "dailydot.com",
-    "globaltimes.cn",
-    "mynavi.jp",
-    "euractiv.com",
-    "foodandwine.com",
-    "metacritic.com",
-    "googleadservices.com",
-    "worldwildlife.org",
-    "govinfo.gov",
-    "springerlink.com",
-    "nicovideo.jp",
-    "wyndhamhotels.com",
-    "il.us",
-    "discuz.net",
-    "uio.no",
-    "alltrails.com",
-    "unity3d.com",
-    "123rf.com",
-    "pingdom.com",
-    "stlouisfed.org",
-    "pitchfork.com",
-    "law.com",
-    "oecd-ilibrary.org",
-    "nordstrom.com",
-    "cntraveler.com",
-    "klarna.com",
-    "macys.com",
-    "recode.net",
-    "parents.com",
-    "cpsc.gov",
-    "walgreens.com",
-    "yoast.com",
-    "architecturaldigest.com",
-    "mathworks.com",
-    "nghttp2.org",
-    "tradingeconomics.com",
-    "www.bl.uk",
-    "rferl.org",
-    "liveabout.com",
-    "sapo.pt",
-    "rakuten.com",
-    "reviewjournal.com",
-    "tudelft.nl",
-    "j.mp",
-    "ubereats.com",
-    "sendgrid.net",
-    "adp.com",
-    "airtable.com",
-    "producthunt.com",
-    "aa.com",
-    "thekitchn.com",
-    "experian.com",
-    "fsf.org",
-    "wellsfargo.com",
-    "studiopress.com",
-    "focus.de",
-    "epfl.ch",
-    "fourseasons.com",
-    "wi.gov",
-    "rebrand.ly",
-    "windy.com",
-    "socialmediatoday.com",
-    "geekwire.com",
-    "newstatesman.com",
-    "bigcommerce.com",
-    "europepmc.org",
-    "ggpht.com",
-    "zdf.de",
-    "britishmuseum.org",
-    "networkworld.com",
-    "hc360.com",
-    "usdoj.gov",
-    "gsmarena.com",
-    "nypl.org",
-    "dnb.com",
-    "ucf.edu",
-    "asana.com",
-    "dzone.com",
-    "csiro.au",
-    "handelsblatt.com",
-    "as.com",
-    "usp.br",
-    "rapidshare.com",
-    "topuniversities.com",
-    "made-in-china.com",
-    "hku.hk",
-    "goal.com",
-    "ala.org",
-    "buydomains.com",
-    "pfizer.com",
-    "oprah.com",
-    "acer.com",
-    "od.ua",
-    "guidestar.org",
-    "smallbiztrends.com",
-    "icq.com",
-    "unblog.fr",
-    "nami.org",
-    "wolframalpha.com",
-    "firstpost.com",
-    "news18.com",
-    "html5up.net",
-    "liberation.fr",
-    "houstonchronicle.com",
-    "heritage.org",
-    "financialexpress.com",
-    "degruyter.com",
-    "real.com",
-    "pantheonsite.io",
-    "reason.com",
-    "unodc.org",
-    "libreoffice.org",
-    "fordham.edu",
-    "ghost.org",
-    "informationweek.com",
-    "bostonherald.com",
-    "caranddriver.com",
-    "swissinfo.ch",
-    "canon.com",
-    "study.com",
-    "theweek.com",
-    "sitepoint.com",
-    "opentable.com",
-    "active.com",
-    "uvm.edu",
-    "newsmax.com",
-    "on24.com",
-    "payscale.com",
-    "toptal.com",
-    "eeoc.gov",
-    "esri.com",
-    "tn.gov",
-    "smarturl.it",
-    "ryanair.com",
-    "homeadvisor.com",
-    "politifact.com",
-    "packagist.org",
-    "blizzard.com",
-    "eurogamer.net",
-    "bbcgoodfood.com",
-    "morningstar.com",
-    "uva.nl",
-    "phpmyadmin.net",
-    "sltrib.com",
-    "peta.org",
-    "postimg.org",
-    "avaaz.org",
-    "dc.gov",
-    "epicurious.com",
-    "medicare.gov",
-    "mb.ca",
-    "kommersant.ru",
-    "syfy.com",
-    "virustotal.com",
-    "visualcapitalist.com",
-    "sciencenews.org",
-    "tokyo.jp",
-    "countryliving.com",
-    "eset.com",
-    "nationalacademies.org",
-    "yamaha.com",
-    "opensuse.org",
-    "androidauthority.com",
-    "streamable.com",
-    "businessnewsdaily.com",
-    "cocolog-nifty.com",
-    "porsche.com",
-    "ifixit.com",
-    "sc.edu",
-    "panda.org",
-    "vcu.edu",
-    "themezee.com",
-    "skyrock.com",
-    "archlinux.org",
-    "clemson.edu",
-    "britishairways.com",
-    "oclc.org",
-    "yadi.sk",
-    "redfin.com",
-    "zara.com",
-    "ko-fi.com",
-    "hostgator.com",
-    "energystar.gov",
-    "pagesix.com",
-    "icrc.org",
-    "cloudinary.com",
-    "kqed.org",
-    "bigthink.com",
-    "myportfolio.com",
-    "owasp.org",
-    "bangkokpost.com",
-    "christies.com",
-    "ets.org",
-    "west.cn",
-    "mensjournal.com",
-    "idaho.gov",
-    "seesaa.net",
-    "sproutsocial.com",
-    "iaea.org",
-    "ingentaconnect.com",
-    "alaska.gov",
-    "fu-berlin.de",
-    "clck.ru",
-    "presscustomizr.com",
-    "wikileaks.org",
-    "costco.com",
-    "mercola.com",
-    "andersnoren.se",
-    "bonappetit.com",
-    "wizards.com",
-    "jooble.org",
-    "uvic.ca",
-    "careerbuilder.com",
-    "dispatch.com",
-    "cisa.gov",
-    "sas.com",
-    "gridserver.com",
-    "skillshare.com",
-    "designboom.com",
-    "nbcnewyork.com",
-    "boeing.com",
-    "lexisnexis.com",
-    "pearson.com",
-    "lenta.ru",
-    "jalopnik.com",
-    "gesetze-im-internet.de",
-    "unt.edu",
-    "bnf.fr",
-    "tkqlhce.com",
-    "sdsu.edu",
-    "thediplomat.com",
-    "healthcare.gov",
-    "sketchup.com",
-    "bgr.com",
-    "zerohedge.com",
-    "afp.com",
-    "americanprogress.org",
-    "worldatlas.com",
-    "tennessean.com",
-    "newsobserver.com",
-    "dailycaller.com",
-    "headspace.com",
-    "me.com",
-    "ontario.ca",
-    "case.edu",
-    "india.com",
-    "dafont.com",
-    "authorstream.com",
-    "myanimelist.net",
-    "jigsy.com",
-    "wikimapia.org",
-    "deseret.com",
-    "newswire.ca",
-    "wordreference.com",
-    "doodlekit.com",
-    "se.com",
-    "ce.cn",
-    "main.jp",
-    "jdoqocy.com",
-    "extremetech.com",
-    "jianshu.com",
-    "nolo.com",
-    "re.kr",
-    "creativebloq.com",
-    "gigaom.com",
-    "famethemes.com",
-    "scielo.br",
-    "edmunds.com",
-    "fiu.edu",
-    "wwd.com",
-    "ahrq.gov",
-    "ranker.com",
-    "queensu.ca",
-    "usu.edu",
-    "uni-muenchen.de",
-    "acast.com",
-    "squidoo.com",
-    "windowscentral.com",
-    "acuityscheduling.com",
-    "yellowpages.com",
-    "malwarebytes.com",
-    "indystar.com",
-    "rug.nl",
-    "battle.net",
-    "chrome.com",
-    "pornhub.com",
-    "mediaroom.com",
-    "babycenter.com",
-    "ssl-images-amazon.com",
-    "esy.es",
-    "getty.edu",
-    "springeropen.com",
-    "emojipedia.org",
-    "foreignaffairs.com",
-    "vancouversun.com",
-    "unh.edu",
-    "redis.io",
-    "allafrica.com",
-    "wikitravel.org",
-    "consumerfinance.gov",
-    "charlotteobserver.com",
-    "oh.us",
-    "pbworks.com",
-    "httpwg.org",
-    "wholefoodsmarket.com",
-    "phoca.cz",
-    "japanpost.jp",
-    "teenvogue.com",
-    "lesechos.fr",
-    "torontosun.com",
-    "ericsson.com",
-    "cjb.net",
-    "tagesspiegel.de",
-    "js.org",
-    "towardsdatascience.com",
-    "elitedaily.com",
-    "seattlepi.com",
-    "inverse.com",
-    "hotmail.com",
-    "seriouseats.com",
-    "thinkific.com",
-    "geocaching.com",
-    "itemfix.com",
-    "asp.net",
-    "rediff.com",
-    "broadwayworld.com",
-    "quizlet.com",
-    "searchenginewatch.com",
-    "tsa.gov",
-    "edweek.org",
-    "dailykos.com",
-    "folkd.com",
-    "oxforddictionaries.com",
-    "wfp.org",
-    "scopus.com",
-    "sephora.com",
-    "dpbolvw.net",
-    "docdroid.net",
-    "mix.com",
-    "termsfeed.com",
-    "freedesktop.org",
-    "zomato.com",
-    "infobae.com",
-    "mt.gov",
-    "cookieyes.com",
-    "computerweekly.com",
-    "crunchyroll.com",
-    "plosone.org",
-    "harpercollins.com",
-    "infoplease.com",
-    "ready.gov",
-    "adjust.com",
-    "mattel.com",
-    "odnoklassniki.ru",
-    "united.com",
-    "avclub.com",
-    "clarin.com",
-    "cancerresearchuk.org",
-    "photoshelter.com",
-    "akc.org",
-    "abebooks.com",
-    "daum.net",
-    "gale.com",
-    "openlibrary.org",
-    "scitation.org",
-    "r-project.org",
-    "realclearpolitics.com",
-    "follow.it",
-    "dev.to",
-    "mainichi.jp",
-    "thedrum.com",
-    "monash.edu",
-    "eastmoney.com",
-    "krakow.pl",
-    "hypebeast.com",
-    "flightradar24.com",
-    "bfmtv.com",
-    "canalblog.com",
-    "qualcomm.com",
-    "motortrend.com",
-    "ou.edu",
-    "ansa.it",
-    "delaware.gov",
-    "pandora.com",
-    "css-tricks.com",
-    "weddingwire.com",
-    "brides.com",
-    "nwsource.com",
-    "themoscowtimes.com",
-    "kpmg.com",
-    "ballotpedia.org",
-    "simonandschuster.com",
-    "statesman.com",
-    "mindtools.com",
-    "dummies.com",
-    "unctad.org",
-    "list.ly",
-    "sxsw.com",
-    "commondreams.org",
-    "desmoinesregister.com",
-    "cgtn.com",
-    "thinkprogress.org",
-    "wolterskluwer.com",
-    "mindbodygreen.com",
-    "namecheap.com",
-    "wmo.int",
-    "tagesschau.de",
-    "heavy.com",
-    "openedition.org",
-    "disneyplus.com",
-    "theodysseyonline.com",
-    "easyjet.com",
-    "bts.gov",
-    "wikiwand.com",
-    "weheartit.com",
-    "libguides.com",
-    "emptyhammock.com",
-    "yimg.com",
-    "paris.fr",
-    "berlin.de",
-    "lmgtfy.com",
-    "gopro.com",
-    "libero.it",
-    "yourdictionary.com",
-    "toyota.com",
-    "anandtech.com",
-    "clickfunnels.com",
-    "amap.com",
-    "akamai.com",
-    "depositphotos.com",
-    "naturalnews.com",
-    "uc.edu",
-    "ua.edu",
-    "delish.com",
-    "shell.com",
-    "info.pl",
-    "annualreviews.org",
-    "cafe24.com",
-    "codeproject.com",
-    "uni-heidelberg.de",
-    "idnes.cz",
-    "american.edu",
-    "freelancer.com",
-    "pastemagazine.com",
-    "siteground.com",
-    "esteri.it",
-    "motorola.com",
-    "studentaid.gov",
-    "timesunion.com",
-    "letterboxd.com",
-    "laravel.com",
-    "rumble.com",
-    "netvibes.com",
-    "iucn.org",
-    "ma.us",
-    "taleo.net",
-    "smartsheet.com",
-    "radissonhotels.com",
-    "commonsensemedia.org",
-    "mcmaster.ca",
-    "magento.com",
-    "georgia.gov",
-    "runnersworld.com",
-    "investors.com",
-    "pscp.tv",
-    "collider.com",
-    "gatesfoundation.org",
-    "formula1.com",
-    "thenational.ae",
-    "nc.us",
-    "templatemonster.com",
-    "sheknows.com",
-    "cincinnati.com",
-    "marketplace.org",
-    "thermofisher.com",
-    "doaj.org",
-    "honda.com",
-    "www.parliament.uk",
-    "abc7.com",
-    "parade.com",
-    "freecodecamp.org",
-    "capterra.com",
-    "fineartamerica.com",
-    "netdna-cdn.com",
-    "myworkdayjobs.com",
-    "auburn.edu",
-    "seagate.com",
-    "podomatic.com",
-    "ipsos.com",
-    "aspca.org",
-    "alternet.org",
-    "orf.at",
-    "kaggle.com",
-    "ethereum.org",
-    "sedo.com",
-    "digitalspy.com",
-    "icims.com",
-    "prevention.com",
-    "instyle.com",
-    "ello.co",
-    "dawn.com",
-    "ritzcarlton.com",
-    "pantone.com",
-    "viglink.com",
-    "sf.net",
-    "devpost.com",
-    "courant.com",
-    "repec.org",
-    "syracuse.com",
-    "thenationalnews.com",
-    "wtop.com",
-    "mic.com",
-    "themuse.com",
-    "cloudwaysapps.com",
-    "inquisitr.com",
-    "archive-it.org",
-    "uab.edu",
-    "arabnews.com",
-    "healthychildren.org",
-    "suicidepreventionlifeline.org",
-    "bookdepository.com",
-    "buffalonews.com",
-    "siteorigin.com",
-    "amebaownd.com",
-    "boe.es",
-    "gap.com",
-    "smu.edu",
-    "justpaste.it",
-    "zappos.com",
-    "thesaurus.com",
-    "overstock.com",
-    "gsa.gov",
-    "affordable-papers.net",
-    "marieclaire.com",
-    "inhabitat.com",
-    "yle.fi",
-    "cato.org",
-    "fotolia.com",
-    "ifttt.com",
-    "ouest-france.fr",
-    "alberta.ca",
-    "artsy.net",
-    "kiva.org",
-    "ada.org",
-    "q4cdn.com",
-    "umontreal.ca",
-    "tripsavvy.com",
-    "audacy.com",
-    "signupgenius.com",
-    "spring.io",
-    "volvocars.com",
-    "futurism.com",
-    "pewtrusts.org",
-    "nybooks.com",
-    "tum.de",
-    "nngroup.com",
-    "nh.gov",
-    "nv.gov",
-    "flippingbook.com",
-    "inkscape.org",
-    "bplaced.net",
-    "zimbra.com",
-    "ispconfig.org",
-    "mercedes-benz.com",
-    "ohio-state.edu",
-    "tasteofhome.com",
-    "findagrave.com",
-    "moneycontrol.com",
-    "usgbc.org",
-    "uwo.ca",
-    "pin.it",
-    "collinsdictionary.com",
-    "pixnet.net",
-    "tesco.com",
-    "mongodb.com",
-    "golang.org",
-    "getcomposer.org",
-    "fox.com",
-    "milb.com",
-    "mos.ru",
-    "powerbi.com",
-    "unige.ch",
-    "tvguide.com",
-    "tcd.ie",
-    "slashgear.com",
-    "roku.com",
-    "amnh.org",
-    "techspot.com",
-    "aweber.com",
-    "recaptcha.net",
-    "dji.com",
-    "hpage.com",
-    "ushmm.org",
-    "allure.com",
-    "here.com",
-    "contently.com",
-    "baylor.edu",
-    "bonanza.com",
-    "uproxx.com",
-    "tistory.com",
-    "okstate.edu",
-    "pennlive.com",
-    "triblive.com",
-    "wonderhowto.com",
-    "namebright.com",
-    "thehindubusinessline.com",
-    "panoramio.com",
-    "alarabiya.net",
-    "the-sun.com",
-    "southernliving.com",
-    "ul.com",
-    "jezebel.com",
-    "csis.org",
-    "translate.goog",
-    "tutorialspoint.com",
-    "lufthansa.com",
-    "accorhotels.com",
-    "qiita.com",
-    "comscore.com",
-    "messefrankfurt.com",
-    "agoda.com",
-    "etonline.com",
-    "bitchute.com",
-    "tapatalk.com",
-    "player.fm",
-    "sendinblue.com",
-    "tawk.to",
-    "reverso.net",
-    "symfony.com",
-    "steemit.com",
-    "finra.org",
-    "shape.com",
-    "openculture.com",
-    "comicbook.com",
-    "sendspace.com",
-    "googlecode.com",
-    "smore.com",
-    "thedrive.com",
-    "acpjournals.org",
-    "ub.edu",
-    "ipsnews.net",
-    "couchsurfing.com",
-    "sqlite.org",
-    "freeprivacypolicy.com",
-    "inria.fr",
-    "androidpolice.com",
-    "proboards.com",
-    "opencart.com",
-    "xerox.com",
-    "giantbomb.com",
-    "govtrack.us",
-    "trust.org",
-    "ornl.gov",
-    "lu.se",
-    "kobo.com",
-    "emirates.com",
-    "macmillan.com",
-    "hasbro.com",
-    "informa.com",
-    "gog.com",
-    "gm.com",
-    "audubon.org",
-    "kuleuven.be",
-    "goldmansachs.com",
-    "wri.org",
-    "backlinko.com",
-    "jnj.com",
-    "nouvelobs.com",
-    "br.de",
-    "myfitnesspal.com",
-    "familysearch.org",
-    "aboutamazon.com",
-    "adafruit.com",
-    "consumeraffairs.com",
-    "mynewsdesk.com",
-    "cheezburger.com",
-    "csoonline.com",
-    "eastday.com",
-    "gucci.com",
-    "pardot.com",
-    "city-data.com",
-    "md.us",
-    "lexico.com",
-    "kinoghoote.xyz",
-    "poynter.org",
-    "fidelity.com",
-    "outsideonline.com",
-    "iflscience.com",
-    "techtimes.com",
-    "bayern.de",
-    "12377.cn",
-    "pagesperso-orange.fr",
-    "comodo.com",
-    "wayfair.com",
-    "cinemablend.com",
-    "transportation.gov",
-    "bodybuilding.com",
-    "lexology.com",
-    "masslive.com",
-    "wisconsin.gov",
-    "kit.edu",
-    "petapixel.com",
-    "nationalinterest.org",
-    "publishersweekly.com",
-    "digiday.com",
-    "farfetch.com",
-    "kp.ru",
-    "penzu.com",
-    "cplusplus.com",
-    "askubuntu.com",
-    "mediapost.com",
-    "aip.org",
-    "gab.com",
-    "ndr.de",
-    "rg.ru",
-    "ilsole24ore.com",
-    "eugdpr.org",
-    "uzh.ch",
-    "utm.edu",
-    "cracked.com",
-    "wral.com",
-    "manta.com",
-    "ulule.com",
-    "boardgamegeek.com",
-    "20minutos.es",
-    "villagevoice.com",
-    "khaleejtimes.com",
-    "vecteezy.com",
-    "uniqlo.com",
-    "slides.com",
-    "ucar.edu",
-    "blip.tv",
-    "superuser.com",
-    "verywellfit.com",
-    "gnupg.org",
-    "capgemini.com",
-    "doe.gov",
-    "zenodo.org",
-    "northjersey.com",
-    "elastic.co",
-    "lastampa.it",
-    "texastribune.org",
-    "haveibeenpwned.com",
-    "democracynow.org",
-    "imore.com",
-    "trulia.com",
-    "worldpopulationreview.com",
-    "tianqi.com",
-    "ctrip.com",
-    "natlawreview.com",
-    "uschamber.com",
-    "bloomberglaw.com",
-    "grist.org",
-    "dailyherald.com",
-    "zotero.org",
-    "dnaindia.com",
-    "csic.es",
-    "kiplinger.com",
-    "physiology.org",
-    "findarticles.com",
-    "karger.com",
-    "export.gov",
-    "angieslist.com",
-    "fdic.gov",
-    "g2.com",
-    "stern.de",
-    "puma.com",
-    "cnr.cn",
-    "24go.me",
-    "newindianexpress.com",
-    "wvu.edu",
-    "gameinformer.com",
-    "e-monsite.com",
-    "lviv.ua",
-    "madison.com",
-    "androidcentral.com",
-    "lexpress.fr",
-    "gsk.com",
-    "bitdefender.com",
-    "notepad-plus-plus.org",
-    "hrsa.gov",
-    "kaltura.com",
-    "pdx.edu",
-    "star-telegram.com",
-    "daringfireball.net",
-    "autonews.com",
-    "opendemocracy.net",
-    "wdr.de",
-    "sierraclub.org",
-    "cochrane.org",
-    "bloombergquint.com",
-    "ucsusa.org",
-    "res.in",
-    "udacity.com",
-    "mid.ru",
-    "checkpoint.com",
-    "xfinity.com",
-    "econsultancy.com",
-    "ktla.com",
-    "ziprecruiter.com",
-    "jpmorgan.com",
-    "techdirt.com",
-    "patagonia.com",
-    "cision.com",
-    "choicehotels.com",
-    "housebeautiful.com",
-    "hackaday.com",
-    "airbus.com",
-    "superbthemes.com",
-    "ojp.gov",
-    "themeansar.com",
-    "chosun.com",
-    "earthday.org",
-    "wroclaw.pl",
-    "pressherald.com",
-    "grammy.com",
-    "sothebys.com",
-    "quantcast.com",
-    "bundestag.de",
-    "rockstargames.com",
-    "getresponse.com",
-    "googlesyndication.com",
-    "kth.se",
-    "food.com",
-    "elespanol.com",
-    "greatist.com",
-    "mendeley.com",
-    "vocabulary.com",
-    "nbcchicago.com",
-    "megaupload.com",
-    "hrc.org",
-    "law360.com",
-    "rsf.org",
-    "shop-pro.jp",
-    "poznan.pl",
-    "azure.com",
-    "plannedparenthood.org",
-    "spacex.com",
-    "doc.gov",
-    "workable.com",
-    "kbb.com",
-    "rki.de",
-    "thunderbird.net",
-    "bestwestern.com",
-    "bayer.com",
-    "healthaffairs.org",
-    "cas.cn",
-    "viki.com",
-    "uib.no",
-    "kakao.com",
-    "zimbio.com",
-    "gtmetrix.com",
-    "techsmith.com",
-    "gitbook.io",
-    "soup.io",
-    "doordash.com",
-    "mongabay.com",
-    "ubs.com",
-    "pbskids.org",
-    "transparency.org",
-    "chanel.com",
-    "snapwidget.com",
-    "krebsonsecurity.com",
-    "kayak.com",
-    "wbs-law.de",
-    "mymodernmet.com",
-    "wn.com",
-    "gothamist.com",
-    "thepaper.cn",
-    "abc7news.com",
-    "tulane.edu",
-    "lung.org",
-    "intechopen.com",
-    "overdrive.com",
-    "pymnts.com",
-    "thinkgeek.com",
-    "heraldnet.com",
-    "charitynavigator.org",
-    "opensecrets.org",
-    "uni-hamburg.de",
-    "threadless.com",
-    "marxists.org",
-    "techopedia.com",
-    "utwente.nl",
-    "amtrak.com",
-    "patheos.com",
-    "mysanantonio.com",
-    "aepd.es",
-    "palmbeachpost.com",
-    "diabetesjournals.org",
-    "smartinsights.com",
-    "nbclosangeles.com",
-    "lyft.com",
-    "motor1.com",
-    "secureservercdn.net",
-    "elconfidencial.com",
-    "ucm.es",
-    "project-syndicate.org",
-    "electrek.co",
-    "scirp.org",
-    "theathletic.com",
-    "winzip.com",
-    "humanesociety.org",
-    "writeablog.net",
-    "rijksoverheid.nl",
-    "hellomagazine.com",
-    "habr.com",
-    "globalsign.com",
-    "bedbathandbeyond.com",
-    "contentmarketinginstitute.com",
-    "paho.org",
-    "spoti.fi",
-    "futurelearn.com",
-    "service-public.fr",
-    "nar.realtor",
-    "note.com",
-    "grandviewresearch.com",
-    "square-enix.com",
-    "westerndigital.com",
-    "unece.org",
-    "sfexaminer.com",
-    "thriveglobal.com",
-    "webopedia.com",
-    "montrealgazette.com",
-    "twincities.com",
-    "government.ru",
-    "courier-journal.com",
-    "jdsupra.com",
-    "urbanoutfitters.com",
-    "cbn.com",
-    "chase.com",
-    "criteo.com",
-    "wayne.edu",
-    "stripes.com",
-    "basecamp.com",
-    "plurk.com",
-    "ubi.com",
-    "fairmont.com",
-    "viator.com",
-    "uark.edu",
-    "iowa.gov",
-    "uservoice.com",
-    "tue.nl",
-    "jugem.jp",
-    "ksl.com",
-    "regulations.gov",
-    "omny.fm",
-    "bundesregierung.de",
-    "twilio.com",
-    "pmi.org",
-    "abc7chicago.com",
-    "haproxy.org",
-    "dailynews.com",
-    "awwwards.com",
-    "similarweb.com",
-    "uptodate.com",
-    "thalesgroup.com",
-    "lasvegassun.com",
-    "tenor.com",
-    "zenwriting.net",
-    "vermont.gov",
-    "mtu.edu",
-    "uni-koeln.de",
-    "xsrv.jp",
-    "sjsu.edu",
-    "irishexaminer.com",
-    "christianitytoday.com",
-    "ri.gov",
-    "test.com",
-    "bain.com",
-    "emeraldinsight.com",
-    "postheaven.net",
-    "theblaze.com",
-    "pixlr.com",
-    "kharkov.ua",
-    "lynda.com",
-    "joins.com",
-    "unibo.it",
-    "coocan.jp",
-    "thejakartapost.com",
-    "medpagetoday.com",
-    "edutopia.org",
-    "michelin.com",
-    "ugent.be",
-    "radio.com",
-    "idv.tw",
-    "poets.org",
-    "simplecast.com",
-    "fortunecity.com",
-    "lodz.pl",
-    "dhgate.com",
-    "europapress.es",
-    "shorturl.at",
-    "koreaherald.com",
-    "townhall.com",
-    "sfweekly.com",
-    "metal-archives.com",
-    "interfax.ru",
-    "cbinsights.com",
-    "csun.edu",
-    "abc7ny.com",
-    "globalresearch.ca",
-    "bookshop.org",
-    "convio.net",
-    "iom.int",
-    "cityam.com",
-    "onet.pl",
-    "wnyc.org",
-    "cars.com",
-    "wanadoo.fr",
-    "zenfolio.com",
-    "eklablog.com",
-    "militarytimes.com",
-    "teespring.com",
-    "lacounty.gov",
-    "morganstanley.com",
-    "usask.ca",
-    "brave.com",
-    "jpn.org",
-    "moonfruit.com",
-    "epi.org",
-    "reactjs.org",
-    "staples.com",
-    "netcraft.com",
-    "jalbum.net",
-    "cvs.com",
-    "wsimg.com",
-    "aad.org",
-    "gencat.cat",
-    "almanac.com",
-    "bloggersdelight.dk",
-    "radio-canada.ca",
-    "oxfam.org",
-    "hu-berlin.de",
-    "dreamhosters.com",
-    "basf.com",
-    "msi.com",
-    "pocket-lint.com",
-    "louisvuitton.com",
-    "socialmediaexaminer.com",
-    "liu.se",
-    "christianpost.com",
-    "9to5google.com",
-    "iarc.fr",
-    "verywellfamily.com",
-    "nxp.com",
-    "nzz.ch",
-    "djangoproject.com",
-    "netgear.com",
-    "code.org",
-    "indiebound.org",
-    "redd.it",
-    "townandcountrymag.com",
-    "iupui.edu",
-    "nazwa.pl",
-    "blogfreely.net",
-    "heraldscotland.com",
-    "rarathemes.com",
-    "makezine.com",
-    "networksolutions.com",
-    "jamieoliver.com",
-    "download.com",
-    "tidal.com",
-    "pixiv.net",
-    "diplo.de",
-    "masterclass.com",
-    "nsc.org",
-    "51job.com",
-    "figma.com",
-    "macleans.ca",
-    "infoq.com",
-    "lovetoknow.com",
-    "viber.com",
-    "lepoint.fr",
-    "mgmresorts.com",
-    "firefox.com",
-    "muckrack.com",
-    "slashfilm.com",
-    "bshare.cn",
-    "apkpure.com",
-    "moneysavingexpert.com",
-    "carrd.co",
-    "nocookie.net",
-    "nextdoor.com",
-    "smashwords.com",
-    "rutube.ru",
-    "computerhope.com",
-    "neu.edu",
-    "tp-link.com",
-    "wm.edu",
-    "nbcbayarea.com",
-    "campaignmonitor.com",
-    "nrel.gov",
-    "gitee.com",
-    "bnnbloomberg.ca",
-    "rawstory.com",
-    "zoominfo.com",
-    "webgarden.com",
-    "wur.nl",
-    "clarivate.com",
-    "blm.gov",
-    "carleton.ca",
-    "wondershare.com",
-    "bahn.de",
-    "thoughtcatalog.com",
-    "kent.edu",
-    "printfriendly.com",
-    "linuxfoundation.org",
-    "unfpa.org",
-    "cookpad.com",
-    "cbr.com",
-    "newgrounds.com",
-    "youdao.com",
-    "f-secure.com",
-    "knightlab.com",
-    "gazeta.ru",
-    "kh.ua",
-    "magcloud.com",
-    "oberlo.com",
-    "courthousenews.com",
-    "alamy.com",
-    "9news.com",
-    "adl.org",
-    "bloomsbury.com",
-    "citylab.com",
-    "askmen.com",
-    "omaha.com",
-    "globalsecurity.org",
-    "au.dk",
-    "provenexpert.com",
-    "obsproject.com",
-    "ncaa.com",
-    "nga.gov",
-    "renren.com",
-    "cuni.cz",
-    "nm.us",
-    "flipkart.com",
-    "hsforms.com",
-    "auswaertiges-amt.de",
-    "dal.ca",
-    "seattle.gov",
-    "href.li",
-    "boxofficemojo.com",
-    "webshots.com",
-    "adn.com",
-    "fujifilm.com",
-    "europeana.eu",
-    "yougov.com",
-    "psychiatryonline.org",
-    "asme.org",
-    "derstandard.at",
-    "fortinet.com",
-    "iherb.com",
-    "rwth-aachen.de",
-    "cleantechnica.com",
-    "nrf.com",
-    "kodak.com",
-    "urban.org",
-    "topsy.com",
-    "the-scientist.com",
-    "nutrition.org",
-    "acog.org",
-    "univision.com",
-    "aacrjournals.org",
-    "blossomthemes.com",
-    "dg-datenschutz.de",
-    "kohls.com",
-    "premierleague.com",
-    "uwm.edu",
-    "umbc.edu",
-    "timesnownews.com",
-    "starwoodhotels.com",
-    "cheatsheet.com",
-    "b-cdn.net",
-    "marketingland.com",
-    "sears.com",
-    "healthgrades.com",
-    "bitcointalk.org",
-    "yourtango.com",
-    "internationalwomensday.com",
-    "gandi.net",
-    "uottawa.ca",
-    "outlookindia.com",
-    "psychiatry.org",
-    "ecfr.gov",
-    "schema.org",
-    "kissmetrics.com",
-    "sfsu.edu",
-    "skynet.be",
-    "abc13.com",
-    "secondlife.com",
-    "uni-bonn.de",
-    "bis.org",
-    "exploratorium.edu",
-    "rogerebert.com",
-    "domain.com",
-    "medicaldaily.com",
-    "fandango.com",
-    "microchip.com",
-    "udn.com",
-    "deccanherald.com",
-    "thedenverchannel.com",
-    "unrealengine.com",
-    "upf.edu",
-    "reg.ru",
-    "nec.com",
-    "sparkfun.com",
-    "freehostia.com",
-    "stonybrook.edu",
-    "prlog.org",
-    "mozillazine.org",
-    "screencast.com",
-    "gouvernement.fr",
-    "heraldtribune.com",
-    "wallethub.com",
-    "taylorandfrancis.com",
-    "ic3.gov",
-    "pewforum.org",
-    "leo.org",
-    "dupont.com",
-    "openlearning.com",
-    "torrentfreak.com",
-    "oscars.org",
-    "privacypolicies.com",
-    "numbeo.com",
-    "deadspin.com",
-    "beckershospitalreview.com",
-    "powells.com",
-    "salary.com",
-    "annals.org",
-    "factcheck.org",
-    "msstate.edu",
-    "archives-ouvertes.fr",
-    "nmsu.edu",
-    "eweek.com",
-    "pri.org",
-    "unr.edu",
-    "io9.com",
-    "radiotimes.com",
-    "alistapart.com",
-    "sonypictures.com",
-    "geeksforgeeks.org",
-    "aei.org",
-    "splcenter.org",
-    "fodors.com",
-    "mydrivers.com",
-    "jetpack.com",
-    "wnd.com",
-    "blockchain.com",
-    "pravda.ru",
-    "onlinehome.us",
-    "1tv.ru",
-    "thewaltdisneycompany.com",
-    "adb.org",
-    "dokuwiki.org",
-    "einnews.com",
-    "goodmorningamerica.com",
-    "vuejs.org",
-    "digicert.com",
-    "biblehub.com",
-    "lightwidget.com",
-    "bol.com",
-    "washingtonian.com",
-    "arkansas.gov",
-    "tilda.ws",
-    "youth.cn",
-    "db.tt",
-    "wpbeginner.com",
-    "healio.com",
-    "thomasnet.com",
-    "whmcs.com",
-    "activecampaign.com",
-    "tu-berlin.de",
-    "zhaopin.com",
-    "spokesman.com",
-    "crazyegg.com",
-    "8tracks.com",
-    "at.ua",
-    "fanfiction.net",
-    "postandcourier.com",
-    "counterpunch.org",
-    "a8.net",
-    "mnn.com",
-    "fanpop.com",
-    "alabama.gov",
-    "fullerton.edu",
-    "coingecko.com",
-    "nbcdfw.com",
-    "privacypolicyonline.com",
-    "piktochart.com",
-    "nbcwashington.com",
-    "pluralsight.com",
-    "ecwid.com",
-    "bobvila.com",
-    "theadvocate.com",
-    "radikal.ru",
-    "humblebundle.com",
-    "librarything.com",
-    "angi.com",
-    "keybase.io",
-    "bangordailynews.com",
-    "albany.edu",
-    "gamasutra.com",
-    "alter.com",
-    "imgix.net",
-    "elementor.com",
-    "postimage.org",
-    "eldiario.es",
-    "vaticannews.va",
-    "eatingwell.com",
-    "fastcodesign.com",
-    "ga.us",
-    "authorize.net",
-    "uptodown.com",
-    "ms.us",
-    "sphinx-doc.org",
-    "anl.gov",
-    "ttu.edu",
-    "extendthemes.com",
-    "freedomhouse.org",
-    "psychologicalscience.org",
-    "marinetraffic.com",
-    "roblox.com",
-    "yourstory.com",
-    "softbank.jp",
-    "rs-online.com",
-    "grubhub.com",
-    "richmond.com",
-    "epson.com",
-    "jsfiddle.net",
-    "king5.com",
-    "etymonline.com",
-    "anydesk.com",
-    "mediaite.com",
-    "k-state.edu",
-    "elperiodico.com",
-    "highsnobiety.com",
-    "netfirms.com",
-    "feedingamerica.org",
-    "images-amazon.com",
-    "specificfeeds.com",
-    "cloudways.com",
-    "teamusa.org",
-    "uaf.edu",
-    "zp.ua",
-    "nyti.ms",
-    "comsenz.com",
-    "funnyordie.com",
-    "thefreelibrary.com",
-    "familyhandyman.com",
-    "sina.cn",
-    "nrw.de",
-    "trustedreviews.com",
-    "tucson.com",
-    "oas.org",
-    "ttlink.com",
-    "care2.com",
-    "nos.nl",
-    "chip.de",
-    "ottawacitizen.com",
-    "etherscan.io",
-    "southwest.com",
-    "khn.org",
-    "draxe.com",
-    "oanda.com",
-    "kroger.com",
-    "12371.cn",
-    "rappler.com",
-    "nrk.no",
-    "gamesindustry.biz",
-    "n-tv.de",
-    "phonearena.com",
-    "genial.ly",
-    "umt.edu",
-    "subway.com",
-    "brandeis.edu",
-    "neurology.org",
-    "ccm.net",
-    "no-ip.org",
-    "linux.org",
-    "musescore.com",
-    "ssllabs.com",
-    "ustr.gov",
-    "de.tl",
-    "ru.com",
-    "tu-dresden.de",
-    "surveygizmo.com",
-    "uri.edu",
-    "luc.edu",
-    "computer.org",
-    "tomtom.com",
-    "rxlist.com",
-    "rai.it",
-    "one.com",
-    "mcall.com",
-    "merck.com",
-    "eatthis.com",
-    "anotepad.com",
-    "commerce.gov",
-    "az.gov",
-    "republicworld.com",
-    "razer.com",
-    "xero.com",
-    "money.com",
-    "techinasia.com",
-    "20minutes.fr",
-    "garanteprivacy.it",
-    "unlv.edu",
-    "freeimages.com",
-    "fnac.com",
-    "delltechnologies.com",
-    "neowin.net",
-    "mailerlite.com",
-    "uoguelph.ca",
-    "primevideo.com",
-    "lanl.gov",
-    "banggood.com",
-    "ddns.net",
-    "prf.hn",
-    "sans.org",
-    "khou.com",
-    "dn.ua",
-    "avvo.com",
-    "society6.com",
-    "pg.com",
-    "vu.nl",
-    "net-a-porter.com",
-    "wsws.org",
-    "bget.ru",
-    "caesars.com",
-    "audacityteam.org",
-    "unibe.ch",
-    "westernunion.com",
-    "flexjobs.com",
-    "interestingengineering.com",
-    "astm.org",
-    "cognitoforms.com",
-    "biz.ua",
-    "buymeacoffee.com",
-    "prntscr.com",
-    "du.edu",
-    "taz.de",
-    "opm.gov",
-    "theringer.com",
-    "vedomosti.ru",
-    "art.pl",
-    "sd.gov",
-    "movember.com",
-    "pandasecurity.com",
-    "citynews.ca",
-    "veoh.com",
-    "dangdang.com",
-    "tulsaworld.com",
-    "marksandspencer.com",
-    "technet.com",
-    "crn.com",
-    "hometalk.com",
-    "meltwater.com",
-    "cjr.org",
-    "247wallst.com",
-    "ihsmarkit.com",
-    "consultant.ru",
-    "dtic.mil",
-    "autismspeaks.org",
-    "osce.org",
-    "canadiantire.ca",
-    "unglobalcompact.org",
-    "postimages.org",
-    "iucnredlist.org",
-    "denofgeek.com",
-    "osf.io",
-    "beget.tech",
-    "theiet.org",
-    "scu.edu",
-    "viadeo.com",
-    "ecowatch.com",
-    "williams-sonoma.com",
-    "datingranking.net",
-    "gosuslugi.ru",
-    "manutd.com",
-    "kubernetes.io",
-    "imgbb.com",
-    "newyorkfed.org",
-    "aeaweb.org",
-    "imgflip.com",
-    "beatport.com",
-    "adaa.org",
-    "truthout.org",
-    "conta.cc",
-    "zohopublic.com",
-    "sportskeeda.com",
-    "cookieconsent.com",
-    "thebase.in",
-    "gohugo.io",
-    "aftonbladet.se",
-    "acronis.com",
-    "ctv.ca",
-    "azlyrics.com",
-    "betanews.com",
-    "petitiononline.com",
-    "philstar.com",
-    "johnlewis.com",
-    "wfaa.com",
-    "39.net",
-    "credit-suisse.com",
-    "aaas.org",
-    "sparknotes.com",
-    "digitaloceanspaces.com",
-    "wccftech.com",
-    "myfonts.com",
-    "brownpapertickets.com",
-    "wikidata.org",
-    "telenet.be",
-    "umblr.com",
-    "iyfubh.com",
-    "dzwww.com",
-    "bamboohr.com",
-    "thejournal.ie",
-    "nebraska.gov",
-    "jdpower.com",
-    "chegg.com",
-    "fsc.org",
-    "loom.com",
-    "lockheedmartin.com",
-    "utdallas.edu",
-    "credly.com",
-    "serverfault.com",
-    "niu.edu",
-    "nau.edu",
-    "goto.com",
-    "kaiserpermanente.org",
-    "yfrog.com",
-    "mhanational.org",
-    "winnipegfreepress.com",
-    "annualcreditreport.com",
-    "avma.org",
-    "globalcitizen.org",
-    "ebaumsworld.com",
-    "ice.gov",
-    "tensorflow.org",
-    "coca-colacompany.com",
-    "9gag.com",
-    "dazeddigital.com",
-    "thehackernews.com",
-    "toronto.ca",
-    "adv.br",
-    "marketsandmarkets.com",
-    "newsvine.com",
-    "la.gov",
-    "audioboom.com",
-    "mobirise.com",
-    "ameba.jp",
-    "generateprivacypolicy.com",
-    "forward.com",
-    "medtronic.com",
-    "ns.ca",
-    "carbonmade.com",
-    "harley-davidson.com",
-    "kongregate.com",
-    "umanitoba.ca",
-    "tes.com",
-    "arm.com",
-    "talkingpointsmemo.com",
-    "neimanmarcus.com",
-    "earthsky.org",
-    "atlanticcouncil.org",
-    "infusionsoft.com",
-    "1password.com",
-    "58.com",
-    "mikecrm.com",
-    "aircanada.com",
-    "streetinsider.com",
-    "hao123.com",
-    "montana.edu",
-    "flightaware.com",
-    "wpcomstaging.com",
-    "sucuri.net",
-    "purevolume.com",
-    "jacobinmag.com",
-    "usccb.org",
-    "allstate.com",
-    "myflorida.com",
-    "dior.com",
-    "blackrock.com",
-    "escholarship.org",
-    "paper.li",
-    "retailmenot.com",
-    "jcpenney.com",
-    "sage.com",
-    "eaton.com",
-    "uv.es",
-    "afthemes.com",
-    "winamp.com",
-    "cbo.gov",
-    "hollywoodlife.com",
-    "asiaone.com",
-    "dailysabah.com",
-    "join.chat",
-    "mhthemes.com",
-    "wp-royal.com",
-    "wpzoom.com",
-    "interia.pl",
-    "htc.com",
-    "siriusxm.com",
-    "jacksonville.com",
-    "uni-freiburg.de",
-    "bepress.com",
-    "michaels.com",
-    "umb.edu",
-    "cba.pl",
-    "officedepot.com",
-    "ivoox.com",
-    "researchandmarkets.com",
-    "newswise.com",
-    "unaids.org",
-    "amara.org",
-    "mail-archive.com",
-    "kdvr.com",
-    "aao.org",
-    "nwf.org",
-    "jhsph.edu",
-    "eltiempo.com",
-    "simplemachines.org",
-    "chicago.gov",
-    "godaddysites.com",
-    "kia.com",
-    "iht.com",
-    "myrecipes.com",
-    "upm.es",
-    "ccb.com",
-    "churchofjesuschrist.org",
-    "womansday.com",
-    "indiamart.com",
-    "deseretnews.com",
-    "animoto.com",
-    "clickondetroit.com",
-    "taxfoundation.org",
-    "gu.se",
-    "6abc.com",
-    "equifax.com",
-    "filmkovasi.org",
-    "courtlistener.com",
-    "empowher.com",
-    "arthritis.org",
-    "cultofmac.com",
-    "klm.com",
-    "99designs.com",
-    "virgin.com",
-    "corporate-ir.net",
-    "calm.com",
-    "wellandgood.com",
-    "leagueoflegends.com",
-    "videoshub.com",
-    "wroc.pl",
-    "universetoday.com",
-    "ramseysolutions.com",
-    "eiu.com",
-    "rootsweb.com",
-    "flagcounter.com",
-    "longisland.com",
-    "dreamwidth.org",
-    "chevrolet.com",
-    "compuserve.com",
-    "unu.edu",
-    "waterstones.com",
-    "worldofwarcraft.com",
-    "xtgem.com",
-    "tianya.cn",
-    "eurosport.com",
-    "radiofrance.fr",
-    "ctfassets.net",
-    "termly.io",
-    "st.com",
-    "sil.org",
-    "simplypsychology.org",
-    "uidaho.edu",
-    "bea.gov",
-    "japantoday.com",
-    "nyse.com",
-    "ucpress.edu",
-    "corporatefinanceinstitute.com",
-    "godotengine.org",
-    "gobankingrates.com",
-    "thefederalist.com",
-    "positivepsychology.com",
-    "boots.com",
-    "click2houston.com",
-    "beniculturali.it",
-    "defensenews.com",
-    "niche.com",
-    "darkreading.com",
-    "dickssportinggoods.com",
-    "dwcdn.net",
-    "rbth.com",
-    "vestacp.com",
-    "tor.com",
-    "insiderintelligence.com",
-    "die.net",
-    "misterpoll.com",
-    "qatarairways.com",
-    "justjared.com",
-    "miaminewtimes.com",
-    "allegro.pl",
-    "wenthemes.com",
-    "discover.com",
-    "cmegroup.com",
-    "rollcall.com",
-    "louisiana.gov",
-    "iz.ru",
-    "greatschools.org",
-    "lapresse.ca",
-    "kxan.com",
-    "us-cert.gov",
-    "nerdist.com",
-    "eleconomista.es",
-    "kentucky.com",
-    "soso.com",
-    "ghostery.com",
-    "theinformation.com",
-    "cudasvc.com",
-    "shaw.ca",
-    "chalmers.se",
-    "rian.ru",
-    "concordia.ca",
-    "ozon.ru",
-    "infowars.com",
-    "cigna.com",
-    "randomhouse.com",
-    "iadb.org",
-    "depaul.edu",
-    "tmcnet.com",
-    "merchantcircle.com",
-    "excite.com",
-    "wwe.com",
-    "wisegeek.com",
-    "uchile.cl",
-    "fitchratings.com",
-    "wordpressfoundation.org",
-    "wsbtv.com",
-    "bethesda.net",
-    "womenshealth.gov",
-    "prtimes.jp",
-    "thisoldhouse.com",
-    "bravejournal.net",
-    "samsclub.com",
-    "freepatentsonline.com",
-    "thepetitionsite.com",
-    "aicpa.org",
-    "uscg.mil",
-    "listverse.com",
-    "hurriyetdailynews.com",
-    "nbcphiladelphia.com",
-    "gyazo.com",
-    "essence.com",
-    "verizonwireless.com",
-    "scienceblogs.com",
-    "muffingroup.com",
-    "motorsport.com",
-    "statefarm.com",
-    "food52.com",
-    "gazette.com",
-    "eso.org",
-    "binghamton.edu",
-    "abs-cbn.com",
-    "calgaryherald.com",
-    "movieweb.com",
-    "okta.com",
-    "guggenheim.org",
-    "swarthmore.edu",
-    "sublimetext.com",
-    "dccomics.com",
-    "citi.com",
-    "webaim.org",
-    "svt.se",
-    "rockpapershotgun.com",
-    "newschool.edu",
-    "thumbtack.com",
-    "colibriwp.com",
-    "wgntv.com",
-    "swr.de",
-    "irfanview.com",
-    "gamerant.com",
-    "elifesciences.org",
-    "bestlifeonline.com",
-    "oprahdaily.com",
-    "newsbreak.com",
-    "financesonline.com",
-    "flywheelsites.com",
-    "citysearch.com",
-    "heroku.com",
-    "nysed.gov",
-    "umkc.edu",
-    "creativemarket.com",
-    "lpages.co",
-    "thestate.com",
-    "eatright.org",
-    "deutschlandfunk.de",
-    "eqxiu.com",
-    "odu.edu",
-    "universityofcalifornia.edu",
-    "callofduty.com",
-    "newspapers.com",
-    "xml-sitemaps.com",
-    "3ds.com",
-    "anthropologie.com",
-    "hsbc.com",
-    "nexusmods.com",
-    "belgium.be",
-    "w3techs.com",
-    "lublin.pl",
-    "copernicus.org",
-    "beliefnet.com",
-    "donorbox.org",
-    "superpages.com",
-    "ebayimg.com",
-    "2345.com",
-    "chess.com",
-    "cyberpolice.cn",
-    "nsa.gov",
-    "skift.com",
-    "collegehumor.com",
-    "brainpickings.org",
-    "greenhouse.io",
-    "safedog.cn",
-    "artofmanliness.com",
-    "newadvent.org",
-    "wenming.cn",
-    "clickorlando.com",
-    "smartasset.com",
-    "llnl.gov",
-    "paloaltonetworks.com",
-    "thepointsguy.com",
-    "ferrari.com",
-    "aaos.org",
-    "ionos.com",
-    "usenix.org",
-    "taylorfrancis.com",
-    "rb.gy",
-    "hbomax.com",
-    "telegraaf.nl",
-    "rtbf.be",
-    "capitalone.com",
-    "11alive.com",
-    "sitejabber.com",
-    "uni-muenster.de",
-    "ambafrance.org",
-    "analog.com",
-    "aeon.co",
-    "undocs.org",
-    "uni-frankfurt.de",
-    "vesti.ru",
-    "icij.org",
-    "werite.net",
-    "reedsy.com",
-    "spiceworks.com",
-    "mises.org",
-    "uofmhealth.org",
-    "thecrimson.com",
-    "wickedlocal.com",
-    "gleam.io",
-    "ugr.es",
-    "rackspace.com",
-    "kinsta.com",
-    "diva-portal.org",
-    "therealdeal.com",
-    "livenation.com",
-    "mediamatters.org",
-    "spin.com",
-    "cults3d.com",
-    "knoxnews.com",
-    "upc.edu",
-    "rae.es",
-    "pewsocialtrends.org",
-    "insurancejournal.com",
-    "savethechildren.org",
-    "hongkiat.com",
-    "ams.org",
-    "komonews.com",
-    "e2ma.net",
-    "theweathernetwork.com",
-    "blubrry.com",
-    "texasmonthly.com",
-    "ebsco.com",
-    "gizmag.com",
-    "rainn.org",
-    "chicagobusiness.com",
-    "roma.it",
-    "nysenate.gov",
-    "turkishairlines.com",
-    "vingle.net",
-    "runsignup.com",
-    "govtech.com",
-    "hubblesite.org",
-    "mskcc.org",
-    "jaxa.jp",
-    "pgatour.com",
-    "petfinder.com",
-    "yummly.com",
-    "consumerist.com",
-    "dilbert.com",
-    "mondaq.com",
-    "minds.com",
-    "dignitymemorial.com",
-    "hotpepper.jp",
-    "wordfence.com",
-    "bab.la",
-    "ad.nl",
-    "csulb.edu",
-    "digikey.com",
-    "mint.com",
-    "stjude.org",
-    "247sports.com",
-    "kinja.com",
-    "moodys.com",
-    "thelocal.se",
-    "massgeneral.org",
-    "care.com",
-    "freeservers.com",
-    "aamc.org",
-    "habitat.org",
-    "unimi.it",
-    "finder.com",
-    "hse.ru",
-    "tabelog.com",
-    "signal.org",
-    "wmich.edu",
-    "720yun.com",
-    "chng.it",
-    "westword.com",
-    "fau.edu",
-    "xuexi.cn",
-    "miro.com",
-    "uni-tuebingen.de",
-    "stylecaster.com",
-    "marketscreener.com",
-    "bible.com",
-    "mapbox.com",
-    "hostelworld.com",
-    "wikimediafoundation.org",
-    "animenewsnetwork.com",
-    "destatis.de",
-    "clutch.co",
-    "tucows.com",
-    "besthookupwebsites.org",
-    "instacart.com",
-    "lehigh.edu",
-    "educause.edu",
-    "itunes.com",
-    "dow.com",
-    "ind.br",
-    "pe.com",
-    "genome.gov",
-    "iii.org",
-    "rp-online.de",
-    "princetonreview.com",
-    "mprnews.org",
-    "boc.cn",
-    "asha.org",
-    "c2.com",
-    "confex.com",
-    "sennheiser.com",
-    "coursehero.com",
-    "dea.gov",
-    "interpol.int",
-    "wdc.com",
-    "gentoo.org",
-    "getmonero.org",
-    "random.org",
-    "cleantalkorg2.ru",
-    "desktopnexus.com",
-    "cyberchimps.com",
-    "snazzymaps.com",
-    "jneurosci.org",
-    "mk.ru",
-    "psmag.com",
-    "businesstoday.in",
-    "ansi.org",
-    "embedgooglemap.net",
-    "ces.tech",
-    "sberbank.ru",
-    "onlyfans.com",
-    "ulta.com",
-    "blogactiv.eu",
-    "bluestacks.com",
-    "vanguardngr.com",
-    "meduza.io",
-    "sharethis.com",
-    "thetrevorproject.org",
-    "conac.cn",
-    "kakaku.com",
-    "packtpub.com",
-    "literatureessaysamples.com",
-    "martinfowler.com",
-    "edelman.com",
-    "wakwak.com",
-    "treas.gov",
-    "carbonbrief.org",
-    "prospect.org",
-    "themarginalian.org",
-    "ulaval.ca",
-    "privacypolicygenerator.info",
-    "histats.com",
-    "seedandspark.com",
-    "royalsociety.org",
-    "rikunabi.com",
-    "emailmeform.com",
-    "dotdashmeredith.com",
-    "monday.com",
-    "indymedia.org",
-    "victoriassecret.com",
-    "democratandchronicle.com",
-    "caringbridge.org",
-    "kijiji.ca",
-    "linode.com",
-    "abc15.com",
-    "destructoid.com",
-    "bet.com",
-    "ascd.org",
-    "trade.gov",
-    "empireonline.com",
-    "wfu.edu",
-    "influencermarketinghub.com",
-    "theroot.com",
-    "homeip.net",
-    "unwto.org",
-    "feedspot.com",
-    "shapeways.com",
-    "transunion.com",
-    "southcn.com",
-    "hertz.com",
-    "storeboard.com",
-    "osd.mil",
-    "icons8.com",
-    "ynetnews.com",
-    "copyblogger.com",
-    "cnsnews.com",
-    "gg.gg",
-    "suning.com",
-    "ni.com",
-    "playbill.com",
-    "qantas.com",
-    "shinobi.jp",
-    "redirectingat.com",
-    "nestle.com",
-    "freerepublic.com",
-    "uwyo.edu",
-    "nrc.nl",
-    "liverpoolfc.com",
-    "umaine.edu",
-    "muni.cz",
-    "clevescene.com",
-    "optimizely.com",
-    "rsna.org",
-    "news4jax.com",
-    "wv.gov",
-    "dict.cc",
-    "alternativeto.net",
-    "fang.com",
-    "uni-goettingen.de",
-    "vnexpress.net",
-    "periscope.tv",
-    "brill.com",
-    "mdr.de",
-    "iit.edu",
-    "teacherspayteachers.com",
-    "quicksprout.com",
-    "uwec.edu",
-    "local10.com",
-    "macrotrends.net",
-    "bsigroup.com",
-    "napster.com",
-    "dtu.dk",
-    "sankei.com",
-    "sherwin-williams.com",
-    "tvline.com",
-    "jamendo.com",
-    "jewishvirtuallibrary.org",
-    "opengroup.org",
-    "autotrader.com",
-    "qt.io",
-    "fcbarcelona.com",
-    "uta.edu",
-    "icao.int",
-    "imo.org",
-    "mdanderson.org",
-    "multiply.com",
-    "darpa.mil",
-    "timesfreepress.com",
-    "thenewstribune.com",
-    "artic.edu",
-    "ipl.org",
-    "moneycrashers.com",
-    "education.com",
-    "theprint.in",
-    "arkansasonline.com",
-    "pastelink.net",
-    "allthingsd.com",
-    "metafilter.com",
-    "threatpost.com",
-    "avira.com",
-    "sae.org",
-    "usajobs.gov",
-    "linuxmint.com",
-    "daimler.com",
-    "unenvironment.org",
-    "adac.de",
-    "unina.it",
-    "biblestudytools.com",
-    "uba.ar",
-    "calpoly.edu",
-    "synology.com",
-    "skku.edu",
-    "uni-stuttgart.de",
-    "datingreviewer.net",
-    "unilever.com",
-    "hathitrust.org",
-    "songkick.com",
-    "nbcsandiego.com",
-    "saksfifthavenue.com",
-    "spreadshirt.com",
-    "rubyonrails.org",
-    "volkskrant.nl",
-    "optimole.com",
-    "expressen.se",
-    "marines.mil",
-    "uni-leipzig.de",
-    "riseup.net",
-    "sjv.io",
-    "singaporeair.com",
-    "nova.edu",
-    "8b.io",
-    "gdpr-info.eu",
-    "nu.nl",
-    "srf.ch",
-    "foxitsoftware.com",
-    "advocate.com",
-    "kitco.com",
-    "break.com",
-    "hackerone.com",
-    "datingrating.net",
-    "thesprucecrafts.com",
-    "bravotv.com",
-    "babbel.com",
-    "middlebury.edu",
-    "sandiegozoo.org",
-    "namesilo.com",
-    "pilotonline.com",
-    "mindspring.com",
-    "polimi.it",
-    "travelocity.com",
-    "dw-world.de",
-    "jqueryui.com",
-    "smashballoon.com",
-    "omicsonline.org",
-    "99brides.com",
-    "hyperallergic.com",
-    "publicradio.org",
-    "corel.com",
-    "mindbodyonline.com",
-    "tribuneindia.com",
-    "opendns.com",
-    "adblockplus.org",
-    "tsn.ca",
-    "pokemon.com",
-    "catchtiger.com",
-    "toshiba.com",
-    "guardian.ng",
-    "iihs.org",
-    "nascar.com",
-    "visitscotland.com",
-    "opb.org",
-    "toasttab.com",
-    "scitechdaily.com",
-    "themehorse.com",
-    "trendhunter.com",
-    "byrdie.com",
-    "jigsawplanet.com",
-    "oilprice.com",
-    "rafflecopter.com",
-    "scroll.in",
-    "ufrj.br",
-    "score.org",
-    "royalmail.com",
-    "healthdata.org",
-    "cabelas.com",
-    "txdot.gov",
-    "thewire.in",
-    "allocine.fr",
-    "bmwi.de",
-    "chowhound.com",
-    "aif.ru",
-    "wpi.edu",
-    "vg247.com",
-    "wfla.com",
-    "journalstar.com",
-    "questionpro.com",
-    "tldp.org",
-    "laptopmag.com",
-    "arbeitsagentur.de",
-    "activision.com",
-    "deepl.com",
-    "indigo.ca",
-    "tokopedia.com",
-    "brew.sh",
-    "easports.com",
-    "bundesgesundheitsministerium.de",
-    "paulgraham.com",
-    "actionnetwork.org",
-    "espncricinfo.com",
-    "cafelog.com",
-    "ohsu.edu",
-    "ntnu.no",
-    "depositfiles.com",
-    "hypermart.net",
-    "carnegieendowment.org",
-    "peninsuladailynews.com",
-    "voxeu.org",
-    "dovepress.com",
-    "linksys.com",
-    "ryerson.ca",
-    "aalto.fi",
-    "clustrmaps.com",
-    "crateandbarrel.com",
-    "wfmz.com",
-    "abqjournal.com",
-    "taipeitimes.com",
-    "webstarts.com",
-    "coca-cola.com",
-    "moddb.com",
-    "netsuite.com",
-    "hollywood.com",
-    "nyt.com",
-    "thepiratebay.org",
-    "catb.org",
-    "marketo.com",
-    "middleeasteye.net",
-    "exxonmobil.com",
-    "morningconsult.com",
-    "atom.io",
-    "invisionapp.com",
-    "venmo.com",
-    "techpowerup.com",
-    "patient.info",
-    "zoosnet.net",
-    "israelnationalnews.com",
-    "thisamericanlife.org",
-    "computerhistory.org",
-    "fireeye.com",
-    "hetzner.com",
-    "yell.com",
-    "prnt.sc",
-    "austinchronicle.com",
-    "xvideos.com",
-    "elledecor.com",
-    "cmbchina.com",
-    "sho.com",
-    "edf.org",
-    "mozdev.org",
-    "flourish.studio",
-    "louisville.edu",
-    "yubico.com",
-    "buzzsumo.com",
-    "seattleweekly.com",
-    "novartis.com",
-    "vim.org",
-    "mouser.com",
-    "sverigesradio.se",
-    "mta.info",
-    "belkin.com",
-    "inaturalist.org",
-    "jp.net",
-    "casetext.com",
-    "digitalcommerce360.com",
-    "datenschutz-generator.de",
-    "umaryland.edu",
-    "easeus.com",
-    "betfair.com",
-    "geek.com",
-    "astronomy.com",
-    "efe.com",
-    "biospace.com",
-    "levi.com",
-    "50megs.com",
-    "freshbooks.com",
-    "cambridgeenglish.org",
-    "cmail20.com",
-    "stores.jp",
-    "juntadeandalucia.es",
-    "tf1.fr",
-    "su.se",
-    "gearbest.com",
-    "unicamp.br",
-    "realmadrid.com",
-    "mobygames.com",
-    "kingston.com",
-    "harpers.org",
-    "wusa9.com",
-    "cbd.int",
-    "businessoffashion.com",
-    "teslamotors.com",
-    "opensocietyfoundations.org",
-    "wjla.com",
-    "chewy.com",
-    "greenbiz.com",
-    "france.tv",
-    "yudu.com",
-    "piriform.com",
-    "hookupwebsites.org",
-    "a16z.com",
-    "directv.com",
-    "ralphlauren.com",
-    "gatesnotes.com",
-    "gumtree.com",
-    "topgear.com",
-    "konami.com",
-    "blackboard.com",
-    "regjeringen.no",
-    "wilsoncenter.org",
-    "lwn.net",
-    "cadenaser.com",
-    "kadencewp.com",
-    "autoevolution.com",
-    "jobvite.com",
-    "photo.net",
-    "mobypicture.com",
-    "url.cn",
-    "sigmaaldrich.com",
-    "distractify.com",
-    "healthfully.com",
-    "pcgamesn.com",
-    "nordvpn.com",
-    "hookupdate.net",
-    "ksat.com",
-    "dailywire.com",
-    "crypto.com",
-    "ukcop26.org",
-    "umu.se",
-    "chelseafc.com",
-    "comparitech.com",
-    "smartrecruiters.com",
-    "setlist.fm",
-    "convertkit.com",
-    "brit.co",
-    "fox8.com",
-    "diynetwork.com",
-    "online.fr",
-    "downdetector.com",
-    "xxx.com",
-    "10best.com",
-    "mewe.com",
-    "creativelive.com",
-    "nbcmiami.com",
-    "nongnu.org",
-    "staradvertiser.com",
-    "filehippo.com",
-    "euobserver.com",
-    "nuance.com",
-    "up.pt",
-    "pressdemocrat.com",
-    "endocrine.org",
-    "daytondailynews.com",
-    "olemiss.edu",
-    "astrazeneca.com",
-    "haosou.com",
-    "travelchannel.com",
-    "thenounproject.com",
-    "ametsoc.org",
-    "thedailymeal.com",
-    "nextcloud.com",
-    "ripe.net",
-    "8m.com",
-    "purewow.com",
-    "lumenlearning.com",
-    "gazzetta.it",
-    "origin.com",
-    "mindmeister.com",
-    "ust.hk",
-    "usbank.com",
-    "forever21.com",
-    "gamepedia.com",
-    "emedicinehealth.com",
-    "lever.co",
-    "lifesitenews.com",
-    "gda.pl",
-    "skyscanner.net",
-    "suite101.com",
-    "neocities.org",
-    "providencejournal.com",
-    "canoe.ca",
-    "kansas.com",
-    "sprint.com",
-    "palgrave.com",
-    "decrypt.co",
-    "rotary.org",
-    "beacons.ai",
-    "cafemom.com",
-    "wgbh.org",
-    "cirquedusoleil.com",
-    "worldscientific.com",
-    "appsto.re",
-    "liberty.edu",
-    "ruby-lang.org",
-    "yogajournal.com",
-    "tok2.com",
-    "leg.br",
-    "theinquirer.net",
-    "shopping.com",
-    "hostinger.com",
-    "notebookcheck.net",
-    "myheritage.com",
-    "chop.edu",
-    "rijksmuseum.nl",
-    "baseball-reference.com",
-    "cbpp.org",
-    "ath.cx",
-    "tinypng.com",
-    "publons.com",
-    "marquette.edu",
-    "thehotline.org",
-    "merckmanuals.com",
-    "optinmonster.com",
-    "amc.com",
-    "lequipe.fr",
-    "pcisecuritystandards.org",
-    "rr.com",
-    "underarmour.com",
-    "israelnightclub.com",
-    "sk.ca",
-    "gardeningknowhow.com",
-    "creative.com",
-    "ecosia.org",
-    "cert.org",
-    "pair.com",
-    "loreal.com",
-    "schneider-electric.com",
-    "worldhistory.org",
-    "oschina.net",
-    "tigris.org",
-    "freesound.org",
-    "securelist.com",
-    "toptenreviews.com",
-    "auth.gr",
-    "36kr.com",
-    "avito.ru",
-    "ukri.org",
-    "friendfeed.com",
-    "transportr.io",
-    "nest.com",
-    "ladbible.com",
-    "amny.com",
-    "phillymag.com",
-    "sixflags.com",
-    "wikivoyage.org",
-    "ipetitions.com",
-    "golfdigest.com",
-    "agu.org",
-    "blackmagicdesign.com",
-    "onfeetnation.com",
-    "coolors.co",
-    "racked.com",
-    "lohud.com",
-    "ilga.gov",
-    "v.gd",
-    "suse.com",
-    "aphapublications.org",
-    "gsma.com",
-    "sacred-texts.com",
-    "wiwo.de",
-    "readwrite.com",
-    "intercom.com",
-    "nintendolife.com",
-    "sg-host.com",
-    "agilent.com",
-    "clickcease.com",
-    "bloomingdales.com",
-    "news12.com",
-    "milano.it",
-    "snap.com",
-    "lilly.com",
-    "instagr.am",
-    "bloglines.com",
-    "swarovski.com",
-    "nationwide.com",
-    "delawareonline.com",
-    "wpforo.com",
-    "expatica.com",
-    "anyflip.com",
-    "infineon.com",
-    "ardmediathek.de",
-    "ntlworld.com",
-    "datingmentor.org",
-    "metrotimes.com",
-    "polldaddy.com",
-    "audiomack.com",
-    "tomsk.ru",
-    "adr.org",
-    "wcvb.com",
-    "casio.com",
-    "bgsu.edu",
-    "spectrumlocalnews.com",
-    "jw.org",
-    "hamburg.de",
-    "12306.cn",
-    "jwplayer.com",
-    "mcclatchydc.com",
-    "ia.us",
-    "cyol.com",
-    "protocol.com",
-    "douyin.com",
-    "mixi.jp",
-    "ctan.org",
-    "pxf.io",
-    "petmd.com",
-    "tv-hd-1.org",
-    "batmanapollo.ru",
-    "hulkshare.com",
-    "dlr.de",
-    "thepioneerwoman.com",
-    "woothemes.com",
-    "slu.edu",
-    "martindale.com",
-    "nespresso.com",
-    "juniper.net",
-    "eetimes.com",
-    "hypotheses.org",
-    "dr.dk",
-    "winehq.org",
-    "act.org",
-    "robbreport.com",
-    "comingsoon.net",
-    "colourlovers.com",
-    "rtl.de",
-    "ucd.ie",
-    "chathamhouse.org",
-    "mastodon.social",
-    "presseportal.de",
-    "jmu.edu",
-    "poshmark.com",
-    "trezor.io",
-    "migrationpolicy.org",
-    "francebleu.fr",
-    "preply.com",
-    "2track.info",
-    "virginmedia.com",
-    "ubuntuforums.org",
-    "labiennale.org",
-    "abcactionnews.com",
-    "bostonmagazine.com",
-    "openbsd.org",
-    "wonderplugin.com",
-    "goodtherapy.org",
-    "fox2now.com",
-    "lookbook.nu",
-    "atw.hu",
-    "niemanlab.org",
-    "ny1.com",
-    "inmotionhosting.com",
-    "onetrust.com",
-    "zippia.com",
-    "zebra.com",
-    "whyy.org",
-    "osti.gov",
-    "nea.org",
-    "schwab.com",
-    "walkscore.com",
-    "kompas.com",
-    "nationmaster.com",
-    "gadgets360.com",
-    "seventeen.com",
-    "dmm.com",
-    "radiopublic.com",
-    "agpd.es",
-    "squareblogs.net",
-    "sympatico.ca",
-    "scotusblog.com",
-    "bose.com",
-    "virgilio.it",
-    "copyscape.com",
-    "activestate.com",
-    "themify.me",
-    "thedailystar.net",
-    "kinopoisk.ru",
-    "deccanchronicle.com",
-    "wwnorton.com",
-    "oneplus.com",
-    "orbitz.com",
-    "porch.com",
-    "upv.es",
-    "mpaa.org",
-    "wtsp.com",
-    "xanga.com",
-    "myswitzerland.com",
-    "expansion.com",
-    "retaildive.com",
-    "edgesuite.net",
-    "gigabyte.com",
-    "ravelry.com",
-    "themarysue.com",
-    "wkyc.com",
-    "kiro7.com",
-    "thinglink.com",
-    "epik.com",
-    "sandiego.edu",
-    "mun.ca",
-    "ghacks.net",
-    "slickdeals.net",
-    "whitepages.com",
-    "buff.ly",
-    "embedly.com",
-    "unbounce.com",
-    "theladders.com",
-    "goop.com",
-    "leafly.com",
-    "finalfantasyxiv.com",
-    "nabble.com",
-    "visitlondon.com",
-    "bootstrapmade.com",
-    "metacpan.org",
-    "jcrew.com",
-    "essayswriting.org",
-    "stereogum.com",
-    "getyourguide.com",
-    "jekyllrb.com",
-    "fontsquirrel.com",
-    "jpmorganchase.com",
-    "listennotes.com",
-    "hyundai.com",
-    "lithub.com",
-    "mountsinai.org",
-    "vercel.app",
-    "royalcaribbean.com",
-    "mediabistro.com",
-    "biggerpockets.com",
-    "buybitcoinworldwide.com",
-    "multiscreensite.com",
-    "peerj.com",
-    "16personalities.com",
-    "nwitimes.com",
-    "company.site",
-    "todayonline.com",
-    "ifc.org",
-    "trustwave.com",
-    "networkforgood.com",
-    "cakeresume.com",
-    "6te.net",
-    "phoenixnewtimes.com",
-    "fashionista.com",
-    "continental.com",
-    "handmadewriting.com",
-    "shinystat.com",
-    "freebeacon.com",
-    "finextra.com",
-    "wmagazine.com",
-    "epo.org",
-    "translatewiki.net",
-    "winscp.net",
-    "tiffany.com",
-    "bioone.org",
-    "controlc.com",
-    "franceinter.fr",
-    "aetna.com",
-    "silive.com",
-    "theartnewspaper.com",
-    "ticksy.com",
-    "williams.edu",
-    "cycling74.com",
-    "jci.org",
-    "axs.com",
-    "format.com",
-    "simon.com",
-    "samba.org",
-    "vh1.com",
-    "cairn.info",
-    "truste.com",
-    "learnreligions.com",
-    "onegreenplanet.org",
-    "chipotle.com",
-    "beforeitsnews.com",
-    "56.com",
-    "castbox.fm",
-    "kinoteatrzarya.ru",
-    "szczecin.pl",
-    "ufmg.br",
-    "kanagawa.jp",
-    "createspace.com",
-    "directadmin.com",
-    "seetickets.com",
-    "brandwatch.com",
-    "redcrossblood.org",
-    "pubhtml5.com",
-    "recreation.gov",
-    "glaad.org",
-    "jus.br",
-    "mathsisfun.com",
-    "chabad.org",
-    "joomag.com",
-    "kingcounty.gov",
-    "al-monitor.com",
-    "juneauempire.com",
-    "governing.com",
-    "shangri-la.com",
-    "matadornetwork.com",
-    "shazam.com",
-    "gcs-web.com",
-    "ak.us",
-    "aon.com",
-    "odysee.com",
-    "gmanetwork.com",
-    "softwareadvice.com",
-    "iis.net",
-    "marketingdive.com",
-    "cmail19.com",
-    "dni.gov",
-    "arsenal.com",
-    "telerik.com",
-    "huduser.gov",
-    "doctorswithoutborders.org",
-    "businessofapps.com",
-    "telegraphindia.com",
-    "apartments.com",
-    "markmonitor.com",
-    "baike.com",
-    "formsite.com",
-    "acehardware.com",
-    "eastbaytimes.com",
-    "allaboutbirds.org",
-    "thestranger.com",
-    "grainger.com",
-    "yesky.com",
-    "open.edu",
-    "turnkeylinux.org",
-    "mediaset.it",
-    "booksamillion.com",
-    "fgov.be",
-    "amp-wp.org",
-    "txstate.edu",
-    "fee.org",
-    "upworthy.com",
-    "burberry.com",
-    "governmentjobs.com",
-    "ielts.org",
-    "kddi.com",
-    "artnews.com",
-    "austintexas.gov",
-    "bungie.net",
-    "vanguard.com",
-    "radaronline.com",
-    "amnestyusa.org",
-    "catholicnewsagency.com",
-    "forecast7.com",
-    "robinhood.com",
-    "appannie.com",
-    "cochranelibrary.com",
-    "kgw.com",
-    "toggl.com",
-    "etoro.com",
-    "buzznet.com",
-    "tv-tv-tv.org",
-    "td.com",
-    "queue-it.net",
-    "accesspressthemes.com",
-    "doityourself.com",
-    "jamesclear.com",
-    "jta.org",
-    "ernet.in",
-    "ndsu.edu",
-    "sundance.org",
-    "gamespy.com",
-    "spacenews.com",
-    "answerthepublic.com",
-    "ccn.com",
-    "theoatmeal.com",
-    "paramount.com",
-    "ccleaner.com",
-    "189.cn",
-    "australia.com",
-    "uncg.edu",
-    "myplate.gov",
-    "cathaypacific.com",
-    "marketingweek.com",
-    "legiscan.com",
-    "speedyloan.net",
-    "uni-bremen.de",
-    "xoom.com",
-    "tom.com",
-    "simplyrecipes.com",
-    "yousendit.com",
-    "userway.org",
-    "intercontinental.com",
-    "ens.fr",
-    "ibisworld.com",
-    "blacklivesmatter.com",
-    "webfx.com",
-    "skyscrapercity.com",
-    "academic.ru",
-    "investorplace.com",
-    "europe1.fr",
-    "dmagazine.com",
-    "carfax.com",
-    "keepass.info",
-    "pitchbook.com",
-    "diepresse.com",
-    "apc.org",
-    "mozilla-europe.org",
-    "ctpost.com",
-    "ktvu.com",
-    "miamioh.edu",
-    "quia.com",
-    "librivox.org",
-    "go2cloud.org",
-    "wantedly.com",
-    "royalcbd.com",
-    "qvc.com",
-    "basspro.com",
-    "splice.com",
-    "gotquestions.org",
-    "kennedy-center.org",
-    "azfamily.com",
-    "ks.gov",
-    "thegamer.com",
-    "americanthinker.com",
-    "creditcards.com",
-    "latribune.fr",
-    "hola.com",
-    "autoweek.com",
-    "tiscali.it",
-    "wko.at",
-    "wework.com",
-    "fark.com",
-    "madmimi.com",
-    "nirsoft.net",
-    "myminifactory.com",
-    "sudouest.fr",
-    "hktdc.com",
-    "volunteermatch.org",
-    "elte.hu",
-    "utsa.edu",
-    "cervantes.es",
-    "trekbikes.com",
-    "wesleyan.edu",
-    "creditkarma.com",
-    "mundodeportivo.com",
-    "asics.com",
-    "nbcolympics.com",
-    "gmpg.org",
-    "ffmpeg.org",
-    "tribunnews.com",
-    "iisd.org",
-    "mediapart.fr",
-    "americanbanker.com",
-    "tallahassee.com",
-    "lacity.org",
-    "filmfreeway.com",
-    "awin.com",
-    "venngage.com",
-    "unirioja.es",
-    "iconfinder.com",
-    "mythem.es",
-    "roche.com",
-    "jenkins.io",
-    "avid.com",
-    "todoist.com",
-    "if.ua",
-    "vrt.be",
-    "roanoke.com",
-    "hover.com",
-    "uni-trier.de",
-    "japan-guide.com",
-    "webself.net",
-    "untappd.com",
-    "cs-cart.com",
-    "freshmeat.net",
-    "thetrainline.com",
-    "simplyhired.com",
-    "oklahoman.com",
-    "zacks.com",
-    "sipri.org",
-    "press-crew.com",
-    "novayagazeta.ru",
-    "solidworks.com",
-    "uni-mainz.de",
-    "passkey.com",
-    "tribe.so",
-    "hinet.net",
-    "carecredit.com",
-    "kyodonews.net",
-    "topforeignbrides.com",
-    "colgate.com",
-    "xinmin.cn",
-    "webcindario.com",
-    "clarionledger.com",
-    "fi.it",
-    "linuxjournal.com",
-    "whattoexpect.com",
-    "bleedingcool.com",
-    "la-croix.com",
-    "pix11.com",
-    "activerain.com",
-    "umweltbundesamt.de",
-    "fatherly.com",
-    "floridatoday.com",
-    "newsok.com",
-    "alturl.com",
-    "joelonsoftware.com",
-    "geni.com",
-    "whatwg.org",
-    "fec.gov",
-    "theamericanconservative.com",
-    "hallmark.com",
-    "riken.jp",
-    "oppo.com",
-    "crossref.org",
-    "viamichelin.com",
-    "ymaws.com",
-    "digital-photography-school.com",
-    "cmaj.ca",
-    "csus.edu",
-    "infogr.am",
-    "elcomercio.pe",
-    "jssor.com",
-    "financialcontent.com",
-    "milenio.com",
-    "tmweb.ru",
-    "skyandtelescope.org",
-    "scarymommy.com",
-    "emc.com",
-    "bcz.com",
-    "fourmilab.ch",
-    "bmwgroup.com",
-    "malaymail.com",
-    "freemusicarchive.org",
-    "msdmanuals.com",
-    "lancasteronline.com",
-    "bravenet.com",
-    "sgs.com",
-    "riverfronttimes.com",
-    "sched.com",
-    "material.io",
-    "mandarinoriental.com",
-    "readwriteweb.com",
-    "commercialappeal.com",
-    "chez.com",
-    "tu-chemnitz.de",
-    "with2.net",
-    "pxhere.com",
-    "it168.com",
-    "cyberciti.biz",
-    "daad.de",
-    "20min.ch",
-    "click4r.com",
-    "lib.ru",
-    "regnum.ru",
-    "adobeconnect.com",
-    "familydoctor.org",
-    "assets.kpmg",
-    "geogebra.org",
-    "dlink.com",
-    "dvidshub.net",
-    "bmw.com",
-    "cengage.com",
-    "aleteia.org",
-    "wpml.org",
-    "dice.com",
-    "lululemon.com",
-    "cpj.org",
-    "lamag.com",
-    "upmc.com",
-    "kare11.com",
-    "sciam.com",
-    "thecanadianencyclopedia.ca",
-    "united-domains.de",
-    "mango.com",
-    "insee.fr",
-    "usal.es",
-    "igi-global.com",
-    "modernhealthcare.com",
-    "atptour.com",
-    "hermes.com",
-    "escapistmagazine.com",
-    "golf.com",
-    "flsenate.gov",
-    "londonstockexchange.com",
-    "valuewalk.com",
-    "jetblue.com",
-    "t3.com",
-    "allthatsinteresting.com",
-    "fpdf.org",
-    "good.is",
-    "naacp.org",
-    "orst.edu",
-    "perezhilton.com",
-    "sonos.com",
-    "enotes.com",
-    "a.co",
-    "adorama.com",
-    "fresnobee.com",
-    "thefa.com",
-    "vg.no",
-    "marchofdimes.org",
-    "discourse.org",
-    "wxyz.com",
-    "detik.com",
-    "pca.st",
-    "paralympic.org",
-    "motherearthnews.com",
-    "builtin.com",
-    "joomshaper.com",
-    "sitemeter.com",
-    "shopbop.com",
-    "mercari.com",
-    "eib.org",
-    "physorg.com",
-    "bitcoinmagazine.com",
-    "wcpo.com",
-    "commonwealthfund.org",
-    "mtsu.edu",
-    "openid.net",
-    "doingbusiness.org",
-    "whoi.edu",
-    "goodmenproject.com",
-    "paperwritings.com",
-    "ancient-origins.net",
-    "architizer.com",
-    "thinkupthemes.com",
-    "autoriteitpersoonsgegevens.nl",
-    "playbuzz.com",
-    "123formbuilder.com",
-    "musicbrainz.org",
-    "ksdk.com",
-    "videopress.com",
-    "alaskaair.com",
-    "christianbook.com",
-    "youcanbook.me",
-    "roadandtrack.com",
-    "comptia.org",
-    "wwu.edu",
-    "howard.edu",
-    "phillyvoice.com",
-    "quantamagazine.org",
-    "internetlivestats.com",
-    "jinshuju.net",
-    "wacom.com",
-    "ucc.ie",
-    "helpscout.com",
-    "phila.gov",
-    "festival-cannes.com",
-    "vodafone.com",
-    "rarlab.com",
-    "thegatewaypundit.com",
-    "yjtag.jp",
-    "rgj.com",
-    "fox6now.com",
-    "bookriot.com",
-    "eenews.net",
-    "acronymfinder.com",
-    "wftv.com",
-    "mixpanel.com",
-    "divephotoguide.com",
-    "mybluehost.me",
-    "slideserve.com",
-    "kcrw.com",
-    "ruhr-uni-bochum.de",
-    "floridahealth.gov",
-    "hs-sites.com",
-    "hellogiggles.com",
-    "irena.org",
-    "payforessay.net",
-    "curseforge.com",
-    "thesmokinggun.com",
-    "fastweb.com",
-    "lesoir.be",
-    "ya.ru",
-    "billingsgazette.com",
-    "tineye.com",
-    "thebulletin.org",
-    "golem.de",
-    "proprofs.com",
-    "iab.com",
-    "questia.com",
-    "jiji.com",
-    "beaconjournal.com",
-    "yr.no",
-    "straightdope.com",
-    "idealist.org",
-    "decider.com",
-    "ksu.edu",
-    "yaml.org",
-    "metlife.com",
-    "kcra.com",
-    "salvationarmy.org",
-    "saatchiart.com",
-    "wz.cz",
-    "getpaint.net",
-    "expertise.com",
-    "unipd.it",
-    "london.edu",
-    "dallasobserver.com",
-    "qianlong.com",
-    "auth0.com",
-    "gasbuddy.com",
-    "futura-sciences.com",
-    "nationalmssociety.org",
-    "informs.org",
-    "outbrain.com",
-    "globalsources.com",
-    "expressvpn.com",
-    "ucdenver.edu",
-    "priceline.com",
-    "ushistory.org",
-    "omnihotels.com",
-    "allposters.com",
-    "wizardingworld.com",
-    "neh.gov",
-    "marketwire.com",
-    "prv.pl",
-    "nctm.org",
-    "fr.de",
-    "healthday.com",
-    "catholic.org",
-    "people-press.org",
-    "ubergizmo.com",
-    "healthcareitnews.com",
-    "monstersandcritics.com",
-    "enterprise.com",
-    "unipi.it",
-    "gva.es",
-    "brynmawr.edu",
-    "zblogcn.com",
-    "citigroup.com",
-    "poemhunter.com",
-    "ki.se",
-    "amherst.edu",
-    "barcelona.cat",
-    "kirkusreviews.com",
-    "donaldjtrump.com",
-    "kantar.com",
-    "indexmundi.com",
-    "php-fig.org",
-    "uclahealth.org",
-    "googlesource.com",
-    "webkit.org",
-    "geology.com",
-    "journaldunet.com",
-    "qooh.me",
-    "woot.com",
-    "pulitzer.org",
-    "overcast.fm",
-    "fox5atlanta.com",
-    "bcove.me",
-    "uniroma1.it",
-    "spectrum.com",
-    "tu-darmstadt.de",
-    "virtualmin.com",
-    "acl.gov",
-    "cgiar.org",
-    "hawaiinewsnow.com",
-    "trip.com",
-    "siu.edu",
-    "guttmacher.org",
-    "weightwatchers.com",
-    "fishki.net",
-    "abchina.com",
-    "ascopubs.org",
-    "metapress.com",
-    "idahostatesman.com",
-    "camp-fire.jp",
-    "www.royal.uk",
-    "legalzoom.com",
-    "toysrus.com",
-    "safer-networking.org",
-    "goodrx.com",
-    "smith.edu",
-    "crosswalk.com",
-    "website2.me",
-    "sante.fr",
-    "septcasino.com",
-    "uqam.ca",
-    "dailysignal.com",
-    "franceculture.fr",
-    "tvzvezda.ru",
-    "waseda.jp",
-    "petco.com",
-    "expressnews.com",
-    "desertsun.com",
-    "climate.gov",
-    "ssense.com",
-    "procon.org",
-    "glosbe.com",
-    "hackster.io",
-    "eol.cn",
-    "restaurantguru.com",
-    "allevents.in",
-    "hopin.com",
-    "metro.us",
-    "potterybarn.com",
-    "dmv.org",
-    "nycgovparks.org",
-    "miniclip.com",
-    "sinaimg.cn",
-    "marketbeat.com",
-    "turner.com",
-    "coschedule.com",
-    "unionleader.com",
-    "dukeupress.edu",
-    "edmontonjournal.com",
-    "gocomics.com",
-    "51cto.com",
-    "gub.uy",
-    "cox.net",
-    "arabianbusiness.com",
-    "f6s.com",
-    "media-amazon.com",
-    "rivals.com",
-    "unibas.ch",
-    "penny-arcade.com",
-    "linternaute.com",
-    "valuecommerce.com",
-    "udayton.edu",
-    "freakonomics.com",
-    "assemblee-nationale.fr",
-    "pepsico.com",
-    "clickz.com",
-    "ladepeche.fr",
-    "bestplaces.net",
-    "tcm.com",
-    "musicradar.com",
-    "webdesignerdepot.com",
-    "thesun.ie",
-    "redstate.com",
-    "irishmirror.ie",
-    "betterhelp.com",
-    "artmight.com",
-    "jotformeu.com",
-    "physicsworld.com",
-    "fueleconomy.gov",
-    "cnzz.com",
-    "ultipro.com",
-    "kvue.com",
-    "bizrate.com",
-    "foxit.com",
-    "tv.com",
-    "scimagojr.com",
-    "talksport.com",
-    "akamaized.net",
-    "jalan.net",
-    "kfor.com",
-    "welivesecurity.com",
-    "religionnews.com",
-    "blackenterprise.com",
-    "sportsnet.ca",
-    "hikvision.com",
-    "json.org",
-    "themepalace.com",
-    "sugar-daddies.us",
-    "blogg.se",
-    "draftkings.com",
-    "cookinglight.com",
-    "timesofindia.com",
-    "loopnet.com",
-    "taringa.net",
-    "openclipart.org",
-    "yankodesign.com",
-    "nxtbook.com",
-    "thinkquest.org",
-    "eslgaming.com",
-    "constitutioncenter.org",
-    "shorl.com",
-    "vn.ua",
-    "choosemyplate.gov",
-    "melia.com",
-    "bandsintown.com",
-    "mail-order-bride.net",
-    "news5cleveland.com",
-    "visme.co",
-    "aspeninstitute.org",
-    "arcor.de",
-    "kraken.com",
-    "freddiemac.com",
-    "cabanova.com",
-    "ufc.com",
-    "afsp.org",
-    "uni-lj.si",
-    "bignewsnetwork.com",
-    "sharecare.com",
-    "wnycstudios.org",
-    "uni-hannover.de",
-    "mykajabi.com",
-    "aichi.jp",
-    "rdcu.be",
-    "ffm.to",
-    "rescue.org",
-    "kidney.org",
-    "oed.com",
-    "internet.com",
-    "thomann.de",
-    "grc.com",
-    "match.com",
-    "renewableenergyworld.com",
-    "abcnews.com",
-    "harborfreight.com",
-    "brightbrides.org",
-    "wptv.com",
-    "flock.com",
-    "xhamster.com",
-    "ispot.tv",
-    "whowhatwear.com",
-    "lush.com",
-    "sparkpeople.com",
-    "gofund.me",
-    "usfca.edu",
-    "scene7.com",
-    "ixigua.com",
-    "modernatx.com",
-    "toledoblade.com",
-    "shizuoka.jp",
-    "menafn.com",
-    "jmir.org",
-    "informit.com",
-    "peraichi.com",
-    "villanova.edu",
-    "dwell.com",
-    "rivm.nl",
-    "clubhouse.com",
-    "global.abb",
-    "bizcommunity.com",
-    "publico.es",
-    "beaxy.com",
-    "mobile.de",
-    "advfn.com",
-    "bcorporation.net",
-    "indiatvnews.com",
-    "steinberg.net",
-    "igg.me",
-    "dailypress.com",
-    "medicaid.gov",
-    "stubhub.com",
-    "remax.com",
-    "webpagetest.org",
-    "iospress.com",
-    "selfridges.com",
-    "buddypress.org",
-    "eyoucms.com",
-    "ticketleap.com",
-    "110mb.com",
-    "wallpaper.com",
-    "memberclicks.net",
-    "1stdibs.com",
-    "appstate.edu",
-    "ebay-kleinanzeigen.de",
-    "wjx.cn",
-    "ellenmacarthurfoundation.org",
-    "ui.com",
-    "enchantedlearning.com",
-    "kew.org",
-    "bosch.com",
-    "espacenet.com",
-    "hotmart.com",
-    "uni-regensburg.de",
-    "celebritynetworth.com",
-    "fansided.com",
-    "solarwinds.com",
-    "daveramsey.com",
-    "stylecraze.com",
-    "greentechmedia.com",
-    "playboy.com",
-    "nethouse.ru",
-    "lnks.gd",
-    "marketingprofs.com",
-    "punchng.com",
-    "veeam.com",
-    "thisiscolossal.com",
-    "wearesocial.com",
-    "wttw.com",
-    "sfr.fr",
-    "360cities.net",
-    "rospotrebnadzor.ru",
-    "abc11.com",
-    "divx.com",
-    "custom-roms.com",
-    "blogmura.com",
-    "ptc.com",
-    "nahb.org",
-    "usm.edu",
-    "cmswire.com",
-    "wthr.com",
-    "boisestate.edu",
-    "historynet.com",
-    "jcp.org",
-    "uni-kiel.de",
-    "mailorderbridesadvisor.com",
-    "wowhead.com",
-    "yourdomain.com",
-    "research.net",
-    "joebiden.com",
-    "latercera.com",
-    "statisticbrain.com",
-    "brightside.me",
-    "netbeans.org",
-    "vevo.com",
-    "aftenposten.no",
-    "eventscloud.com",
-    "rense.com",
-    "deepmind.com",
-    "allbusiness.com",
-    "definitions.net",
-    "pennmedicine.org",
-    "ecu.edu",
-    "museodelprado.es",
-    "deere.com",
-    "fotki.com",
-    "sytes.net",
-    "laist.com",
-    "laracasts.com",
-    "adultswim.com"
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string_view>
+
+constexpr char TopDomainNames[] = {
+    'g','o','o','g','l','e','.','c','o','m',0,
+    'f','a','c','e','b','o','o','k','.','c','o','m',0,
+    'y','o','u','t','u','b','e','.','c','o','m',0,
+    't','w','i','t','t','e','r','.','c','o','m',0,
+    'i','n','s','t','a','g','r','a','m','.','c','o','m',0,
+    'l','i','n','k','e','d','i','n','.','c','o','m',0,
+    'a','p','p','l','e','.','c','o','m',0,
+    'm','i','c','r','o','s','o','f','t','.','c','o','m',0,
+    'w','i','k','i','p','e','d','i','a','.','o','r','g',0,
+    'w','o','r','d','p','r','e','s','s','.','o','r','g',0,
+    'g','o','o','g','l','e','t','a','g','m','a','n','a','g','e','r','.','c','o','m',0,
+    'y','o','u','t','u','.','b','e',0,
+    'p','i','n','t','e','r','e','s','t','.','c','o','m',0,
+    'v','i','m','e','o','.','c','o','m',0,
+    'g','i','t','h','u','b','.','c','o','m',0,
+    'g','o','o','.','g','l',0,
+    'b','i','t','.','l','y',0,
+    'a','d','o','b','e','.','c','o','m',0,
+    'b','l','o','g','s','p','o','t','.','c','o','m',0,
+    'a','m','a','z','o','n','.','c','o','m',0,
+    'm','a','c','r','o','m','e','d','i','a','.','c','o','m',0,
+    'm','o','z','i','l','l','a','.','o','r','g',0,
+    'y','a','h','o','o','.','c','o','m',0,
+    't','u','m','b','l','r','.','c','o','m',0,
+    'w','h','a','t','s','a','p','p','.','c','o','m',0,
+    'e','u','r','o','p','a','.','e','u',0,
+    'f','l','i','c','k','r','.','c','o','m',0,
+    'g','r','a','v','a','t','a','r','.','c','o','m',0,
+    'r','e','d','d','i','t','.','c','o','m',0,
+    'q','q','.','c','o','m',0,
+    'n','i','h','.','g','o','v',0,
+    'n','y','t','i','m','e','s','.','c','o','m',0,
+    'a','p','a','c','h','e','.','o','r','g',0,
+    'a','m','a','z','o','n','a','w','s','.','c','o','m',0,
+    's','o','u','n','d','c','l','o','u','d','.','c','o','m',0,
+    'w','3','.','o','r','g',0,
+    'm','e','d','i','u','m','.','c','o','m',0,
+    'f','o','r','b','e','s','.','c','o','m',0,
+    't','.','c','o',0,
+    'z','o','o','m','.','u','s',0,
+    'f','o','r','m','s','.','g','l','e',0,
+    'b','a','i','d','u','.','c','o','m',0,
+    's','p','o','t','i','f','y','.','c','o','m',0,
+    'm','i','i','t','.','g','o','v','.','c','n',0,
+    't','h','e','g','u','a','r','d','i','a','n','.','c','o','m',0,
+    'a','r','c','h','i','v','e','.','o','r','g',0,
+    's','o','u','r','c','e','f','o','r','g','e','.','n','e','t',0,
+    'c','r','e','a','t','i','v','e','c','o','m','m','o','n','s','.','o','r','g',0,
+    'c','n','n','.','c','o','m',0,
+    'd','r','o','p','b','o','x','.','c','o','m',0,
+    'w','h','o','.','i','n','t',0,
+    'w','i','x','s','i','t','e','.','c','o','m',0,
+    'b','b','c','.','c','o','.','u','k',0,
+    'p','a','y','p','a','l','.','c','o','m',0,
+    'i','s','s','u','u','.','c','o','m',0,
+    'c','l','o','u','d','f','l','a','r','e','.','c','o','m',0,
+    'c','d','c','.','g','o','v',0,
+    'w','e','e','b','l','y','.','c','o','m',0,
+    'w','a','.','m','e',0,
+    'b','b','c','.','c','o','m',0,
+    'v','k','.','c','o','m',0,
+    's','c','i','e','n','c','e','d','i','r','e','c','t','.','c','o','m',0,
+    't','i','n','y','u','r','l','.','c','o','m',0,
+    'r','e','u','t','e','r','s','.','c','o','m',0,
+    'w','a','s','h','i','n','g','t','o','n','p','o','s','t','.','c','o','m',0,
+    'o','p','e','r','a','.','c','o','m',0,
+    'y','o','u','t','u','b','e','-','n','o','c','o','o','k','i','e','.','c','o','m',0,
+    'o','r','a','c','l','e','.','c','o','m',0,
+    'o','f','f','i','c','e','.','c','o','m',0,
+    'b','l','o','o','m','b','e','r','g','.','c','o','m',0,
+    'h','a','r','v','a','r','d','.','e','d','u',0,
+    'i','m','d','b','.','c','o','m',0,
+    'p','h','p','.','n','e','t',0,
+    'w','s','j','.','c','o','m',0,
+    'w','i','k','i','m','e','d','i','a','.','o','r','g',0,
+    'n','g','i','n','x','.','o','r','g',0,
+    'm','i','t','.','e','d','u',0,
+    'w','e','i','b','o','.','c','o','m',0,
+    'b','i','n','g','.','c','o','m',0,
+    'b','u','s','i','n','e','s','s','i','n','s','i','d','e','r','.','c','o','m',0,
+    'w','i','l','e','y','.','c','o','m',0,
+    'm','s','n','.','c','o','m',0,
+    'd','o','i','.','o','r','g',0,
+    'w','p','.','c','o','m',0,
+    'g','n','u','.','o','r','g',0,
+    'n','a','t','u','r','e','.','c','o','m',0,
+    'u','n','.','o','r','g',0,
+    't','i','k','t','o','k','.','c','o','m',0,
+    's','t','a','n','f','o','r','d','.','e','d','u',0,
+    'i','b','m','.','c','o','m',0,
+    'l','i','s','t','-','m','a','n','a','g','e','.','c','o','m',0,
+    'l','i','v','e','.','c','o','m',0,
+    's','l','i','d','e','s','h','a','r','e','.','n','e','t',0,
+    'r','e','s','e','a','r','c','h','g','a','t','e','.','n','e','t',0,
+    's','p','r','i','n','g','e','r','.','c','o','m',0,
+    'n','a','s','a','.','g','o','v',0,
+    'w','i','x','.','c','o','m',0,
+    'g','o','.','c','o','m',0,
+    'c','p','a','n','e','l','.','n','e','t',0,
+    'c','n','b','c','.','c','o','m',0,
+    't','i','m','e','.','c','o','m',0,
+    'e','v','e','n','t','b','r','i','t','e','.','c','o','m',0,
+    'u','s','a','t','o','d','a','y','.','c','o','m',0,
+    'c','n','e','t','.','c','o','m',0,
+    'n','p','r','.','o','r','g',0,
+    't','e','d','.','c','o','m',0,
+    'o','u','t','l','o','o','k','.','c','o','m',0,
+    'a','d','d','t','o','a','n','y','.','c','o','m',0,
+    's','u','r','v','e','y','m','o','n','k','e','y','.','c','o','m',0,
+    'c','l','o','u','d','f','r','o','n','t','.','n','e','t',0,
+    'e','b','a','y','.','c','o','m',0,
+    'w','i','r','e','d','.','c','o','m',0,
+    'g','.','p','a','g','e',0,
+    'a','o','l','.','c','o','m',0,
+    'm','y','s','p','a','c','e','.','c','o','m',0,
+    'b','l','o','g','g','e','r','.','c','o','m',0,
+    'm','y','s','q','l','.','c','o','m',0,
+    'a','m','z','n','.','t','o',0,
+    'h','p','.','c','o','m',0,
+    'h','u','f','f','i','n','g','t','o','n','p','o','s','t','.','c','o','m',0,
+    'l','o','c','.','g','o','v',0,
+    'g','o','o','g','l','e','u','s','e','r','c','o','n','t','e','n','t','.','c','o','m',0,
+    'b','e','r','k','e','l','e','y','.','e','d','u',0,
+    't','e','c','h','c','r','u','n','c','h','.','c','o','m',0,
+    'u','n','s','p','l','a','s','h','.','c','o','m',0,
+    'g','c','.','c','a',0,
+    'e','t','s','y','.','c','o','m',0,
+    's','t','a','t','i','s','t','a','.','c','o','m',0,
+    'd','e','b','i','a','n','.','o','r','g',0,
+    'f','t','.','c','o','m',0,
+    'l','a','t','i','m','e','s','.','c','o','m',0,
+    'i','m','g','u','r','.','c','o','m',0,
+    'b','e','h','a','n','c','e','.','n','e','t',0,
+    'y','e','l','p','.','c','o','m',0,
+    't','h','e','m','e','f','o','r','e','s','t','.','n','e','t',0,
+    'w','a','s','h','i','n','g','t','o','n','.','e','d','u',0,
+    'i','e','t','f','.','o','r','g',0,
+    'p','r','n','e','w','s','w','i','r','e','.','c','o','m',0,
+    'f','r','e','e','.','f','r',0,
+    't','w','i','t','c','h','.','t','v',0,
+    'w','e','b','m','d','.','c','o','m',0,
+    't','h','e','v','e','r','g','e','.','c','o','m',0,
+    'd','a','i','l','y','m','o','t','i','o','n','.','c','o','m',0,
+    's','h','o','p','i','f','y','.','c','o','m',0,
+    'n','a','t','i','o','n','a','l','g','e','o','g','r','a','p','h','i','c','.','c','o','m',0,
+    'c','b','s','n','e','w','s','.','c','o','m',0,
+    'c','o','r','n','e','l','l','.','e','d','u',0,
+    's','i','n','a','.','c','o','m','.','c','n',0,
+    'c','a','.','g','o','v',0,
+    'f','d','a','.','g','o','v',0,
+    's','t','a','c','k','o','v','e','r','f','l','o','w','.','c','o','m',0,
+    't','h','e','a','t','l','a','n','t','i','c','.','c','o','m',0,
+    'm','a','i','l','c','h','i','m','p','.','c','o','m',0,
+    'g','o','o','d','r','e','a','d','s','.','c','o','m',0,
+    'o','u','p','.','c','o','m',0,
+    'a','b','o','u','t','a','d','s','.','i','n','f','o',0,
+    'y','o','u','k','u','.','c','o','m',0,
+    's','i','t','e','m','a','p','s','.','o','r','g',0,
+    't','a','n','d','f','o','n','l','i','n','e','.','c','o','m',0,
+    'b','i','t','l','y','.','c','o','m',0,
+    's','q','u','a','r','e','s','p','a','c','e','.','c','o','m',0,
+    'h','u','f','f','p','o','s','t','.','c','o','m',0,
+    'k','i','c','k','s','t','a','r','t','e','r','.','c','o','m',0,
+    't','r','i','p','a','d','v','i','s','o','r','.','c','o','m',0,
+    's','a','m','s','u','n','g','.','c','o','m',0,
+    'p','r','i','n','c','e','t','o','n','.','e','d','u',0,
+    's','c','r','i','b','d','.','c','o','m',0,
+    'l','i','v','e','j','o','u','r','n','a','l','.','c','o','m',0,
+    'a','r','n','e','b','r','a','c','h','h','o','l','d','.','d','e',0,
+    'm','a','i','l','c','h','i','.','m','p',0,
+    'l','a','u','n','c','h','p','a','d','.','n','e','t',0,
+    'i','n','.','u','a',0,
+    's','a','g','e','p','u','b','.','c','o','m',0,
+    'f','b','.','c','o','m',0,
+    's','k','y','p','e','.','c','o','m',0,
+    'h','b','r','.','o','r','g',0,
+    'h','u','b','s','p','o','t','.','c','o','m',0,
+    's','t','a','t','c','o','u','n','t','e','r','.','c','o','m',0,
+    'u','n','e','s','c','o','.','o','r','g',0,
+    'l','i','n','e','.','m','e',0,
+    'n','b','c','n','e','w','s','.','c','o','m',0,
+    'b','u','s','i','n','e','s','s','.','s','i','t','e',0,
+    'm','y','s','h','o','p','i','f','y','.','c','o','m',0,
+    't','e','l','e','g','r','a','m','.','m','e',0,
+    'w','h','i','t','e','h','o','u','s','e','.','g','o','v',0,
+    'u','s','d','a','.','g','o','v',0,
+    'a','k','i','s','m','e','t','.','c','o','m',0,
+    'a','l','l','a','b','o','u','t','c','o','o','k','i','e','s','.','o','r','g',0,
+    'b','a','n','d','c','a','m','p','.','c','o','m',0,
+    'j','i','m','d','o','.','c','o','m',0,
+    'n','e','t','w','o','r','k','a','d','v','e','r','t','i','s','i','n','g','.','o','r','g',0,
+    'c','h','a','n','g','e','.','o','r','g',0,
+    'b','u','s','i','n','e','s','s','w','i','r','e','.','c','o','m',0,
+    'u','s','n','e','w','s','.','c','o','m',0,
+    'm','a','r','r','i','o','t','t','.','c','o','m',0,
+    't','a','o','b','a','o','.','c','o','m',0,
+    'e','c','o','n','o','m','i','s','t','.','c','o','m',0,
+    'n','e','t','f','l','i','x','.','c','o','m',0,
+    '1','6','3','.','c','o','m',0,
+    'e','p','a','.','g','o','v',0,
+    'l','i','n','k','t','r','.','e','e',0,
+    'p','i','x','a','b','a','y','.','c','o','m',0,
+    'f','o','x','n','e','w','s','.','c','o','m',0,
+    'a','b','o','u','t','.','c','o','m',0,
+    'd','i','g','g','.','c','o','m',0,
+    't','y','p','e','p','a','d','.','c','o','m',0,
+    'i','n','v','e','s','t','o','p','e','d','i','a','.','c','o','m',0,
+    'q','u','o','r','a','.','c','o','m',0,
+    'b','r','i','t','a','n','n','i','c','a','.','c','o','m',0,
+    's','c','i','e','n','c','e','m','a','g','.','o','r','g',0,
+    'x','i','n','h','u','a','n','e','t','.','c','o','m',0,
+    'i','s','o','.','o','r','g',0,
+    'p','b','s','.','o','r','g',0,
+    'r','e','d','h','a','t','.','c','o','m',0,
+    'b','o','o','k','i','n','g','.','c','o','m',0,
+    'c','a','m','b','r','i','d','g','e','.','o','r','g',0,
+    'w','o','r','l','d','b','a','n','k','.','o','r','g',0,
+    'e','e','p','u','r','l','.','c','o','m',0,
+    'b','u','z','z','f','e','e','d','.','c','o','m',0,
+    'c','o','l','u','m','b','i','a','.','e','d','u',0,
+    'u','m','i','c','h','.','e','d','u',0,
+    'h','u','g','e','d','o','m','a','i','n','s','.','c','o','m',0,
+    'i','n','d','i','a','t','i','m','e','s','.','c','o','m',0,
+    'h','e','a','l','t','h','l','i','n','e','.','c','o','m',0,
+    'd','o','m','a','i','n','m','a','r','k','e','t','.','c','o','m',0,
+    'z','d','n','e','t','.','c','o','m',0,
+    's','t','a','t','e','.','g','o','v',0,
+    'd','e','v','i','a','n','t','a','r','t','.','c','o','m',0,
+    's','c','i','e','n','c','e','d','a','i','l','y','.','c','o','m',0,
+    'm','a','y','o','c','l','i','n','i','c','.','o','r','g',0,
+    'y','a','l','e','.','e','d','u',0,
+    'm','a','r','k','e','t','w','a','t','c','h','.','c','o','m',0,
+    'f','e','e','d','b','u','r','n','e','r','.','c','o','m',0,
+    'v','i','c','e','.','c','o','m',0,
+    'n','o','a','a','.','g','o','v',0,
+    'c','i','s','c','o','.','c','o','m',0,
+    'p','s','u','.','e','d','u',0,
+    'm','a','s','h','a','b','l','e','.','c','o','m',0,
+    'g','i','p','h','y','.','c','o','m',0,
+    'z','e','n','d','e','s','k','.','c','o','m',0,
+    'a','r','c','g','i','s','.','c','o','m',0,
+    'b','m','j','.','c','o','m',0,
+    'c','b','c','.','c','a',0,
+    'p','l','o','s','.','o','r','g',0,
+    'v','o','x','.','c','o','m',0,
+    'd','i','s','c','o','r','d','.','g','g',0,
+    'g','o','u','v','.','f','r',0,
+    'u','p','e','n','n','.','e','d','u',0,
+    'p','s','y','c','h','o','l','o','g','y','t','o','d','a','y','.','c','o','m',0,
+    'a','c','a','d','e','m','i','a','.','e','d','u',0,
+    'd','r','i','b','b','b','l','e','.','c','o','m',0,
+    'p','t','i','n','e','w','s','.','c','o','m',0,
+    'w','e','f','o','r','u','m','.','o','r','g',0,
+    'f','o','r','t','u','n','e','.','c','o','m',0,
+    'o','x','.','a','c','.','u','k',0,
+    'd','e','l','o','i','t','t','e','.','c','o','m',0,
+    't','h','e','c','o','n','v','e','r','s','a','t','i','o','n','.','c','o','m',0,
+    's','o','h','u','.','c','o','m',0,
+    'w','i','k','i','h','o','w','.','c','o','m',0,
+    'i','n','t','e','l','.','c','o','m',0,
+    'n','y','p','o','s','t','.','c','o','m',0,
+    's','t','u','m','b','l','e','u','p','o','n','.','c','o','m',0,
+    'y','a','n','d','e','x','.','r','u',0,
+    'a','b','c','.','n','e','t','.','a','u',0,
+    's','u','n','.','c','o','m',0,
+    'f','a','s','t','c','o','m','p','a','n','y','.','c','o','m',0,
+    'a','d','d','t','h','i','s','.','c','o','m',0,
+    's','h','a','r','e','p','o','i','n','t','.','c','o','m',0,
+    'b','i','o','m','e','d','c','e','n','t','r','a','l','.','c','o','m',0,
+    'g','o','f','u','n','d','m','e','.','c','o','m',0,
+    'i','e','e','e','.','o','r','g',0,
+    'n','e','w','y','o','r','k','e','r','.','c','o','m',0,
+    'w','p','e','n','g','i','n','e','.','c','o','m',0,
+    'a','n','d','r','o','i','d','.','c','o','m',0,
+    'f','a','n','d','o','m','.','c','o','m',0,
+    'w','i','s','c','.','e','d','u',0,
+    'd','i','s','q','u','s','.','c','o','m',0,
+    'e','x','a','m','p','l','e','.','c','o','m',0,
+    'i','n','c','.','c','o','m',0,
+    't','r','i','p','o','d','.','c','o','m',0,
+    'y','o','u','r','o','n','l','i','n','e','c','h','o','i','c','e','s','.','c','o','m',0,
+    'u','m','n','.','e','d','u',0,
+    'w','e','b','s','.','c','o','m',0,
+    'm','c','k','i','n','s','e','y','.','c','o','m',0,
+    'a','l','i','b','a','b','a','.','c','o','m',0,
+    'p','l','e','s','k','.','c','o','m',0,
+    'o','r','e','i','l','l','y','.','c','o','m',0,
+    'g','e','o','c','i','t','i','e','s','.','c','o','m',0,
+    'u','c','i','.','e','d','u',0,
+    'a','p','a','.','o','r','g',0,
+    'e','n','g','a','d','g','e','t','.','c','o','m',0,
+    'o','r','.','k','r',0,
+    'c','o','n','s','t','a','n','t','c','o','n','t','a','c','t','.','c','o','m',0,
+    'o','e','c','d','.','o','r','g',0,
+    'a','p','n','e','w','s','.','c','o','m',0,
+    'e','l','s','e','v','i','e','r','.','c','o','m',0,
+    'g','o','d','a','d','d','y','.','c','o','m',0,
+    'e','n','t','r','e','p','r','e','n','e','u','r','.','c','o','m',0,
+    'a','r','x','i','v','.','o','r','g',0,
+    'j','o','t','f','o','r','m','.','c','o','m',0,
+    'g','i','z','m','o','d','o','.','c','o','m',0,
+    'c','a','l','e','n','d','l','y','.','c','o','m',0,
+    'j','h','u','.','e','d','u',0,
+    't','y','p','e','f','o','r','m','.','c','o','m',0,
+    'n','e','w','s','w','e','e','k','.','c','o','m',0,
+    'p','e','w','r','e','s','e','a','r','c','h','.','o','r','g',0,
+    'u','b','u','n','t','u','.','c','o','m',0,
+    's','t','e','a','m','p','o','w','e','r','e','d','.','c','o','m',0,
+    's','c','i','e','n','t','i','f','i','c','a','m','e','r','i','c','a','n','.','c','o','m',0,
+    'd','e','l','l','.','c','o','m',0,
+    'i','n','d','e','e','d','.','c','o','m',0,
+    't','r','u','s','t','p','i','l','o','t','.','c','o','m',0,
+    'm','e','r','r','i','a','m','-','w','e','b','s','t','e','r','.','c','o','m',0,
+    'u','c','l','a','.','e','d','u',0,
+    'm','e','e','t','u','p','.','c','o','m',0,
+    'd','w','.','c','o','m',0,
+    'c','a','n','v','a','.','c','o','m',0,
+    't','h','e','l','a','n','c','e','t','.','c','o','m',0,
+    'f','t','c','.','g','o','v',0,
+    'p','a','t','r','e','o','n','.','c','o','m',0,
+    'e','l','e','g','a','n','t','t','h','e','m','e','s','.','c','o','m',0,
+    'u','t','e','x','a','s','.','e','d','u',0,
+    'n','p','s','.','g','o','v',0,
+    'i','n','t','u','i','t','.','c','o','m',0,
+    'f','a','o','.','o','r','g',0,
+    'c','m','u','.','e','d','u',0,
+    'i','r','s','.','g','o','v',0,
+    'u','k','.','c','o','m',0,
+    'p','n','a','s','.','o','r','g',0,
+    'a','b','o','u','t','c','o','o','k','i','e','s','.','o','r','g',0,
+    'x','i','n','g','.','c','o','m',0,
+    'd','o','u','b','l','e','c','l','i','c','k','.','n','e','t',0,
+    'e','d','.','g','o','v',0,
+    's','a','l','e','s','f','o','r','c','e','.','c','o','m',0,
+    'u','c','h','i','c','a','g','o','.','e','d','u',0,
+    'a','z','u','r','e','w','e','b','s','i','t','e','s','.','n','e','t',0,
+    'p','h','o','t','o','b','u','c','k','e','t','.','c','o','m',0,
+    'm','d','p','i','.','c','o','m',0,
+    'o','p','e','n','s','t','r','e','e','t','m','a','p','.','o','r','g',0,
+    'p','y','t','h','o','n','.','o','r','g',0,
+    's','i','.','e','d','u',0,
+    'p','e','x','e','l','s','.','c','o','m',0,
+    'b','b','b','.','o','r','g',0,
+    'a','l','i','y','u','n','.','c','o','m',0,
+    'r','e','a','d','t','h','e','d','o','c','s','.','i','o',0,
+    'a','r','s','t','e','c','h','n','i','c','a','.','c','o','m',0,
+    's','l','a','t','e','.','c','o','m',0,
+    'h','o','u','s','e','.','g','o','v',0,
+    't','r','e','l','l','o','.','c','o','m',0,
+    'c','h','i','c','a','g','o','t','r','i','b','u','n','e','.','c','o','m',0,
+    'b','i','z','j','o','u','r','n','a','l','s','.','c','o','m',0,
+    's','f','g','a','t','e','.','c','o','m',0,
+    'i','n','d','i','e','g','o','g','o','.','c','o','m',0,
+    'f','r','o','n','t','i','e','r','s','i','n','.','o','r','g',0,
+    'w','a','l','m','a','r','t','.','c','o','m',0,
+    'v','k','o','n','t','a','k','t','e','.','r','u',0,
+    'j','s','t','o','r','.','o','r','g',0,
+    'd','o','c','k','e','r','.','c','o','m',0,
+    'w','i','k','t','i','o','n','a','r','y','.','o','r','g',0,
+    'a','n','c','h','o','r','.','f','m',0,
+    'g','i','t','l','a','b','.','c','o','m',0,
+    'j','a','m','a','n','e','t','w','o','r','k','.','c','o','m',0,
+    'q','z','.','c','o','m',0,
+    'g','o','t','o','w','e','b','i','n','a','r','.','c','o','m',0,
+    'w','i','k','i','a','.','c','o','m',0,
+    'f','c','2','.','c','o','m',0,
+    'g','o','o','g','l','e','a','p','i','s','.','c','o','m',0,
+    'i','k','e','a','.','c','o','m',0,
+    'b','i','l','i','b','i','l','i','.','c','o','m',0,
+    'b','o','x','.','c','o','m',0,
+    's','c','i','e','n','c','e','.','o','r','g',0,
+    'c','e','n','s','u','s','.','g','o','v',0,
+    'u','i','u','c','.','e','d','u',0,
+    'b','l','s','.','g','o','v',0,
+    'g','a','r','t','n','e','r','.','c','o','m',0,
+    'h','i','l','t','o','n','.','c','o','m',0,
+    'l','i','v','e','s','c','i','e','n','c','e','.','c','o','m',0,
+    'm','e','d','i','c','a','l','n','e','w','s','t','o','d','a','y','.','c','o','m',0,
+    'a','c','s','.','o','r','g',0,
+    's','t','r','i','p','e','.','c','o','m',0,
+    'h','u','a','w','e','i','.','c','o','m',0,
+    'a','p','p','s','p','o','t','.','c','o','m',0,
+    's','e','n','a','t','e','.','g','o','v',0,
+    'g','e','t','p','o','c','k','e','t','.','c','o','m',0,
+    'u','s','g','s','.','g','o','v',0,
+    'h','o','w','s','t','u','f','f','w','o','r','k','s','.','c','o','m',0,
+    'a','l','i','e','x','p','r','e','s','s','.','c','o','m',0,
+    'h','h','s','.','g','o','v',0,
+    'u','s','c','.','e','d','u',0,
+    'u','n','i','c','e','f','.','o','r','g',0,
+    'f','o','r','c','e','.','c','o','m',0,
+    'k','i','e','v','.','u','a',0,
+    'b','a','r','n','e','s','a','n','d','n','o','b','l','e','.','c','o','m',0,
+    'p','u','r','d','u','e','.','e','d','u',0,
+    'w','i','t','h','g','o','o','g','l','e','.','c','o','m',0,
+    'q','c','.','c','a',0,
+    'n','y','u','.','e','d','u',0,
+    'c','b','s','l','o','c','a','l','.','c','o','m',0,
+    'n','i','s','t','.','g','o','v',0,
+    'g','o','b','.','m','x',0,
+    'o','n','.','c','a',0,
+    'r','t','.','c','o','m',0,
+    'v','a','r','i','e','t','y','.','c','o','m',0,
+    'm','i','c','r','o','s','o','f','t','o','n','l','i','n','e','.','c','o','m',0,
+    'a','l','t','e','r','v','i','s','t','a','.','o','r','g',0,
+    'a','l','j','a','z','e','e','r','a','.','c','o','m',0,
+    'g','l','o','b','e','n','e','w','s','w','i','r','e','.','c','o','m',0,
+    't','e','a','m','v','i','e','w','e','r','.','c','o','m',0,
+    'g','o','v','t','.','n','z',0,
+    'p','o','l','i','t','i','c','o','.','c','o','m',0,
+    'r','o','l','l','i','n','g','s','t','o','n','e','.','c','o','m',0,
+    'n','e','j','m','.','o','r','g',0,
+    'g','o','o','g','l','e','b','l','o','g','.','c','o','m',0,
+    'c','o','u','r','s','e','r','a','.','o','r','g',0,
+    'e','f','f','.','o','r','g',0,
+    's','e','c','.','g','o','v',0,
+    'n','e','t','s','c','a','p','e','.','c','o','m',0,
+    's','t','a','c','k','e','x','c','h','a','n','g','e','.','c','o','m',0,
+    'e','v','e','r','n','o','t','e','.','c','o','m',0,
+    'e','l','p','a','i','s','.','c','o','m',0,
+    'd','a','n','.','c','o','m',0,
+    's','p','i','e','g','e','l','.','d','e',0,
+    'p','o','s','t','g','r','e','s','q','l','.','o','r','g',0,
+    'n','v','i','d','i','a','.','c','o','m',0,
+    'm','.','m','e',0,
+    'p','c','m','a','g','.','c','o','m',0,
+    'f','r','e','e','p','i','k','.','c','o','m',0,
+    's','l','a','c','k','.','c','o','m',0,
+    'm','a','t','t','e','r','p','o','r','t','.','c','o','m',0,
+    'e','s','p','n','.','c','o','m',0,
+    'm','i','t','r','e','.','o','r','g',0,
+    's','h','u','t','t','e','r','s','t','o','c','k','.','c','o','m',0,
+    'v','e','n','t','u','r','e','b','e','a','t','.','c','o','m',0,
+    'w','3','s','c','h','o','o','l','s','.','c','o','m',0,
+    'i','t','u','.','i','n','t',0,
+    'm','s','u','.','e','d','u',0,
+    'b','i','t','n','a','m','i','.','c','o','m',0,
+    'd','u','k','e','.','e','d','u',0,
+    'u','c','s','d','.','e','d','u',0,
+    'c','a','n','a','d','a','.','c','a',0,
+    'e','n','a','b','l','e','-','j','a','v','a','s','c','r','i','p','t','.','c','o','m',0,
+    'w','w','w','.','n','h','s','.','u','k',0,
+    's','o','.','c','o','m',0,
+    'm','y','s','t','r','i','k','i','n','g','l','y','.','c','o','m',0,
+    'a','i','r','b','n','b','.','c','o','m',0,
+    'h','i','s','t','o','r','y','.','c','o','m',0,
+    's','c','m','p','.','c','o','m',0,
+    'u','f','l','.','e','d','u',0,
+    'v','m','w','a','r','e','.','c','o','m',0,
+    'p','r','o','o','f','p','o','i','n','t','.','c','o','m',0,
+    'm','e','d','i','a','f','i','r','e','.','c','o','m',0,
+    'n','y','d','a','i','l','y','n','e','w','s','.','c','o','m',0,
+    'p','e','r','f','e','c','t','d','o','m','a','i','n','.','c','o','m',0,
+    't','i','m','e','a','n','d','d','a','t','e','.','c','o','m',0,
+    's','s','r','n','.','c','o','m',0,
+    'j','d','.','c','o','m',0,
+    'k','e','r','n','e','l','.','o','r','g',0,
+    's','k','y','.','c','o','m',0,
+    't','h','e','g','l','o','b','e','a','n','d','m','a','i','l','.','c','o','m',0,
+    'n','e','w','s','c','i','e','n','t','i','s','t','.','c','o','m',0,
+    'u','m','d','.','e','d','u',0,
+    'e','a','r','t','h','l','i','n','k','.','n','e','t',0,
+    'h','a','t','e','n','a','.','n','e','.','j','p',0,
+    'm','i','x','c','l','o','u','d','.','c','o','m',0,
+    'm','o','o','d','l','e','.','o','r','g',0,
+    'n','y','.','g','o','v',0,
+    'h','o','l','l','y','w','o','o','d','r','e','p','o','r','t','e','r','.','c','o','m',0,
+    't','e','c','h','t','a','r','g','e','t','.','c','o','m',0,
+    'u','n','c','.','e','d','u',0,
+    's','l','a','s','h','d','o','t','.','o','r','g',0,
+    't','h','e','h','i','l','l','.','c','o','m',0,
+    'd','o','t','.','g','o','v',0,
+    'w','i','n','d','o','w','s','.','n','e','t',0,
+    't','h','o','u','g','h','t','c','o','.','c','o','m',0,
+    'a','r','i','z','o','n','a','.','e','d','u',0,
+    'u','s','.','c','o','m',0,
+    'i','l','l','i','n','o','i','s','.','e','d','u',0,
+    'a','r','c','h','i','v','e','s','.','g','o','v',0,
+    'a','u','t','o','m','a','t','t','i','c','.','c','o','m',0,
+    'n','i','n','g','.','c','o','m',0,
+    'o','p','e','n','s','s','l','.','o','r','g',0,
+    'j','u','s','t','i','c','e','.','g','o','v',0,
+    'c','u','t','t','.','l','y',0,
+    'd','r','u','p','a','l','.','o','r','g',0,
+    'u','t','o','r','o','n','t','o','.','c','a',0,
+    'a','d','m','i','n','.','c','h',0,
+    'g','a','l','l','u','p','.','c','o','m',0,
+    'n','o','r','t','h','w','e','s','t','e','r','n','.','e','d','u',0,
+    'o','k','.','r','u',0,
+    'a','m','a','z','o','n','-','a','d','s','y','s','t','e','m','.','c','o','m',0,
+    'c','h','r','o','n','.','c','o','m',0,
+    't','h','e','m','e','i','s','l','e','.','c','o','m',0,
+    'j','a','v','a','.','c','o','m',0,
+    'p','w','c','.','c','o','m',0,
+    'p','a','r','a','l','l','e','l','s','.','c','o','m',0,
+    'f','r','e','e','b','s','d','.','o','r','g',0,
+    'i','n','s','t','r','u','c','t','a','b','l','e','s','.','c','o','m',0,
+    'w','e','a','t','h','e','r','.','c','o','m',0,
+    't','o','d','a','y','.','c','o','m',0,
+    'g','e','t','b','o','o','t','s','t','r','a','p','.','c','o','m',0,
+    'p','r','i','v','a','c','y','s','h','i','e','l','d','.','g','o','v',0,
+    's','m','i','t','h','s','o','n','i','a','n','m','a','g','.','c','o','m',0,
+    'n','i','k','e','.','c','o','m',0,
+    'l','i','f','e','h','a','c','k','e','r','.','c','o','m',0,
+    'a','s','u','.','e','d','u',0,
+    's','i','e','m','e','n','s','.','c','o','m',0,
+    'u','c','d','a','v','i','s','.','e','d','u',0,
+    'a','c','m','.','o','r','g',0,
+    't','e','c','h','r','a','d','a','r','.','c','o','m',0,
+    'p','h','y','s','.','o','r','g',0,
+    'n','a','v','e','r','.','c','o','m',0,
+    'i','a','n','a','.','o','r','g',0,
+    'w','e','b','e','x','.','c','o','m',0,
+    'j','o','o','m','l','a','.','o','r','g',0,
+    'n','i','k','k','e','i','.','c','o','m',0,
+    'l','w','w','.','c','o','m',0,
+    'f','c','c','.','g','o','v',0,
+    'u','d','e','m','y','.','c','o','m',0,
+    'l','i','b','s','y','n','.','c','o','m',0,
+    'a','n','g','e','l','f','i','r','e','.','c','o','m',0,
+    'f','b','c','d','n','.','n','e','t',0,
+    'a','p','a','c','h','e','f','r','i','e','n','d','s','.','o','r','g',0,
+    'n','y','m','a','g','.','c','o','m',0,
+    'c','o','n','g','r','e','s','s','.','g','o','v',0,
+    't','h','e','d','a','i','l','y','b','e','a','s','t','.','c','o','m',0,
+    'j','q','u','e','r','y','.','c','o','m',0,
+    'p','l','a','y','s','t','a','t','i','o','n','.','c','o','m',0,
+    't','e','c','h','n','o','l','o','g','y','r','e','v','i','e','w','.','c','o','m',0,
+    'p','r','e','z','i','.','c','o','m',0,
+    'w','o','o','c','o','m','m','e','r','c','e','.','c','o','m',0,
+    'f','o','u','r','s','q','u','a','r','e','.','c','o','m',0,
+    's','u','b','s','t','a','c','k','.','c','o','m',0,
+    'f','o','o','l','.','c','o','m',0,
+    'l','e','m','o','n','d','e','.','f','r',0,
+    't','r','e','a','s','u','r','y','.','g','o','v',0,
+    'o','v','e','r','-','b','l','o','g','.','c','o','m',0,
+    'i','m','a','g','e','s','h','a','c','k','.','u','s',0,
+    'a','t','l','a','s','s','i','a','n','.','c','o','m',0,
+    'i','g','n','.','c','o','m',0,
+    'b','o','s','t','o','n','.','c','o','m',0,
+    'u','s','a','.','g','o','v',0,
+    'd','i','g','i','t','a','l','t','r','e','n','d','s','.','c','o','m',0,
+    'e','u','r','o','n','e','w','s','.','c','o','m',0,
+    'd','i','c','t','i','o','n','a','r','y','.','c','o','m',0,
+    'o','w','.','l','y',0,
+    't','h','e','n','a','i','.','o','r','g',0,
+    'y','o','l','a','s','i','t','e','.','c','o','m',0,
+    's','n','a','p','c','h','a','t','.','c','o','m',0,
+    'e','n','e','r','g','y','.','g','o','v',0,
+    't','e','l','e','g','r','a','.','p','h',0,
+    'b','i','g','c','a','r','t','e','l','.','c','o','m',0,
+    'f','b','i','.','g','o','v',0,
+    'v','i','r','g','i','n','i','a','.','e','d','u',0,
+    'r','u','t','g','e','r','s','.','e','d','u',0,
+    'q','u','a','l','t','r','i','c','s','.','c','o','m',0,
+    'o','f','f','i','c','e','3','6','5','.','c','o','m',0,
+    'b','c','.','c','a',0,
+    'i','m','f','.','o','r','g',0,
+    'i','c','o','.','o','r','g','.','u','k',0,
+    'p','r','w','e','b','.','c','o','m',0,
+    'd','m','o','z','.','o','r','g',0,
+    'u','s','p','t','o','.','g','o','v',0,
+    'o','p','e','n','s','o','u','r','c','e','.','o','r','g',0,
+    'b','r','o','o','k','i','n','g','s','.','e','d','u',0,
+    'o','s','u','.','e','d','u',0,
+    'm','a','i','l','.','r','u',0,
+    'c','a','n','c','e','r','.','o','r','g',0,
+    'c','o','l','o','r','a','d','o','.','e','d','u',0,
+    'h','e','r','o','k','u','a','p','p','.','c','o','m',0,
+    't','a','r','g','e','t','.','c','o','m',0,
+    'w','u','f','o','o','.','c','o','m',0,
+    'u','b','c','.','c','a',0,
+    'z','e','n','d','.','c','o','m',0,
+    'p','o','d','b','e','a','n','.','c','o','m',0,
+    'm','o','z','.','c','o','m',0,
+    'p','e','o','p','l','e','.','c','o','m',0,
+    'k','d','e','.','o','r','g',0,
+    'b','o','s','t','o','n','g','l','o','b','e','.','c','o','m',0,
+    'k','h','a','n','a','c','a','d','e','m','y','.','o','r','g',0,
+    'n','a','s','d','a','q','.','c','o','m',0,
+    't','h','e','r','e','g','i','s','t','e','r','.','c','o','m',0,
+    'a','r','m','y','.','m','i','l',0,
+    'u','b','e','r','.','c','o','m',0,
+    't','w','i','m','g','.','c','o','m',0,
+    'u','r','b','a','n','d','i','c','t','i','o','n','a','r','y','.','c','o','m',0,
+    't','h','e','f','r','e','e','d','i','c','t','i','o','n','a','r','y','.','c','o','m',0,
+    's','a','p','.','c','o','m',0,
+    'i','s','.','g','d',0,
+    'z','h','i','h','u','.','c','o','m',0,
+    'g','u','t','e','n','b','e','r','g','.','o','r','g',0,
+    't','a','m','u','.','e','d','u',0,
+    'f','a','q','s','.','o','r','g',0,
+    'p','e','r','l','.','o','r','g',0,
+    't','m','a','l','l','.','c','o','m',0,
+    'b','u','.','e','d','u',0,
+    'v','a','.','g','o','v',0,
+    'v','e','r','i','s','i','g','n','.','c','o','m',0,
+    'i','c','i','o','.','u','s',0,
+    'm','e','d','s','c','a','p','e','.','c','o','m',0,
+    'a','t','t','.','c','o','m',0,
+    'l','o','n','e','l','y','p','l','a','n','e','t','.','c','o','m',0,
+    'd','r','o','p','c','a','t','c','h','.','c','o','m',0,
+    'f','e','d','o','r','a','p','r','o','j','e','c','t','.','o','r','g',0,
+    'b','u','n','d','.','d','e',0,
+    'f','i','v','e','r','r','.','c','o','m',0,
+    'u','s','e','m','b','a','s','s','y','.','g','o','v',0,
+    'd','o','l','.','g','o','v',0,
+    's','y','m','a','n','t','e','c','.','c','o','m',0,
+    't','h','e','m','e','g','r','i','l','l','.','c','o','m',0,
+    'd','h','s','.','g','o','v',0,
+    'm','l','b','.','c','o','m',0,
+    't','h','e','n','e','x','t','w','e','b','.','c','o','m',0,
+    'h','e','a','r','t','.','o','r','g',0,
+    's','e','m','a','n','t','i','c','s','c','h','o','l','a','r','.','o','r','g',0,
+    't','h','e','s','t','a','r','.','c','o','m',0,
+    'a','d','w','e','e','k','.','c','o','m',0,
+    's','a','l','o','n','.','c','o','m',0,
+    'm','a','p','q','u','e','s','t','.','c','o','m',0,
+    'r','s','6','.','n','e','t',0,
+    'r','f','c','-','e','d','i','t','o','r','.','o','r','g',0,
+    'l','i','v','e','s','t','r','e','a','m','.','c','o','m',0,
+    'n','b','a','.','c','o','m',0,
+    'u','n','d','p','.','o','r','g',0,
+    'g','a','m','e','s','p','o','t','.','c','o','m',0,
+    'c','e','l','l','.','c','o','m',0,
+    'i','c','a','n','n','.','o','r','g',0,
+    'm','i','c','r','o','f','o','c','u','s','.','c','o','m',0,
+    'n','d','t','v','.','c','o','m',0,
+    's','p','b','.','r','u',0,
+    'c','r','u','n','c','h','b','a','s','e','.','c','o','m',0,
+    'b','l','o','g','.','g','o','o','g','l','e',0,
+    'm','e','d','l','i','n','e','p','l','u','s','.','g','o','v',0,
+    'h','o','u','z','z','.','c','o','m',0,
+    'w','u','s','t','l','.','e','d','u',0,
+    'a','u','t','o','d','e','s','k','.','c','o','m',0,
+    'n','e','t','d','n','a','-','s','s','l','.','c','o','m',0,
+    'a','l','e','x','a','.','c','o','m',0,
+    'e','u','r','e','k','a','l','e','r','t','.','o','r','g',0,
+    'c','o','n','s','u','m','e','r','r','e','p','o','r','t','s','.','o','r','g',0,
+    's','c','h','n','e','i','e','r','.','c','o','m',0,
+    'v','a','n','i','t','y','f','a','i','r','.','c','o','m',0,
+    'a','c','c','e','n','t','u','r','e','.','c','o','m',0,
+    'x','b','o','x','.','c','o','m',0,
+    'e','y','.','c','o','m',0,
+    'i','h','e','a','r','t','.','c','o','m',0,
+    'u','s','t','r','e','a','m','.','t','v',0,
+    'h','o','o','t','s','u','i','t','e','.','c','o','m',0,
+    'd','i','g','i','t','a','l','.','c','o','m',0,
+    'd','i','s','c','o','v','e','r','y','.','c','o','m',0,
+    'l','a','s','t','.','f','m',0,
+    'v','e','r','i','z','o','n','.','c','o','m',0,
+    'n','c','s','u','.','e','d','u',0,
+    'g','m','a','i','l','.','c','o','m',0,
+    'l','e','n','o','v','o','.','c','o','m',0,
+    'i','n','d','i','a','n','a','.','e','d','u',0,
+    's','t','e','a','m','c','o','m','m','u','n','i','t','y','.','c','o','m',0,
+    'f','l','i','c','.','k','r',0,
+    'e','t','h','z','.','c','h',0,
+    'm','e','r','c','u','r','y','n','e','w','s','.','c','o','m',0,
+    'l','n','k','d','.','i','n',0,
+    'j','i','m','d','o','f','r','e','e','.','c','o','m',0,
+    'g','r','e','e','n','p','e','a','c','e','.','o','r','g',0,
+    't','e','x','a','s','.','g','o','v',0,
+    'f','e','e','d','l','y','.','c','o','m',0,
+    'v','o','a','n','e','w','s','.','c','o','m',0,
+    'c','p','a','n','.','o','r','g',0,
+    'n','y','c','.','g','o','v',0,
+    'o','x','f','o','r','d','j','o','u','r','n','a','l','s','.','o','r','g',0,
+    'i','r','i','s','h','t','i','m','e','s','.','c','o','m',0,
+    'p','c','w','o','r','l','d','.','c','o','m',0,
+    's','m','u','g','m','u','g','.','c','o','m',0,
+    't','u','f','t','s','.','e','d','u',0,
+    'e','a','.','c','o','m',0,
+    'c','o','e','.','i','n','t',0,
+    'n','a','v','y','.','m','i','l',0,
+    's','b','a','.','g','o','v',0,
+    'n','o','k','i','a','.','c','o','m',0,
+    'u','t','a','h','.','e','d','u',0,
+    'n','o','v','e','l','l','.','c','o','m',0,
+    'i','o','p','.','o','r','g',0,
+    'i','l','o','.','o','r','g',0,
+    'l','e','t','s','e','n','c','r','y','p','t','.','o','r','g',0,
+    'c','c','t','v','.','c','o','m',0,
+    'w','e','b','.','d','e','v',0,
+    'b','r','o','a','d','c','o','m','.','c','o','m',0,
+    'a','c','c','u','w','e','a','t','h','e','r','.','c','o','m',0,
+    'p','i','t','t','.','e','d','u',0,
+    'b','i','l','l','b','o','a','r','d','.','c','o','m',0,
+    'i','h','g','.','c','o','m',0,
+    'f','r','a','n','c','e','2','4','.','c','o','m',0,
+    's','e','a','t','t','l','e','t','i','m','e','s','.','c','o','m',0,
+    'p','a','s','t','e','b','i','n','.','c','o','m',0,
+    '1','6','8','8','.','c','o','m',0,
+    'i','n','s','i','d','e','r','.','c','o','m',0,
+    'g','l','o','b','o','.','c','o','m',0,
+    'g','l','o','b','a','l','n','e','w','s','.','c','a',0,
+    'p','b','a','s','e','.','c','o','m',0,
+    'h','y','a','t','t','.','c','o','m',0,
+    'c','o','o','k','i','e','d','a','t','a','b','a','s','e','.','o','r','g',0,
+    'u','s','p','s','.','c','o','m',0,
+    'b','i','t','b','u','c','k','e','t','.','o','r','g',0,
+    'b','u','s','i','n','e','s','s','w','e','e','k','.','c','o','m',0,
+    'w','u','n','d','e','r','g','r','o','u','n','d','.','c','o','m',0,
+    'z','o','h','o','.','c','o','m',0,
+    'c','o','m','p','u','t','e','r','w','o','r','l','d','.','c','o','m',0,
+    'c','o','l','o','r','l','i','b','.','c','o','m',0,
+    'a','a','r','p','.','o','r','g',0,
+    'c','r','a','i','g','s','l','i','s','t','.','o','r','g',0,
+    'u','c','s','b','.','e','d','u',0,
+    'c','y','g','w','i','n','.','c','o','m',0,
+    'g','l','a','s','s','d','o','o','r','.','c','o','m',0,
+    'g','a','r','m','i','n','.','c','o','m',0,
+    'f','r','o','n','t','i','e','r','.','c','o','m',0,
+    'b','e','s','t','b','u','y','.','c','o','m',0,
+    'h','a','x','x','.','s','e',0,
+    'p','a','t','c','h','.','c','o','m',0,
+    'l','e','g','o','.','c','o','m',0,
+    'a','s','u','s','.','c','o','m',0,
+    'n','o','b','e','l','p','r','i','z','e','.','o','r','g',0,
+    'd','u','c','k','d','u','c','k','g','o','.','c','o','m',0,
+    'f','i','f','a','.','c','o','m',0,
+    'a','m','e','b','l','o','.','j','p',0,
+    'z','i','l','l','o','w','.','c','o','m',0,
+    'g','e','o','r','g','e','t','o','w','n','.','e','d','u',0,
+    'h','r','w','.','o','r','g',0,
+    'c','i','a','.','g','o','v',0,
+    'c','u','r','l','.','s','e',0,
+    'v','i','s','u','a','l','s','t','u','d','i','o','.','c','o','m',0,
+    'n','i','c','.','i','n',0,
+    'p','h','p','b','b','.','c','o','m',0,
+    'd','e','a','d','l','i','n','e','.','c','o','m',0,
+    'c','t','v','n','e','w','s','.','c','a',0,
+    'v','o','g','u','e','.','c','o','m',0,
+    'g','i','t','-','s','c','m','.','c','o','m',0,
+    's','e','e','k','i','n','g','a','l','p','h','a','.','c','o','m',0,
+    'u','d','e','l','.','e','d','u',0,
+    'o','s','h','a','.','g','o','v',0,
+    'f','e','m','a','.','g','o','v',0,
+    'w','a','s','h','i','n','g','t','o','n','t','i','m','e','s','.','c','o','m',0,
+    'g','u','m','r','o','a','d','.','c','o','m',0,
+    'f','e','d','e','x','.','c','o','m',0,
+    's','n','o','p','e','s','.','c','o','m',0,
+    'l','e','f','i','g','a','r','o','.','f','r',0,
+    'i','s','t','o','c','k','p','h','o','t','o','.','c','o','m',0,
+    'g','e','t','t','y','i','m','a','g','e','s','.','c','o','m',0,
+    'l','i','s','t','-','m','a','n','a','g','e','1','.','c','o','m',0,
+    'd','i','s','n','e','y','.','c','o','m',0,
+    's','o','n','y','.','c','o','m',0,
+    'f','o','o','d','n','e','t','w','o','r','k','.','c','o','m',0,
+    'v','t','.','e','d','u',0,
+    'm','i','a','m','i','h','e','r','a','l','d','.','c','o','m',0,
+    'a','m','e','r','i','c','a','n','e','x','p','r','e','s','s','.','c','o','m',0,
+    'o','p','e','n','l','d','a','p','.','o','r','g',0,
+    'd','o','u','b','a','n','.','c','o','m',0,
+    'i','b','t','i','m','e','s','.','c','o','m',0,
+    'u','p','s','.','c','o','m',0,
+    'n','e','i','l','p','a','t','e','l','.','c','o','m',0,
+    'h','u','b','p','a','g','e','s','.','c','o','m',0,
+    'p','r','e','s','t','a','s','h','o','p','.','c','o','m',0,
+    'w','o','r','l','d','o','m','e','t','e','r','s','.','i','n','f','o',0,
+    'f','o','x','b','u','s','i','n','e','s','s','.','c','o','m',0,
+    'i','p','c','c','.','c','h',0,
+    'f','i','n','d','l','a','w','.','c','o','m',0,
+    '3','6','0','.','c','n',0,
+    '5','0','0','p','x','.','c','o','m',0,
+    't','e','c','h','r','e','p','u','b','l','i','c','.','c','o','m',0,
+    'b','r','o','w','n','.','e','d','u',0,
+    's','t','i','t','c','h','e','r','.','c','o','m',0,
+    'o','h','c','h','r','.','o','r','g',0,
+    'c','l','e','v','e','l','a','n','d','c','l','i','n','i','c','.','o','r','g',0,
+    'a','p','.','o','r','g',0,
+    's','p','e','e','d','t','e','s','t','.','n','e','t',0,
+    'h','a','w','a','i','i','.','e','d','u',0,
+    'r','e','f','e','r','e','n','c','e','.','c','o','m',0,
+    'r','e','d','c','r','o','s','s','.','o','r','g',0,
+    'n','i','e','l','s','e','n','.','c','o','m',0,
+    't','h','e','b','a','l','a','n','c','e','.','c','o','m',0,
+    'j','p','o','s','t','.','c','o','m',0,
+    'a','n','s','w','e','r','s','.','c','o','m',0,
+    'n','a','r','o','d','.','r','u',0,
+    'c','c','c','.','d','e',0,
+    'c','u','n','y','.','e','d','u',0,
+    't','e','n','c','e','n','t','.','c','o','m',0,
+    'i','n','d','i','a','n','e','x','p','r','e','s','s','.','c','o','m',0,
+    'c','l','i','n','i','c','a','l','t','r','i','a','l','s','.','g','o','v',0,
+    's','p','a','c','e','.','c','o','m',0,
+    's','p','r','e','a','k','e','r','.','c','o','m',0,
+    'c','a','l','t','e','c','h','.','e','d','u',0,
+    'a','c','c','o','r','.','c','o','m',0,
+    'g','v','.','a','t',0,
+    'p','a','n','a','s','o','n','i','c','.','c','o','m',0,
+    'h','i','n','d','u','s','t','a','n','t','i','m','e','s','.','c','o','m',0,
+    'y','u','m','p','u','.','c','o','m',0,
+    's','e','c','u','r','i','t','y','f','o','c','u','s','.','c','o','m',0,
+    'r','e','d','b','u','l','l','.','c','o','m',0,
+    'a','m','d','.','c','o','m',0,
+    'e','u','.','c','o','m',0,
+    'u','n','l','.','e','d','u',0,
+    '1','d','r','v','.','m','s',0,
+    't','x','.','u','s',0,
+    'l','i','v','e','i','n','t','e','r','n','e','t','.','r','u',0,
+    't','i','m','e','o','u','t','.','c','o','m',0,
+    'o','r','c','i','d','.','o','r','g',0,
+    'a','x','i','o','s','.','c','o','m',0,
+    'v','a','n','d','e','r','b','i','l','t','.','e','d','u',0,
+    'm','e','t','m','u','s','e','u','m','.','o','r','g',0,
+    'o','r','e','g','o','n','s','t','a','t','e','.','e','d','u',0,
+    's','t','a','r','t','r','i','b','u','n','e','.','c','o','m',0,
+    'm','p','g','.','d','e',0,
+    'v','a','t','i','c','a','n','.','v','a',0,
+    'i','b','b','.','c','o',0,
+    'k','a','s','p','e','r','s','k','y','.','c','o','m',0,
+    'e','s','q','u','i','r','e','.','c','o','m',0,
+    'o','l','y','m','p','i','c','s','.','c','o','m',0,
+    'w','o','r','l','d','c','a','t','.','o','r','g',0,
+    'm','e','d','i','a','w','i','k','i','.','o','r','g',0,
+    'a','k','a','m','a','i','h','d','.','n','e','t',0,
+    'd','i','i','g','o','.','c','o','m',0,
+    's','s','a','.','g','o','v',0,
+    'h','o','p','k','i','n','s','m','e','d','i','c','i','n','e','.','o','r','g',0,
+    'c','a','n','i','u','s','e','.','c','o','m',0,
+    'e','h','o','w','.','c','o','m',0,
+    'm','s','n','b','c','.','c','o','m',0,
+    'a','t','h','e','m','e','s','.','c','o','m',0,
+    'g','o','o','d','h','o','u','s','e','k','e','e','p','i','n','g','.','c','o','m',0,
+    'w','i','p','o','.','i','n','t',0,
+    'h','a','t','e','n','a','b','l','o','g','.','c','o','m',0,
+    'e','l','s','e','v','i','e','r','h','e','a','l','t','h','.','c','o','m',0,
+    'e','s','a','.','i','n','t',0,
+    'g','a','t','e','c','h','.','e','d','u',0,
+    'r','o','t','t','e','n','t','o','m','a','t','o','e','s','.','c','o','m',0,
+    'h','o','w','t','o','g','e','e','k','.','c','o','m',0,
+    'c','o','s','m','o','p','o','l','i','t','a','n','.','c','o','m',0,
+    'p','o','p','s','c','i','.','c','o','m',0,
+    'l','g','.','c','o','m',0,
+    'w','i','k','i','s','o','u','r','c','e','.','o','r','g',0,
+    't','r','e','n','d','m','i','c','r','o','.','c','o','m',0,
+    'd','r','o','p','b','o','x','u','s','e','r','c','o','n','t','e','n','t','.','c','o','m',0,
+    'd','e','n','v','e','r','p','o','s','t','.','c','o','m',0,
+    'i','s','c','.','o','r','g',0,
+    'c','s','m','o','n','i','t','o','r','.','c','o','m',0,
+    'i','a','s','t','a','t','e','.','e','d','u',0,
+    'y','c','o','m','b','i','n','a','t','o','r','.','c','o','m',0,
+    't','h','e','h','i','n','d','u','.','c','o','m',0,
+    'd','e','e','z','e','r','.','c','o','m',0,
+    'b','u','z','z','f','e','e','d','n','e','w','s','.','c','o','m',0,
+    'c','s','d','n','.','n','e','t',0,
+    'p','h','i','l','i','p','s','.','c','o','m',0,
+    'u','p','w','o','r','k','.','c','o','m',0,
+    'f','o','r','e','i','g','n','p','o','l','i','c','y','.','c','o','m',0,
+    'm','n','.','u','s',0,
+    't','a','b','l','e','a','u','.','c','o','m',0,
+    'u','g','a','.','e','d','u',0,
+    'e','l','l','e','.','c','o','m',0,
+    'v','e','r','y','w','e','l','l','m','i','n','d','.','c','o','m',0,
+    'm','c','g','i','l','l','.','c','a',0,
+    'm','s','d','n','.','c','o','m',0,
+    'a','s','a','h','i','.','c','o','m',0,
+    'f','l','i','p','b','o','a','r','d','.','c','o','m',0,
+    'a','t','l','a','s','o','b','s','c','u','r','a','.','c','o','m',0,
+    'u','i','o','w','a','.','e','d','u',0,
+    'm','t','v','.','c','o','m',0,
+    'c','a','l','a','m','e','o','.','c','o','m',0,
+    'w','i','k','i','b','o','o','k','s','.','o','r','g',0,
+    'g','i','m','p','.','o','r','g',0,
+    'c','o','l','o','s','t','a','t','e','.','e','d','u',0,
+    'o','u','r','w','o','r','l','d','i','n','d','a','t','a','.','o','r','g',0,
+    'r','o','c','h','e','s','t','e','r','.','e','d','u',0,
+    'b','i','b','l','e','g','a','t','e','w','a','y','.','c','o','m',0,
+    'o','b','s','e','r','v','e','r','.','c','o','m',0,
+    'w','i','k','i','d','o','t','.','c','o','m',0,
+    't','h','o','m','s','o','n','r','e','u','t','e','r','s','.','c','o','m',0,
+    'h','o','m','e','d','e','p','o','t','.','c','o','m',0,
+    'g','e','n','e','r','a','t','e','p','r','e','s','s','.','c','o','m',0,
+    'o','p','e','n','o','f','f','i','c','e','.','o','r','g',0,
+    'm','c','a','f','e','e','.','c','o','m',0,
+    'p','o','p','u','l','a','r','m','e','c','h','a','n','i','c','s','.','c','o','m',0,
+    's','q','u','a','r','e','u','p','.','c','o','m',0,
+    'u','m','a','s','s','.','e','d','u',0,
+    'u','c','s','f','.','e','d','u',0,
+    'a','m','n','e','s','t','y','.','o','r','g',0,
+    'n','j','.','c','o','m',0,
+    'e','n','v','a','t','o','.','m','a','r','k','e','t',0,
+    'b','u','s','t','l','e','.','c','o','m',0,
+    'a','l','l','r','e','c','i','p','e','s','.','c','o','m',0,
+    'w','e','t','r','a','n','s','f','e','r','.','c','o','m',0,
+    'f','l','i','p','h','t','m','l','5','.','c','o','m',0,
+    'b','e','l','l','-','l','a','b','s','.','c','o','m',0,
+    'l','u','a','.','o','r','g',0,
+    'w','e','l','t','.','d','e',0,
+    's','f','u','.','c','a',0,
+    'f','i','l','e','s','u','s','r','.','c','o','m',0,
+    't','i','n','y','p','i','c','.','c','o','m',0,
+    'd','a','l','l','a','s','n','e','w','s','.','c','o','m',0,
+    'n','o','d','e','j','s','.','o','r','g',0,
+    'e','d','x','.','o','r','g',0,
+    'a','f','.','m','i','l',0,
+    'u','s','f','.','e','d','u',0,
+    'r','e','v','e','r','b','n','a','t','i','o','n','.','c','o','m',0,
+    'j','u','s','t','i','a','.','c','o','m',0,
+    't','r','e','e','h','u','g','g','e','r','.','c','o','m',0,
+    'l','i','n','k','s','y','n','e','r','g','y','.','c','o','m',0,
+    'g','e','n','i','u','s','.','c','o','m',0,
+    'u','p','i','.','c','o','m',0,
+    'm','a','n','7','.','o','r','g',0,
+    'e','w','.','c','o','m',0,
+    'd','e','f','e','n','s','e','.','g','o','v',0,
+    'a','z','c','e','n','t','r','a','l','.','c','o','m',0,
+    's','e','a','r','c','h','e','n','g','i','n','e','l','a','n','d','.','c','o','m',0,
+    'd','i','s','c','o','g','s','.','c','o','m',0,
+    'r','s','c','.','o','r','g',0,
+    'h','i','n','d','a','w','i','.','c','o','m',0,
+    'y','p','.','t','o',0,
+    'u','s','c','o','u','r','t','s','.','g','o','v',0,
+    'r','e','p','u','b','b','l','i','c','a','.','i','t',0,
+    's','t','a','t','i','c','f','l','i','c','k','r','.','c','o','m',0,
+    'w','s','u','.','e','d','u',0,
+    'c','o','i','n','d','e','s','k','.','c','o','m',0,
+    't','m','z','.','c','o','m',0,
+    'c','v','e','n','t','.','c','o','m',0,
+    's','h','u','t','t','e','r','f','l','y','.','c','o','m',0,
+    't','e','s','l','a','.','c','o','m',0,
+    'l','i','f','e','w','i','r','e','.','c','o','m',0,
+    '0','0','0','w','e','b','h','o','s','t','a','p','p','.','c','o','m',0,
+    'i','n','s','t','r','u','c','t','u','r','e','.','c','o','m',0,
+    's','e','m','r','u','s','h','.','c','o','m',0,
+    't','i','m','e','w','e','b','.','r','u',0,
+    'x','k','c','d','.','c','o','m',0,
+    'd','i','g','i','t','a','l','o','c','e','a','n','.','c','o','m',0,
+    't','h','a','w','t','e','.','c','o','m',0,
+    'w','p','a','s','t','r','a','.','c','o','m',0,
+    'd','e','l','i','c','i','o','u','s','.','c','o','m',0,
+    'h','o','m','e','s','t','e','a','d','.','c','o','m',0,
+    'g','w','u','.','e','d','u',0,
+    'm','e','n','t','a','l','f','l','o','s','s','.','c','o','m',0,
+    's','c','o','o','p','.','i','t',0,
+    'n','a','t','i','o','n','a','l','p','o','s','t','.','c','o','m',0,
+    't','i','m','e','s','o','f','i','s','r','a','e','l','.','c','o','m',0,
+    'f','e','d','e','r','a','l','r','e','g','i','s','t','e','r','.','g','o','v',0,
+    'w','i','r','e','s','h','a','r','k','.','o','r','g',0,
+    's','t','r','a','i','t','s','t','i','m','e','s','.','c','o','m',0,
+    'i','u','b','e','n','d','a','.','c','o','m',0,
+    'a','s','s','o','.','f','r',0,
+    'n','f','l','.','c','o','m',0,
+    'h','b','s','.','e','d','u',0,
+    's','q','u','a','r','e','.','s','i','t','e',0,
+    'e','i','a','.','g','o','v',0,
+    'p','i','n','i','m','g','.','c','o','m',0,
+    't','i','n','y','.','c','c',0,
+    'm','a','c','.','c','o','m',0,
+    'v','i','d','e','o','l','a','n','.','o','r','g',0,
+    'c','d','n','i','n','s','t','a','g','r','a','m','.','c','o','m',0,
+    'g','p','o','.','g','o','v',0,
+    'b','o','u','t','e','l','l','.','c','o','m',0,
+    'i','n','q','u','i','r','e','r','.','c','o','m',0,
+    'e','a','t','e','r','.','c','o','m',0,
+    'n','p','m','j','s','.','c','o','m',0,
+    'b','o','r','e','d','p','a','n','d','a','.','c','o','m',0,
+    'b','l','a','c','k','b','e','r','r','y','.','c','o','m',0,
+    'n','a','p','.','e','d','u',0,
+    's','q','u','i','d','-','c','a','c','h','e','.','o','r','g',0,
+    'c','a','m','p','a','i','g','n','-','a','r','c','h','i','v','e','.','c','o','m',0,
+    'f','e','d','e','r','a','l','r','e','s','e','r','v','e','.','g','o','v',0,
+    'a','m','a','-','a','s','s','n','.','o','r','g',0,
+    'n','t','p','.','o','r','g',0,
+    't','o','u','t','i','a','o','.','c','o','m',0,
+    'f','l','i','p','s','n','a','c','k','.','c','o','m',0,
+    'b','a','l','t','i','m','o','r','e','s','u','n','.','c','o','m',0,
+    'w','a','r','n','e','r','b','r','o','s','.','c','o','m',0,
+    's','e','a','r','c','h','e','n','g','i','n','e','j','o','u','r','n','a','l','.','c','o','m',0,
+    'c','w','i','.','n','l',0,
+    'b','r','i','g','h','t','c','o','v','e','.','n','e','t',0,
+    'm','a','c','r','u','m','o','r','s','.','c','o','m',0,
+    's','o','p','h','o','s','.','c','o','m',0,
+    'p','e','n','g','u','i','n','r','a','n','d','o','m','h','o','u','s','e','.','c','o','m',0,
+    'w','a','m','p','s','e','r','v','e','r','.','c','o','m',0,
+    'a','m','p','p','r','o','j','e','c','t','.','o','r','g',0,
+    'r','a','s','p','b','e','r','r','y','p','i','.','o','r','g',0,
+    'n','b','c','.','c','o','m',0,
+    'u','n','h','c','r','.','o','r','g',0,
+    'p','u','r','l','.','o','r','g',0,
+    's','k','e','t','c','h','f','a','b','.','c','o','m',0,
+    'o','l','y','m','p','i','c','.','o','r','g',0,
+    'm','e','d','i','c','i','n','e','n','e','t','.','c','o','m',0,
+    'k','n','o','w','y','o','u','r','m','e','m','e','.','c','o','m',0,
+    'g','m','u','.','e','d','u',0,
+    's','u','n','t','i','m','e','s','.','c','o','m',0,
+    'c','h','i','n','a','n','e','w','s','.','c','o','m',0,
+    'o','r','e','g','o','n','l','i','v','e','.','c','o','m',0,
+    'p','o','p','s','u','g','a','r','.','c','o','m',0,
+    'b','u','f','f','e','r','.','c','o','m',0,
+    'i','t','v','.','c','o','m',0,
+    'f','s','u','.','e','d','u',0,
+    'c','h','a','n','n','e','l','4','.','c','o','m',0,
+    't','h','e','s','p','r','u','c','e','.','c','o','m',0,
+    'j','u','s','t','g','i','v','i','n','g','.','c','o','m',0,
+    't','h','i','n','g','i','v','e','r','s','e','.','c','o','m',0,
+    'x','e','.','c','o','m',0,
+    'f','o','r','d','.','c','o','m',0,
+    'f','r','e','e','p','.','c','o','m',0,
+    's','o','f','t','p','e','d','i','a','.','c','o','m',0,
+    'r','i','c','e','.','e','d','u',0,
+    'm','e','g','a','.','n','z',0,
+    'l','i','f','e','h','a','c','k','.','o','r','g',0,
+    'b','y','u','.','e','d','u',0,
+    'a','v','a','s','t','.','c','o','m',0,
+    'h','e','i','s','e','.','d','e',0,
+    'a','h','a','j','o','u','r','n','a','l','s','.','o','r','g',0,
+    'f','a','a','.','g','o','v',0,
+    'm','a','s','s','.','g','o','v',0,
+    'e','o','n','l','i','n','e','.','c','o','m',0,
+    'w','a','w','.','p','l',0,
+    'r','e','f','i','n','e','r','y','2','9','.','c','o','m',0,
+    'n','e','w','s','.','c','n',0,
+    'p','o','l','y','g','o','n','.','c','o','m',0,
+    'u','n','f','c','c','c','.','i','n','t',0,
+    'z','l','i','b','.','n','e','t',0,
+    'i','n','v','e','s','t','i','n','g','.','c','o','m',0,
+    'b','o','i','n','g','b','o','i','n','g','.','n','e','t',0,
+    'u','n','e','p','.','o','r','g',0,
+    's','m','a','s','h','i','n','g','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    't','h','i','n','k','w','i','t','h','g','o','o','g','l','e','.','c','o','m',0,
+    'r','o','u','t','l','e','d','g','e','.','c','o','m',0,
+    'r','e','d','b','u','b','b','l','e','.','c','o','m',0,
+    'w','i','k','i','q','u','o','t','e','.','o','r','g',0,
+    'l','i','v','e','c','h','a','t','i','n','c','.','c','o','m',0,
+    'd','o','x','y','g','e','n','.','o','r','g',0,
+    'e','p','i','c','g','a','m','e','s','.','c','o','m',0,
+    'a','n','u','.','e','d','u','.','a','u',0,
+    'u','w','a','t','e','r','l','o','o','.','c','a',0,
+    'b','i','o','g','r','a','p','h','y','.','c','o','m',0,
+    'f','l','a','t','i','c','o','n','.','c','o','m',0,
+    'a','j','c','.','c','o','m',0,
+    'b','u','s','i','n','e','s','s','-','s','t','a','n','d','a','r','d','.','c','o','m',0,
+    'l','i','b','p','n','g','.','o','r','g',0,
+    'r','i','a','.','r','u',0,
+    't','r','a','v','e','l','a','n','d','l','e','i','s','u','r','e','.','c','o','m',0,
+    'n','d','.','e','d','u',0,
+    'b','a','n','k','r','a','t','e','.','c','o','m',0,
+    'd','a','r','t','m','o','u','t','h','.','e','d','u',0,
+    'h','e','x','u','n','.','c','o','m',0,
+    'n','o','r','t','o','n','.','c','o','m',0,
+    'w','a','t','t','p','a','d','.','c','o','m',0,
+    '4','s','h','a','r','e','d','.','c','o','m',0,
+    'c','o','i','n','b','a','s','e','.','c','o','m',0,
+    'h','a','r','d','e','n','e','d','-','p','h','p','.','n','e','t',0,
+    'w','e','b','n','o','d','e','.','c','o','m',0,
+    'e','m','a','r','k','e','t','e','r','.','c','o','m',0,
+    'h','p','e','.','c','o','m',0,
+    'h','u','l','u','.','c','o','m',0,
+    'e','x','a','m','i','n','e','r','.','c','o','m',0,
+    't','h','e','s','t','r','e','e','t','.','c','o','m',0,
+    's','u','e','d','d','e','u','t','s','c','h','e','.','d','e',0,
+    'n','i','n','t','e','n','d','o','.','c','o','m',0,
+    'j','i','a','t','h','i','s','.','c','o','m',0,
+    'h','o','m','e','.','b','l','o','g',0,
+    'f','u','j','i','t','s','u','.','c','o','m',0,
+    'p','c','r','e','.','o','r','g',0,
+    'h','m','.','c','o','m',0,
+    'm','i','s','s','o','u','r','i','.','e','d','u',0,
+    'n','b','e','r','.','o','r','g',0,
+    'g','z','i','p','.','o','r','g',0,
+    'a','d','a','g','e','.','c','o','m',0,
+    'u','n','a','m','.','m','x',0,
+    'n','s','f','.','g','o','v',0,
+    'm','i','.','c','o','m',0,
+    'm','e','m','c','a','c','h','e','d','.','o','r','g',0,
+    'u','r','l','d','e','f','e','n','s','e','.','c','o','m',0,
+    'f','l','.','u','s',0,
+    'c','m','s','.','g','o','v',0,
+    'w','e','b','f','l','o','w','.','i','o',0,
+    's','a','n','d','i','e','g','o','u','n','i','o','n','t','r','i','b','u','n','e','.','c','o','m',0,
+    'b','i','n','a','n','c','e','.','c','o','m',0,
+    'm','a','r','t','h','a','s','t','e','w','a','r','t','.','c','o','m',0,
+    'v','e','r','y','w','e','l','l','h','e','a','l','t','h','.','c','o','m',0,
+    'b','r','i','t','i','s','h','c','o','u','n','c','i','l','.','o','r','g',0,
+    'f','a','s','.','o','r','g',0,
+    'm','o','t','h','e','r','j','o','n','e','s','.','c','o','m',0,
+    'g','i','t','h','u','b','u','s','e','r','c','o','n','t','e','n','t','.','c','o','m',0,
+    'e','c','-','l','y','o','n','.','f','r',0,
+    't','i','c','k','e','t','m','a','s','t','e','r','.','c','o','m',0,
+    'h','b','o','.','c','o','m',0,
+    'm','o','m','a','.','o','r','g',0,
+    'e','v','e','r','y','d','a','y','h','e','a','l','t','h','.','c','o','m',0,
+    'z','e','i','t','.','d','e',0,
+    'n','i','f','t','y','.','c','o','m',0,
+    'm','i','c','h','i','g','a','n','.','g','o','v',0,
+    'i','e','a','.','o','r','g',0,
+    's','c','h','.','i','d',0,
+    's','p','u','t','n','i','k','n','e','w','s','.','c','o','m',0,
+    'l','o','g','i','t','e','c','h','.','c','o','m',0,
+    's','c','h','o','l','a','s','t','i','c','.','c','o','m',0,
+    'n','e','t','l','i','f','y','.','a','p','p',0,
+    'e','l','m','u','n','d','o','.','e','s',0,
+    'c','e','r','n','.','c','h',0,
+    'o','n','l','a','m','p','.','c','o','m',0,
+    'n','h','l','.','c','o','m',0,
+    'c','e','n','t','o','s','.','o','r','g',0,
+    'c','u','s','t','h','e','l','p','.','c','o','m',0,
+    's','t','a','r','b','u','c','k','s','.','c','o','m',0,
+    'd','h','l','.','c','o','m',0,
+    'g','s','t','a','t','i','c','.','c','o','m',0,
+    'i','q','i','y','i','.','c','o','m',0,
+    'b','u','f','f','a','l','o','.','e','d','u',0,
+    'u','e','f','a','.','c','o','m',0,
+    'p','e','a','t','i','x','.','c','o','m',0,
+    'a','p','a','c','h','e','l','o','u','n','g','e','.','c','o','m',0,
+    'l','i','v','e','s','t','r','o','n','g','.','c','o','m',0,
+    'a','c','l','u','.','o','r','g',0,
+    'c','o','i','n','m','a','r','k','e','t','c','a','p','.','c','o','m',0,
+    'g','q','.','c','o','m',0,
+    'o','n','e','l','i','n','k','.','m','e',0,
+    'n','e','r','d','w','a','l','l','e','t','.','c','o','m',0,
+    'p','a','g','e','.','l','i','n','k',0,
+    'p','r','o','p','u','b','l','i','c','a','.','o','r','g',0,
+    'f','r','e','e','t','y','p','e','.','o','r','g',0,
+    'h','a','a','r','e','t','z','.','c','o','m',0,
+    'x','m','l','s','o','f','t','.','o','r','g',0,
+    'a','r','d','u','i','n','o','.','c','c',0,
+    'r','e','a','l','t','o','r','.','c','o','m',0,
+    'a','u','d','i','b','l','e','.','c','o','m',0,
+    'u','o','r','e','g','o','n','.','e','d','u',0,
+    'l','u','l','u','.','c','o','m',0,
+    'm','l','i','v','e','.','c','o','m',0,
+    'b','a','r','r','o','n','s','.','c','o','m',0,
+    'f','r','e','e','w','e','b','s','.','c','o','m',0,
+    'p','o','s','t','-','g','a','z','e','t','t','e','.','c','o','m',0,
+    'w','e','b','d','a','v','.','o','r','g',0,
+    's','o','f','t','o','n','i','c','.','c','o','m',0,
+    'f','a','s','t','c','g','i','.','c','o','m',0,
+    'u','a','l','b','e','r','t','a','.','c','a',0,
+    'm','a','t','o','m','o','.','o','r','g',0,
+    'k','o','t','a','k','u','.','c','o','m',0,
+    'd','i','g','i','t','a','l','j','o','u','r','n','a','l','.','c','o','m',0,
+    'h','o','t','j','a','r','.','c','o','m',0,
+    'x','d','a','-','d','e','v','e','l','o','p','e','r','s','.','c','o','m',0,
+    'j','e','t','b','r','a','i','n','s','.','c','o','m',0,
+    'i','t','c','h','.','i','o',0,
+    't','u','n','e','i','n','.','c','o','m',0,
+    'e','n','l','i','g','h','t','e','n','m','e','n','t','.','o','r','g',0,
+    'b','l','u','e','h','o','s','t','.','c','o','m',0,
+    'm','o','d','s','e','c','u','r','i','t','y','.','o','r','g',0,
+    't','e','c','h','n','o','r','a','t','i','.','c','o','m',0,
+    'u','k','y','.','e','d','u',0,
+    'u','i','c','.','e','d','u',0,
+    'a','b','c','.','c','o','m',0,
+    's','e','r','v','e','r','w','a','t','c','h','.','c','o','m',0,
+    'l','i','v','e','m','i','n','t','.','c','o','m',0,
+    's','t','r','a','v','a','.','c','o','m',0,
+    'p','a','.','u','s',0,
+    'c','o','u','b','.','c','o','m',0,
+    'c','o','r','r','i','e','r','e','.','i','t',0,
+    'r','s','a','s','e','c','u','r','i','t','y','.','c','o','m',0,
+    'b','l','o','g','s','.','c','o','m',0,
+    'l','n','k','.','t','o',0,
+    's','e','l','f','.','c','o','m',0,
+    'h','o','t','e','l','s','.','c','o','m',0,
+    'c','o','u','n','t','e','r','p','a','n','e','.','c','o','m',0,
+    'c','t','.','g','o','v',0,
+    's','l','e','e','p','y','c','a','t','.','c','o','m',0,
+    'r','o','y','a','l','s','o','c','i','e','t','y','p','u','b','l','i','s','h','i','n','g','.','o','r','g',0,
+    'b','l','o','g','l','o','v','i','n','.','c','o','m',0,
+    'c','o','d','e','p','e','n','.','i','o',0,
+    'r','d','.','c','o','m',0,
+    'p','r','o','q','u','e','s','t','.','c','o','m',0,
+    'c','a','f','e','p','r','e','s','s','.','c','o','m',0,
+    'c','l','e','v','e','l','a','n','d','.','c','o','m',0,
+    'f','a','z','.','n','e','t',0,
+    'w','i','x','s','t','a','t','i','c','.','c','o','m',0,
+    'm','e','d','r','x','i','v','.','o','r','g',0,
+    'c','a','t','c','h','t','h','e','m','e','s','.','c','o','m',0,
+    'b','u','z','z','s','p','r','o','u','t','.','c','o','m',0,
+    'v','u','l','t','u','r','e','.','c','o','m',0,
+    'h','a','r','p','e','r','s','b','a','z','a','a','r','.','c','o','m',0,
+    'd','o','m','a','i','n','t','o','o','l','s','.','c','o','m',0,
+    'i','j','g','.','o','r','g',0,
+    'c','h','i','n','a','z','.','c','o','m',0,
+    'm','a','s','t','e','r','c','a','r','d','.','c','o','m',0,
+    's','e','c','u','r','e','s','e','r','v','e','r','.','n','e','t',0,
+    'u','b','i','s','o','f','t','.','c','o','m',0,
+    's','c','o','t','s','m','a','n','.','c','o','m',0,
+    'e','m','o','r','y','.','e','d','u',0,
+    'm','a','k','e','u','s','e','o','f','.','c','o','m',0,
+    's','i','t','e','1','2','3','.','m','e',0,
+    'i','n','f','o','g','r','a','m','.','c','o','m',0,
+    's','h','a','r','e','a','s','a','l','e','.','c','o','m',0,
+    'x','r','e','a','.','c','o','m',0,
+    'h','w','g','.','o','r','g',0,
+    't','h','e','i','n','t','e','r','c','e','p','t','.','c','o','m',0,
+    'd','i','s','c','o','r','d','a','p','p','.','c','o','m',0,
+    'w','a','s','s','e','n','a','a','r','.','o','r','g',0,
+    'w','a','s','h','i','n','g','t','o','n','e','x','a','m','i','n','e','r','.','c','o','m',0,
+    'a','r','c','h','d','a','i','l','y','.','c','o','m',0,
+    'c','o','d','e','c','a','d','e','m','y','.','c','o','m',0,
+    'p','a','d','l','e','t','.','c','o','m',0,
+    '3','m','.','c','o','m',0,
+    'm','o','n','s','t','e','r','.','c','o','m',0,
+    'c','b','s','s','p','o','r','t','s','.','c','o','m',0,
+    'v','i','s','a','.','c','o','m',0,
+    'a','l','i','c','d','n','.','c','o','m',0,
+    's','h','r','m','.','o','r','g',0,
+    'e','c','l','i','p','s','e','.','o','r','g',0,
+    'd','e','d','e','c','m','s','.','c','o','m',0,
+    't','a','s','s','.','r','u',0,
+    'd','m','c','a','.','c','o','m',0,
+    'p','d','f','l','i','b','.','c','o','m',0,
+    's','b','n','a','t','i','o','n','.','c','o','m',0,
+    't','o','m','s','h','a','r','d','w','a','r','e','.','c','o','m',0,
+    'l','i','n','.','e','e',0,
+    'p','p','.','u','a',0,
+    'f','r','e','e','t','d','s','.','o','r','g',0,
+    's','c','i','e','n','c','e','a','l','e','r','t','.','c','o','m',0,
+    'o','r','a','.','c','o','m',0,
+    'b','r','e','i','t','b','a','r','t','.','c','o','m',0,
+    'd','o','c','u','m','e','n','t','c','l','o','u','d','.','o','r','g',0,
+    'h','u','d','.','g','o','v',0,
+    'i','n','d','e','p','e','n','d','e','n','t','.','i','e',0,
+    'd','u','o','l','i','n','g','o','.','c','o','m',0,
+    'u','c','s','c','.','e','d','u',0,
+    'i','u','.','e','d','u',0,
+    'a','p','a','c','h','e','-','s','s','l','.','o','r','g',0,
+    's','f','c','h','r','o','n','i','c','l','e','.','c','o','m',0,
+    'p','r','e','s','s','r','e','a','d','e','r','.','c','o','m',0,
+    'l','e','g','a','c','y','.','c','o','m',0,
+    'u','h','.','e','d','u',0,
+    '9','t','o','5','m','a','c','.','c','o','m',0,
+    'f','o','n','t','a','w','e','s','o','m','e','.','c','o','m',0,
+    'd','y','n','d','n','s','.','o','r','g',0,
+    'o','h','i','o','.','g','o','v',0,
+    'w','e','b','t','h','i','n','g','.','c','o','m',0,
+    't','-','o','n','l','i','n','e','.','d','e',0,
+    'b','l','e','a','c','h','e','r','r','e','p','o','r','t','.','c','o','m',0,
+    't','w','i','t','p','i','c','.','c','o','m',0,
+    'c','o','d','e','p','l','e','x','.','c','o','m',0,
+    't','h','e','n','a','t','i','o','n','.','c','o','m',0,
+    'n','e','w','s','d','a','y','.','c','o','m',0,
+    'k','r','.','u','a',0,
+    'a','l','i','p','a','y','.','c','o','m',0,
+    'd','e','z','e','e','n','.','c','o','m',0,
+    's','p','e','c','b','e','n','c','h','.','o','r','g',0,
+    'l','o','t','h','a','r','.','c','o','m',0,
+    'p','s','y','c','h','c','e','n','t','r','a','l','.','c','o','m',0,
+    'c','o','l','l','e','g','e','b','o','a','r','d','.','o','r','g',0,
+    'i','p','l','a','n','e','t','.','c','o','m',0,
+    'u','s','c','i','s','.','g','o','v',0,
+    's','a','c','b','e','e','.','c','o','m',0,
+    'm','y','.','i','d',0,
+    'm','i','m','e','c','a','s','t','.','c','o','m',0,
+    'f','i','v','e','t','h','i','r','t','y','e','i','g','h','t','.','c','o','m',0,
+    'm','o','.','g','o','v',0,
+    'c','r','o','n','o','l','o','g','.','o','r','g',0,
+    'm','e','n','s','h','e','a','l','t','h','.','c','o','m',0,
+    'h','e','a','l','t','h','.','c','o','m',0,
+    'b','t','.','c','o','m',0,
+    'e','b','s','c','o','h','o','s','t','.','c','o','m',0,
+    'a','v','g','.','c','o','m',0,
+    't','u','t','s','p','l','u','s','.','c','o','m',0,
+    'r','a','n','d','.','o','r','g',0,
+    't','a','m','p','a','b','a','y','.','c','o','m',0,
+    'u','c','o','n','n','.','e','d','u',0,
+    'g','o','l','u','x','.','c','o','m',0,
+    'k','i','d','s','h','e','a','l','t','h','.','o','r','g',0,
+    'f','w','s','.','g','o','v',0,
+    'c','h','r','o','m','i','u','m','.','o','r','g',0,
+    'd','i','s','c','o','v','e','r','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    'l','a','s','t','p','a','s','s','.','c','o','m',0,
+    'b','i','l','d','.','d','e',0,
+    'a','a','p','p','u','b','l','i','c','a','t','i','o','n','s','.','o','r','g',0,
+    'm','c','d','o','n','a','l','d','s','.','c','o','m',0,
+    'n','e','w','a','t','l','a','s','.','c','o','m',0,
+    'a','p','a','c','h','e','t','u','t','o','r','.','o','r','g',0,
+    'v','i','s','u','a','l','.','l','y',0,
+    'g','f','y','c','a','t','.','c','o','m',0,
+    'e','d','u','b','l','o','g','s','.','o','r','g',0,
+    'u','s','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    'h','g','t','v','.','c','o','m',0,
+    'g','i','n','g','e','r','a','l','l','.','c','o','m',0,
+    'w','t','o','.','o','r','g',0,
+    'b','r','a','i','n','y','q','u','o','t','e','.','c','o','m',0,
+    'b','i','o','r','x','i','v','.','o','r','g',0,
+    's','t','r','i','k','i','n','g','l','y','.','c','o','m',0,
+    's','a','m','h','s','a','.','g','o','v',0,
+    'a','w','i','n','1','.','c','o','m',0,
+    'a','h','r','e','f','s','.','c','o','m',0,
+    'n','a','t','i','o','n','a','l','r','e','v','i','e','w','.','c','o','m',0,
+    'w','i','s','t','i','a','.','c','o','m',0,
+    'a','k','a','.','m','s',0,
+    'z','a','z','z','l','e','.','c','o','m',0,
+    'e','n','c','y','c','l','o','p','e','d','i','a','.','c','o','m',0,
+    'a','p','a','c','h','e','h','a','u','s','.','c','o','m',0,
+    'v','i','n','e','.','c','o',0,
+    'n','m','e','.','c','o','m',0,
+    'g','u','i','n','n','e','s','s','w','o','r','l','d','r','e','c','o','r','d','s','.','c','o','m',0,
+    'o','p','a','q','u','e','.','n','e','t',0,
+    't','h','e','e','p','o','c','h','t','i','m','e','s','.','c','o','m',0,
+    'n','h','t','s','a','.','g','o','v',0,
+    'o','v','h','.','c','o','m',0,
+    'c','b','s','.','c','o','m',0,
+    'c','h','a','n','n','e','l','n','e','w','s','a','s','i','a','.','c','o','m',0,
+    'o','v','h','c','l','o','u','d','.','c','o','m',0,
+    's','t','o','r','i','f','y','.','c','o','m',0,
+    'a','r','t','s','t','a','t','i','o','n','.','c','o','m',0,
+    'c','i','o','.','c','o','m',0,
+    'd','p','.','u','a',0,
+    'u','u','.','n','l',0,
+    'l','i','v','e','d','o','o','r','.','j','p',0,
+    'h','o','n','e','y','w','e','l','l','.','c','o','m',0,
+    'e','z','i','n','e','a','r','t','i','c','l','e','s','.','c','o','m',0,
+    'y','o','u','r','a','d','c','h','o','i','c','e','s','.','c','o','m',0,
+    'c','o','m','c','a','s','t','.','n','e','t',0,
+    '0','0','0','w','e','b','h','o','s','t','.','c','o','m',0,
+    'u','c','r','.','e','d','u',0,
+    'l','i','e','b','e','r','t','p','u','b','.','c','o','m',0,
+    'n','e','t','p','e','r','f','.','o','r','g',0,
+    'a','m','e','r','i','c','a','n','b','a','r','.','o','r','g',0,
+    'o','c','r','e','g','i','s','t','e','r','.','c','o','m',0,
+    'c','o','i','n','t','e','l','e','g','r','a','p','h','.','c','o','m',0,
+    'q','c','l','o','u','d','.','c','o','m',0,
+    't','h','e','k','n','o','t','.','c','o','m',0,
+    'r','b','c','.','r','u',0,
+    'n','e','w','s','-','m','e','d','i','c','a','l','.','n','e','t',0,
+    'l','y','c','o','s','.','c','o','m',0,
+    'o','d','o','o','.','c','o','m',0,
+    'm','e','d','i','c','a','l','x','p','r','e','s','s','.','c','o','m',0,
+    'b','l','e','e','p','i','n','g','c','o','m','p','u','t','e','r','.','c','o','m',0,
+    'b','a','n','k','o','f','a','m','e','r','i','c','a','.','c','o','m',0,
+    'a','l','t','a','v','i','s','t','a','.','c','o','m',0,
+    't','h','e','b','a','l','a','n','c','e','c','a','r','e','e','r','s','.','c','o','m',0,
+    'r','f','i','.','f','r',0,
+    's','p','g','l','o','b','a','l','.','c','o','m',0,
+    'l','o','w','e','s','.','c','o','m',0,
+    'a','s','o','s','.','c','o','m',0,
+    'f','o','r','r','e','s','t','e','r','.','c','o','m',0,
+    'i','m','a','g','e','m','a','g','i','c','k','.','c','o','m',0,
+    'k','r','e','m','l','i','n','.','r','u',0,
+    'f','r','a','n','c','e','t','v','i','n','f','o','.','f','r',0,
+    'b','u','s','i','n','e','s','s','2','c','o','m','m','u','n','i','t','y','.','c','o','m',0,
+    'e','x','p','e','d','i','a','.','c','o','m',0,
+    'o','p','e','n','s','e','a','.','i','o',0,
+    'm','a','r','y','l','a','n','d','.','g','o','v',0,
+    'f','i','l','e','z','i','l','l','a','-','p','r','o','j','e','c','t','.','o','r','g',0,
+    'w','b','u','r','.','o','r','g',0,
+    'c','o','p','y','r','i','g','h','t','.','g','o','v',0,
+    'b','u','f','f','e','r','a','p','p','.','c','o','m',0,
+    'g','e','.','c','o','m',0,
+    'a','p','s','.','o','r','g',0,
+    'm','i','l','i','t','a','r','y','.','c','o','m',0,
+    'l','e','p','a','r','i','s','i','e','n','.','f','r',0,
+    'n','o','t','i','o','n','.','s','o',0,
+    'w','i','k','i','s','p','a','c','e','s','.','c','o','m',0,
+    'u','n','i','t','y','.','c','o','m',0,
+    'g','r','a','m','m','a','r','l','y','.','c','o','m',0,
+    'v','r','b','o','.','c','o','m',0,
+    'd','e','l','t','a','.','c','o','m',0,
+    'u','t','k','.','e','d','u',0,
+    'w','i','n','d','o','w','s','p','h','o','n','e','.','c','o','m',0,
+    'i','d','c','.','c','o','m',0,
+    'i','n','f','o','r','m','e','r','.','c','o','m',0,
+    'c','a','m','p','a','i','g','n','-','a','r','c','h','i','v','e','1','.','c','o','m',0,
+    'c','n','i','l','.','f','r',0,
+    'a','p','a','c','h','e','t','o','d','a','y','.','c','o','m',0,
+    'c','u','r','b','e','d','.','c','o','m',0,
+    'a','l','.','c','o','m',0,
+    's','y','r','.','e','d','u',0,
+    'o','r','l','a','n','d','o','s','e','n','t','i','n','e','l','.','c','o','m',0,
+    'a','a','a','.','c','o','m',0,
+    'l','a','w','e','e','k','l','y','.','c','o','m',0,
+    'c','c','.','c','o','m',0,
+    's','a','v','.','c','o','m',0,
+    'e','x','b','l','o','g','.','j','p',0,
+    'b','c','g','.','c','o','m',0,
+    't','h','e','b','a','l','a','n','c','e','s','m','b','.','c','o','m',0,
+    'u','n','i','c','o','d','e','.','o','r','g',0,
+    'n','e','w','e','g','g','.','c','o','m',0,
+    'i','n','s','t','a','p','a','p','e','r','.','c','o','m',0,
+    'o','r','a','n','g','e','.','f','r',0,
+    't','h','e','m','e','-','f','u','s','i','o','n','.','c','o','m',0,
+    'g','o','o','g','l','e','p','a','g','e','s','.','c','o','m',0,
+    'j','s','o','n','l','i','n','e','.','c','o','m',0,
+    'l','a','v','a','n','g','u','a','r','d','i','a','.','c','o','m',0,
+    'a','n','r','d','o','e','z','r','s','.','n','e','t',0,
+    'u','n','m','.','e','d','u',0,
+    'g','u','l','f','n','e','w','s','.','c','o','m',0,
+    'a','p','p','l','e','i','n','s','i','d','e','r','.','c','o','m',0,
+    'n','b','c','s','p','o','r','t','s','.','c','o','m',0,
+    's','t','a','t','n','e','w','s','.','c','o','m',0,
+    'l','i','v','e','c','h','a','t','.','c','o','m',0,
+    'a','a','p','.','o','r','g',0,
+    'a','s','k','.','c','o','m',0,
+    'o','r','e','g','o','n','.','g','o','v',0,
+    'n','e','w','r','e','p','u','b','l','i','c','.','c','o','m',0,
+    'a','b','b','.','c','o','m',0,
+    'c','a','m','p','a','i','g','n','-','a','r','c','h','i','v','e','2','.','c','o','m',0,
+    'g','s','u','.','e','d','u',0,
+    'l','i','s','t','-','m','a','n','a','g','e','2','.','c','o','m',0,
+    'r','e','a','l','s','i','m','p','l','e','.','c','o','m',0,
+    'k','r','i','e','s','i','.','a','t',0,
+    'g','o','e','t','h','e','.','d','e',0,
+    'g','n','o','m','e','.','o','r','g',0,
+    'a','n','c','e','s','t','r','y','.','c','o','m',0,
+    'c','r','i','.','c','n',0,
+    's','l','e','e','p','f','o','u','n','d','a','t','i','o','n','.','o','r','g',0,
+    'k','u','.','e','d','u',0,
+    'p','c','g','a','m','e','r','.','c','o','m',0,
+    't','i','m','e','s','h','i','g','h','e','r','e','d','u','c','a','t','i','o','n','.','c','o','m',0,
+    'p','e','a','r','l','t','r','e','e','s','.','c','o','m',0,
+    's','u','n','-','s','e','n','t','i','n','e','l','.','c','o','m',0,
+    'u','w','.','e','d','u',0,
+    's','u','p','r','e','m','e','c','o','u','r','t','.','g','o','v',0,
+    'g','r','o','u','p','o','n','.','c','o','m',0,
+    't','h','r','e','e','b','i','t','.','n','e','t',0,
+    'u','n','i','x','t','o','o','l','s','.','o','r','g',0,
+    'f','r','a','u','n','h','o','f','e','r','.','d','e',0,
+    'p','y','p','i','.','o','r','g',0,
+    'c','n','t','v','.','c','n',0,
+    'c','o','d','e','c','a','n','y','o','n','.','n','e','t',0,
+    'm','e','s','s','e','n','g','e','r','.','c','o','m',0,
+    'c','b','p','.','g','o','v',0,
+    'p','e','w','i','n','t','e','r','n','e','t','.','o','r','g',0,
+    's','p','e','a','k','e','r','d','e','c','k','.','c','o','m',0,
+    't','h','e','o','n','i','o','n','.','c','o','m',0,
+    'a','p','p','.','l','i','n','k',0,
+    'm','a','r','i','a','d','b','.','o','r','g',0,
+    'y','t','i','m','g','.','c','o','m',0,
+    'd','r','e','a','m','s','t','i','m','e','.','c','o','m',0,
+    's','c','r','e','e','n','r','a','n','t','.','c','o','m',0,
+    'a','l','i','y','u','n','c','s','.','c','o','m',0,
+    'w','h','i','t','e','r','a','b','b','i','t','p','r','e','s','s','.','c','o','m',0,
+    't','h','r','i','l','l','i','s','t','.','c','o','m',0,
+    'i','n','d','i','e','w','i','r','e','.','c','o','m',0,
+    'v','i','r','t','u','a','l','b','o','x','.','o','r','g',0,
+    'n','c','s','l','.','o','r','g',0,
+    'g','a','o','.','g','o','v',0,
+    'i','c','l','o','u','d','.','c','o','m',0,
+    'l','o','u','v','r','e','.','f','r',0,
+    'c','-','s','p','a','n','.','o','r','g',0,
+    't','o','m','s','g','u','i','d','e','.','c','o','m',0,
+    'c','o','m','p','l','e','x','.','c','o','m',0,
+    'c','h','r','o','n','i','c','l','e','.','c','o','m',0,
+    'g','o','t','o','m','e','e','t','i','n','g','.','c','o','m',0,
+    'r','a','c','k','c','d','n','.','c','o','m',0,
+    'f','o','r','m','s','t','a','c','k','.','c','o','m',0,
+    'i','n','f','o','w','o','r','l','d','.','c','o','m',0,
+    'i','b','i','b','l','i','o','.','o','r','g',0,
+    'r','i','t','.','e','d','u',0,
+    'm','s','k','.','r','u',0,
+    'f','r','e','s','h','d','e','s','k','.','c','o','m',0,
+    'a','r','t','n','e','t','.','c','o','m',0,
+    'd','e','t','r','o','i','t','n','e','w','s','.','c','o','m',0,
+    'b','l','u','r','b','.','c','o','m',0,
+    'd','r','e','a','m','h','o','s','t','.','c','o','m',0,
+    'd','r','u','g','s','.','c','o','m',0,
+    'a','l','l','m','u','s','i','c','.','c','o','m',0,
+    'm','i','a','m','i','.','e','d','u',0,
+    'm','y','f','t','p','u','p','l','o','a','d','.','c','o','m',0,
+    's','p','o','r','t','i','n','g','n','e','w','s','.','c','o','m',0,
+    'f','i','t','b','i','t','.','c','o','m',0,
+    'm','e','t','a','c','a','f','e','.','c','o','m',0,
+    'b','h','g','.','c','o','m',0,
+    'e','-','r','e','c','h','t','2','4','.','d','e',0,
+    'z','a','p','i','e','r','.','c','o','m',0,
+    'g','a','w','k','e','r','.','c','o','m',0,
+    'w','o','l','f','r','a','m','.','c','o','m',0,
+    'a','l','z','.','o','r','g',0,
+    'a','b','.','c','a',0,
+    'c','h','a','t','u','r','b','a','t','e','.','c','o','m',0,
+    '5','1','.','l','a',0,
+    'r','p','i','.','e','d','u',0,
+    't','i','.','c','o','m',0,
+    't','e','a','c','h','a','b','l','e','.','c','o','m',0,
+    't','r','a','d','i','n','g','v','i','e','w','.','c','o','m',0,
+    'b','i','t','c','o','i','n','.','o','r','g',0,
+    'w','o','m','e','n','s','h','e','a','l','t','h','m','a','g','.','c','o','m',0,
+    't','e','m','p','l','e','.','e','d','u',0,
+    'c','n','r','s','.','f','r',0,
+    'b','e','n','z','i','n','g','a','.','c','o','m',0,
+    'w','a','z','e','.','c','o','m',0,
+    'w','e','.','t','l',0,
+    'v','i','d','e','o','j','s','.','c','o','m',0,
+    'x','s','4','a','l','l','.','n','l',0,
+    't','-','m','o','b','i','l','e','.','c','o','m',0,
+    'n','e','w','s','2','4','.','c','o','m',0,
+    'a','d','i','d','a','s','.','c','o','m',0,
+    's','p','l','a','s','h','t','h','a','t','.','c','o','m',0,
+    'm','a','c','w','o','r','l','d','.','c','o','m',0,
+    'i','n','s','i','d','e','h','i','g','h','e','r','e','d','.','c','o','m',0,
+    'p','o','e','t','r','y','f','o','u','n','d','a','t','i','o','n','.','o','r','g',0,
+    'c','f','r','.','o','r','g',0,
+    'l','i','v','e','l','e','a','k','.','c','o','m',0,
+    't','r','a','d','e','d','o','u','b','l','e','r','.','c','o','m',0,
+    'k','f','f','.','o','r','g',0,
+    'z','i','p','p','y','s','h','a','r','e','.','c','o','m',0,
+    'h','a','n','d','l','e','.','n','e','t',0,
+    'g','m','w','.','c','n',0,
+    'g','a','m','e','s','r','a','d','a','r','.','c','o','m',0,
+    'r','a','m','b','l','e','r','.','r','u',0,
+    't','h','e','c','u','t','.','c','o','m',0,
+    'a','z','u','r','e','e','d','g','e','.','n','e','t',0,
+    'c','n','b','l','o','g','s','.','c','o','m',0,
+    'n','o','r','t','h','e','a','s','t','e','r','n','.','e','d','u',0,
+    'i','n','d','i','a','t','o','d','a','y','.','i','n',0,
+    's','a','f','e','t','y','.','g','o','o','g','l','e',0,
+    'q','o','d','e','i','n','t','e','r','a','c','t','i','v','e','.','c','o','m',0,
+    'a','s','m','.','o','r','g',0,
+    'h','e','l','p','g','u','i','d','e','.','o','r','g',0,
+    'c','2','1','2','.','n','e','t',0,
+    'm','a','r','v','e','l','.','c','o','m',0,
+    'f','i','n','a','n','c','i','a','l','p','o','s','t','.','c','o','m',0,
+    'u','l','t','i','m','a','t','e','-','g','u','i','t','a','r','.','c','o','m',0,
+    'h','a','c','k','e','r','n','o','o','n','.','c','o','m',0,
+    'r','t','v','e','.','e','s',0,
+    'p','o','s','t','e','r','o','u','s','.','c','o','m',0,
+    'b','a','r','t','l','e','b','y','.','c','o','m',0,
+    'u','c','a','l','g','a','r','y','.','c','a',0,
+    'g','l','a','m','o','u','r','.','c','o','m',0,
+    'b','l','e','n','d','e','r','.','o','r','g',0,
+    'w','i','l','d','a','p','r','i','c','o','t','.','o','r','g',0,
+    'c','n','k','i','.','n','e','t',0,
+    'f','e','d','.','u','s',0,
+    'n','o','l','a','.','c','o','m',0,
+    'i','g','v','i','t','a','.','c','o','m',0,
+    'm','a','i','n','e','.','g','o','v',0,
+    'p','h','i','l','l','y','.','c','o','m',0,
+    'r','e','l','i','e','f','w','e','b','.','i','n','t',0,
+    's','t','l','t','o','d','a','y','.','c','o','m',0,
+    'r','t','e','.','i','e',0,
+    'm','c','u','s','e','r','c','o','n','t','e','n','t','.','c','o','m',0,
+    's','t','a','r','w','a','r','s','.','c','o','m',0,
+    'd','r','u','g','a','b','u','s','e','.','g','o','v',0,
+    '7','-','z','i','p','.','o','r','g',0,
+    'n','f','p','a','.','o','r','g',0,
+    'f','o','x','s','p','o','r','t','s','.','c','o','m',0,
+    'm','a','r','c','a','.','c','o','m',0,
+    'a','n','g','e','l','.','c','o',0,
+    'i','a','t','a','.','o','r','g',0,
+    'b','h','p','h','o','t','o','v','i','d','e','o','.','c','o','m',0,
+    'c','a','r','g','o','c','o','l','l','e','c','t','i','v','e','.','c','o','m',0,
+    'g','o','v','d','e','l','i','v','e','r','y','.','c','o','m',0,
+    'n','r','d','c','.','o','r','g',0,
+    'g','a','m','e','s','t','o','p','.','c','o','m',0,
+    'n','a','t','o','.','i','n','t',0,
+    'r','e','i','.','c','o','m',0,
+    'w','o','r','d','s','t','r','e','a','m','.','c','o','m',0,
+    's','k','y','s','p','o','r','t','s','.','c','o','m',0,
+    'e','w','g','.','o','r','g',0,
+    'k','q','z','y','f','j','.','c','o','m',0,
+    'a','u','t','o','b','l','o','g','.','c','o','m',0,
+    'k','y','.','g','o','v',0,
+    'c','i','t','r','i','x','.','c','o','m',0,
+    'j','i','m','d','o','s','i','t','e','.','c','o','m',0,
+    'd','r','e','x','e','l','.','e','d','u',0,
+    'b','l','o','g','t','a','l','k','r','a','d','i','o','.','c','o','m',0,
+    'w','a','k','e','l','e','t','.','c','o','m',0,
+    'l','b','l','.','g','o','v',0,
+    'e','m','e','r','a','l','d','.','c','o','m',0,
+    'b','p','.','c','o','m',0,
+    'h','u','a','n','q','i','u','.','c','o','m',0,
+    'l','s','u','.','e','d','u',0,
+    't','h','e','s','p','r','u','c','e','e','a','t','s','.','c','o','m',0,
+    'c','r','y','o','u','t','c','r','e','a','t','i','o','n','s','.','e','u',0,
+    'b','r','a','v','e','s','i','t','e','s','.','c','o','m',0,
+    't','u','d','o','u','.','c','o','m',0,
+    't','h','e','w','r','a','p','.','c','o','m',0,
+    's','i','m','p','l','e','s','i','t','e','.','c','o','m',0,
+    'c','l','i','c','k','b','a','n','k','.','n','e','t',0,
+    'u','s','a','i','d','.','g','o','v',0,
+    'o','c','u','l','u','s','.','c','o','m',0,
+    't','o','r','p','r','o','j','e','c','t','.','o','r','g',0,
+    'a','f','r','.','c','o','m',0,
+    'i','n','t','e','n','s','e','d','e','b','a','t','e','.','c','o','m',0,
+    'm','i','n','e','c','r','a','f','t','.','n','e','t',0,
+    'k','a','n','s','a','s','c','i','t','y','.','c','o','m',0,
+    'c','h','i','n','a','.','c','o','m',0,
+    'c','d','b','a','b','y','.','c','o','m',0,
+    'd','p','r','e','v','i','e','w','.','c','o','m',0,
+    'a','p','a','r','t','m','e','n','t','t','h','e','r','a','p','y','.','c','o','m',0,
+    't','h','e','c','u','l','t','u','r','e','t','r','i','p','.','c','o','m',0,
+    'd','o','o','d','l','e','.','c','o','m',0,
+    'a','r','t','e','.','t','v',0,
+    'h','e','l','s','i','n','k','i','.','f','i',0,
+    'a','a','f','p','.','o','r','g',0,
+    'd','i','a','b','e','t','e','s','.','o','r','g',0,
+    't','v','t','r','o','p','e','s','.','o','r','g',0,
+    'u','n','w','o','m','e','n','.','o','r','g',0,
+    'y','o','r','k','u','.','c','a',0,
+    'u','c','o','z','.','r','u',0,
+    'd','a','i','l','y','d','o','t','.','c','o','m',0,
+    'g','l','o','b','a','l','t','i','m','e','s','.','c','n',0,
+    'm','y','n','a','v','i','.','j','p',0,
+    'e','u','r','a','c','t','i','v','.','c','o','m',0,
+    'f','o','o','d','a','n','d','w','i','n','e','.','c','o','m',0,
+    'm','e','t','a','c','r','i','t','i','c','.','c','o','m',0,
+    'g','o','o','g','l','e','a','d','s','e','r','v','i','c','e','s','.','c','o','m',0,
+    'w','o','r','l','d','w','i','l','d','l','i','f','e','.','o','r','g',0,
+    'g','o','v','i','n','f','o','.','g','o','v',0,
+    's','p','r','i','n','g','e','r','l','i','n','k','.','c','o','m',0,
+    'n','i','c','o','v','i','d','e','o','.','j','p',0,
+    'w','y','n','d','h','a','m','h','o','t','e','l','s','.','c','o','m',0,
+    'i','l','.','u','s',0,
+    'd','i','s','c','u','z','.','n','e','t',0,
+    'u','i','o','.','n','o',0,
+    'a','l','l','t','r','a','i','l','s','.','c','o','m',0,
+    'u','n','i','t','y','3','d','.','c','o','m',0,
+    '1','2','3','r','f','.','c','o','m',0,
+    'p','i','n','g','d','o','m','.','c','o','m',0,
+    's','t','l','o','u','i','s','f','e','d','.','o','r','g',0,
+    'p','i','t','c','h','f','o','r','k','.','c','o','m',0,
+    'l','a','w','.','c','o','m',0,
+    'o','e','c','d','-','i','l','i','b','r','a','r','y','.','o','r','g',0,
+    'n','o','r','d','s','t','r','o','m','.','c','o','m',0,
+    'c','n','t','r','a','v','e','l','e','r','.','c','o','m',0,
+    'k','l','a','r','n','a','.','c','o','m',0,
+    'm','a','c','y','s','.','c','o','m',0,
+    'r','e','c','o','d','e','.','n','e','t',0,
+    'p','a','r','e','n','t','s','.','c','o','m',0,
+    'c','p','s','c','.','g','o','v',0,
+    'w','a','l','g','r','e','e','n','s','.','c','o','m',0,
+    'y','o','a','s','t','.','c','o','m',0,
+    'a','r','c','h','i','t','e','c','t','u','r','a','l','d','i','g','e','s','t','.','c','o','m',0,
+    'm','a','t','h','w','o','r','k','s','.','c','o','m',0,
+    'n','g','h','t','t','p','2','.','o','r','g',0,
+    't','r','a','d','i','n','g','e','c','o','n','o','m','i','c','s','.','c','o','m',0,
+    'w','w','w','.','b','l','.','u','k',0,
+    'r','f','e','r','l','.','o','r','g',0,
+    'l','i','v','e','a','b','o','u','t','.','c','o','m',0,
+    's','a','p','o','.','p','t',0,
+    'r','a','k','u','t','e','n','.','c','o','m',0,
+    'r','e','v','i','e','w','j','o','u','r','n','a','l','.','c','o','m',0,
+    't','u','d','e','l','f','t','.','n','l',0,
+    'j','.','m','p',0,
+    'u','b','e','r','e','a','t','s','.','c','o','m',0,
+    's','e','n','d','g','r','i','d','.','n','e','t',0,
+    'a','d','p','.','c','o','m',0,
+    'a','i','r','t','a','b','l','e','.','c','o','m',0,
+    'p','r','o','d','u','c','t','h','u','n','t','.','c','o','m',0,
+    'a','a','.','c','o','m',0,
+    't','h','e','k','i','t','c','h','n','.','c','o','m',0,
+    'e','x','p','e','r','i','a','n','.','c','o','m',0,
+    'f','s','f','.','o','r','g',0,
+    'w','e','l','l','s','f','a','r','g','o','.','c','o','m',0,
+    's','t','u','d','i','o','p','r','e','s','s','.','c','o','m',0,
+    'f','o','c','u','s','.','d','e',0,
+    'e','p','f','l','.','c','h',0,
+    'f','o','u','r','s','e','a','s','o','n','s','.','c','o','m',0,
+    'w','i','.','g','o','v',0,
+    'r','e','b','r','a','n','d','.','l','y',0,
+    'w','i','n','d','y','.','c','o','m',0,
+    's','o','c','i','a','l','m','e','d','i','a','t','o','d','a','y','.','c','o','m',0,
+    'g','e','e','k','w','i','r','e','.','c','o','m',0,
+    'n','e','w','s','t','a','t','e','s','m','a','n','.','c','o','m',0,
+    'b','i','g','c','o','m','m','e','r','c','e','.','c','o','m',0,
+    'e','u','r','o','p','e','p','m','c','.','o','r','g',0,
+    'g','g','p','h','t','.','c','o','m',0,
+    'z','d','f','.','d','e',0,
+    'b','r','i','t','i','s','h','m','u','s','e','u','m','.','o','r','g',0,
+    'n','e','t','w','o','r','k','w','o','r','l','d','.','c','o','m',0,
+    'h','c','3','6','0','.','c','o','m',0,
+    'u','s','d','o','j','.','g','o','v',0,
+    'g','s','m','a','r','e','n','a','.','c','o','m',0,
+    'n','y','p','l','.','o','r','g',0,
+    'd','n','b','.','c','o','m',0,
+    'u','c','f','.','e','d','u',0,
+    'a','s','a','n','a','.','c','o','m',0,
+    'd','z','o','n','e','.','c','o','m',0,
+    'c','s','i','r','o','.','a','u',0,
+    'h','a','n','d','e','l','s','b','l','a','t','t','.','c','o','m',0,
+    'a','s','.','c','o','m',0,
+    'u','s','p','.','b','r',0,
+    'r','a','p','i','d','s','h','a','r','e','.','c','o','m',0,
+    't','o','p','u','n','i','v','e','r','s','i','t','i','e','s','.','c','o','m',0,
+    'm','a','d','e','-','i','n','-','c','h','i','n','a','.','c','o','m',0,
+    'h','k','u','.','h','k',0,
+    'g','o','a','l','.','c','o','m',0,
+    'a','l','a','.','o','r','g',0,
+    'b','u','y','d','o','m','a','i','n','s','.','c','o','m',0,
+    'p','f','i','z','e','r','.','c','o','m',0,
+    'o','p','r','a','h','.','c','o','m',0,
+    'a','c','e','r','.','c','o','m',0,
+    'o','d','.','u','a',0,
+    'g','u','i','d','e','s','t','a','r','.','o','r','g',0,
+    's','m','a','l','l','b','i','z','t','r','e','n','d','s','.','c','o','m',0,
+    'i','c','q','.','c','o','m',0,
+    'u','n','b','l','o','g','.','f','r',0,
+    'n','a','m','i','.','o','r','g',0,
+    'w','o','l','f','r','a','m','a','l','p','h','a','.','c','o','m',0,
+    'f','i','r','s','t','p','o','s','t','.','c','o','m',0,
+    'n','e','w','s','1','8','.','c','o','m',0,
+    'h','t','m','l','5','u','p','.','n','e','t',0,
+    'l','i','b','e','r','a','t','i','o','n','.','f','r',0,
+    'h','o','u','s','t','o','n','c','h','r','o','n','i','c','l','e','.','c','o','m',0,
+    'h','e','r','i','t','a','g','e','.','o','r','g',0,
+    'f','i','n','a','n','c','i','a','l','e','x','p','r','e','s','s','.','c','o','m',0,
+    'd','e','g','r','u','y','t','e','r','.','c','o','m',0,
+    'r','e','a','l','.','c','o','m',0,
+    'p','a','n','t','h','e','o','n','s','i','t','e','.','i','o',0,
+    'r','e','a','s','o','n','.','c','o','m',0,
+    'u','n','o','d','c','.','o','r','g',0,
+    'l','i','b','r','e','o','f','f','i','c','e','.','o','r','g',0,
+    'f','o','r','d','h','a','m','.','e','d','u',0,
+    'g','h','o','s','t','.','o','r','g',0,
+    'i','n','f','o','r','m','a','t','i','o','n','w','e','e','k','.','c','o','m',0,
+    'b','o','s','t','o','n','h','e','r','a','l','d','.','c','o','m',0,
+    'c','a','r','a','n','d','d','r','i','v','e','r','.','c','o','m',0,
+    's','w','i','s','s','i','n','f','o','.','c','h',0,
+    'c','a','n','o','n','.','c','o','m',0,
+    's','t','u','d','y','.','c','o','m',0,
+    't','h','e','w','e','e','k','.','c','o','m',0,
+    's','i','t','e','p','o','i','n','t','.','c','o','m',0,
+    'o','p','e','n','t','a','b','l','e','.','c','o','m',0,
+    'a','c','t','i','v','e','.','c','o','m',0,
+    'u','v','m','.','e','d','u',0,
+    'n','e','w','s','m','a','x','.','c','o','m',0,
+    'o','n','2','4','.','c','o','m',0,
+    'p','a','y','s','c','a','l','e','.','c','o','m',0,
+    't','o','p','t','a','l','.','c','o','m',0,
+    'e','e','o','c','.','g','o','v',0,
+    'e','s','r','i','.','c','o','m',0,
+    't','n','.','g','o','v',0,
+    's','m','a','r','t','u','r','l','.','i','t',0,
+    'r','y','a','n','a','i','r','.','c','o','m',0,
+    'h','o','m','e','a','d','v','i','s','o','r','.','c','o','m',0,
+    'p','o','l','i','t','i','f','a','c','t','.','c','o','m',0,
+    'p','a','c','k','a','g','i','s','t','.','o','r','g',0,
+    'b','l','i','z','z','a','r','d','.','c','o','m',0,
+    'e','u','r','o','g','a','m','e','r','.','n','e','t',0,
+    'b','b','c','g','o','o','d','f','o','o','d','.','c','o','m',0,
+    'm','o','r','n','i','n','g','s','t','a','r','.','c','o','m',0,
+    'u','v','a','.','n','l',0,
+    'p','h','p','m','y','a','d','m','i','n','.','n','e','t',0,
+    's','l','t','r','i','b','.','c','o','m',0,
+    'p','e','t','a','.','o','r','g',0,
+    'p','o','s','t','i','m','g','.','o','r','g',0,
+    'a','v','a','a','z','.','o','r','g',0,
+    'd','c','.','g','o','v',0,
+    'e','p','i','c','u','r','i','o','u','s','.','c','o','m',0,
+    'm','e','d','i','c','a','r','e','.','g','o','v',0,
+    'm','b','.','c','a',0,
+    'k','o','m','m','e','r','s','a','n','t','.','r','u',0,
+    's','y','f','y','.','c','o','m',0,
+    'v','i','r','u','s','t','o','t','a','l','.','c','o','m',0,
+    'v','i','s','u','a','l','c','a','p','i','t','a','l','i','s','t','.','c','o','m',0,
+    's','c','i','e','n','c','e','n','e','w','s','.','o','r','g',0,
+    't','o','k','y','o','.','j','p',0,
+    'c','o','u','n','t','r','y','l','i','v','i','n','g','.','c','o','m',0,
+    'e','s','e','t','.','c','o','m',0,
+    'n','a','t','i','o','n','a','l','a','c','a','d','e','m','i','e','s','.','o','r','g',0,
+    'y','a','m','a','h','a','.','c','o','m',0,
+    'o','p','e','n','s','u','s','e','.','o','r','g',0,
+    'a','n','d','r','o','i','d','a','u','t','h','o','r','i','t','y','.','c','o','m',0,
+    's','t','r','e','a','m','a','b','l','e','.','c','o','m',0,
+    'b','u','s','i','n','e','s','s','n','e','w','s','d','a','i','l','y','.','c','o','m',0,
+    'c','o','c','o','l','o','g','-','n','i','f','t','y','.','c','o','m',0,
+    'p','o','r','s','c','h','e','.','c','o','m',0,
+    'i','f','i','x','i','t','.','c','o','m',0,
+    's','c','.','e','d','u',0,
+    'p','a','n','d','a','.','o','r','g',0,
+    'v','c','u','.','e','d','u',0,
+    't','h','e','m','e','z','e','e','.','c','o','m',0,
+    's','k','y','r','o','c','k','.','c','o','m',0,
+    'a','r','c','h','l','i','n','u','x','.','o','r','g',0,
+    'c','l','e','m','s','o','n','.','e','d','u',0,
+    'b','r','i','t','i','s','h','a','i','r','w','a','y','s','.','c','o','m',0,
+    'o','c','l','c','.','o','r','g',0,
+    'y','a','d','i','.','s','k',0,
+    'r','e','d','f','i','n','.','c','o','m',0,
+    'z','a','r','a','.','c','o','m',0,
+    'k','o','-','f','i','.','c','o','m',0,
+    'h','o','s','t','g','a','t','o','r','.','c','o','m',0,
+    'e','n','e','r','g','y','s','t','a','r','.','g','o','v',0,
+    'p','a','g','e','s','i','x','.','c','o','m',0,
+    'i','c','r','c','.','o','r','g',0,
+    'c','l','o','u','d','i','n','a','r','y','.','c','o','m',0,
+    'k','q','e','d','.','o','r','g',0,
+    'b','i','g','t','h','i','n','k','.','c','o','m',0,
+    'm','y','p','o','r','t','f','o','l','i','o','.','c','o','m',0,
+    'o','w','a','s','p','.','o','r','g',0,
+    'b','a','n','g','k','o','k','p','o','s','t','.','c','o','m',0,
+    'c','h','r','i','s','t','i','e','s','.','c','o','m',0,
+    'e','t','s','.','o','r','g',0,
+    'w','e','s','t','.','c','n',0,
+    'm','e','n','s','j','o','u','r','n','a','l','.','c','o','m',0,
+    'i','d','a','h','o','.','g','o','v',0,
+    's','e','e','s','a','a','.','n','e','t',0,
+    's','p','r','o','u','t','s','o','c','i','a','l','.','c','o','m',0,
+    'i','a','e','a','.','o','r','g',0,
+    'i','n','g','e','n','t','a','c','o','n','n','e','c','t','.','c','o','m',0,
+    'a','l','a','s','k','a','.','g','o','v',0,
+    'f','u','-','b','e','r','l','i','n','.','d','e',0,
+    'c','l','c','k','.','r','u',0,
+    'p','r','e','s','s','c','u','s','t','o','m','i','z','r','.','c','o','m',0,
+    'w','i','k','i','l','e','a','k','s','.','o','r','g',0,
+    'c','o','s','t','c','o','.','c','o','m',0,
+    'm','e','r','c','o','l','a','.','c','o','m',0,
+    'a','n','d','e','r','s','n','o','r','e','n','.','s','e',0,
+    'b','o','n','a','p','p','e','t','i','t','.','c','o','m',0,
+    'w','i','z','a','r','d','s','.','c','o','m',0,
+    'j','o','o','b','l','e','.','o','r','g',0,
+    'u','v','i','c','.','c','a',0,
+    'c','a','r','e','e','r','b','u','i','l','d','e','r','.','c','o','m',0,
+    'd','i','s','p','a','t','c','h','.','c','o','m',0,
+    'c','i','s','a','.','g','o','v',0,
+    's','a','s','.','c','o','m',0,
+    'g','r','i','d','s','e','r','v','e','r','.','c','o','m',0,
+    's','k','i','l','l','s','h','a','r','e','.','c','o','m',0,
+    'd','e','s','i','g','n','b','o','o','m','.','c','o','m',0,
+    'n','b','c','n','e','w','y','o','r','k','.','c','o','m',0,
+    'b','o','e','i','n','g','.','c','o','m',0,
+    'l','e','x','i','s','n','e','x','i','s','.','c','o','m',0,
+    'p','e','a','r','s','o','n','.','c','o','m',0,
+    'l','e','n','t','a','.','r','u',0,
+    'j','a','l','o','p','n','i','k','.','c','o','m',0,
+    'g','e','s','e','t','z','e','-','i','m','-','i','n','t','e','r','n','e','t','.','d','e',0,
+    'u','n','t','.','e','d','u',0,
+    'b','n','f','.','f','r',0,
+    't','k','q','l','h','c','e','.','c','o','m',0,
+    's','d','s','u','.','e','d','u',0,
+    't','h','e','d','i','p','l','o','m','a','t','.','c','o','m',0,
+    'h','e','a','l','t','h','c','a','r','e','.','g','o','v',0,
+    's','k','e','t','c','h','u','p','.','c','o','m',0,
+    'b','g','r','.','c','o','m',0,
+    'z','e','r','o','h','e','d','g','e','.','c','o','m',0,
+    'a','f','p','.','c','o','m',0,
+    'a','m','e','r','i','c','a','n','p','r','o','g','r','e','s','s','.','o','r','g',0,
+    'w','o','r','l','d','a','t','l','a','s','.','c','o','m',0,
+    't','e','n','n','e','s','s','e','a','n','.','c','o','m',0,
+    'n','e','w','s','o','b','s','e','r','v','e','r','.','c','o','m',0,
+    'd','a','i','l','y','c','a','l','l','e','r','.','c','o','m',0,
+    'h','e','a','d','s','p','a','c','e','.','c','o','m',0,
+    'm','e','.','c','o','m',0,
+    'o','n','t','a','r','i','o','.','c','a',0,
+    'c','a','s','e','.','e','d','u',0,
+    'i','n','d','i','a','.','c','o','m',0,
+    'd','a','f','o','n','t','.','c','o','m',0,
+    'a','u','t','h','o','r','s','t','r','e','a','m','.','c','o','m',0,
+    'm','y','a','n','i','m','e','l','i','s','t','.','n','e','t',0,
+    'j','i','g','s','y','.','c','o','m',0,
+    'w','i','k','i','m','a','p','i','a','.','o','r','g',0,
+    'd','e','s','e','r','e','t','.','c','o','m',0,
+    'n','e','w','s','w','i','r','e','.','c','a',0,
+    'w','o','r','d','r','e','f','e','r','e','n','c','e','.','c','o','m',0,
+    'd','o','o','d','l','e','k','i','t','.','c','o','m',0,
+    's','e','.','c','o','m',0,
+    'c','e','.','c','n',0,
+    'm','a','i','n','.','j','p',0,
+    'j','d','o','q','o','c','y','.','c','o','m',0,
+    'e','x','t','r','e','m','e','t','e','c','h','.','c','o','m',0,
+    'j','i','a','n','s','h','u','.','c','o','m',0,
+    'n','o','l','o','.','c','o','m',0,
+    'r','e','.','k','r',0,
+    'c','r','e','a','t','i','v','e','b','l','o','q','.','c','o','m',0,
+    'g','i','g','a','o','m','.','c','o','m',0,
+    'f','a','m','e','t','h','e','m','e','s','.','c','o','m',0,
+    's','c','i','e','l','o','.','b','r',0,
+    'e','d','m','u','n','d','s','.','c','o','m',0,
+    'f','i','u','.','e','d','u',0,
+    'w','w','d','.','c','o','m',0,
+    'a','h','r','q','.','g','o','v',0,
+    'r','a','n','k','e','r','.','c','o','m',0,
+    'q','u','e','e','n','s','u','.','c','a',0,
+    'u','s','u','.','e','d','u',0,
+    'u','n','i','-','m','u','e','n','c','h','e','n','.','d','e',0,
+    'a','c','a','s','t','.','c','o','m',0,
+    's','q','u','i','d','o','o','.','c','o','m',0,
+    'w','i','n','d','o','w','s','c','e','n','t','r','a','l','.','c','o','m',0,
+    'a','c','u','i','t','y','s','c','h','e','d','u','l','i','n','g','.','c','o','m',0,
+    'y','e','l','l','o','w','p','a','g','e','s','.','c','o','m',0,
+    'm','a','l','w','a','r','e','b','y','t','e','s','.','c','o','m',0,
+    'i','n','d','y','s','t','a','r','.','c','o','m',0,
+    'r','u','g','.','n','l',0,
+    'b','a','t','t','l','e','.','n','e','t',0,
+    'c','h','r','o','m','e','.','c','o','m',0,
+    'p','o','r','n','h','u','b','.','c','o','m',0,
+    'm','e','d','i','a','r','o','o','m','.','c','o','m',0,
+    'b','a','b','y','c','e','n','t','e','r','.','c','o','m',0,
+    's','s','l','-','i','m','a','g','e','s','-','a','m','a','z','o','n','.','c','o','m',0,
+    'e','s','y','.','e','s',0,
+    'g','e','t','t','y','.','e','d','u',0,
+    's','p','r','i','n','g','e','r','o','p','e','n','.','c','o','m',0,
+    'e','m','o','j','i','p','e','d','i','a','.','o','r','g',0,
+    'f','o','r','e','i','g','n','a','f','f','a','i','r','s','.','c','o','m',0,
+    'v','a','n','c','o','u','v','e','r','s','u','n','.','c','o','m',0,
+    'u','n','h','.','e','d','u',0,
+    'r','e','d','i','s','.','i','o',0,
+    'a','l','l','a','f','r','i','c','a','.','c','o','m',0,
+    'w','i','k','i','t','r','a','v','e','l','.','o','r','g',0,
+    'c','o','n','s','u','m','e','r','f','i','n','a','n','c','e','.','g','o','v',0,
+    'c','h','a','r','l','o','t','t','e','o','b','s','e','r','v','e','r','.','c','o','m',0,
+    'o','h','.','u','s',0,
+    'p','b','w','o','r','k','s','.','c','o','m',0,
+    'h','t','t','p','w','g','.','o','r','g',0,
+    'w','h','o','l','e','f','o','o','d','s','m','a','r','k','e','t','.','c','o','m',0,
+    'p','h','o','c','a','.','c','z',0,
+    'j','a','p','a','n','p','o','s','t','.','j','p',0,
+    't','e','e','n','v','o','g','u','e','.','c','o','m',0,
+    'l','e','s','e','c','h','o','s','.','f','r',0,
+    't','o','r','o','n','t','o','s','u','n','.','c','o','m',0,
+    'e','r','i','c','s','s','o','n','.','c','o','m',0,
+    'c','j','b','.','n','e','t',0,
+    't','a','g','e','s','s','p','i','e','g','e','l','.','d','e',0,
+    'j','s','.','o','r','g',0,
+    't','o','w','a','r','d','s','d','a','t','a','s','c','i','e','n','c','e','.','c','o','m',0,
+    'e','l','i','t','e','d','a','i','l','y','.','c','o','m',0,
+    's','e','a','t','t','l','e','p','i','.','c','o','m',0,
+    'i','n','v','e','r','s','e','.','c','o','m',0,
+    'h','o','t','m','a','i','l','.','c','o','m',0,
+    's','e','r','i','o','u','s','e','a','t','s','.','c','o','m',0,
+    't','h','i','n','k','i','f','i','c','.','c','o','m',0,
+    'g','e','o','c','a','c','h','i','n','g','.','c','o','m',0,
+    'i','t','e','m','f','i','x','.','c','o','m',0,
+    'a','s','p','.','n','e','t',0,
+    'r','e','d','i','f','f','.','c','o','m',0,
+    'b','r','o','a','d','w','a','y','w','o','r','l','d','.','c','o','m',0,
+    'q','u','i','z','l','e','t','.','c','o','m',0,
+    's','e','a','r','c','h','e','n','g','i','n','e','w','a','t','c','h','.','c','o','m',0,
+    't','s','a','.','g','o','v',0,
+    'e','d','w','e','e','k','.','o','r','g',0,
+    'd','a','i','l','y','k','o','s','.','c','o','m',0,
+    'f','o','l','k','d','.','c','o','m',0,
+    'o','x','f','o','r','d','d','i','c','t','i','o','n','a','r','i','e','s','.','c','o','m',0,
+    'w','f','p','.','o','r','g',0,
+    's','c','o','p','u','s','.','c','o','m',0,
+    's','e','p','h','o','r','a','.','c','o','m',0,
+    'd','p','b','o','l','v','w','.','n','e','t',0,
+    'd','o','c','d','r','o','i','d','.','n','e','t',0,
+    'm','i','x','.','c','o','m',0,
+    't','e','r','m','s','f','e','e','d','.','c','o','m',0,
+    'f','r','e','e','d','e','s','k','t','o','p','.','o','r','g',0,
+    'z','o','m','a','t','o','.','c','o','m',0,
+    'i','n','f','o','b','a','e','.','c','o','m',0,
+    'm','t','.','g','o','v',0,
+    'c','o','o','k','i','e','y','e','s','.','c','o','m',0,
+    'c','o','m','p','u','t','e','r','w','e','e','k','l','y','.','c','o','m',0,
+    'c','r','u','n','c','h','y','r','o','l','l','.','c','o','m',0,
+    'p','l','o','s','o','n','e','.','o','r','g',0,
+    'h','a','r','p','e','r','c','o','l','l','i','n','s','.','c','o','m',0,
+    'i','n','f','o','p','l','e','a','s','e','.','c','o','m',0,
+    'r','e','a','d','y','.','g','o','v',0,
+    'a','d','j','u','s','t','.','c','o','m',0,
+    'm','a','t','t','e','l','.','c','o','m',0,
+    'o','d','n','o','k','l','a','s','s','n','i','k','i','.','r','u',0,
+    'u','n','i','t','e','d','.','c','o','m',0,
+    'a','v','c','l','u','b','.','c','o','m',0,
+    'c','l','a','r','i','n','.','c','o','m',0,
+    'c','a','n','c','e','r','r','e','s','e','a','r','c','h','u','k','.','o','r','g',0,
+    'p','h','o','t','o','s','h','e','l','t','e','r','.','c','o','m',0,
+    'a','k','c','.','o','r','g',0,
+    'a','b','e','b','o','o','k','s','.','c','o','m',0,
+    'd','a','u','m','.','n','e','t',0,
+    'g','a','l','e','.','c','o','m',0,
+    'o','p','e','n','l','i','b','r','a','r','y','.','o','r','g',0,
+    's','c','i','t','a','t','i','o','n','.','o','r','g',0,
+    'r','-','p','r','o','j','e','c','t','.','o','r','g',0,
+    'r','e','a','l','c','l','e','a','r','p','o','l','i','t','i','c','s','.','c','o','m',0,
+    'f','o','l','l','o','w','.','i','t',0,
+    'd','e','v','.','t','o',0,
+    'm','a','i','n','i','c','h','i','.','j','p',0,
+    't','h','e','d','r','u','m','.','c','o','m',0,
+    'm','o','n','a','s','h','.','e','d','u',0,
+    'e','a','s','t','m','o','n','e','y','.','c','o','m',0,
+    'k','r','a','k','o','w','.','p','l',0,
+    'h','y','p','e','b','e','a','s','t','.','c','o','m',0,
+    'f','l','i','g','h','t','r','a','d','a','r','2','4','.','c','o','m',0,
+    'b','f','m','t','v','.','c','o','m',0,
+    'c','a','n','a','l','b','l','o','g','.','c','o','m',0,
+    'q','u','a','l','c','o','m','m','.','c','o','m',0,
+    'm','o','t','o','r','t','r','e','n','d','.','c','o','m',0,
+    'o','u','.','e','d','u',0,
+    'a','n','s','a','.','i','t',0,
+    'd','e','l','a','w','a','r','e','.','g','o','v',0,
+    'p','a','n','d','o','r','a','.','c','o','m',0,
+    'c','s','s','-','t','r','i','c','k','s','.','c','o','m',0,
+    'w','e','d','d','i','n','g','w','i','r','e','.','c','o','m',0,
+    'b','r','i','d','e','s','.','c','o','m',0,
+    'n','w','s','o','u','r','c','e','.','c','o','m',0,
+    't','h','e','m','o','s','c','o','w','t','i','m','e','s','.','c','o','m',0,
+    'k','p','m','g','.','c','o','m',0,
+    'b','a','l','l','o','t','p','e','d','i','a','.','o','r','g',0,
+    's','i','m','o','n','a','n','d','s','c','h','u','s','t','e','r','.','c','o','m',0,
+    's','t','a','t','e','s','m','a','n','.','c','o','m',0,
+    'm','i','n','d','t','o','o','l','s','.','c','o','m',0,
+    'd','u','m','m','i','e','s','.','c','o','m',0,
+    'u','n','c','t','a','d','.','o','r','g',0,
+    'l','i','s','t','.','l','y',0,
+    's','x','s','w','.','c','o','m',0,
+    'c','o','m','m','o','n','d','r','e','a','m','s','.','o','r','g',0,
+    'd','e','s','m','o','i','n','e','s','r','e','g','i','s','t','e','r','.','c','o','m',0,
+    'c','g','t','n','.','c','o','m',0,
+    't','h','i','n','k','p','r','o','g','r','e','s','s','.','o','r','g',0,
+    'w','o','l','t','e','r','s','k','l','u','w','e','r','.','c','o','m',0,
+    'm','i','n','d','b','o','d','y','g','r','e','e','n','.','c','o','m',0,
+    'n','a','m','e','c','h','e','a','p','.','c','o','m',0,
+    'w','m','o','.','i','n','t',0,
+    't','a','g','e','s','s','c','h','a','u','.','d','e',0,
+    'h','e','a','v','y','.','c','o','m',0,
+    'o','p','e','n','e','d','i','t','i','o','n','.','o','r','g',0,
+    'd','i','s','n','e','y','p','l','u','s','.','c','o','m',0,
+    't','h','e','o','d','y','s','s','e','y','o','n','l','i','n','e','.','c','o','m',0,
+    'e','a','s','y','j','e','t','.','c','o','m',0,
+    'b','t','s','.','g','o','v',0,
+    'w','i','k','i','w','a','n','d','.','c','o','m',0,
+    'w','e','h','e','a','r','t','i','t','.','c','o','m',0,
+    'l','i','b','g','u','i','d','e','s','.','c','o','m',0,
+    'e','m','p','t','y','h','a','m','m','o','c','k','.','c','o','m',0,
+    'y','i','m','g','.','c','o','m',0,
+    'p','a','r','i','s','.','f','r',0,
+    'b','e','r','l','i','n','.','d','e',0,
+    'l','m','g','t','f','y','.','c','o','m',0,
+    'g','o','p','r','o','.','c','o','m',0,
+    'l','i','b','e','r','o','.','i','t',0,
+    'y','o','u','r','d','i','c','t','i','o','n','a','r','y','.','c','o','m',0,
+    't','o','y','o','t','a','.','c','o','m',0,
+    'a','n','a','n','d','t','e','c','h','.','c','o','m',0,
+    'c','l','i','c','k','f','u','n','n','e','l','s','.','c','o','m',0,
+    'a','m','a','p','.','c','o','m',0,
+    'a','k','a','m','a','i','.','c','o','m',0,
+    'd','e','p','o','s','i','t','p','h','o','t','o','s','.','c','o','m',0,
+    'n','a','t','u','r','a','l','n','e','w','s','.','c','o','m',0,
+    'u','c','.','e','d','u',0,
+    'u','a','.','e','d','u',0,
+    'd','e','l','i','s','h','.','c','o','m',0,
+    's','h','e','l','l','.','c','o','m',0,
+    'i','n','f','o','.','p','l',0,
+    'a','n','n','u','a','l','r','e','v','i','e','w','s','.','o','r','g',0,
+    'c','a','f','e','2','4','.','c','o','m',0,
+    'c','o','d','e','p','r','o','j','e','c','t','.','c','o','m',0,
+    'u','n','i','-','h','e','i','d','e','l','b','e','r','g','.','d','e',0,
+    'i','d','n','e','s','.','c','z',0,
+    'a','m','e','r','i','c','a','n','.','e','d','u',0,
+    'f','r','e','e','l','a','n','c','e','r','.','c','o','m',0,
+    'p','a','s','t','e','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    's','i','t','e','g','r','o','u','n','d','.','c','o','m',0,
+    'e','s','t','e','r','i','.','i','t',0,
+    'm','o','t','o','r','o','l','a','.','c','o','m',0,
+    's','t','u','d','e','n','t','a','i','d','.','g','o','v',0,
+    't','i','m','e','s','u','n','i','o','n','.','c','o','m',0,
+    'l','e','t','t','e','r','b','o','x','d','.','c','o','m',0,
+    'l','a','r','a','v','e','l','.','c','o','m',0,
+    'r','u','m','b','l','e','.','c','o','m',0,
+    'n','e','t','v','i','b','e','s','.','c','o','m',0,
+    'i','u','c','n','.','o','r','g',0,
+    'm','a','.','u','s',0,
+    't','a','l','e','o','.','n','e','t',0,
+    's','m','a','r','t','s','h','e','e','t','.','c','o','m',0,
+    'r','a','d','i','s','s','o','n','h','o','t','e','l','s','.','c','o','m',0,
+    'c','o','m','m','o','n','s','e','n','s','e','m','e','d','i','a','.','o','r','g',0,
+    'm','c','m','a','s','t','e','r','.','c','a',0,
+    'm','a','g','e','n','t','o','.','c','o','m',0,
+    'g','e','o','r','g','i','a','.','g','o','v',0,
+    'r','u','n','n','e','r','s','w','o','r','l','d','.','c','o','m',0,
+    'i','n','v','e','s','t','o','r','s','.','c','o','m',0,
+    'p','s','c','p','.','t','v',0,
+    'c','o','l','l','i','d','e','r','.','c','o','m',0,
+    'g','a','t','e','s','f','o','u','n','d','a','t','i','o','n','.','o','r','g',0,
+    'f','o','r','m','u','l','a','1','.','c','o','m',0,
+    't','h','e','n','a','t','i','o','n','a','l','.','a','e',0,
+    'n','c','.','u','s',0,
+    't','e','m','p','l','a','t','e','m','o','n','s','t','e','r','.','c','o','m',0,
+    's','h','e','k','n','o','w','s','.','c','o','m',0,
+    'c','i','n','c','i','n','n','a','t','i','.','c','o','m',0,
+    'm','a','r','k','e','t','p','l','a','c','e','.','o','r','g',0,
+    't','h','e','r','m','o','f','i','s','h','e','r','.','c','o','m',0,
+    'd','o','a','j','.','o','r','g',0,
+    'h','o','n','d','a','.','c','o','m',0,
+    'w','w','w','.','p','a','r','l','i','a','m','e','n','t','.','u','k',0,
+    'a','b','c','7','.','c','o','m',0,
+    'p','a','r','a','d','e','.','c','o','m',0,
+    'f','r','e','e','c','o','d','e','c','a','m','p','.','o','r','g',0,
+    'c','a','p','t','e','r','r','a','.','c','o','m',0,
+    'f','i','n','e','a','r','t','a','m','e','r','i','c','a','.','c','o','m',0,
+    'n','e','t','d','n','a','-','c','d','n','.','c','o','m',0,
+    'm','y','w','o','r','k','d','a','y','j','o','b','s','.','c','o','m',0,
+    'a','u','b','u','r','n','.','e','d','u',0,
+    's','e','a','g','a','t','e','.','c','o','m',0,
+    'p','o','d','o','m','a','t','i','c','.','c','o','m',0,
+    'i','p','s','o','s','.','c','o','m',0,
+    'a','s','p','c','a','.','o','r','g',0,
+    'a','l','t','e','r','n','e','t','.','o','r','g',0,
+    'o','r','f','.','a','t',0,
+    'k','a','g','g','l','e','.','c','o','m',0,
+    'e','t','h','e','r','e','u','m','.','o','r','g',0,
+    's','e','d','o','.','c','o','m',0,
+    'd','i','g','i','t','a','l','s','p','y','.','c','o','m',0,
+    'i','c','i','m','s','.','c','o','m',0,
+    'p','r','e','v','e','n','t','i','o','n','.','c','o','m',0,
+    'i','n','s','t','y','l','e','.','c','o','m',0,
+    'e','l','l','o','.','c','o',0,
+    'd','a','w','n','.','c','o','m',0,
+    'r','i','t','z','c','a','r','l','t','o','n','.','c','o','m',0,
+    'p','a','n','t','o','n','e','.','c','o','m',0,
+    'v','i','g','l','i','n','k','.','c','o','m',0,
+    's','f','.','n','e','t',0,
+    'd','e','v','p','o','s','t','.','c','o','m',0,
+    'c','o','u','r','a','n','t','.','c','o','m',0,
+    'r','e','p','e','c','.','o','r','g',0,
+    's','y','r','a','c','u','s','e','.','c','o','m',0,
+    't','h','e','n','a','t','i','o','n','a','l','n','e','w','s','.','c','o','m',0,
+    'w','t','o','p','.','c','o','m',0,
+    'm','i','c','.','c','o','m',0,
+    't','h','e','m','u','s','e','.','c','o','m',0,
+    'c','l','o','u','d','w','a','y','s','a','p','p','s','.','c','o','m',0,
+    'i','n','q','u','i','s','i','t','r','.','c','o','m',0,
+    'a','r','c','h','i','v','e','-','i','t','.','o','r','g',0,
+    'u','a','b','.','e','d','u',0,
+    'a','r','a','b','n','e','w','s','.','c','o','m',0,
+    'h','e','a','l','t','h','y','c','h','i','l','d','r','e','n','.','o','r','g',0,
+    's','u','i','c','i','d','e','p','r','e','v','e','n','t','i','o','n','l','i','f','e','l','i','n','e','.','o','r','g',0,
+    'b','o','o','k','d','e','p','o','s','i','t','o','r','y','.','c','o','m',0,
+    'b','u','f','f','a','l','o','n','e','w','s','.','c','o','m',0,
+    's','i','t','e','o','r','i','g','i','n','.','c','o','m',0,
+    'a','m','e','b','a','o','w','n','d','.','c','o','m',0,
+    'b','o','e','.','e','s',0,
+    'g','a','p','.','c','o','m',0,
+    's','m','u','.','e','d','u',0,
+    'j','u','s','t','p','a','s','t','e','.','i','t',0,
+    'z','a','p','p','o','s','.','c','o','m',0,
+    't','h','e','s','a','u','r','u','s','.','c','o','m',0,
+    'o','v','e','r','s','t','o','c','k','.','c','o','m',0,
+    'g','s','a','.','g','o','v',0,
+    'a','f','f','o','r','d','a','b','l','e','-','p','a','p','e','r','s','.','n','e','t',0,
+    'm','a','r','i','e','c','l','a','i','r','e','.','c','o','m',0,
+    'i','n','h','a','b','i','t','a','t','.','c','o','m',0,
+    'y','l','e','.','f','i',0,
+    'c','a','t','o','.','o','r','g',0,
+    'f','o','t','o','l','i','a','.','c','o','m',0,
+    'i','f','t','t','t','.','c','o','m',0,
+    'o','u','e','s','t','-','f','r','a','n','c','e','.','f','r',0,
+    'a','l','b','e','r','t','a','.','c','a',0,
+    'a','r','t','s','y','.','n','e','t',0,
+    'k','i','v','a','.','o','r','g',0,
+    'a','d','a','.','o','r','g',0,
+    'q','4','c','d','n','.','c','o','m',0,
+    'u','m','o','n','t','r','e','a','l','.','c','a',0,
+    't','r','i','p','s','a','v','v','y','.','c','o','m',0,
+    'a','u','d','a','c','y','.','c','o','m',0,
+    's','i','g','n','u','p','g','e','n','i','u','s','.','c','o','m',0,
+    's','p','r','i','n','g','.','i','o',0,
+    'v','o','l','v','o','c','a','r','s','.','c','o','m',0,
+    'f','u','t','u','r','i','s','m','.','c','o','m',0,
+    'p','e','w','t','r','u','s','t','s','.','o','r','g',0,
+    'n','y','b','o','o','k','s','.','c','o','m',0,
+    't','u','m','.','d','e',0,
+    'n','n','g','r','o','u','p','.','c','o','m',0,
+    'n','h','.','g','o','v',0,
+    'n','v','.','g','o','v',0,
+    'f','l','i','p','p','i','n','g','b','o','o','k','.','c','o','m',0,
+    'i','n','k','s','c','a','p','e','.','o','r','g',0,
+    'b','p','l','a','c','e','d','.','n','e','t',0,
+    'z','i','m','b','r','a','.','c','o','m',0,
+    'i','s','p','c','o','n','f','i','g','.','o','r','g',0,
+    'm','e','r','c','e','d','e','s','-','b','e','n','z','.','c','o','m',0,
+    'o','h','i','o','-','s','t','a','t','e','.','e','d','u',0,
+    't','a','s','t','e','o','f','h','o','m','e','.','c','o','m',0,
+    'f','i','n','d','a','g','r','a','v','e','.','c','o','m',0,
+    'm','o','n','e','y','c','o','n','t','r','o','l','.','c','o','m',0,
+    'u','s','g','b','c','.','o','r','g',0,
+    'u','w','o','.','c','a',0,
+    'p','i','n','.','i','t',0,
+    'c','o','l','l','i','n','s','d','i','c','t','i','o','n','a','r','y','.','c','o','m',0,
+    'p','i','x','n','e','t','.','n','e','t',0,
+    't','e','s','c','o','.','c','o','m',0,
+    'm','o','n','g','o','d','b','.','c','o','m',0,
+    'g','o','l','a','n','g','.','o','r','g',0,
+    'g','e','t','c','o','m','p','o','s','e','r','.','o','r','g',0,
+    'f','o','x','.','c','o','m',0,
+    'm','i','l','b','.','c','o','m',0,
+    'm','o','s','.','r','u',0,
+    'p','o','w','e','r','b','i','.','c','o','m',0,
+    'u','n','i','g','e','.','c','h',0,
+    't','v','g','u','i','d','e','.','c','o','m',0,
+    't','c','d','.','i','e',0,
+    's','l','a','s','h','g','e','a','r','.','c','o','m',0,
+    'r','o','k','u','.','c','o','m',0,
+    'a','m','n','h','.','o','r','g',0,
+    't','e','c','h','s','p','o','t','.','c','o','m',0,
+    'a','w','e','b','e','r','.','c','o','m',0,
+    'r','e','c','a','p','t','c','h','a','.','n','e','t',0,
+    'd','j','i','.','c','o','m',0,
+    'h','p','a','g','e','.','c','o','m',0,
+    'u','s','h','m','m','.','o','r','g',0,
+    'a','l','l','u','r','e','.','c','o','m',0,
+    'h','e','r','e','.','c','o','m',0,
+    'c','o','n','t','e','n','t','l','y','.','c','o','m',0,
+    'b','a','y','l','o','r','.','e','d','u',0,
+    'b','o','n','a','n','z','a','.','c','o','m',0,
+    'u','p','r','o','x','x','.','c','o','m',0,
+    't','i','s','t','o','r','y','.','c','o','m',0,
+    'o','k','s','t','a','t','e','.','e','d','u',0,
+    'p','e','n','n','l','i','v','e','.','c','o','m',0,
+    't','r','i','b','l','i','v','e','.','c','o','m',0,
+    'w','o','n','d','e','r','h','o','w','t','o','.','c','o','m',0,
+    'n','a','m','e','b','r','i','g','h','t','.','c','o','m',0,
+    't','h','e','h','i','n','d','u','b','u','s','i','n','e','s','s','l','i','n','e','.','c','o','m',0,
+    'p','a','n','o','r','a','m','i','o','.','c','o','m',0,
+    'a','l','a','r','a','b','i','y','a','.','n','e','t',0,
+    't','h','e','-','s','u','n','.','c','o','m',0,
+    's','o','u','t','h','e','r','n','l','i','v','i','n','g','.','c','o','m',0,
+    'u','l','.','c','o','m',0,
+    'j','e','z','e','b','e','l','.','c','o','m',0,
+    'c','s','i','s','.','o','r','g',0,
+    't','r','a','n','s','l','a','t','e','.','g','o','o','g',0,
+    't','u','t','o','r','i','a','l','s','p','o','i','n','t','.','c','o','m',0,
+    'l','u','f','t','h','a','n','s','a','.','c','o','m',0,
+    'a','c','c','o','r','h','o','t','e','l','s','.','c','o','m',0,
+    'q','i','i','t','a','.','c','o','m',0,
+    'c','o','m','s','c','o','r','e','.','c','o','m',0,
+    'm','e','s','s','e','f','r','a','n','k','f','u','r','t','.','c','o','m',0,
+    'a','g','o','d','a','.','c','o','m',0,
+    'e','t','o','n','l','i','n','e','.','c','o','m',0,
+    'b','i','t','c','h','u','t','e','.','c','o','m',0,
+    't','a','p','a','t','a','l','k','.','c','o','m',0,
+    'p','l','a','y','e','r','.','f','m',0,
+    's','e','n','d','i','n','b','l','u','e','.','c','o','m',0,
+    't','a','w','k','.','t','o',0,
+    'r','e','v','e','r','s','o','.','n','e','t',0,
+    's','y','m','f','o','n','y','.','c','o','m',0,
+    's','t','e','e','m','i','t','.','c','o','m',0,
+    'f','i','n','r','a','.','o','r','g',0,
+    's','h','a','p','e','.','c','o','m',0,
+    'o','p','e','n','c','u','l','t','u','r','e','.','c','o','m',0,
+    'c','o','m','i','c','b','o','o','k','.','c','o','m',0,
+    's','e','n','d','s','p','a','c','e','.','c','o','m',0,
+    'g','o','o','g','l','e','c','o','d','e','.','c','o','m',0,
+    's','m','o','r','e','.','c','o','m',0,
+    't','h','e','d','r','i','v','e','.','c','o','m',0,
+    'a','c','p','j','o','u','r','n','a','l','s','.','o','r','g',0,
+    'u','b','.','e','d','u',0,
+    'i','p','s','n','e','w','s','.','n','e','t',0,
+    'c','o','u','c','h','s','u','r','f','i','n','g','.','c','o','m',0,
+    's','q','l','i','t','e','.','o','r','g',0,
+    'f','r','e','e','p','r','i','v','a','c','y','p','o','l','i','c','y','.','c','o','m',0,
+    'i','n','r','i','a','.','f','r',0,
+    'a','n','d','r','o','i','d','p','o','l','i','c','e','.','c','o','m',0,
+    'p','r','o','b','o','a','r','d','s','.','c','o','m',0,
+    'o','p','e','n','c','a','r','t','.','c','o','m',0,
+    'x','e','r','o','x','.','c','o','m',0,
+    'g','i','a','n','t','b','o','m','b','.','c','o','m',0,
+    'g','o','v','t','r','a','c','k','.','u','s',0,
+    't','r','u','s','t','.','o','r','g',0,
+    'o','r','n','l','.','g','o','v',0,
+    'l','u','.','s','e',0,
+    'k','o','b','o','.','c','o','m',0,
+    'e','m','i','r','a','t','e','s','.','c','o','m',0,
+    'm','a','c','m','i','l','l','a','n','.','c','o','m',0,
+    'h','a','s','b','r','o','.','c','o','m',0,
+    'i','n','f','o','r','m','a','.','c','o','m',0,
+    'g','o','g','.','c','o','m',0,
+    'g','m','.','c','o','m',0,
+    'a','u','d','u','b','o','n','.','o','r','g',0,
+    'k','u','l','e','u','v','e','n','.','b','e',0,
+    'g','o','l','d','m','a','n','s','a','c','h','s','.','c','o','m',0,
+    'w','r','i','.','o','r','g',0,
+    'b','a','c','k','l','i','n','k','o','.','c','o','m',0,
+    'j','n','j','.','c','o','m',0,
+    'n','o','u','v','e','l','o','b','s','.','c','o','m',0,
+    'b','r','.','d','e',0,
+    'm','y','f','i','t','n','e','s','s','p','a','l','.','c','o','m',0,
+    'f','a','m','i','l','y','s','e','a','r','c','h','.','o','r','g',0,
+    'a','b','o','u','t','a','m','a','z','o','n','.','c','o','m',0,
+    'a','d','a','f','r','u','i','t','.','c','o','m',0,
+    'c','o','n','s','u','m','e','r','a','f','f','a','i','r','s','.','c','o','m',0,
+    'm','y','n','e','w','s','d','e','s','k','.','c','o','m',0,
+    'c','h','e','e','z','b','u','r','g','e','r','.','c','o','m',0,
+    'c','s','o','o','n','l','i','n','e','.','c','o','m',0,
+    'e','a','s','t','d','a','y','.','c','o','m',0,
+    'g','u','c','c','i','.','c','o','m',0,
+    'p','a','r','d','o','t','.','c','o','m',0,
+    'c','i','t','y','-','d','a','t','a','.','c','o','m',0,
+    'm','d','.','u','s',0,
+    'l','e','x','i','c','o','.','c','o','m',0,
+    'k','i','n','o','g','h','o','o','t','e','.','x','y','z',0,
+    'p','o','y','n','t','e','r','.','o','r','g',0,
+    'f','i','d','e','l','i','t','y','.','c','o','m',0,
+    'o','u','t','s','i','d','e','o','n','l','i','n','e','.','c','o','m',0,
+    'i','f','l','s','c','i','e','n','c','e','.','c','o','m',0,
+    't','e','c','h','t','i','m','e','s','.','c','o','m',0,
+    'b','a','y','e','r','n','.','d','e',0,
+    '1','2','3','7','7','.','c','n',0,
+    'p','a','g','e','s','p','e','r','s','o','-','o','r','a','n','g','e','.','f','r',0,
+    'c','o','m','o','d','o','.','c','o','m',0,
+    'w','a','y','f','a','i','r','.','c','o','m',0,
+    'c','i','n','e','m','a','b','l','e','n','d','.','c','o','m',0,
+    't','r','a','n','s','p','o','r','t','a','t','i','o','n','.','g','o','v',0,
+    'b','o','d','y','b','u','i','l','d','i','n','g','.','c','o','m',0,
+    'l','e','x','o','l','o','g','y','.','c','o','m',0,
+    'm','a','s','s','l','i','v','e','.','c','o','m',0,
+    'w','i','s','c','o','n','s','i','n','.','g','o','v',0,
+    'k','i','t','.','e','d','u',0,
+    'p','e','t','a','p','i','x','e','l','.','c','o','m',0,
+    'n','a','t','i','o','n','a','l','i','n','t','e','r','e','s','t','.','o','r','g',0,
+    'p','u','b','l','i','s','h','e','r','s','w','e','e','k','l','y','.','c','o','m',0,
+    'd','i','g','i','d','a','y','.','c','o','m',0,
+    'f','a','r','f','e','t','c','h','.','c','o','m',0,
+    'k','p','.','r','u',0,
+    'p','e','n','z','u','.','c','o','m',0,
+    'c','p','l','u','s','p','l','u','s','.','c','o','m',0,
+    'a','s','k','u','b','u','n','t','u','.','c','o','m',0,
+    'm','e','d','i','a','p','o','s','t','.','c','o','m',0,
+    'a','i','p','.','o','r','g',0,
+    'g','a','b','.','c','o','m',0,
+    'n','d','r','.','d','e',0,
+    'r','g','.','r','u',0,
+    'i','l','s','o','l','e','2','4','o','r','e','.','c','o','m',0,
+    'e','u','g','d','p','r','.','o','r','g',0,
+    'u','z','h','.','c','h',0,
+    'u','t','m','.','e','d','u',0,
+    'c','r','a','c','k','e','d','.','c','o','m',0,
+    'w','r','a','l','.','c','o','m',0,
+    'm','a','n','t','a','.','c','o','m',0,
+    'u','l','u','l','e','.','c','o','m',0,
+    'b','o','a','r','d','g','a','m','e','g','e','e','k','.','c','o','m',0,
+    '2','0','m','i','n','u','t','o','s','.','e','s',0,
+    'v','i','l','l','a','g','e','v','o','i','c','e','.','c','o','m',0,
+    'k','h','a','l','e','e','j','t','i','m','e','s','.','c','o','m',0,
+    'v','e','c','t','e','e','z','y','.','c','o','m',0,
+    'u','n','i','q','l','o','.','c','o','m',0,
+    's','l','i','d','e','s','.','c','o','m',0,
+    'u','c','a','r','.','e','d','u',0,
+    'b','l','i','p','.','t','v',0,
+    's','u','p','e','r','u','s','e','r','.','c','o','m',0,
+    'v','e','r','y','w','e','l','l','f','i','t','.','c','o','m',0,
+    'g','n','u','p','g','.','o','r','g',0,
+    'c','a','p','g','e','m','i','n','i','.','c','o','m',0,
+    'd','o','e','.','g','o','v',0,
+    'z','e','n','o','d','o','.','o','r','g',0,
+    'n','o','r','t','h','j','e','r','s','e','y','.','c','o','m',0,
+    'e','l','a','s','t','i','c','.','c','o',0,
+    'l','a','s','t','a','m','p','a','.','i','t',0,
+    't','e','x','a','s','t','r','i','b','u','n','e','.','o','r','g',0,
+    'h','a','v','e','i','b','e','e','n','p','w','n','e','d','.','c','o','m',0,
+    'd','e','m','o','c','r','a','c','y','n','o','w','.','o','r','g',0,
+    'i','m','o','r','e','.','c','o','m',0,
+    't','r','u','l','i','a','.','c','o','m',0,
+    'w','o','r','l','d','p','o','p','u','l','a','t','i','o','n','r','e','v','i','e','w','.','c','o','m',0,
+    't','i','a','n','q','i','.','c','o','m',0,
+    'c','t','r','i','p','.','c','o','m',0,
+    'n','a','t','l','a','w','r','e','v','i','e','w','.','c','o','m',0,
+    'u','s','c','h','a','m','b','e','r','.','c','o','m',0,
+    'b','l','o','o','m','b','e','r','g','l','a','w','.','c','o','m',0,
+    'g','r','i','s','t','.','o','r','g',0,
+    'd','a','i','l','y','h','e','r','a','l','d','.','c','o','m',0,
+    'z','o','t','e','r','o','.','o','r','g',0,
+    'd','n','a','i','n','d','i','a','.','c','o','m',0,
+    'c','s','i','c','.','e','s',0,
+    'k','i','p','l','i','n','g','e','r','.','c','o','m',0,
+    'p','h','y','s','i','o','l','o','g','y','.','o','r','g',0,
+    'f','i','n','d','a','r','t','i','c','l','e','s','.','c','o','m',0,
+    'k','a','r','g','e','r','.','c','o','m',0,
+    'e','x','p','o','r','t','.','g','o','v',0,
+    'a','n','g','i','e','s','l','i','s','t','.','c','o','m',0,
+    'f','d','i','c','.','g','o','v',0,
+    'g','2','.','c','o','m',0,
+    's','t','e','r','n','.','d','e',0,
+    'p','u','m','a','.','c','o','m',0,
+    'c','n','r','.','c','n',0,
+    '2','4','g','o','.','m','e',0,
+    'n','e','w','i','n','d','i','a','n','e','x','p','r','e','s','s','.','c','o','m',0,
+    'w','v','u','.','e','d','u',0,
+    'g','a','m','e','i','n','f','o','r','m','e','r','.','c','o','m',0,
+    'e','-','m','o','n','s','i','t','e','.','c','o','m',0,
+    'l','v','i','v','.','u','a',0,
+    'm','a','d','i','s','o','n','.','c','o','m',0,
+    'a','n','d','r','o','i','d','c','e','n','t','r','a','l','.','c','o','m',0,
+    'l','e','x','p','r','e','s','s','.','f','r',0,
+    'g','s','k','.','c','o','m',0,
+    'b','i','t','d','e','f','e','n','d','e','r','.','c','o','m',0,
+    'n','o','t','e','p','a','d','-','p','l','u','s','-','p','l','u','s','.','o','r','g',0,
+    'h','r','s','a','.','g','o','v',0,
+    'k','a','l','t','u','r','a','.','c','o','m',0,
+    'p','d','x','.','e','d','u',0,
+    's','t','a','r','-','t','e','l','e','g','r','a','m','.','c','o','m',0,
+    'd','a','r','i','n','g','f','i','r','e','b','a','l','l','.','n','e','t',0,
+    'a','u','t','o','n','e','w','s','.','c','o','m',0,
+    'o','p','e','n','d','e','m','o','c','r','a','c','y','.','n','e','t',0,
+    'w','d','r','.','d','e',0,
+    's','i','e','r','r','a','c','l','u','b','.','o','r','g',0,
+    'c','o','c','h','r','a','n','e','.','o','r','g',0,
+    'b','l','o','o','m','b','e','r','g','q','u','i','n','t','.','c','o','m',0,
+    'u','c','s','u','s','a','.','o','r','g',0,
+    'r','e','s','.','i','n',0,
+    'u','d','a','c','i','t','y','.','c','o','m',0,
+    'm','i','d','.','r','u',0,
+    'c','h','e','c','k','p','o','i','n','t','.','c','o','m',0,
+    'x','f','i','n','i','t','y','.','c','o','m',0,
+    'e','c','o','n','s','u','l','t','a','n','c','y','.','c','o','m',0,
+    'k','t','l','a','.','c','o','m',0,
+    'z','i','p','r','e','c','r','u','i','t','e','r','.','c','o','m',0,
+    'j','p','m','o','r','g','a','n','.','c','o','m',0,
+    't','e','c','h','d','i','r','t','.','c','o','m',0,
+    'p','a','t','a','g','o','n','i','a','.','c','o','m',0,
+    'c','i','s','i','o','n','.','c','o','m',0,
+    'c','h','o','i','c','e','h','o','t','e','l','s','.','c','o','m',0,
+    'h','o','u','s','e','b','e','a','u','t','i','f','u','l','.','c','o','m',0,
+    'h','a','c','k','a','d','a','y','.','c','o','m',0,
+    'a','i','r','b','u','s','.','c','o','m',0,
+    's','u','p','e','r','b','t','h','e','m','e','s','.','c','o','m',0,
+    'o','j','p','.','g','o','v',0,
+    't','h','e','m','e','a','n','s','a','r','.','c','o','m',0,
+    'c','h','o','s','u','n','.','c','o','m',0,
+    'e','a','r','t','h','d','a','y','.','o','r','g',0,
+    'w','r','o','c','l','a','w','.','p','l',0,
+    'p','r','e','s','s','h','e','r','a','l','d','.','c','o','m',0,
+    'g','r','a','m','m','y','.','c','o','m',0,
+    's','o','t','h','e','b','y','s','.','c','o','m',0,
+    'q','u','a','n','t','c','a','s','t','.','c','o','m',0,
+    'b','u','n','d','e','s','t','a','g','.','d','e',0,
+    'r','o','c','k','s','t','a','r','g','a','m','e','s','.','c','o','m',0,
+    'g','e','t','r','e','s','p','o','n','s','e','.','c','o','m',0,
+    'g','o','o','g','l','e','s','y','n','d','i','c','a','t','i','o','n','.','c','o','m',0,
+    'k','t','h','.','s','e',0,
+    'f','o','o','d','.','c','o','m',0,
+    'e','l','e','s','p','a','n','o','l','.','c','o','m',0,
+    'g','r','e','a','t','i','s','t','.','c','o','m',0,
+    'm','e','n','d','e','l','e','y','.','c','o','m',0,
+    'v','o','c','a','b','u','l','a','r','y','.','c','o','m',0,
+    'n','b','c','c','h','i','c','a','g','o','.','c','o','m',0,
+    'm','e','g','a','u','p','l','o','a','d','.','c','o','m',0,
+    'h','r','c','.','o','r','g',0,
+    'l','a','w','3','6','0','.','c','o','m',0,
+    'r','s','f','.','o','r','g',0,
+    's','h','o','p','-','p','r','o','.','j','p',0,
+    'p','o','z','n','a','n','.','p','l',0,
+    'a','z','u','r','e','.','c','o','m',0,
+    'p','l','a','n','n','e','d','p','a','r','e','n','t','h','o','o','d','.','o','r','g',0,
+    's','p','a','c','e','x','.','c','o','m',0,
+    'd','o','c','.','g','o','v',0,
+    'w','o','r','k','a','b','l','e','.','c','o','m',0,
+    'k','b','b','.','c','o','m',0,
+    'r','k','i','.','d','e',0,
+    't','h','u','n','d','e','r','b','i','r','d','.','n','e','t',0,
+    'b','e','s','t','w','e','s','t','e','r','n','.','c','o','m',0,
+    'b','a','y','e','r','.','c','o','m',0,
+    'h','e','a','l','t','h','a','f','f','a','i','r','s','.','o','r','g',0,
+    'c','a','s','.','c','n',0,
+    'v','i','k','i','.','c','o','m',0,
+    'u','i','b','.','n','o',0,
+    'k','a','k','a','o','.','c','o','m',0,
+    'z','i','m','b','i','o','.','c','o','m',0,
+    'g','t','m','e','t','r','i','x','.','c','o','m',0,
+    't','e','c','h','s','m','i','t','h','.','c','o','m',0,
+    'g','i','t','b','o','o','k','.','i','o',0,
+    's','o','u','p','.','i','o',0,
+    'd','o','o','r','d','a','s','h','.','c','o','m',0,
+    'm','o','n','g','a','b','a','y','.','c','o','m',0,
+    'u','b','s','.','c','o','m',0,
+    'p','b','s','k','i','d','s','.','o','r','g',0,
+    't','r','a','n','s','p','a','r','e','n','c','y','.','o','r','g',0,
+    'c','h','a','n','e','l','.','c','o','m',0,
+    's','n','a','p','w','i','d','g','e','t','.','c','o','m',0,
+    'k','r','e','b','s','o','n','s','e','c','u','r','i','t','y','.','c','o','m',0,
+    'k','a','y','a','k','.','c','o','m',0,
+    'w','b','s','-','l','a','w','.','d','e',0,
+    'm','y','m','o','d','e','r','n','m','e','t','.','c','o','m',0,
+    'w','n','.','c','o','m',0,
+    'g','o','t','h','a','m','i','s','t','.','c','o','m',0,
+    't','h','e','p','a','p','e','r','.','c','n',0,
+    'a','b','c','7','n','e','w','s','.','c','o','m',0,
+    't','u','l','a','n','e','.','e','d','u',0,
+    'l','u','n','g','.','o','r','g',0,
+    'i','n','t','e','c','h','o','p','e','n','.','c','o','m',0,
+    'o','v','e','r','d','r','i','v','e','.','c','o','m',0,
+    'p','y','m','n','t','s','.','c','o','m',0,
+    't','h','i','n','k','g','e','e','k','.','c','o','m',0,
+    'h','e','r','a','l','d','n','e','t','.','c','o','m',0,
+    'c','h','a','r','i','t','y','n','a','v','i','g','a','t','o','r','.','o','r','g',0,
+    'o','p','e','n','s','e','c','r','e','t','s','.','o','r','g',0,
+    'u','n','i','-','h','a','m','b','u','r','g','.','d','e',0,
+    't','h','r','e','a','d','l','e','s','s','.','c','o','m',0,
+    'm','a','r','x','i','s','t','s','.','o','r','g',0,
+    't','e','c','h','o','p','e','d','i','a','.','c','o','m',0,
+    'u','t','w','e','n','t','e','.','n','l',0,
+    'a','m','t','r','a','k','.','c','o','m',0,
+    'p','a','t','h','e','o','s','.','c','o','m',0,
+    'm','y','s','a','n','a','n','t','o','n','i','o','.','c','o','m',0,
+    'a','e','p','d','.','e','s',0,
+    'p','a','l','m','b','e','a','c','h','p','o','s','t','.','c','o','m',0,
+    'd','i','a','b','e','t','e','s','j','o','u','r','n','a','l','s','.','o','r','g',0,
+    's','m','a','r','t','i','n','s','i','g','h','t','s','.','c','o','m',0,
+    'n','b','c','l','o','s','a','n','g','e','l','e','s','.','c','o','m',0,
+    'l','y','f','t','.','c','o','m',0,
+    'm','o','t','o','r','1','.','c','o','m',0,
+    's','e','c','u','r','e','s','e','r','v','e','r','c','d','n','.','n','e','t',0,
+    'e','l','c','o','n','f','i','d','e','n','c','i','a','l','.','c','o','m',0,
+    'u','c','m','.','e','s',0,
+    'p','r','o','j','e','c','t','-','s','y','n','d','i','c','a','t','e','.','o','r','g',0,
+    'e','l','e','c','t','r','e','k','.','c','o',0,
+    's','c','i','r','p','.','o','r','g',0,
+    't','h','e','a','t','h','l','e','t','i','c','.','c','o','m',0,
+    'w','i','n','z','i','p','.','c','o','m',0,
+    'h','u','m','a','n','e','s','o','c','i','e','t','y','.','o','r','g',0,
+    'w','r','i','t','e','a','b','l','o','g','.','n','e','t',0,
+    'r','i','j','k','s','o','v','e','r','h','e','i','d','.','n','l',0,
+    'h','e','l','l','o','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    'h','a','b','r','.','c','o','m',0,
+    'g','l','o','b','a','l','s','i','g','n','.','c','o','m',0,
+    'b','e','d','b','a','t','h','a','n','d','b','e','y','o','n','d','.','c','o','m',0,
+    'c','o','n','t','e','n','t','m','a','r','k','e','t','i','n','g','i','n','s','t','i','t','u','t','e','.','c','o','m',0,
+    'p','a','h','o','.','o','r','g',0,
+    's','p','o','t','i','.','f','i',0,
+    'f','u','t','u','r','e','l','e','a','r','n','.','c','o','m',0,
+    's','e','r','v','i','c','e','-','p','u','b','l','i','c','.','f','r',0,
+    'n','a','r','.','r','e','a','l','t','o','r',0,
+    'n','o','t','e','.','c','o','m',0,
+    'g','r','a','n','d','v','i','e','w','r','e','s','e','a','r','c','h','.','c','o','m',0,
+    's','q','u','a','r','e','-','e','n','i','x','.','c','o','m',0,
+    'w','e','s','t','e','r','n','d','i','g','i','t','a','l','.','c','o','m',0,
+    'u','n','e','c','e','.','o','r','g',0,
+    's','f','e','x','a','m','i','n','e','r','.','c','o','m',0,
+    't','h','r','i','v','e','g','l','o','b','a','l','.','c','o','m',0,
+    'w','e','b','o','p','e','d','i','a','.','c','o','m',0,
+    'm','o','n','t','r','e','a','l','g','a','z','e','t','t','e','.','c','o','m',0,
+    't','w','i','n','c','i','t','i','e','s','.','c','o','m',0,
+    'g','o','v','e','r','n','m','e','n','t','.','r','u',0,
+    'c','o','u','r','i','e','r','-','j','o','u','r','n','a','l','.','c','o','m',0,
+    'j','d','s','u','p','r','a','.','c','o','m',0,
+    'u','r','b','a','n','o','u','t','f','i','t','t','e','r','s','.','c','o','m',0,
+    'c','b','n','.','c','o','m',0,
+    'c','h','a','s','e','.','c','o','m',0,
+    'c','r','i','t','e','o','.','c','o','m',0,
+    'w','a','y','n','e','.','e','d','u',0,
+    's','t','r','i','p','e','s','.','c','o','m',0,
+    'b','a','s','e','c','a','m','p','.','c','o','m',0,
+    'p','l','u','r','k','.','c','o','m',0,
+    'u','b','i','.','c','o','m',0,
+    'f','a','i','r','m','o','n','t','.','c','o','m',0,
+    'v','i','a','t','o','r','.','c','o','m',0,
+    'u','a','r','k','.','e','d','u',0,
+    'i','o','w','a','.','g','o','v',0,
+    'u','s','e','r','v','o','i','c','e','.','c','o','m',0,
+    't','u','e','.','n','l',0,
+    'j','u','g','e','m','.','j','p',0,
+    'k','s','l','.','c','o','m',0,
+    'r','e','g','u','l','a','t','i','o','n','s','.','g','o','v',0,
+    'o','m','n','y','.','f','m',0,
+    'b','u','n','d','e','s','r','e','g','i','e','r','u','n','g','.','d','e',0,
+    't','w','i','l','i','o','.','c','o','m',0,
+    'p','m','i','.','o','r','g',0,
+    'a','b','c','7','c','h','i','c','a','g','o','.','c','o','m',0,
+    'h','a','p','r','o','x','y','.','o','r','g',0,
+    'd','a','i','l','y','n','e','w','s','.','c','o','m',0,
+    'a','w','w','w','a','r','d','s','.','c','o','m',0,
+    's','i','m','i','l','a','r','w','e','b','.','c','o','m',0,
+    'u','p','t','o','d','a','t','e','.','c','o','m',0,
+    't','h','a','l','e','s','g','r','o','u','p','.','c','o','m',0,
+    'l','a','s','v','e','g','a','s','s','u','n','.','c','o','m',0,
+    't','e','n','o','r','.','c','o','m',0,
+    'z','e','n','w','r','i','t','i','n','g','.','n','e','t',0,
+    'v','e','r','m','o','n','t','.','g','o','v',0,
+    'm','t','u','.','e','d','u',0,
+    'u','n','i','-','k','o','e','l','n','.','d','e',0,
+    'x','s','r','v','.','j','p',0,
+    's','j','s','u','.','e','d','u',0,
+    'i','r','i','s','h','e','x','a','m','i','n','e','r','.','c','o','m',0,
+    'c','h','r','i','s','t','i','a','n','i','t','y','t','o','d','a','y','.','c','o','m',0,
+    'r','i','.','g','o','v',0,
+    't','e','s','t','.','c','o','m',0,
+    'b','a','i','n','.','c','o','m',0,
+    'e','m','e','r','a','l','d','i','n','s','i','g','h','t','.','c','o','m',0,
+    'p','o','s','t','h','e','a','v','e','n','.','n','e','t',0,
+    't','h','e','b','l','a','z','e','.','c','o','m',0,
+    'p','i','x','l','r','.','c','o','m',0,
+    'k','h','a','r','k','o','v','.','u','a',0,
+    'l','y','n','d','a','.','c','o','m',0,
+    'j','o','i','n','s','.','c','o','m',0,
+    'u','n','i','b','o','.','i','t',0,
+    'c','o','o','c','a','n','.','j','p',0,
+    't','h','e','j','a','k','a','r','t','a','p','o','s','t','.','c','o','m',0,
+    'm','e','d','p','a','g','e','t','o','d','a','y','.','c','o','m',0,
+    'e','d','u','t','o','p','i','a','.','o','r','g',0,
+    'm','i','c','h','e','l','i','n','.','c','o','m',0,
+    'u','g','e','n','t','.','b','e',0,
+    'r','a','d','i','o','.','c','o','m',0,
+    'i','d','v','.','t','w',0,
+    'p','o','e','t','s','.','o','r','g',0,
+    's','i','m','p','l','e','c','a','s','t','.','c','o','m',0,
+    'f','o','r','t','u','n','e','c','i','t','y','.','c','o','m',0,
+    'l','o','d','z','.','p','l',0,
+    'd','h','g','a','t','e','.','c','o','m',0,
+    'e','u','r','o','p','a','p','r','e','s','s','.','e','s',0,
+    's','h','o','r','t','u','r','l','.','a','t',0,
+    'k','o','r','e','a','h','e','r','a','l','d','.','c','o','m',0,
+    't','o','w','n','h','a','l','l','.','c','o','m',0,
+    's','f','w','e','e','k','l','y','.','c','o','m',0,
+    'm','e','t','a','l','-','a','r','c','h','i','v','e','s','.','c','o','m',0,
+    'i','n','t','e','r','f','a','x','.','r','u',0,
+    'c','b','i','n','s','i','g','h','t','s','.','c','o','m',0,
+    'c','s','u','n','.','e','d','u',0,
+    'a','b','c','7','n','y','.','c','o','m',0,
+    'g','l','o','b','a','l','r','e','s','e','a','r','c','h','.','c','a',0,
+    'b','o','o','k','s','h','o','p','.','o','r','g',0,
+    'c','o','n','v','i','o','.','n','e','t',0,
+    'i','o','m','.','i','n','t',0,
+    'c','i','t','y','a','m','.','c','o','m',0,
+    'o','n','e','t','.','p','l',0,
+    'w','n','y','c','.','o','r','g',0,
+    'c','a','r','s','.','c','o','m',0,
+    'w','a','n','a','d','o','o','.','f','r',0,
+    'z','e','n','f','o','l','i','o','.','c','o','m',0,
+    'e','k','l','a','b','l','o','g','.','c','o','m',0,
+    'm','i','l','i','t','a','r','y','t','i','m','e','s','.','c','o','m',0,
+    't','e','e','s','p','r','i','n','g','.','c','o','m',0,
+    'l','a','c','o','u','n','t','y','.','g','o','v',0,
+    'm','o','r','g','a','n','s','t','a','n','l','e','y','.','c','o','m',0,
+    'u','s','a','s','k','.','c','a',0,
+    'b','r','a','v','e','.','c','o','m',0,
+    'j','p','n','.','o','r','g',0,
+    'm','o','o','n','f','r','u','i','t','.','c','o','m',0,
+    'e','p','i','.','o','r','g',0,
+    'r','e','a','c','t','j','s','.','o','r','g',0,
+    's','t','a','p','l','e','s','.','c','o','m',0,
+    'n','e','t','c','r','a','f','t','.','c','o','m',0,
+    'j','a','l','b','u','m','.','n','e','t',0,
+    'c','v','s','.','c','o','m',0,
+    'w','s','i','m','g','.','c','o','m',0,
+    'a','a','d','.','o','r','g',0,
+    'g','e','n','c','a','t','.','c','a','t',0,
+    'a','l','m','a','n','a','c','.','c','o','m',0,
+    'b','l','o','g','g','e','r','s','d','e','l','i','g','h','t','.','d','k',0,
+    'r','a','d','i','o','-','c','a','n','a','d','a','.','c','a',0,
+    'o','x','f','a','m','.','o','r','g',0,
+    'h','u','-','b','e','r','l','i','n','.','d','e',0,
+    'd','r','e','a','m','h','o','s','t','e','r','s','.','c','o','m',0,
+    'b','a','s','f','.','c','o','m',0,
+    'm','s','i','.','c','o','m',0,
+    'p','o','c','k','e','t','-','l','i','n','t','.','c','o','m',0,
+    'l','o','u','i','s','v','u','i','t','t','o','n','.','c','o','m',0,
+    's','o','c','i','a','l','m','e','d','i','a','e','x','a','m','i','n','e','r','.','c','o','m',0,
+    'l','i','u','.','s','e',0,
+    'c','h','r','i','s','t','i','a','n','p','o','s','t','.','c','o','m',0,
+    '9','t','o','5','g','o','o','g','l','e','.','c','o','m',0,
+    'i','a','r','c','.','f','r',0,
+    'v','e','r','y','w','e','l','l','f','a','m','i','l','y','.','c','o','m',0,
+    'n','x','p','.','c','o','m',0,
+    'n','z','z','.','c','h',0,
+    'd','j','a','n','g','o','p','r','o','j','e','c','t','.','c','o','m',0,
+    'n','e','t','g','e','a','r','.','c','o','m',0,
+    'c','o','d','e','.','o','r','g',0,
+    'i','n','d','i','e','b','o','u','n','d','.','o','r','g',0,
+    'r','e','d','d','.','i','t',0,
+    't','o','w','n','a','n','d','c','o','u','n','t','r','y','m','a','g','.','c','o','m',0,
+    'i','u','p','u','i','.','e','d','u',0,
+    'n','a','z','w','a','.','p','l',0,
+    'b','l','o','g','f','r','e','e','l','y','.','n','e','t',0,
+    'h','e','r','a','l','d','s','c','o','t','l','a','n','d','.','c','o','m',0,
+    'r','a','r','a','t','h','e','m','e','s','.','c','o','m',0,
+    'm','a','k','e','z','i','n','e','.','c','o','m',0,
+    'n','e','t','w','o','r','k','s','o','l','u','t','i','o','n','s','.','c','o','m',0,
+    'j','a','m','i','e','o','l','i','v','e','r','.','c','o','m',0,
+    'd','o','w','n','l','o','a','d','.','c','o','m',0,
+    't','i','d','a','l','.','c','o','m',0,
+    'p','i','x','i','v','.','n','e','t',0,
+    'd','i','p','l','o','.','d','e',0,
+    'm','a','s','t','e','r','c','l','a','s','s','.','c','o','m',0,
+    'n','s','c','.','o','r','g',0,
+    '5','1','j','o','b','.','c','o','m',0,
+    'f','i','g','m','a','.','c','o','m',0,
+    'm','a','c','l','e','a','n','s','.','c','a',0,
+    'i','n','f','o','q','.','c','o','m',0,
+    'l','o','v','e','t','o','k','n','o','w','.','c','o','m',0,
+    'v','i','b','e','r','.','c','o','m',0,
+    'l','e','p','o','i','n','t','.','f','r',0,
+    'm','g','m','r','e','s','o','r','t','s','.','c','o','m',0,
+    'f','i','r','e','f','o','x','.','c','o','m',0,
+    'm','u','c','k','r','a','c','k','.','c','o','m',0,
+    's','l','a','s','h','f','i','l','m','.','c','o','m',0,
+    'b','s','h','a','r','e','.','c','n',0,
+    'a','p','k','p','u','r','e','.','c','o','m',0,
+    'm','o','n','e','y','s','a','v','i','n','g','e','x','p','e','r','t','.','c','o','m',0,
+    'c','a','r','r','d','.','c','o',0,
+    'n','o','c','o','o','k','i','e','.','n','e','t',0,
+    'n','e','x','t','d','o','o','r','.','c','o','m',0,
+    's','m','a','s','h','w','o','r','d','s','.','c','o','m',0,
+    'r','u','t','u','b','e','.','r','u',0,
+    'c','o','m','p','u','t','e','r','h','o','p','e','.','c','o','m',0,
+    'n','e','u','.','e','d','u',0,
+    't','p','-','l','i','n','k','.','c','o','m',0,
+    'w','m','.','e','d','u',0,
+    'n','b','c','b','a','y','a','r','e','a','.','c','o','m',0,
+    'c','a','m','p','a','i','g','n','m','o','n','i','t','o','r','.','c','o','m',0,
+    'n','r','e','l','.','g','o','v',0,
+    'g','i','t','e','e','.','c','o','m',0,
+    'b','n','n','b','l','o','o','m','b','e','r','g','.','c','a',0,
+    'r','a','w','s','t','o','r','y','.','c','o','m',0,
+    'z','o','o','m','i','n','f','o','.','c','o','m',0,
+    'w','e','b','g','a','r','d','e','n','.','c','o','m',0,
+    'w','u','r','.','n','l',0,
+    'c','l','a','r','i','v','a','t','e','.','c','o','m',0,
+    'b','l','m','.','g','o','v',0,
+    'c','a','r','l','e','t','o','n','.','c','a',0,
+    'w','o','n','d','e','r','s','h','a','r','e','.','c','o','m',0,
+    'b','a','h','n','.','d','e',0,
+    't','h','o','u','g','h','t','c','a','t','a','l','o','g','.','c','o','m',0,
+    'k','e','n','t','.','e','d','u',0,
+    'p','r','i','n','t','f','r','i','e','n','d','l','y','.','c','o','m',0,
+    'l','i','n','u','x','f','o','u','n','d','a','t','i','o','n','.','o','r','g',0,
+    'u','n','f','p','a','.','o','r','g',0,
+    'c','o','o','k','p','a','d','.','c','o','m',0,
+    'c','b','r','.','c','o','m',0,
+    'n','e','w','g','r','o','u','n','d','s','.','c','o','m',0,
+    'y','o','u','d','a','o','.','c','o','m',0,
+    'f','-','s','e','c','u','r','e','.','c','o','m',0,
+    'k','n','i','g','h','t','l','a','b','.','c','o','m',0,
+    'g','a','z','e','t','a','.','r','u',0,
+    'k','h','.','u','a',0,
+    'm','a','g','c','l','o','u','d','.','c','o','m',0,
+    'o','b','e','r','l','o','.','c','o','m',0,
+    'c','o','u','r','t','h','o','u','s','e','n','e','w','s','.','c','o','m',0,
+    'a','l','a','m','y','.','c','o','m',0,
+    '9','n','e','w','s','.','c','o','m',0,
+    'a','d','l','.','o','r','g',0,
+    'b','l','o','o','m','s','b','u','r','y','.','c','o','m',0,
+    'c','i','t','y','l','a','b','.','c','o','m',0,
+    'a','s','k','m','e','n','.','c','o','m',0,
+    'o','m','a','h','a','.','c','o','m',0,
+    'g','l','o','b','a','l','s','e','c','u','r','i','t','y','.','o','r','g',0,
+    'a','u','.','d','k',0,
+    'p','r','o','v','e','n','e','x','p','e','r','t','.','c','o','m',0,
+    'o','b','s','p','r','o','j','e','c','t','.','c','o','m',0,
+    'n','c','a','a','.','c','o','m',0,
+    'n','g','a','.','g','o','v',0,
+    'r','e','n','r','e','n','.','c','o','m',0,
+    'c','u','n','i','.','c','z',0,
+    'n','m','.','u','s',0,
+    'f','l','i','p','k','a','r','t','.','c','o','m',0,
+    'h','s','f','o','r','m','s','.','c','o','m',0,
+    'a','u','s','w','a','e','r','t','i','g','e','s','-','a','m','t','.','d','e',0,
+    'd','a','l','.','c','a',0,
+    's','e','a','t','t','l','e','.','g','o','v',0,
+    'h','r','e','f','.','l','i',0,
+    'b','o','x','o','f','f','i','c','e','m','o','j','o','.','c','o','m',0,
+    'w','e','b','s','h','o','t','s','.','c','o','m',0,
+    'a','d','n','.','c','o','m',0,
+    'f','u','j','i','f','i','l','m','.','c','o','m',0,
+    'e','u','r','o','p','e','a','n','a','.','e','u',0,
+    'y','o','u','g','o','v','.','c','o','m',0,
+    'p','s','y','c','h','i','a','t','r','y','o','n','l','i','n','e','.','o','r','g',0,
+    'a','s','m','e','.','o','r','g',0,
+    'd','e','r','s','t','a','n','d','a','r','d','.','a','t',0,
+    'f','o','r','t','i','n','e','t','.','c','o','m',0,
+    'i','h','e','r','b','.','c','o','m',0,
+    'r','w','t','h','-','a','a','c','h','e','n','.','d','e',0,
+    'c','l','e','a','n','t','e','c','h','n','i','c','a','.','c','o','m',0,
+    'n','r','f','.','c','o','m',0,
+    'k','o','d','a','k','.','c','o','m',0,
+    'u','r','b','a','n','.','o','r','g',0,
+    't','o','p','s','y','.','c','o','m',0,
+    't','h','e','-','s','c','i','e','n','t','i','s','t','.','c','o','m',0,
+    'n','u','t','r','i','t','i','o','n','.','o','r','g',0,
+    'a','c','o','g','.','o','r','g',0,
+    'u','n','i','v','i','s','i','o','n','.','c','o','m',0,
+    'a','a','c','r','j','o','u','r','n','a','l','s','.','o','r','g',0,
+    'b','l','o','s','s','o','m','t','h','e','m','e','s','.','c','o','m',0,
+    'd','g','-','d','a','t','e','n','s','c','h','u','t','z','.','d','e',0,
+    'k','o','h','l','s','.','c','o','m',0,
+    'p','r','e','m','i','e','r','l','e','a','g','u','e','.','c','o','m',0,
+    'u','w','m','.','e','d','u',0,
+    'u','m','b','c','.','e','d','u',0,
+    't','i','m','e','s','n','o','w','n','e','w','s','.','c','o','m',0,
+    's','t','a','r','w','o','o','d','h','o','t','e','l','s','.','c','o','m',0,
+    'c','h','e','a','t','s','h','e','e','t','.','c','o','m',0,
+    'b','-','c','d','n','.','n','e','t',0,
+    'm','a','r','k','e','t','i','n','g','l','a','n','d','.','c','o','m',0,
+    's','e','a','r','s','.','c','o','m',0,
+    'h','e','a','l','t','h','g','r','a','d','e','s','.','c','o','m',0,
+    'b','i','t','c','o','i','n','t','a','l','k','.','o','r','g',0,
+    'y','o','u','r','t','a','n','g','o','.','c','o','m',0,
+    'i','n','t','e','r','n','a','t','i','o','n','a','l','w','o','m','e','n','s','d','a','y','.','c','o','m',0,
+    'g','a','n','d','i','.','n','e','t',0,
+    'u','o','t','t','a','w','a','.','c','a',0,
+    'o','u','t','l','o','o','k','i','n','d','i','a','.','c','o','m',0,
+    'p','s','y','c','h','i','a','t','r','y','.','o','r','g',0,
+    'e','c','f','r','.','g','o','v',0,
+    's','c','h','e','m','a','.','o','r','g',0,
+    'k','i','s','s','m','e','t','r','i','c','s','.','c','o','m',0,
+    's','f','s','u','.','e','d','u',0,
+    's','k','y','n','e','t','.','b','e',0,
+    'a','b','c','1','3','.','c','o','m',0,
+    's','e','c','o','n','d','l','i','f','e','.','c','o','m',0,
+    'u','n','i','-','b','o','n','n','.','d','e',0,
+    'b','i','s','.','o','r','g',0,
+    'e','x','p','l','o','r','a','t','o','r','i','u','m','.','e','d','u',0,
+    'r','o','g','e','r','e','b','e','r','t','.','c','o','m',0,
+    'd','o','m','a','i','n','.','c','o','m',0,
+    'm','e','d','i','c','a','l','d','a','i','l','y','.','c','o','m',0,
+    'f','a','n','d','a','n','g','o','.','c','o','m',0,
+    'm','i','c','r','o','c','h','i','p','.','c','o','m',0,
+    'u','d','n','.','c','o','m',0,
+    'd','e','c','c','a','n','h','e','r','a','l','d','.','c','o','m',0,
+    't','h','e','d','e','n','v','e','r','c','h','a','n','n','e','l','.','c','o','m',0,
+    'u','n','r','e','a','l','e','n','g','i','n','e','.','c','o','m',0,
+    'u','p','f','.','e','d','u',0,
+    'r','e','g','.','r','u',0,
+    'n','e','c','.','c','o','m',0,
+    's','p','a','r','k','f','u','n','.','c','o','m',0,
+    'f','r','e','e','h','o','s','t','i','a','.','c','o','m',0,
+    's','t','o','n','y','b','r','o','o','k','.','e','d','u',0,
+    'p','r','l','o','g','.','o','r','g',0,
+    'm','o','z','i','l','l','a','z','i','n','e','.','o','r','g',0,
+    's','c','r','e','e','n','c','a','s','t','.','c','o','m',0,
+    'g','o','u','v','e','r','n','e','m','e','n','t','.','f','r',0,
+    'h','e','r','a','l','d','t','r','i','b','u','n','e','.','c','o','m',0,
+    'w','a','l','l','e','t','h','u','b','.','c','o','m',0,
+    't','a','y','l','o','r','a','n','d','f','r','a','n','c','i','s','.','c','o','m',0,
+    'i','c','3','.','g','o','v',0,
+    'p','e','w','f','o','r','u','m','.','o','r','g',0,
+    'l','e','o','.','o','r','g',0,
+    'd','u','p','o','n','t','.','c','o','m',0,
+    'o','p','e','n','l','e','a','r','n','i','n','g','.','c','o','m',0,
+    't','o','r','r','e','n','t','f','r','e','a','k','.','c','o','m',0,
+    'o','s','c','a','r','s','.','o','r','g',0,
+    'p','r','i','v','a','c','y','p','o','l','i','c','i','e','s','.','c','o','m',0,
+    'n','u','m','b','e','o','.','c','o','m',0,
+    'd','e','a','d','s','p','i','n','.','c','o','m',0,
+    'b','e','c','k','e','r','s','h','o','s','p','i','t','a','l','r','e','v','i','e','w','.','c','o','m',0,
+    'p','o','w','e','l','l','s','.','c','o','m',0,
+    's','a','l','a','r','y','.','c','o','m',0,
+    'a','n','n','a','l','s','.','o','r','g',0,
+    'f','a','c','t','c','h','e','c','k','.','o','r','g',0,
+    'm','s','s','t','a','t','e','.','e','d','u',0,
+    'a','r','c','h','i','v','e','s','-','o','u','v','e','r','t','e','s','.','f','r',0,
+    'n','m','s','u','.','e','d','u',0,
+    'e','w','e','e','k','.','c','o','m',0,
+    'p','r','i','.','o','r','g',0,
+    'u','n','r','.','e','d','u',0,
+    'i','o','9','.','c','o','m',0,
+    'r','a','d','i','o','t','i','m','e','s','.','c','o','m',0,
+    'a','l','i','s','t','a','p','a','r','t','.','c','o','m',0,
+    's','o','n','y','p','i','c','t','u','r','e','s','.','c','o','m',0,
+    'g','e','e','k','s','f','o','r','g','e','e','k','s','.','o','r','g',0,
+    'a','e','i','.','o','r','g',0,
+    's','p','l','c','e','n','t','e','r','.','o','r','g',0,
+    'f','o','d','o','r','s','.','c','o','m',0,
+    'm','y','d','r','i','v','e','r','s','.','c','o','m',0,
+    'j','e','t','p','a','c','k','.','c','o','m',0,
+    'w','n','d','.','c','o','m',0,
+    'b','l','o','c','k','c','h','a','i','n','.','c','o','m',0,
+    'p','r','a','v','d','a','.','r','u',0,
+    'o','n','l','i','n','e','h','o','m','e','.','u','s',0,
+    '1','t','v','.','r','u',0,
+    't','h','e','w','a','l','t','d','i','s','n','e','y','c','o','m','p','a','n','y','.','c','o','m',0,
+    'a','d','b','.','o','r','g',0,
+    'd','o','k','u','w','i','k','i','.','o','r','g',0,
+    'e','i','n','n','e','w','s','.','c','o','m',0,
+    'g','o','o','d','m','o','r','n','i','n','g','a','m','e','r','i','c','a','.','c','o','m',0,
+    'v','u','e','j','s','.','o','r','g',0,
+    'd','i','g','i','c','e','r','t','.','c','o','m',0,
+    'b','i','b','l','e','h','u','b','.','c','o','m',0,
+    'l','i','g','h','t','w','i','d','g','e','t','.','c','o','m',0,
+    'b','o','l','.','c','o','m',0,
+    'w','a','s','h','i','n','g','t','o','n','i','a','n','.','c','o','m',0,
+    'a','r','k','a','n','s','a','s','.','g','o','v',0,
+    't','i','l','d','a','.','w','s',0,
+    'y','o','u','t','h','.','c','n',0,
+    'd','b','.','t','t',0,
+    'w','p','b','e','g','i','n','n','e','r','.','c','o','m',0,
+    'h','e','a','l','i','o','.','c','o','m',0,
+    't','h','o','m','a','s','n','e','t','.','c','o','m',0,
+    'w','h','m','c','s','.','c','o','m',0,
+    'a','c','t','i','v','e','c','a','m','p','a','i','g','n','.','c','o','m',0,
+    't','u','-','b','e','r','l','i','n','.','d','e',0,
+    'z','h','a','o','p','i','n','.','c','o','m',0,
+    's','p','o','k','e','s','m','a','n','.','c','o','m',0,
+    'c','r','a','z','y','e','g','g','.','c','o','m',0,
+    '8','t','r','a','c','k','s','.','c','o','m',0,
+    'a','t','.','u','a',0,
+    'f','a','n','f','i','c','t','i','o','n','.','n','e','t',0,
+    'p','o','s','t','a','n','d','c','o','u','r','i','e','r','.','c','o','m',0,
+    'c','o','u','n','t','e','r','p','u','n','c','h','.','o','r','g',0,
+    'a','8','.','n','e','t',0,
+    'm','n','n','.','c','o','m',0,
+    'f','a','n','p','o','p','.','c','o','m',0,
+    'a','l','a','b','a','m','a','.','g','o','v',0,
+    'f','u','l','l','e','r','t','o','n','.','e','d','u',0,
+    'c','o','i','n','g','e','c','k','o','.','c','o','m',0,
+    'n','b','c','d','f','w','.','c','o','m',0,
+    'p','r','i','v','a','c','y','p','o','l','i','c','y','o','n','l','i','n','e','.','c','o','m',0,
+    'p','i','k','t','o','c','h','a','r','t','.','c','o','m',0,
+    'n','b','c','w','a','s','h','i','n','g','t','o','n','.','c','o','m',0,
+    'p','l','u','r','a','l','s','i','g','h','t','.','c','o','m',0,
+    'e','c','w','i','d','.','c','o','m',0,
+    'b','o','b','v','i','l','a','.','c','o','m',0,
+    't','h','e','a','d','v','o','c','a','t','e','.','c','o','m',0,
+    'r','a','d','i','k','a','l','.','r','u',0,
+    'h','u','m','b','l','e','b','u','n','d','l','e','.','c','o','m',0,
+    'l','i','b','r','a','r','y','t','h','i','n','g','.','c','o','m',0,
+    'a','n','g','i','.','c','o','m',0,
+    'k','e','y','b','a','s','e','.','i','o',0,
+    'b','a','n','g','o','r','d','a','i','l','y','n','e','w','s','.','c','o','m',0,
+    'a','l','b','a','n','y','.','e','d','u',0,
+    'g','a','m','a','s','u','t','r','a','.','c','o','m',0,
+    'a','l','t','e','r','.','c','o','m',0,
+    'i','m','g','i','x','.','n','e','t',0,
+    'e','l','e','m','e','n','t','o','r','.','c','o','m',0,
+    'p','o','s','t','i','m','a','g','e','.','o','r','g',0,
+    'e','l','d','i','a','r','i','o','.','e','s',0,
+    'v','a','t','i','c','a','n','n','e','w','s','.','v','a',0,
+    'e','a','t','i','n','g','w','e','l','l','.','c','o','m',0,
+    'f','a','s','t','c','o','d','e','s','i','g','n','.','c','o','m',0,
+    'g','a','.','u','s',0,
+    'a','u','t','h','o','r','i','z','e','.','n','e','t',0,
+    'u','p','t','o','d','o','w','n','.','c','o','m',0,
+    'm','s','.','u','s',0,
+    's','p','h','i','n','x','-','d','o','c','.','o','r','g',0,
+    'a','n','l','.','g','o','v',0,
+    't','t','u','.','e','d','u',0,
+    'e','x','t','e','n','d','t','h','e','m','e','s','.','c','o','m',0,
+    'f','r','e','e','d','o','m','h','o','u','s','e','.','o','r','g',0,
+    'p','s','y','c','h','o','l','o','g','i','c','a','l','s','c','i','e','n','c','e','.','o','r','g',0,
+    'm','a','r','i','n','e','t','r','a','f','f','i','c','.','c','o','m',0,
+    'r','o','b','l','o','x','.','c','o','m',0,
+    'y','o','u','r','s','t','o','r','y','.','c','o','m',0,
+    's','o','f','t','b','a','n','k','.','j','p',0,
+    'r','s','-','o','n','l','i','n','e','.','c','o','m',0,
+    'g','r','u','b','h','u','b','.','c','o','m',0,
+    'r','i','c','h','m','o','n','d','.','c','o','m',0,
+    'e','p','s','o','n','.','c','o','m',0,
+    'j','s','f','i','d','d','l','e','.','n','e','t',0,
+    'k','i','n','g','5','.','c','o','m',0,
+    'e','t','y','m','o','n','l','i','n','e','.','c','o','m',0,
+    'a','n','y','d','e','s','k','.','c','o','m',0,
+    'm','e','d','i','a','i','t','e','.','c','o','m',0,
+    'k','-','s','t','a','t','e','.','e','d','u',0,
+    'e','l','p','e','r','i','o','d','i','c','o','.','c','o','m',0,
+    'h','i','g','h','s','n','o','b','i','e','t','y','.','c','o','m',0,
+    'n','e','t','f','i','r','m','s','.','c','o','m',0,
+    'f','e','e','d','i','n','g','a','m','e','r','i','c','a','.','o','r','g',0,
+    'i','m','a','g','e','s','-','a','m','a','z','o','n','.','c','o','m',0,
+    's','p','e','c','i','f','i','c','f','e','e','d','s','.','c','o','m',0,
+    'c','l','o','u','d','w','a','y','s','.','c','o','m',0,
+    't','e','a','m','u','s','a','.','o','r','g',0,
+    'u','a','f','.','e','d','u',0,
+    'z','p','.','u','a',0,
+    'n','y','t','i','.','m','s',0,
+    'c','o','m','s','e','n','z','.','c','o','m',0,
+    'f','u','n','n','y','o','r','d','i','e','.','c','o','m',0,
+    't','h','e','f','r','e','e','l','i','b','r','a','r','y','.','c','o','m',0,
+    'f','a','m','i','l','y','h','a','n','d','y','m','a','n','.','c','o','m',0,
+    's','i','n','a','.','c','n',0,
+    'n','r','w','.','d','e',0,
+    't','r','u','s','t','e','d','r','e','v','i','e','w','s','.','c','o','m',0,
+    't','u','c','s','o','n','.','c','o','m',0,
+    'o','a','s','.','o','r','g',0,
+    't','t','l','i','n','k','.','c','o','m',0,
+    'c','a','r','e','2','.','c','o','m',0,
+    'n','o','s','.','n','l',0,
+    'c','h','i','p','.','d','e',0,
+    'o','t','t','a','w','a','c','i','t','i','z','e','n','.','c','o','m',0,
+    'e','t','h','e','r','s','c','a','n','.','i','o',0,
+    's','o','u','t','h','w','e','s','t','.','c','o','m',0,
+    'k','h','n','.','o','r','g',0,
+    'd','r','a','x','e','.','c','o','m',0,
+    'o','a','n','d','a','.','c','o','m',0,
+    'k','r','o','g','e','r','.','c','o','m',0,
+    '1','2','3','7','1','.','c','n',0,
+    'r','a','p','p','l','e','r','.','c','o','m',0,
+    'n','r','k','.','n','o',0,
+    'g','a','m','e','s','i','n','d','u','s','t','r','y','.','b','i','z',0,
+    'n','-','t','v','.','d','e',0,
+    'p','h','o','n','e','a','r','e','n','a','.','c','o','m',0,
+    'g','e','n','i','a','l','.','l','y',0,
+    'u','m','t','.','e','d','u',0,
+    's','u','b','w','a','y','.','c','o','m',0,
+    'b','r','a','n','d','e','i','s','.','e','d','u',0,
+    'n','e','u','r','o','l','o','g','y','.','o','r','g',0,
+    'c','c','m','.','n','e','t',0,
+    'n','o','-','i','p','.','o','r','g',0,
+    'l','i','n','u','x','.','o','r','g',0,
+    'm','u','s','e','s','c','o','r','e','.','c','o','m',0,
+    's','s','l','l','a','b','s','.','c','o','m',0,
+    'u','s','t','r','.','g','o','v',0,
+    'd','e','.','t','l',0,
+    'r','u','.','c','o','m',0,
+    't','u','-','d','r','e','s','d','e','n','.','d','e',0,
+    's','u','r','v','e','y','g','i','z','m','o','.','c','o','m',0,
+    'u','r','i','.','e','d','u',0,
+    'l','u','c','.','e','d','u',0,
+    'c','o','m','p','u','t','e','r','.','o','r','g',0,
+    't','o','m','t','o','m','.','c','o','m',0,
+    'r','x','l','i','s','t','.','c','o','m',0,
+    'r','a','i','.','i','t',0,
+    'o','n','e','.','c','o','m',0,
+    'm','c','a','l','l','.','c','o','m',0,
+    'm','e','r','c','k','.','c','o','m',0,
+    'e','a','t','t','h','i','s','.','c','o','m',0,
+    'a','n','o','t','e','p','a','d','.','c','o','m',0,
+    'c','o','m','m','e','r','c','e','.','g','o','v',0,
+    'a','z','.','g','o','v',0,
+    'r','e','p','u','b','l','i','c','w','o','r','l','d','.','c','o','m',0,
+    'r','a','z','e','r','.','c','o','m',0,
+    'x','e','r','o','.','c','o','m',0,
+    'm','o','n','e','y','.','c','o','m',0,
+    't','e','c','h','i','n','a','s','i','a','.','c','o','m',0,
+    '2','0','m','i','n','u','t','e','s','.','f','r',0,
+    'g','a','r','a','n','t','e','p','r','i','v','a','c','y','.','i','t',0,
+    'u','n','l','v','.','e','d','u',0,
+    'f','r','e','e','i','m','a','g','e','s','.','c','o','m',0,
+    'f','n','a','c','.','c','o','m',0,
+    'd','e','l','l','t','e','c','h','n','o','l','o','g','i','e','s','.','c','o','m',0,
+    'n','e','o','w','i','n','.','n','e','t',0,
+    'm','a','i','l','e','r','l','i','t','e','.','c','o','m',0,
+    'u','o','g','u','e','l','p','h','.','c','a',0,
+    'p','r','i','m','e','v','i','d','e','o','.','c','o','m',0,
+    'l','a','n','l','.','g','o','v',0,
+    'b','a','n','g','g','o','o','d','.','c','o','m',0,
+    'd','d','n','s','.','n','e','t',0,
+    'p','r','f','.','h','n',0,
+    's','a','n','s','.','o','r','g',0,
+    'k','h','o','u','.','c','o','m',0,
+    'd','n','.','u','a',0,
+    'a','v','v','o','.','c','o','m',0,
+    's','o','c','i','e','t','y','6','.','c','o','m',0,
+    'p','g','.','c','o','m',0,
+    'v','u','.','n','l',0,
+    'n','e','t','-','a','-','p','o','r','t','e','r','.','c','o','m',0,
+    'w','s','w','s','.','o','r','g',0,
+    'b','g','e','t','.','r','u',0,
+    'c','a','e','s','a','r','s','.','c','o','m',0,
+    'a','u','d','a','c','i','t','y','t','e','a','m','.','o','r','g',0,
+    'u','n','i','b','e','.','c','h',0,
+    'w','e','s','t','e','r','n','u','n','i','o','n','.','c','o','m',0,
+    'f','l','e','x','j','o','b','s','.','c','o','m',0,
+    'i','n','t','e','r','e','s','t','i','n','g','e','n','g','i','n','e','e','r','i','n','g','.','c','o','m',0,
+    'a','s','t','m','.','o','r','g',0,
+    'c','o','g','n','i','t','o','f','o','r','m','s','.','c','o','m',0,
+    'b','i','z','.','u','a',0,
+    'b','u','y','m','e','a','c','o','f','f','e','e','.','c','o','m',0,
+    'p','r','n','t','s','c','r','.','c','o','m',0,
+    'd','u','.','e','d','u',0,
+    't','a','z','.','d','e',0,
+    'o','p','m','.','g','o','v',0,
+    't','h','e','r','i','n','g','e','r','.','c','o','m',0,
+    'v','e','d','o','m','o','s','t','i','.','r','u',0,
+    'a','r','t','.','p','l',0,
+    's','d','.','g','o','v',0,
+    'm','o','v','e','m','b','e','r','.','c','o','m',0,
+    'p','a','n','d','a','s','e','c','u','r','i','t','y','.','c','o','m',0,
+    'c','i','t','y','n','e','w','s','.','c','a',0,
+    'v','e','o','h','.','c','o','m',0,
+    'd','a','n','g','d','a','n','g','.','c','o','m',0,
+    't','u','l','s','a','w','o','r','l','d','.','c','o','m',0,
+    'm','a','r','k','s','a','n','d','s','p','e','n','c','e','r','.','c','o','m',0,
+    't','e','c','h','n','e','t','.','c','o','m',0,
+    'c','r','n','.','c','o','m',0,
+    'h','o','m','e','t','a','l','k','.','c','o','m',0,
+    'm','e','l','t','w','a','t','e','r','.','c','o','m',0,
+    'c','j','r','.','o','r','g',0,
+    '2','4','7','w','a','l','l','s','t','.','c','o','m',0,
+    'i','h','s','m','a','r','k','i','t','.','c','o','m',0,
+    'c','o','n','s','u','l','t','a','n','t','.','r','u',0,
+    'd','t','i','c','.','m','i','l',0,
+    'a','u','t','i','s','m','s','p','e','a','k','s','.','o','r','g',0,
+    'o','s','c','e','.','o','r','g',0,
+    'c','a','n','a','d','i','a','n','t','i','r','e','.','c','a',0,
+    'u','n','g','l','o','b','a','l','c','o','m','p','a','c','t','.','o','r','g',0,
+    'p','o','s','t','i','m','a','g','e','s','.','o','r','g',0,
+    'i','u','c','n','r','e','d','l','i','s','t','.','o','r','g',0,
+    'd','e','n','o','f','g','e','e','k','.','c','o','m',0,
+    'o','s','f','.','i','o',0,
+    'b','e','g','e','t','.','t','e','c','h',0,
+    't','h','e','i','e','t','.','o','r','g',0,
+    's','c','u','.','e','d','u',0,
+    'v','i','a','d','e','o','.','c','o','m',0,
+    'e','c','o','w','a','t','c','h','.','c','o','m',0,
+    'w','i','l','l','i','a','m','s','-','s','o','n','o','m','a','.','c','o','m',0,
+    'd','a','t','i','n','g','r','a','n','k','i','n','g','.','n','e','t',0,
+    'g','o','s','u','s','l','u','g','i','.','r','u',0,
+    'm','a','n','u','t','d','.','c','o','m',0,
+    'k','u','b','e','r','n','e','t','e','s','.','i','o',0,
+    'i','m','g','b','b','.','c','o','m',0,
+    'n','e','w','y','o','r','k','f','e','d','.','o','r','g',0,
+    'a','e','a','w','e','b','.','o','r','g',0,
+    'i','m','g','f','l','i','p','.','c','o','m',0,
+    'b','e','a','t','p','o','r','t','.','c','o','m',0,
+    'a','d','a','a','.','o','r','g',0,
+    't','r','u','t','h','o','u','t','.','o','r','g',0,
+    'c','o','n','t','a','.','c','c',0,
+    'z','o','h','o','p','u','b','l','i','c','.','c','o','m',0,
+    's','p','o','r','t','s','k','e','e','d','a','.','c','o','m',0,
+    'c','o','o','k','i','e','c','o','n','s','e','n','t','.','c','o','m',0,
+    't','h','e','b','a','s','e','.','i','n',0,
+    'g','o','h','u','g','o','.','i','o',0,
+    'a','f','t','o','n','b','l','a','d','e','t','.','s','e',0,
+    'a','c','r','o','n','i','s','.','c','o','m',0,
+    'c','t','v','.','c','a',0,
+    'a','z','l','y','r','i','c','s','.','c','o','m',0,
+    'b','e','t','a','n','e','w','s','.','c','o','m',0,
+    'p','e','t','i','t','i','o','n','o','n','l','i','n','e','.','c','o','m',0,
+    'p','h','i','l','s','t','a','r','.','c','o','m',0,
+    'j','o','h','n','l','e','w','i','s','.','c','o','m',0,
+    'w','f','a','a','.','c','o','m',0,
+    '3','9','.','n','e','t',0,
+    'c','r','e','d','i','t','-','s','u','i','s','s','e','.','c','o','m',0,
+    'a','a','a','s','.','o','r','g',0,
+    's','p','a','r','k','n','o','t','e','s','.','c','o','m',0,
+    'd','i','g','i','t','a','l','o','c','e','a','n','s','p','a','c','e','s','.','c','o','m',0,
+    'w','c','c','f','t','e','c','h','.','c','o','m',0,
+    'm','y','f','o','n','t','s','.','c','o','m',0,
+    'b','r','o','w','n','p','a','p','e','r','t','i','c','k','e','t','s','.','c','o','m',0,
+    'w','i','k','i','d','a','t','a','.','o','r','g',0,
+    't','e','l','e','n','e','t','.','b','e',0,
+    'u','m','b','l','r','.','c','o','m',0,
+    'i','y','f','u','b','h','.','c','o','m',0,
+    'd','z','w','w','w','.','c','o','m',0,
+    'b','a','m','b','o','o','h','r','.','c','o','m',0,
+    't','h','e','j','o','u','r','n','a','l','.','i','e',0,
+    'n','e','b','r','a','s','k','a','.','g','o','v',0,
+    'j','d','p','o','w','e','r','.','c','o','m',0,
+    'c','h','e','g','g','.','c','o','m',0,
+    'f','s','c','.','o','r','g',0,
+    'l','o','o','m','.','c','o','m',0,
+    'l','o','c','k','h','e','e','d','m','a','r','t','i','n','.','c','o','m',0,
+    'u','t','d','a','l','l','a','s','.','e','d','u',0,
+    'c','r','e','d','l','y','.','c','o','m',0,
+    's','e','r','v','e','r','f','a','u','l','t','.','c','o','m',0,
+    'n','i','u','.','e','d','u',0,
+    'n','a','u','.','e','d','u',0,
+    'g','o','t','o','.','c','o','m',0,
+    'k','a','i','s','e','r','p','e','r','m','a','n','e','n','t','e','.','o','r','g',0,
+    'y','f','r','o','g','.','c','o','m',0,
+    'm','h','a','n','a','t','i','o','n','a','l','.','o','r','g',0,
+    'w','i','n','n','i','p','e','g','f','r','e','e','p','r','e','s','s','.','c','o','m',0,
+    'a','n','n','u','a','l','c','r','e','d','i','t','r','e','p','o','r','t','.','c','o','m',0,
+    'a','v','m','a','.','o','r','g',0,
+    'g','l','o','b','a','l','c','i','t','i','z','e','n','.','o','r','g',0,
+    'e','b','a','u','m','s','w','o','r','l','d','.','c','o','m',0,
+    'i','c','e','.','g','o','v',0,
+    't','e','n','s','o','r','f','l','o','w','.','o','r','g',0,
+    'c','o','c','a','-','c','o','l','a','c','o','m','p','a','n','y','.','c','o','m',0,
+    '9','g','a','g','.','c','o','m',0,
+    'd','a','z','e','d','d','i','g','i','t','a','l','.','c','o','m',0,
+    't','h','e','h','a','c','k','e','r','n','e','w','s','.','c','o','m',0,
+    't','o','r','o','n','t','o','.','c','a',0,
+    'a','d','v','.','b','r',0,
+    'm','a','r','k','e','t','s','a','n','d','m','a','r','k','e','t','s','.','c','o','m',0,
+    'n','e','w','s','v','i','n','e','.','c','o','m',0,
+    'l','a','.','g','o','v',0,
+    'a','u','d','i','o','b','o','o','m','.','c','o','m',0,
+    'm','o','b','i','r','i','s','e','.','c','o','m',0,
+    'a','m','e','b','a','.','j','p',0,
+    'g','e','n','e','r','a','t','e','p','r','i','v','a','c','y','p','o','l','i','c','y','.','c','o','m',0,
+    'f','o','r','w','a','r','d','.','c','o','m',0,
+    'm','e','d','t','r','o','n','i','c','.','c','o','m',0,
+    'n','s','.','c','a',0,
+    'c','a','r','b','o','n','m','a','d','e','.','c','o','m',0,
+    'h','a','r','l','e','y','-','d','a','v','i','d','s','o','n','.','c','o','m',0,
+    'k','o','n','g','r','e','g','a','t','e','.','c','o','m',0,
+    'u','m','a','n','i','t','o','b','a','.','c','a',0,
+    't','e','s','.','c','o','m',0,
+    'a','r','m','.','c','o','m',0,
+    't','a','l','k','i','n','g','p','o','i','n','t','s','m','e','m','o','.','c','o','m',0,
+    'n','e','i','m','a','n','m','a','r','c','u','s','.','c','o','m',0,
+    'e','a','r','t','h','s','k','y','.','o','r','g',0,
+    'a','t','l','a','n','t','i','c','c','o','u','n','c','i','l','.','o','r','g',0,
+    'i','n','f','u','s','i','o','n','s','o','f','t','.','c','o','m',0,
+    '1','p','a','s','s','w','o','r','d','.','c','o','m',0,
+    '5','8','.','c','o','m',0,
+    'm','i','k','e','c','r','m','.','c','o','m',0,
+    'a','i','r','c','a','n','a','d','a','.','c','o','m',0,
+    's','t','r','e','e','t','i','n','s','i','d','e','r','.','c','o','m',0,
+    'h','a','o','1','2','3','.','c','o','m',0,
+    'm','o','n','t','a','n','a','.','e','d','u',0,
+    'f','l','i','g','h','t','a','w','a','r','e','.','c','o','m',0,
+    'w','p','c','o','m','s','t','a','g','i','n','g','.','c','o','m',0,
+    's','u','c','u','r','i','.','n','e','t',0,
+    'p','u','r','e','v','o','l','u','m','e','.','c','o','m',0,
+    'j','a','c','o','b','i','n','m','a','g','.','c','o','m',0,
+    'u','s','c','c','b','.','o','r','g',0,
+    'a','l','l','s','t','a','t','e','.','c','o','m',0,
+    'm','y','f','l','o','r','i','d','a','.','c','o','m',0,
+    'd','i','o','r','.','c','o','m',0,
+    'b','l','a','c','k','r','o','c','k','.','c','o','m',0,
+    'e','s','c','h','o','l','a','r','s','h','i','p','.','o','r','g',0,
+    'p','a','p','e','r','.','l','i',0,
+    'r','e','t','a','i','l','m','e','n','o','t','.','c','o','m',0,
+    'j','c','p','e','n','n','e','y','.','c','o','m',0,
+    's','a','g','e','.','c','o','m',0,
+    'e','a','t','o','n','.','c','o','m',0,
+    'u','v','.','e','s',0,
+    'a','f','t','h','e','m','e','s','.','c','o','m',0,
+    'w','i','n','a','m','p','.','c','o','m',0,
+    'c','b','o','.','g','o','v',0,
+    'h','o','l','l','y','w','o','o','d','l','i','f','e','.','c','o','m',0,
+    'a','s','i','a','o','n','e','.','c','o','m',0,
+    'd','a','i','l','y','s','a','b','a','h','.','c','o','m',0,
+    'j','o','i','n','.','c','h','a','t',0,
+    'm','h','t','h','e','m','e','s','.','c','o','m',0,
+    'w','p','-','r','o','y','a','l','.','c','o','m',0,
+    'w','p','z','o','o','m','.','c','o','m',0,
+    'i','n','t','e','r','i','a','.','p','l',0,
+    'h','t','c','.','c','o','m',0,
+    's','i','r','i','u','s','x','m','.','c','o','m',0,
+    'j','a','c','k','s','o','n','v','i','l','l','e','.','c','o','m',0,
+    'u','n','i','-','f','r','e','i','b','u','r','g','.','d','e',0,
+    'b','e','p','r','e','s','s','.','c','o','m',0,
+    'm','i','c','h','a','e','l','s','.','c','o','m',0,
+    'u','m','b','.','e','d','u',0,
+    'c','b','a','.','p','l',0,
+    'o','f','f','i','c','e','d','e','p','o','t','.','c','o','m',0,
+    'i','v','o','o','x','.','c','o','m',0,
+    'r','e','s','e','a','r','c','h','a','n','d','m','a','r','k','e','t','s','.','c','o','m',0,
+    'n','e','w','s','w','i','s','e','.','c','o','m',0,
+    'u','n','a','i','d','s','.','o','r','g',0,
+    'a','m','a','r','a','.','o','r','g',0,
+    'm','a','i','l','-','a','r','c','h','i','v','e','.','c','o','m',0,
+    'k','d','v','r','.','c','o','m',0,
+    'a','a','o','.','o','r','g',0,
+    'n','w','f','.','o','r','g',0,
+    'j','h','s','p','h','.','e','d','u',0,
+    'e','l','t','i','e','m','p','o','.','c','o','m',0,
+    's','i','m','p','l','e','m','a','c','h','i','n','e','s','.','o','r','g',0,
+    'c','h','i','c','a','g','o','.','g','o','v',0,
+    'g','o','d','a','d','d','y','s','i','t','e','s','.','c','o','m',0,
+    'k','i','a','.','c','o','m',0,
+    'i','h','t','.','c','o','m',0,
+    'm','y','r','e','c','i','p','e','s','.','c','o','m',0,
+    'u','p','m','.','e','s',0,
+    'c','c','b','.','c','o','m',0,
+    'c','h','u','r','c','h','o','f','j','e','s','u','s','c','h','r','i','s','t','.','o','r','g',0,
+    'w','o','m','a','n','s','d','a','y','.','c','o','m',0,
+    'i','n','d','i','a','m','a','r','t','.','c','o','m',0,
+    'd','e','s','e','r','e','t','n','e','w','s','.','c','o','m',0,
+    'a','n','i','m','o','t','o','.','c','o','m',0,
+    'c','l','i','c','k','o','n','d','e','t','r','o','i','t','.','c','o','m',0,
+    't','a','x','f','o','u','n','d','a','t','i','o','n','.','o','r','g',0,
+    'g','u','.','s','e',0,
+    '6','a','b','c','.','c','o','m',0,
+    'e','q','u','i','f','a','x','.','c','o','m',0,
+    'f','i','l','m','k','o','v','a','s','i','.','o','r','g',0,
+    'c','o','u','r','t','l','i','s','t','e','n','e','r','.','c','o','m',0,
+    'e','m','p','o','w','h','e','r','.','c','o','m',0,
+    'a','r','t','h','r','i','t','i','s','.','o','r','g',0,
+    'c','u','l','t','o','f','m','a','c','.','c','o','m',0,
+    'k','l','m','.','c','o','m',0,
+    '9','9','d','e','s','i','g','n','s','.','c','o','m',0,
+    'v','i','r','g','i','n','.','c','o','m',0,
+    'c','o','r','p','o','r','a','t','e','-','i','r','.','n','e','t',0,
+    'c','a','l','m','.','c','o','m',0,
+    'w','e','l','l','a','n','d','g','o','o','d','.','c','o','m',0,
+    'l','e','a','g','u','e','o','f','l','e','g','e','n','d','s','.','c','o','m',0,
+    'v','i','d','e','o','s','h','u','b','.','c','o','m',0,
+    'w','r','o','c','.','p','l',0,
+    'u','n','i','v','e','r','s','e','t','o','d','a','y','.','c','o','m',0,
+    'r','a','m','s','e','y','s','o','l','u','t','i','o','n','s','.','c','o','m',0,
+    'e','i','u','.','c','o','m',0,
+    'r','o','o','t','s','w','e','b','.','c','o','m',0,
+    'f','l','a','g','c','o','u','n','t','e','r','.','c','o','m',0,
+    'l','o','n','g','i','s','l','a','n','d','.','c','o','m',0,
+    'd','r','e','a','m','w','i','d','t','h','.','o','r','g',0,
+    'c','h','e','v','r','o','l','e','t','.','c','o','m',0,
+    'c','o','m','p','u','s','e','r','v','e','.','c','o','m',0,
+    'u','n','u','.','e','d','u',0,
+    'w','a','t','e','r','s','t','o','n','e','s','.','c','o','m',0,
+    'w','o','r','l','d','o','f','w','a','r','c','r','a','f','t','.','c','o','m',0,
+    'x','t','g','e','m','.','c','o','m',0,
+    't','i','a','n','y','a','.','c','n',0,
+    'e','u','r','o','s','p','o','r','t','.','c','o','m',0,
+    'r','a','d','i','o','f','r','a','n','c','e','.','f','r',0,
+    'c','t','f','a','s','s','e','t','s','.','n','e','t',0,
+    't','e','r','m','l','y','.','i','o',0,
+    's','t','.','c','o','m',0,
+    's','i','l','.','o','r','g',0,
+    's','i','m','p','l','y','p','s','y','c','h','o','l','o','g','y','.','o','r','g',0,
+    'u','i','d','a','h','o','.','e','d','u',0,
+    'b','e','a','.','g','o','v',0,
+    'j','a','p','a','n','t','o','d','a','y','.','c','o','m',0,
+    'n','y','s','e','.','c','o','m',0,
+    'u','c','p','r','e','s','s','.','e','d','u',0,
+    'c','o','r','p','o','r','a','t','e','f','i','n','a','n','c','e','i','n','s','t','i','t','u','t','e','.','c','o','m',0,
+    'g','o','d','o','t','e','n','g','i','n','e','.','o','r','g',0,
+    'g','o','b','a','n','k','i','n','g','r','a','t','e','s','.','c','o','m',0,
+    't','h','e','f','e','d','e','r','a','l','i','s','t','.','c','o','m',0,
+    'p','o','s','i','t','i','v','e','p','s','y','c','h','o','l','o','g','y','.','c','o','m',0,
+    'b','o','o','t','s','.','c','o','m',0,
+    'c','l','i','c','k','2','h','o','u','s','t','o','n','.','c','o','m',0,
+    'b','e','n','i','c','u','l','t','u','r','a','l','i','.','i','t',0,
+    'd','e','f','e','n','s','e','n','e','w','s','.','c','o','m',0,
+    'n','i','c','h','e','.','c','o','m',0,
+    'd','a','r','k','r','e','a','d','i','n','g','.','c','o','m',0,
+    'd','i','c','k','s','s','p','o','r','t','i','n','g','g','o','o','d','s','.','c','o','m',0,
+    'd','w','c','d','n','.','n','e','t',0,
+    'r','b','t','h','.','c','o','m',0,
+    'v','e','s','t','a','c','p','.','c','o','m',0,
+    't','o','r','.','c','o','m',0,
+    'i','n','s','i','d','e','r','i','n','t','e','l','l','i','g','e','n','c','e','.','c','o','m',0,
+    'd','i','e','.','n','e','t',0,
+    'm','i','s','t','e','r','p','o','l','l','.','c','o','m',0,
+    'q','a','t','a','r','a','i','r','w','a','y','s','.','c','o','m',0,
+    'j','u','s','t','j','a','r','e','d','.','c','o','m',0,
+    'm','i','a','m','i','n','e','w','t','i','m','e','s','.','c','o','m',0,
+    'a','l','l','e','g','r','o','.','p','l',0,
+    'w','e','n','t','h','e','m','e','s','.','c','o','m',0,
+    'd','i','s','c','o','v','e','r','.','c','o','m',0,
+    'c','m','e','g','r','o','u','p','.','c','o','m',0,
+    'r','o','l','l','c','a','l','l','.','c','o','m',0,
+    'l','o','u','i','s','i','a','n','a','.','g','o','v',0,
+    'i','z','.','r','u',0,
+    'g','r','e','a','t','s','c','h','o','o','l','s','.','o','r','g',0,
+    'l','a','p','r','e','s','s','e','.','c','a',0,
+    'k','x','a','n','.','c','o','m',0,
+    'u','s','-','c','e','r','t','.','g','o','v',0,
+    'n','e','r','d','i','s','t','.','c','o','m',0,
+    'e','l','e','c','o','n','o','m','i','s','t','a','.','e','s',0,
+    'k','e','n','t','u','c','k','y','.','c','o','m',0,
+    's','o','s','o','.','c','o','m',0,
+    'g','h','o','s','t','e','r','y','.','c','o','m',0,
+    't','h','e','i','n','f','o','r','m','a','t','i','o','n','.','c','o','m',0,
+    'c','u','d','a','s','v','c','.','c','o','m',0,
+    's','h','a','w','.','c','a',0,
+    'c','h','a','l','m','e','r','s','.','s','e',0,
+    'r','i','a','n','.','r','u',0,
+    'c','o','n','c','o','r','d','i','a','.','c','a',0,
+    'o','z','o','n','.','r','u',0,
+    'i','n','f','o','w','a','r','s','.','c','o','m',0,
+    'c','i','g','n','a','.','c','o','m',0,
+    'r','a','n','d','o','m','h','o','u','s','e','.','c','o','m',0,
+    'i','a','d','b','.','o','r','g',0,
+    'd','e','p','a','u','l','.','e','d','u',0,
+    't','m','c','n','e','t','.','c','o','m',0,
+    'm','e','r','c','h','a','n','t','c','i','r','c','l','e','.','c','o','m',0,
+    'e','x','c','i','t','e','.','c','o','m',0,
+    'w','w','e','.','c','o','m',0,
+    'w','i','s','e','g','e','e','k','.','c','o','m',0,
+    'u','c','h','i','l','e','.','c','l',0,
+    'f','i','t','c','h','r','a','t','i','n','g','s','.','c','o','m',0,
+    'w','o','r','d','p','r','e','s','s','f','o','u','n','d','a','t','i','o','n','.','o','r','g',0,
+    'w','s','b','t','v','.','c','o','m',0,
+    'b','e','t','h','e','s','d','a','.','n','e','t',0,
+    'w','o','m','e','n','s','h','e','a','l','t','h','.','g','o','v',0,
+    'p','r','t','i','m','e','s','.','j','p',0,
+    't','h','i','s','o','l','d','h','o','u','s','e','.','c','o','m',0,
+    'b','r','a','v','e','j','o','u','r','n','a','l','.','n','e','t',0,
+    's','a','m','s','c','l','u','b','.','c','o','m',0,
+    'f','r','e','e','p','a','t','e','n','t','s','o','n','l','i','n','e','.','c','o','m',0,
+    't','h','e','p','e','t','i','t','i','o','n','s','i','t','e','.','c','o','m',0,
+    'a','i','c','p','a','.','o','r','g',0,
+    'u','s','c','g','.','m','i','l',0,
+    'l','i','s','t','v','e','r','s','e','.','c','o','m',0,
+    'h','u','r','r','i','y','e','t','d','a','i','l','y','n','e','w','s','.','c','o','m',0,
+    'n','b','c','p','h','i','l','a','d','e','l','p','h','i','a','.','c','o','m',0,
+    'g','y','a','z','o','.','c','o','m',0,
+    'e','s','s','e','n','c','e','.','c','o','m',0,
+    'v','e','r','i','z','o','n','w','i','r','e','l','e','s','s','.','c','o','m',0,
+    's','c','i','e','n','c','e','b','l','o','g','s','.','c','o','m',0,
+    'm','u','f','f','i','n','g','r','o','u','p','.','c','o','m',0,
+    'm','o','t','o','r','s','p','o','r','t','.','c','o','m',0,
+    's','t','a','t','e','f','a','r','m','.','c','o','m',0,
+    'f','o','o','d','5','2','.','c','o','m',0,
+    'g','a','z','e','t','t','e','.','c','o','m',0,
+    'e','s','o','.','o','r','g',0,
+    'b','i','n','g','h','a','m','t','o','n','.','e','d','u',0,
+    'a','b','s','-','c','b','n','.','c','o','m',0,
+    'c','a','l','g','a','r','y','h','e','r','a','l','d','.','c','o','m',0,
+    'm','o','v','i','e','w','e','b','.','c','o','m',0,
+    'o','k','t','a','.','c','o','m',0,
+    'g','u','g','g','e','n','h','e','i','m','.','o','r','g',0,
+    's','w','a','r','t','h','m','o','r','e','.','e','d','u',0,
+    's','u','b','l','i','m','e','t','e','x','t','.','c','o','m',0,
+    'd','c','c','o','m','i','c','s','.','c','o','m',0,
+    'c','i','t','i','.','c','o','m',0,
+    'w','e','b','a','i','m','.','o','r','g',0,
+    's','v','t','.','s','e',0,
+    'r','o','c','k','p','a','p','e','r','s','h','o','t','g','u','n','.','c','o','m',0,
+    'n','e','w','s','c','h','o','o','l','.','e','d','u',0,
+    't','h','u','m','b','t','a','c','k','.','c','o','m',0,
+    'c','o','l','i','b','r','i','w','p','.','c','o','m',0,
+    'w','g','n','t','v','.','c','o','m',0,
+    's','w','r','.','d','e',0,
+    'i','r','f','a','n','v','i','e','w','.','c','o','m',0,
+    'g','a','m','e','r','a','n','t','.','c','o','m',0,
+    'e','l','i','f','e','s','c','i','e','n','c','e','s','.','o','r','g',0,
+    'b','e','s','t','l','i','f','e','o','n','l','i','n','e','.','c','o','m',0,
+    'o','p','r','a','h','d','a','i','l','y','.','c','o','m',0,
+    'n','e','w','s','b','r','e','a','k','.','c','o','m',0,
+    'f','i','n','a','n','c','e','s','o','n','l','i','n','e','.','c','o','m',0,
+    'f','l','y','w','h','e','e','l','s','i','t','e','s','.','c','o','m',0,
+    'c','i','t','y','s','e','a','r','c','h','.','c','o','m',0,
+    'h','e','r','o','k','u','.','c','o','m',0,
+    'n','y','s','e','d','.','g','o','v',0,
+    'u','m','k','c','.','e','d','u',0,
+    'c','r','e','a','t','i','v','e','m','a','r','k','e','t','.','c','o','m',0,
+    'l','p','a','g','e','s','.','c','o',0,
+    't','h','e','s','t','a','t','e','.','c','o','m',0,
+    'e','a','t','r','i','g','h','t','.','o','r','g',0,
+    'd','e','u','t','s','c','h','l','a','n','d','f','u','n','k','.','d','e',0,
+    'e','q','x','i','u','.','c','o','m',0,
+    'o','d','u','.','e','d','u',0,
+    'u','n','i','v','e','r','s','i','t','y','o','f','c','a','l','i','f','o','r','n','i','a','.','e','d','u',0,
+    'c','a','l','l','o','f','d','u','t','y','.','c','o','m',0,
+    'n','e','w','s','p','a','p','e','r','s','.','c','o','m',0,
+    'x','m','l','-','s','i','t','e','m','a','p','s','.','c','o','m',0,
+    '3','d','s','.','c','o','m',0,
+    'a','n','t','h','r','o','p','o','l','o','g','i','e','.','c','o','m',0,
+    'h','s','b','c','.','c','o','m',0,
+    'n','e','x','u','s','m','o','d','s','.','c','o','m',0,
+    'b','e','l','g','i','u','m','.','b','e',0,
+    'w','3','t','e','c','h','s','.','c','o','m',0,
+    'l','u','b','l','i','n','.','p','l',0,
+    'c','o','p','e','r','n','i','c','u','s','.','o','r','g',0,
+    'b','e','l','i','e','f','n','e','t','.','c','o','m',0,
+    'd','o','n','o','r','b','o','x','.','o','r','g',0,
+    's','u','p','e','r','p','a','g','e','s','.','c','o','m',0,
+    'e','b','a','y','i','m','g','.','c','o','m',0,
+    '2','3','4','5','.','c','o','m',0,
+    'c','h','e','s','s','.','c','o','m',0,
+    'c','y','b','e','r','p','o','l','i','c','e','.','c','n',0,
+    'n','s','a','.','g','o','v',0,
+    's','k','i','f','t','.','c','o','m',0,
+    'c','o','l','l','e','g','e','h','u','m','o','r','.','c','o','m',0,
+    'b','r','a','i','n','p','i','c','k','i','n','g','s','.','o','r','g',0,
+    'g','r','e','e','n','h','o','u','s','e','.','i','o',0,
+    's','a','f','e','d','o','g','.','c','n',0,
+    'a','r','t','o','f','m','a','n','l','i','n','e','s','s','.','c','o','m',0,
+    'n','e','w','a','d','v','e','n','t','.','o','r','g',0,
+    'w','e','n','m','i','n','g','.','c','n',0,
+    'c','l','i','c','k','o','r','l','a','n','d','o','.','c','o','m',0,
+    's','m','a','r','t','a','s','s','e','t','.','c','o','m',0,
+    'l','l','n','l','.','g','o','v',0,
+    'p','a','l','o','a','l','t','o','n','e','t','w','o','r','k','s','.','c','o','m',0,
+    't','h','e','p','o','i','n','t','s','g','u','y','.','c','o','m',0,
+    'f','e','r','r','a','r','i','.','c','o','m',0,
+    'a','a','o','s','.','o','r','g',0,
+    'i','o','n','o','s','.','c','o','m',0,
+    'u','s','e','n','i','x','.','o','r','g',0,
+    't','a','y','l','o','r','f','r','a','n','c','i','s','.','c','o','m',0,
+    'r','b','.','g','y',0,
+    'h','b','o','m','a','x','.','c','o','m',0,
+    't','e','l','e','g','r','a','a','f','.','n','l',0,
+    'r','t','b','f','.','b','e',0,
+    'c','a','p','i','t','a','l','o','n','e','.','c','o','m',0,
+    '1','1','a','l','i','v','e','.','c','o','m',0,
+    's','i','t','e','j','a','b','b','e','r','.','c','o','m',0,
+    'u','n','i','-','m','u','e','n','s','t','e','r','.','d','e',0,
+    'a','m','b','a','f','r','a','n','c','e','.','o','r','g',0,
+    'a','n','a','l','o','g','.','c','o','m',0,
+    'a','e','o','n','.','c','o',0,
+    'u','n','d','o','c','s','.','o','r','g',0,
+    'u','n','i','-','f','r','a','n','k','f','u','r','t','.','d','e',0,
+    'v','e','s','t','i','.','r','u',0,
+    'i','c','i','j','.','o','r','g',0,
+    'w','e','r','i','t','e','.','n','e','t',0,
+    'r','e','e','d','s','y','.','c','o','m',0,
+    's','p','i','c','e','w','o','r','k','s','.','c','o','m',0,
+    'm','i','s','e','s','.','o','r','g',0,
+    'u','o','f','m','h','e','a','l','t','h','.','o','r','g',0,
+    't','h','e','c','r','i','m','s','o','n','.','c','o','m',0,
+    'w','i','c','k','e','d','l','o','c','a','l','.','c','o','m',0,
+    'g','l','e','a','m','.','i','o',0,
+    'u','g','r','.','e','s',0,
+    'r','a','c','k','s','p','a','c','e','.','c','o','m',0,
+    'k','i','n','s','t','a','.','c','o','m',0,
+    'd','i','v','a','-','p','o','r','t','a','l','.','o','r','g',0,
+    't','h','e','r','e','a','l','d','e','a','l','.','c','o','m',0,
+    'l','i','v','e','n','a','t','i','o','n','.','c','o','m',0,
+    'm','e','d','i','a','m','a','t','t','e','r','s','.','o','r','g',0,
+    's','p','i','n','.','c','o','m',0,
+    'c','u','l','t','s','3','d','.','c','o','m',0,
+    'k','n','o','x','n','e','w','s','.','c','o','m',0,
+    'u','p','c','.','e','d','u',0,
+    'r','a','e','.','e','s',0,
+    'p','e','w','s','o','c','i','a','l','t','r','e','n','d','s','.','o','r','g',0,
+    'i','n','s','u','r','a','n','c','e','j','o','u','r','n','a','l','.','c','o','m',0,
+    's','a','v','e','t','h','e','c','h','i','l','d','r','e','n','.','o','r','g',0,
+    'h','o','n','g','k','i','a','t','.','c','o','m',0,
+    'a','m','s','.','o','r','g',0,
+    'k','o','m','o','n','e','w','s','.','c','o','m',0,
+    'e','2','m','a','.','n','e','t',0,
+    't','h','e','w','e','a','t','h','e','r','n','e','t','w','o','r','k','.','c','o','m',0,
+    'b','l','u','b','r','r','y','.','c','o','m',0,
+    't','e','x','a','s','m','o','n','t','h','l','y','.','c','o','m',0,
+    'e','b','s','c','o','.','c','o','m',0,
+    'g','i','z','m','a','g','.','c','o','m',0,
+    'r','a','i','n','n','.','o','r','g',0,
+    'c','h','i','c','a','g','o','b','u','s','i','n','e','s','s','.','c','o','m',0,
+    'r','o','m','a','.','i','t',0,
+    'n','y','s','e','n','a','t','e','.','g','o','v',0,
+    't','u','r','k','i','s','h','a','i','r','l','i','n','e','s','.','c','o','m',0,
+    'v','i','n','g','l','e','.','n','e','t',0,
+    'r','u','n','s','i','g','n','u','p','.','c','o','m',0,
+    'g','o','v','t','e','c','h','.','c','o','m',0,
+    'h','u','b','b','l','e','s','i','t','e','.','o','r','g',0,
+    'm','s','k','c','c','.','o','r','g',0,
+    'j','a','x','a','.','j','p',0,
+    'p','g','a','t','o','u','r','.','c','o','m',0,
+    'p','e','t','f','i','n','d','e','r','.','c','o','m',0,
+    'y','u','m','m','l','y','.','c','o','m',0,
+    'c','o','n','s','u','m','e','r','i','s','t','.','c','o','m',0,
+    'd','i','l','b','e','r','t','.','c','o','m',0,
+    'm','o','n','d','a','q','.','c','o','m',0,
+    'm','i','n','d','s','.','c','o','m',0,
+    'd','i','g','n','i','t','y','m','e','m','o','r','i','a','l','.','c','o','m',0,
+    'h','o','t','p','e','p','p','e','r','.','j','p',0,
+    'w','o','r','d','f','e','n','c','e','.','c','o','m',0,
+    'b','a','b','.','l','a',0,
+    'a','d','.','n','l',0,
+    'c','s','u','l','b','.','e','d','u',0,
+    'd','i','g','i','k','e','y','.','c','o','m',0,
+    'm','i','n','t','.','c','o','m',0,
+    's','t','j','u','d','e','.','o','r','g',0,
+    '2','4','7','s','p','o','r','t','s','.','c','o','m',0,
+    'k','i','n','j','a','.','c','o','m',0,
+    'm','o','o','d','y','s','.','c','o','m',0,
+    't','h','e','l','o','c','a','l','.','s','e',0,
+    'm','a','s','s','g','e','n','e','r','a','l','.','o','r','g',0,
+    'c','a','r','e','.','c','o','m',0,
+    'f','r','e','e','s','e','r','v','e','r','s','.','c','o','m',0,
+    'a','a','m','c','.','o','r','g',0,
+    'h','a','b','i','t','a','t','.','o','r','g',0,
+    'u','n','i','m','i','.','i','t',0,
+    'f','i','n','d','e','r','.','c','o','m',0,
+    'h','s','e','.','r','u',0,
+    't','a','b','e','l','o','g','.','c','o','m',0,
+    's','i','g','n','a','l','.','o','r','g',0,
+    'w','m','i','c','h','.','e','d','u',0,
+    '7','2','0','y','u','n','.','c','o','m',0,
+    'c','h','n','g','.','i','t',0,
+    'w','e','s','t','w','o','r','d','.','c','o','m',0,
+    'f','a','u','.','e','d','u',0,
+    'x','u','e','x','i','.','c','n',0,
+    'm','i','r','o','.','c','o','m',0,
+    'u','n','i','-','t','u','e','b','i','n','g','e','n','.','d','e',0,
+    's','t','y','l','e','c','a','s','t','e','r','.','c','o','m',0,
+    'm','a','r','k','e','t','s','c','r','e','e','n','e','r','.','c','o','m',0,
+    'b','i','b','l','e','.','c','o','m',0,
+    'm','a','p','b','o','x','.','c','o','m',0,
+    'h','o','s','t','e','l','w','o','r','l','d','.','c','o','m',0,
+    'w','i','k','i','m','e','d','i','a','f','o','u','n','d','a','t','i','o','n','.','o','r','g',0,
+    'a','n','i','m','e','n','e','w','s','n','e','t','w','o','r','k','.','c','o','m',0,
+    'd','e','s','t','a','t','i','s','.','d','e',0,
+    'c','l','u','t','c','h','.','c','o',0,
+    't','u','c','o','w','s','.','c','o','m',0,
+    'b','e','s','t','h','o','o','k','u','p','w','e','b','s','i','t','e','s','.','o','r','g',0,
+    'i','n','s','t','a','c','a','r','t','.','c','o','m',0,
+    'l','e','h','i','g','h','.','e','d','u',0,
+    'e','d','u','c','a','u','s','e','.','e','d','u',0,
+    'i','t','u','n','e','s','.','c','o','m',0,
+    'd','o','w','.','c','o','m',0,
+    'i','n','d','.','b','r',0,
+    'p','e','.','c','o','m',0,
+    'g','e','n','o','m','e','.','g','o','v',0,
+    'i','i','i','.','o','r','g',0,
+    'r','p','-','o','n','l','i','n','e','.','d','e',0,
+    'p','r','i','n','c','e','t','o','n','r','e','v','i','e','w','.','c','o','m',0,
+    'm','p','r','n','e','w','s','.','o','r','g',0,
+    'b','o','c','.','c','n',0,
+    'a','s','h','a','.','o','r','g',0,
+    'c','2','.','c','o','m',0,
+    'c','o','n','f','e','x','.','c','o','m',0,
+    's','e','n','n','h','e','i','s','e','r','.','c','o','m',0,
+    'c','o','u','r','s','e','h','e','r','o','.','c','o','m',0,
+    'd','e','a','.','g','o','v',0,
+    'i','n','t','e','r','p','o','l','.','i','n','t',0,
+    'w','d','c','.','c','o','m',0,
+    'g','e','n','t','o','o','.','o','r','g',0,
+    'g','e','t','m','o','n','e','r','o','.','o','r','g',0,
+    'r','a','n','d','o','m','.','o','r','g',0,
+    'c','l','e','a','n','t','a','l','k','o','r','g','2','.','r','u',0,
+    'd','e','s','k','t','o','p','n','e','x','u','s','.','c','o','m',0,
+    'c','y','b','e','r','c','h','i','m','p','s','.','c','o','m',0,
+    's','n','a','z','z','y','m','a','p','s','.','c','o','m',0,
+    'j','n','e','u','r','o','s','c','i','.','o','r','g',0,
+    'm','k','.','r','u',0,
+    'p','s','m','a','g','.','c','o','m',0,
+    'b','u','s','i','n','e','s','s','t','o','d','a','y','.','i','n',0,
+    'a','n','s','i','.','o','r','g',0,
+    'e','m','b','e','d','g','o','o','g','l','e','m','a','p','.','n','e','t',0,
+    'c','e','s','.','t','e','c','h',0,
+    's','b','e','r','b','a','n','k','.','r','u',0,
+    'o','n','l','y','f','a','n','s','.','c','o','m',0,
+    'u','l','t','a','.','c','o','m',0,
+    'b','l','o','g','a','c','t','i','v','.','e','u',0,
+    'b','l','u','e','s','t','a','c','k','s','.','c','o','m',0,
+    'v','a','n','g','u','a','r','d','n','g','r','.','c','o','m',0,
+    'm','e','d','u','z','a','.','i','o',0,
+    's','h','a','r','e','t','h','i','s','.','c','o','m',0,
+    't','h','e','t','r','e','v','o','r','p','r','o','j','e','c','t','.','o','r','g',0,
+    'c','o','n','a','c','.','c','n',0,
+    'k','a','k','a','k','u','.','c','o','m',0,
+    'p','a','c','k','t','p','u','b','.','c','o','m',0,
+    'l','i','t','e','r','a','t','u','r','e','e','s','s','a','y','s','a','m','p','l','e','s','.','c','o','m',0,
+    'm','a','r','t','i','n','f','o','w','l','e','r','.','c','o','m',0,
+    'e','d','e','l','m','a','n','.','c','o','m',0,
+    'w','a','k','w','a','k','.','c','o','m',0,
+    't','r','e','a','s','.','g','o','v',0,
+    'c','a','r','b','o','n','b','r','i','e','f','.','o','r','g',0,
+    'p','r','o','s','p','e','c','t','.','o','r','g',0,
+    't','h','e','m','a','r','g','i','n','a','l','i','a','n','.','o','r','g',0,
+    'u','l','a','v','a','l','.','c','a',0,
+    'p','r','i','v','a','c','y','p','o','l','i','c','y','g','e','n','e','r','a','t','o','r','.','i','n','f','o',0,
+    'h','i','s','t','a','t','s','.','c','o','m',0,
+    's','e','e','d','a','n','d','s','p','a','r','k','.','c','o','m',0,
+    'r','o','y','a','l','s','o','c','i','e','t','y','.','o','r','g',0,
+    'r','i','k','u','n','a','b','i','.','c','o','m',0,
+    'e','m','a','i','l','m','e','f','o','r','m','.','c','o','m',0,
+    'd','o','t','d','a','s','h','m','e','r','e','d','i','t','h','.','c','o','m',0,
+    'm','o','n','d','a','y','.','c','o','m',0,
+    'i','n','d','y','m','e','d','i','a','.','o','r','g',0,
+    'v','i','c','t','o','r','i','a','s','s','e','c','r','e','t','.','c','o','m',0,
+    'd','e','m','o','c','r','a','t','a','n','d','c','h','r','o','n','i','c','l','e','.','c','o','m',0,
+    'c','a','r','i','n','g','b','r','i','d','g','e','.','o','r','g',0,
+    'k','i','j','i','j','i','.','c','a',0,
+    'l','i','n','o','d','e','.','c','o','m',0,
+    'a','b','c','1','5','.','c','o','m',0,
+    'd','e','s','t','r','u','c','t','o','i','d','.','c','o','m',0,
+    'b','e','t','.','c','o','m',0,
+    'a','s','c','d','.','o','r','g',0,
+    't','r','a','d','e','.','g','o','v',0,
+    'e','m','p','i','r','e','o','n','l','i','n','e','.','c','o','m',0,
+    'w','f','u','.','e','d','u',0,
+    'i','n','f','l','u','e','n','c','e','r','m','a','r','k','e','t','i','n','g','h','u','b','.','c','o','m',0,
+    't','h','e','r','o','o','t','.','c','o','m',0,
+    'h','o','m','e','i','p','.','n','e','t',0,
+    'u','n','w','t','o','.','o','r','g',0,
+    'f','e','e','d','s','p','o','t','.','c','o','m',0,
+    's','h','a','p','e','w','a','y','s','.','c','o','m',0,
+    't','r','a','n','s','u','n','i','o','n','.','c','o','m',0,
+    's','o','u','t','h','c','n','.','c','o','m',0,
+    'h','e','r','t','z','.','c','o','m',0,
+    's','t','o','r','e','b','o','a','r','d','.','c','o','m',0,
+    'o','s','d','.','m','i','l',0,
+    'i','c','o','n','s','8','.','c','o','m',0,
+    'y','n','e','t','n','e','w','s','.','c','o','m',0,
+    'c','o','p','y','b','l','o','g','g','e','r','.','c','o','m',0,
+    'c','n','s','n','e','w','s','.','c','o','m',0,
+    'g','g','.','g','g',0,
+    's','u','n','i','n','g','.','c','o','m',0,
+    'n','i','.','c','o','m',0,
+    'p','l','a','y','b','i','l','l','.','c','o','m',0,
+    'q','a','n','t','a','s','.','c','o','m',0,
+    's','h','i','n','o','b','i','.','j','p',0,
+    'r','e','d','i','r','e','c','t','i','n','g','a','t','.','c','o','m',0,
+    'n','e','s','t','l','e','.','c','o','m',0,
+    'f','r','e','e','r','e','p','u','b','l','i','c','.','c','o','m',0,
+    'u','w','y','o','.','e','d','u',0,
+    'n','r','c','.','n','l',0,
+    'l','i','v','e','r','p','o','o','l','f','c','.','c','o','m',0,
+    'u','m','a','i','n','e','.','e','d','u',0,
+    'm','u','n','i','.','c','z',0,
+    'c','l','e','v','e','s','c','e','n','e','.','c','o','m',0,
+    'o','p','t','i','m','i','z','e','l','y','.','c','o','m',0,
+    'r','s','n','a','.','o','r','g',0,
+    'n','e','w','s','4','j','a','x','.','c','o','m',0,
+    'w','v','.','g','o','v',0,
+    'd','i','c','t','.','c','c',0,
+    'a','l','t','e','r','n','a','t','i','v','e','t','o','.','n','e','t',0,
+    'f','a','n','g','.','c','o','m',0,
+    'u','n','i','-','g','o','e','t','t','i','n','g','e','n','.','d','e',0,
+    'v','n','e','x','p','r','e','s','s','.','n','e','t',0,
+    'p','e','r','i','s','c','o','p','e','.','t','v',0,
+    'b','r','i','l','l','.','c','o','m',0,
+    'm','d','r','.','d','e',0,
+    'i','i','t','.','e','d','u',0,
+    't','e','a','c','h','e','r','s','p','a','y','t','e','a','c','h','e','r','s','.','c','o','m',0,
+    'q','u','i','c','k','s','p','r','o','u','t','.','c','o','m',0,
+    'u','w','e','c','.','e','d','u',0,
+    'l','o','c','a','l','1','0','.','c','o','m',0,
+    'm','a','c','r','o','t','r','e','n','d','s','.','n','e','t',0,
+    'b','s','i','g','r','o','u','p','.','c','o','m',0,
+    'n','a','p','s','t','e','r','.','c','o','m',0,
+    'd','t','u','.','d','k',0,
+    's','a','n','k','e','i','.','c','o','m',0,
+    's','h','e','r','w','i','n','-','w','i','l','l','i','a','m','s','.','c','o','m',0,
+    't','v','l','i','n','e','.','c','o','m',0,
+    'j','a','m','e','n','d','o','.','c','o','m',0,
+    'j','e','w','i','s','h','v','i','r','t','u','a','l','l','i','b','r','a','r','y','.','o','r','g',0,
+    'o','p','e','n','g','r','o','u','p','.','o','r','g',0,
+    'a','u','t','o','t','r','a','d','e','r','.','c','o','m',0,
+    'q','t','.','i','o',0,
+    'f','c','b','a','r','c','e','l','o','n','a','.','c','o','m',0,
+    'u','t','a','.','e','d','u',0,
+    'i','c','a','o','.','i','n','t',0,
+    'i','m','o','.','o','r','g',0,
+    'm','d','a','n','d','e','r','s','o','n','.','o','r','g',0,
+    'm','u','l','t','i','p','l','y','.','c','o','m',0,
+    'd','a','r','p','a','.','m','i','l',0,
+    't','i','m','e','s','f','r','e','e','p','r','e','s','s','.','c','o','m',0,
+    't','h','e','n','e','w','s','t','r','i','b','u','n','e','.','c','o','m',0,
+    'a','r','t','i','c','.','e','d','u',0,
+    'i','p','l','.','o','r','g',0,
+    'm','o','n','e','y','c','r','a','s','h','e','r','s','.','c','o','m',0,
+    'e','d','u','c','a','t','i','o','n','.','c','o','m',0,
+    't','h','e','p','r','i','n','t','.','i','n',0,
+    'a','r','k','a','n','s','a','s','o','n','l','i','n','e','.','c','o','m',0,
+    'p','a','s','t','e','l','i','n','k','.','n','e','t',0,
+    'a','l','l','t','h','i','n','g','s','d','.','c','o','m',0,
+    'm','e','t','a','f','i','l','t','e','r','.','c','o','m',0,
+    't','h','r','e','a','t','p','o','s','t','.','c','o','m',0,
+    'a','v','i','r','a','.','c','o','m',0,
+    's','a','e','.','o','r','g',0,
+    'u','s','a','j','o','b','s','.','g','o','v',0,
+    'l','i','n','u','x','m','i','n','t','.','c','o','m',0,
+    'd','a','i','m','l','e','r','.','c','o','m',0,
+    'u','n','e','n','v','i','r','o','n','m','e','n','t','.','o','r','g',0,
+    'a','d','a','c','.','d','e',0,
+    'u','n','i','n','a','.','i','t',0,
+    'b','i','b','l','e','s','t','u','d','y','t','o','o','l','s','.','c','o','m',0,
+    'u','b','a','.','a','r',0,
+    'c','a','l','p','o','l','y','.','e','d','u',0,
+    's','y','n','o','l','o','g','y','.','c','o','m',0,
+    's','k','k','u','.','e','d','u',0,
+    'u','n','i','-','s','t','u','t','t','g','a','r','t','.','d','e',0,
+    'd','a','t','i','n','g','r','e','v','i','e','w','e','r','.','n','e','t',0,
+    'u','n','i','l','e','v','e','r','.','c','o','m',0,
+    'h','a','t','h','i','t','r','u','s','t','.','o','r','g',0,
+    's','o','n','g','k','i','c','k','.','c','o','m',0,
+    'n','b','c','s','a','n','d','i','e','g','o','.','c','o','m',0,
+    's','a','k','s','f','i','f','t','h','a','v','e','n','u','e','.','c','o','m',0,
+    's','p','r','e','a','d','s','h','i','r','t','.','c','o','m',0,
+    'r','u','b','y','o','n','r','a','i','l','s','.','o','r','g',0,
+    'v','o','l','k','s','k','r','a','n','t','.','n','l',0,
+    'o','p','t','i','m','o','l','e','.','c','o','m',0,
+    'e','x','p','r','e','s','s','e','n','.','s','e',0,
+    'm','a','r','i','n','e','s','.','m','i','l',0,
+    'u','n','i','-','l','e','i','p','z','i','g','.','d','e',0,
+    'r','i','s','e','u','p','.','n','e','t',0,
+    's','j','v','.','i','o',0,
+    's','i','n','g','a','p','o','r','e','a','i','r','.','c','o','m',0,
+    'n','o','v','a','.','e','d','u',0,
+    '8','b','.','i','o',0,
+    'g','d','p','r','-','i','n','f','o','.','e','u',0,
+    'n','u','.','n','l',0,
+    's','r','f','.','c','h',0,
+    'f','o','x','i','t','s','o','f','t','w','a','r','e','.','c','o','m',0,
+    'a','d','v','o','c','a','t','e','.','c','o','m',0,
+    'k','i','t','c','o','.','c','o','m',0,
+    'b','r','e','a','k','.','c','o','m',0,
+    'h','a','c','k','e','r','o','n','e','.','c','o','m',0,
+    'd','a','t','i','n','g','r','a','t','i','n','g','.','n','e','t',0,
+    't','h','e','s','p','r','u','c','e','c','r','a','f','t','s','.','c','o','m',0,
+    'b','r','a','v','o','t','v','.','c','o','m',0,
+    'b','a','b','b','e','l','.','c','o','m',0,
+    'm','i','d','d','l','e','b','u','r','y','.','e','d','u',0,
+    's','a','n','d','i','e','g','o','z','o','o','.','o','r','g',0,
+    'n','a','m','e','s','i','l','o','.','c','o','m',0,
+    'p','i','l','o','t','o','n','l','i','n','e','.','c','o','m',0,
+    'm','i','n','d','s','p','r','i','n','g','.','c','o','m',0,
+    'p','o','l','i','m','i','.','i','t',0,
+    't','r','a','v','e','l','o','c','i','t','y','.','c','o','m',0,
+    'd','w','-','w','o','r','l','d','.','d','e',0,
+    'j','q','u','e','r','y','u','i','.','c','o','m',0,
+    's','m','a','s','h','b','a','l','l','o','o','n','.','c','o','m',0,
+    'o','m','i','c','s','o','n','l','i','n','e','.','o','r','g',0,
+    '9','9','b','r','i','d','e','s','.','c','o','m',0,
+    'h','y','p','e','r','a','l','l','e','r','g','i','c','.','c','o','m',0,
+    'p','u','b','l','i','c','r','a','d','i','o','.','o','r','g',0,
+    'c','o','r','e','l','.','c','o','m',0,
+    'm','i','n','d','b','o','d','y','o','n','l','i','n','e','.','c','o','m',0,
+    't','r','i','b','u','n','e','i','n','d','i','a','.','c','o','m',0,
+    'o','p','e','n','d','n','s','.','c','o','m',0,
+    'a','d','b','l','o','c','k','p','l','u','s','.','o','r','g',0,
+    't','s','n','.','c','a',0,
+    'p','o','k','e','m','o','n','.','c','o','m',0,
+    'c','a','t','c','h','t','i','g','e','r','.','c','o','m',0,
+    't','o','s','h','i','b','a','.','c','o','m',0,
+    'g','u','a','r','d','i','a','n','.','n','g',0,
+    'i','i','h','s','.','o','r','g',0,
+    'n','a','s','c','a','r','.','c','o','m',0,
+    'v','i','s','i','t','s','c','o','t','l','a','n','d','.','c','o','m',0,
+    'o','p','b','.','o','r','g',0,
+    't','o','a','s','t','t','a','b','.','c','o','m',0,
+    's','c','i','t','e','c','h','d','a','i','l','y','.','c','o','m',0,
+    't','h','e','m','e','h','o','r','s','e','.','c','o','m',0,
+    't','r','e','n','d','h','u','n','t','e','r','.','c','o','m',0,
+    'b','y','r','d','i','e','.','c','o','m',0,
+    'j','i','g','s','a','w','p','l','a','n','e','t','.','c','o','m',0,
+    'o','i','l','p','r','i','c','e','.','c','o','m',0,
+    'r','a','f','f','l','e','c','o','p','t','e','r','.','c','o','m',0,
+    's','c','r','o','l','l','.','i','n',0,
+    'u','f','r','j','.','b','r',0,
+    's','c','o','r','e','.','o','r','g',0,
+    'r','o','y','a','l','m','a','i','l','.','c','o','m',0,
+    'h','e','a','l','t','h','d','a','t','a','.','o','r','g',0,
+    'c','a','b','e','l','a','s','.','c','o','m',0,
+    't','x','d','o','t','.','g','o','v',0,
+    't','h','e','w','i','r','e','.','i','n',0,
+    'a','l','l','o','c','i','n','e','.','f','r',0,
+    'b','m','w','i','.','d','e',0,
+    'c','h','o','w','h','o','u','n','d','.','c','o','m',0,
+    'a','i','f','.','r','u',0,
+    'w','p','i','.','e','d','u',0,
+    'v','g','2','4','7','.','c','o','m',0,
+    'w','f','l','a','.','c','o','m',0,
+    'j','o','u','r','n','a','l','s','t','a','r','.','c','o','m',0,
+    'q','u','e','s','t','i','o','n','p','r','o','.','c','o','m',0,
+    't','l','d','p','.','o','r','g',0,
+    'l','a','p','t','o','p','m','a','g','.','c','o','m',0,
+    'a','r','b','e','i','t','s','a','g','e','n','t','u','r','.','d','e',0,
+    'a','c','t','i','v','i','s','i','o','n','.','c','o','m',0,
+    'd','e','e','p','l','.','c','o','m',0,
+    'i','n','d','i','g','o','.','c','a',0,
+    't','o','k','o','p','e','d','i','a','.','c','o','m',0,
+    'b','r','e','w','.','s','h',0,
+    'e','a','s','p','o','r','t','s','.','c','o','m',0,
+    'b','u','n','d','e','s','g','e','s','u','n','d','h','e','i','t','s','m','i','n','i','s','t','e','r','i','u','m','.','d','e',0,
+    'p','a','u','l','g','r','a','h','a','m','.','c','o','m',0,
+    'a','c','t','i','o','n','n','e','t','w','o','r','k','.','o','r','g',0,
+    'e','s','p','n','c','r','i','c','i','n','f','o','.','c','o','m',0,
+    'c','a','f','e','l','o','g','.','c','o','m',0,
+    'o','h','s','u','.','e','d','u',0,
+    'n','t','n','u','.','n','o',0,
+    'd','e','p','o','s','i','t','f','i','l','e','s','.','c','o','m',0,
+    'h','y','p','e','r','m','a','r','t','.','n','e','t',0,
+    'c','a','r','n','e','g','i','e','e','n','d','o','w','m','e','n','t','.','o','r','g',0,
+    'p','e','n','i','n','s','u','l','a','d','a','i','l','y','n','e','w','s','.','c','o','m',0,
+    'v','o','x','e','u','.','o','r','g',0,
+    'd','o','v','e','p','r','e','s','s','.','c','o','m',0,
+    'l','i','n','k','s','y','s','.','c','o','m',0,
+    'r','y','e','r','s','o','n','.','c','a',0,
+    'a','a','l','t','o','.','f','i',0,
+    'c','l','u','s','t','r','m','a','p','s','.','c','o','m',0,
+    'c','r','a','t','e','a','n','d','b','a','r','r','e','l','.','c','o','m',0,
+    'w','f','m','z','.','c','o','m',0,
+    'a','b','q','j','o','u','r','n','a','l','.','c','o','m',0,
+    't','a','i','p','e','i','t','i','m','e','s','.','c','o','m',0,
+    'w','e','b','s','t','a','r','t','s','.','c','o','m',0,
+    'c','o','c','a','-','c','o','l','a','.','c','o','m',0,
+    'm','o','d','d','b','.','c','o','m',0,
+    'n','e','t','s','u','i','t','e','.','c','o','m',0,
+    'h','o','l','l','y','w','o','o','d','.','c','o','m',0,
+    'n','y','t','.','c','o','m',0,
+    't','h','e','p','i','r','a','t','e','b','a','y','.','o','r','g',0,
+    'c','a','t','b','.','o','r','g',0,
+    'm','a','r','k','e','t','o','.','c','o','m',0,
+    'm','i','d','d','l','e','e','a','s','t','e','y','e','.','n','e','t',0,
+    'e','x','x','o','n','m','o','b','i','l','.','c','o','m',0,
+    'm','o','r','n','i','n','g','c','o','n','s','u','l','t','.','c','o','m',0,
+    'a','t','o','m','.','i','o',0,
+    'i','n','v','i','s','i','o','n','a','p','p','.','c','o','m',0,
+    'v','e','n','m','o','.','c','o','m',0,
+    't','e','c','h','p','o','w','e','r','u','p','.','c','o','m',0,
+    'p','a','t','i','e','n','t','.','i','n','f','o',0,
+    'z','o','o','s','n','e','t','.','n','e','t',0,
+    'i','s','r','a','e','l','n','a','t','i','o','n','a','l','n','e','w','s','.','c','o','m',0,
+    't','h','i','s','a','m','e','r','i','c','a','n','l','i','f','e','.','o','r','g',0,
+    'c','o','m','p','u','t','e','r','h','i','s','t','o','r','y','.','o','r','g',0,
+    'f','i','r','e','e','y','e','.','c','o','m',0,
+    'h','e','t','z','n','e','r','.','c','o','m',0,
+    'y','e','l','l','.','c','o','m',0,
+    'p','r','n','t','.','s','c',0,
+    'a','u','s','t','i','n','c','h','r','o','n','i','c','l','e','.','c','o','m',0,
+    'x','v','i','d','e','o','s','.','c','o','m',0,
+    'e','l','l','e','d','e','c','o','r','.','c','o','m',0,
+    'c','m','b','c','h','i','n','a','.','c','o','m',0,
+    's','h','o','.','c','o','m',0,
+    'e','d','f','.','o','r','g',0,
+    'm','o','z','d','e','v','.','o','r','g',0,
+    'f','l','o','u','r','i','s','h','.','s','t','u','d','i','o',0,
+    'l','o','u','i','s','v','i','l','l','e','.','e','d','u',0,
+    'y','u','b','i','c','o','.','c','o','m',0,
+    'b','u','z','z','s','u','m','o','.','c','o','m',0,
+    's','e','a','t','t','l','e','w','e','e','k','l','y','.','c','o','m',0,
+    'n','o','v','a','r','t','i','s','.','c','o','m',0,
+    'v','i','m','.','o','r','g',0,
+    'm','o','u','s','e','r','.','c','o','m',0,
+    's','v','e','r','i','g','e','s','r','a','d','i','o','.','s','e',0,
+    'm','t','a','.','i','n','f','o',0,
+    'b','e','l','k','i','n','.','c','o','m',0,
+    'i','n','a','t','u','r','a','l','i','s','t','.','o','r','g',0,
+    'j','p','.','n','e','t',0,
+    'c','a','s','e','t','e','x','t','.','c','o','m',0,
+    'd','i','g','i','t','a','l','c','o','m','m','e','r','c','e','3','6','0','.','c','o','m',0,
+    'd','a','t','e','n','s','c','h','u','t','z','-','g','e','n','e','r','a','t','o','r','.','d','e',0,
+    'u','m','a','r','y','l','a','n','d','.','e','d','u',0,
+    'e','a','s','e','u','s','.','c','o','m',0,
+    'b','e','t','f','a','i','r','.','c','o','m',0,
+    'g','e','e','k','.','c','o','m',0,
+    'a','s','t','r','o','n','o','m','y','.','c','o','m',0,
+    'e','f','e','.','c','o','m',0,
+    'b','i','o','s','p','a','c','e','.','c','o','m',0,
+    'l','e','v','i','.','c','o','m',0,
+    '5','0','m','e','g','s','.','c','o','m',0,
+    'f','r','e','s','h','b','o','o','k','s','.','c','o','m',0,
+    'c','a','m','b','r','i','d','g','e','e','n','g','l','i','s','h','.','o','r','g',0,
+    'c','m','a','i','l','2','0','.','c','o','m',0,
+    's','t','o','r','e','s','.','j','p',0,
+    'j','u','n','t','a','d','e','a','n','d','a','l','u','c','i','a','.','e','s',0,
+    't','f','1','.','f','r',0,
+    's','u','.','s','e',0,
+    'g','e','a','r','b','e','s','t','.','c','o','m',0,
+    'u','n','i','c','a','m','p','.','b','r',0,
+    'r','e','a','l','m','a','d','r','i','d','.','c','o','m',0,
+    'm','o','b','y','g','a','m','e','s','.','c','o','m',0,
+    'k','i','n','g','s','t','o','n','.','c','o','m',0,
+    'h','a','r','p','e','r','s','.','o','r','g',0,
+    'w','u','s','a','9','.','c','o','m',0,
+    'c','b','d','.','i','n','t',0,
+    'b','u','s','i','n','e','s','s','o','f','f','a','s','h','i','o','n','.','c','o','m',0,
+    't','e','s','l','a','m','o','t','o','r','s','.','c','o','m',0,
+    'o','p','e','n','s','o','c','i','e','t','y','f','o','u','n','d','a','t','i','o','n','s','.','o','r','g',0,
+    'w','j','l','a','.','c','o','m',0,
+    'c','h','e','w','y','.','c','o','m',0,
+    'g','r','e','e','n','b','i','z','.','c','o','m',0,
+    'f','r','a','n','c','e','.','t','v',0,
+    'y','u','d','u','.','c','o','m',0,
+    'p','i','r','i','f','o','r','m','.','c','o','m',0,
+    'h','o','o','k','u','p','w','e','b','s','i','t','e','s','.','o','r','g',0,
+    'a','1','6','z','.','c','o','m',0,
+    'd','i','r','e','c','t','v','.','c','o','m',0,
+    'r','a','l','p','h','l','a','u','r','e','n','.','c','o','m',0,
+    'g','a','t','e','s','n','o','t','e','s','.','c','o','m',0,
+    'g','u','m','t','r','e','e','.','c','o','m',0,
+    't','o','p','g','e','a','r','.','c','o','m',0,
+    'k','o','n','a','m','i','.','c','o','m',0,
+    'b','l','a','c','k','b','o','a','r','d','.','c','o','m',0,
+    'r','e','g','j','e','r','i','n','g','e','n','.','n','o',0,
+    'w','i','l','s','o','n','c','e','n','t','e','r','.','o','r','g',0,
+    'l','w','n','.','n','e','t',0,
+    'c','a','d','e','n','a','s','e','r','.','c','o','m',0,
+    'k','a','d','e','n','c','e','w','p','.','c','o','m',0,
+    'a','u','t','o','e','v','o','l','u','t','i','o','n','.','c','o','m',0,
+    'j','o','b','v','i','t','e','.','c','o','m',0,
+    'p','h','o','t','o','.','n','e','t',0,
+    'm','o','b','y','p','i','c','t','u','r','e','.','c','o','m',0,
+    'u','r','l','.','c','n',0,
+    's','i','g','m','a','a','l','d','r','i','c','h','.','c','o','m',0,
+    'd','i','s','t','r','a','c','t','i','f','y','.','c','o','m',0,
+    'h','e','a','l','t','h','f','u','l','l','y','.','c','o','m',0,
+    'p','c','g','a','m','e','s','n','.','c','o','m',0,
+    'n','o','r','d','v','p','n','.','c','o','m',0,
+    'h','o','o','k','u','p','d','a','t','e','.','n','e','t',0,
+    'k','s','a','t','.','c','o','m',0,
+    'd','a','i','l','y','w','i','r','e','.','c','o','m',0,
+    'c','r','y','p','t','o','.','c','o','m',0,
+    'u','k','c','o','p','2','6','.','o','r','g',0,
+    'u','m','u','.','s','e',0,
+    'c','h','e','l','s','e','a','f','c','.','c','o','m',0,
+    'c','o','m','p','a','r','i','t','e','c','h','.','c','o','m',0,
+    's','m','a','r','t','r','e','c','r','u','i','t','e','r','s','.','c','o','m',0,
+    's','e','t','l','i','s','t','.','f','m',0,
+    'c','o','n','v','e','r','t','k','i','t','.','c','o','m',0,
+    'b','r','i','t','.','c','o',0,
+    'f','o','x','8','.','c','o','m',0,
+    'd','i','y','n','e','t','w','o','r','k','.','c','o','m',0,
+    'o','n','l','i','n','e','.','f','r',0,
+    'd','o','w','n','d','e','t','e','c','t','o','r','.','c','o','m',0,
+    'x','x','x','.','c','o','m',0,
+    '1','0','b','e','s','t','.','c','o','m',0,
+    'm','e','w','e','.','c','o','m',0,
+    'c','r','e','a','t','i','v','e','l','i','v','e','.','c','o','m',0,
+    'n','b','c','m','i','a','m','i','.','c','o','m',0,
+    'n','o','n','g','n','u','.','o','r','g',0,
+    's','t','a','r','a','d','v','e','r','t','i','s','e','r','.','c','o','m',0,
+    'f','i','l','e','h','i','p','p','o','.','c','o','m',0,
+    'e','u','o','b','s','e','r','v','e','r','.','c','o','m',0,
+    'n','u','a','n','c','e','.','c','o','m',0,
+    'u','p','.','p','t',0,
+    'p','r','e','s','s','d','e','m','o','c','r','a','t','.','c','o','m',0,
+    'e','n','d','o','c','r','i','n','e','.','o','r','g',0,
+    'd','a','y','t','o','n','d','a','i','l','y','n','e','w','s','.','c','o','m',0,
+    'o','l','e','m','i','s','s','.','e','d','u',0,
+    'a','s','t','r','a','z','e','n','e','c','a','.','c','o','m',0,
+    'h','a','o','s','o','u','.','c','o','m',0,
+    't','r','a','v','e','l','c','h','a','n','n','e','l','.','c','o','m',0,
+    't','h','e','n','o','u','n','p','r','o','j','e','c','t','.','c','o','m',0,
+    'a','m','e','t','s','o','c','.','o','r','g',0,
+    't','h','e','d','a','i','l','y','m','e','a','l','.','c','o','m',0,
+    'n','e','x','t','c','l','o','u','d','.','c','o','m',0,
+    'r','i','p','e','.','n','e','t',0,
+    '8','m','.','c','o','m',0,
+    'p','u','r','e','w','o','w','.','c','o','m',0,
+    'l','u','m','e','n','l','e','a','r','n','i','n','g','.','c','o','m',0,
+    'g','a','z','z','e','t','t','a','.','i','t',0,
+    'o','r','i','g','i','n','.','c','o','m',0,
+    'm','i','n','d','m','e','i','s','t','e','r','.','c','o','m',0,
+    'u','s','t','.','h','k',0,
+    'u','s','b','a','n','k','.','c','o','m',0,
+    'f','o','r','e','v','e','r','2','1','.','c','o','m',0,
+    'g','a','m','e','p','e','d','i','a','.','c','o','m',0,
+    'e','m','e','d','i','c','i','n','e','h','e','a','l','t','h','.','c','o','m',0,
+    'l','e','v','e','r','.','c','o',0,
+    'l','i','f','e','s','i','t','e','n','e','w','s','.','c','o','m',0,
+    'g','d','a','.','p','l',0,
+    's','k','y','s','c','a','n','n','e','r','.','n','e','t',0,
+    's','u','i','t','e','1','0','1','.','c','o','m',0,
+    'n','e','o','c','i','t','i','e','s','.','o','r','g',0,
+    'p','r','o','v','i','d','e','n','c','e','j','o','u','r','n','a','l','.','c','o','m',0,
+    'c','a','n','o','e','.','c','a',0,
+    'k','a','n','s','a','s','.','c','o','m',0,
+    's','p','r','i','n','t','.','c','o','m',0,
+    'p','a','l','g','r','a','v','e','.','c','o','m',0,
+    'd','e','c','r','y','p','t','.','c','o',0,
+    'r','o','t','a','r','y','.','o','r','g',0,
+    'b','e','a','c','o','n','s','.','a','i',0,
+    'c','a','f','e','m','o','m','.','c','o','m',0,
+    'w','g','b','h','.','o','r','g',0,
+    'c','i','r','q','u','e','d','u','s','o','l','e','i','l','.','c','o','m',0,
+    'w','o','r','l','d','s','c','i','e','n','t','i','f','i','c','.','c','o','m',0,
+    'a','p','p','s','t','o','.','r','e',0,
+    'l','i','b','e','r','t','y','.','e','d','u',0,
+    'r','u','b','y','-','l','a','n','g','.','o','r','g',0,
+    'y','o','g','a','j','o','u','r','n','a','l','.','c','o','m',0,
+    't','o','k','2','.','c','o','m',0,
+    'l','e','g','.','b','r',0,
+    't','h','e','i','n','q','u','i','r','e','r','.','n','e','t',0,
+    's','h','o','p','p','i','n','g','.','c','o','m',0,
+    'h','o','s','t','i','n','g','e','r','.','c','o','m',0,
+    'n','o','t','e','b','o','o','k','c','h','e','c','k','.','n','e','t',0,
+    'm','y','h','e','r','i','t','a','g','e','.','c','o','m',0,
+    'c','h','o','p','.','e','d','u',0,
+    'r','i','j','k','s','m','u','s','e','u','m','.','n','l',0,
+    'b','a','s','e','b','a','l','l','-','r','e','f','e','r','e','n','c','e','.','c','o','m',0,
+    'c','b','p','p','.','o','r','g',0,
+    'a','t','h','.','c','x',0,
+    't','i','n','y','p','n','g','.','c','o','m',0,
+    'p','u','b','l','o','n','s','.','c','o','m',0,
+    'm','a','r','q','u','e','t','t','e','.','e','d','u',0,
+    't','h','e','h','o','t','l','i','n','e','.','o','r','g',0,
+    'm','e','r','c','k','m','a','n','u','a','l','s','.','c','o','m',0,
+    'o','p','t','i','n','m','o','n','s','t','e','r','.','c','o','m',0,
+    'a','m','c','.','c','o','m',0,
+    'l','e','q','u','i','p','e','.','f','r',0,
+    'p','c','i','s','e','c','u','r','i','t','y','s','t','a','n','d','a','r','d','s','.','o','r','g',0,
+    'r','r','.','c','o','m',0,
+    'u','n','d','e','r','a','r','m','o','u','r','.','c','o','m',0,
+    'i','s','r','a','e','l','n','i','g','h','t','c','l','u','b','.','c','o','m',0,
+    's','k','.','c','a',0,
+    'g','a','r','d','e','n','i','n','g','k','n','o','w','h','o','w','.','c','o','m',0,
+    'c','r','e','a','t','i','v','e','.','c','o','m',0,
+    'e','c','o','s','i','a','.','o','r','g',0,
+    'c','e','r','t','.','o','r','g',0,
+    'p','a','i','r','.','c','o','m',0,
+    'l','o','r','e','a','l','.','c','o','m',0,
+    's','c','h','n','e','i','d','e','r','-','e','l','e','c','t','r','i','c','.','c','o','m',0,
+    'w','o','r','l','d','h','i','s','t','o','r','y','.','o','r','g',0,
+    'o','s','c','h','i','n','a','.','n','e','t',0,
+    't','i','g','r','i','s','.','o','r','g',0,
+    'f','r','e','e','s','o','u','n','d','.','o','r','g',0,
+    's','e','c','u','r','e','l','i','s','t','.','c','o','m',0,
+    't','o','p','t','e','n','r','e','v','i','e','w','s','.','c','o','m',0,
+    'a','u','t','h','.','g','r',0,
+    '3','6','k','r','.','c','o','m',0,
+    'a','v','i','t','o','.','r','u',0,
+    'u','k','r','i','.','o','r','g',0,
+    'f','r','i','e','n','d','f','e','e','d','.','c','o','m',0,
+    't','r','a','n','s','p','o','r','t','r','.','i','o',0,
+    'n','e','s','t','.','c','o','m',0,
+    'l','a','d','b','i','b','l','e','.','c','o','m',0,
+    'a','m','n','y','.','c','o','m',0,
+    'p','h','i','l','l','y','m','a','g','.','c','o','m',0,
+    's','i','x','f','l','a','g','s','.','c','o','m',0,
+    'w','i','k','i','v','o','y','a','g','e','.','o','r','g',0,
+    'i','p','e','t','i','t','i','o','n','s','.','c','o','m',0,
+    'g','o','l','f','d','i','g','e','s','t','.','c','o','m',0,
+    'a','g','u','.','o','r','g',0,
+    'b','l','a','c','k','m','a','g','i','c','d','e','s','i','g','n','.','c','o','m',0,
+    'o','n','f','e','e','t','n','a','t','i','o','n','.','c','o','m',0,
+    'c','o','o','l','o','r','s','.','c','o',0,
+    'r','a','c','k','e','d','.','c','o','m',0,
+    'l','o','h','u','d','.','c','o','m',0,
+    'i','l','g','a','.','g','o','v',0,
+    'v','.','g','d',0,
+    's','u','s','e','.','c','o','m',0,
+    'a','p','h','a','p','u','b','l','i','c','a','t','i','o','n','s','.','o','r','g',0,
+    'g','s','m','a','.','c','o','m',0,
+    's','a','c','r','e','d','-','t','e','x','t','s','.','c','o','m',0,
+    'w','i','w','o','.','d','e',0,
+    'r','e','a','d','w','r','i','t','e','.','c','o','m',0,
+    'i','n','t','e','r','c','o','m','.','c','o','m',0,
+    'n','i','n','t','e','n','d','o','l','i','f','e','.','c','o','m',0,
+    's','g','-','h','o','s','t','.','c','o','m',0,
+    'a','g','i','l','e','n','t','.','c','o','m',0,
+    'c','l','i','c','k','c','e','a','s','e','.','c','o','m',0,
+    'b','l','o','o','m','i','n','g','d','a','l','e','s','.','c','o','m',0,
+    'n','e','w','s','1','2','.','c','o','m',0,
+    'm','i','l','a','n','o','.','i','t',0,
+    's','n','a','p','.','c','o','m',0,
+    'l','i','l','l','y','.','c','o','m',0,
+    'i','n','s','t','a','g','r','.','a','m',0,
+    'b','l','o','g','l','i','n','e','s','.','c','o','m',0,
+    's','w','a','r','o','v','s','k','i','.','c','o','m',0,
+    'n','a','t','i','o','n','w','i','d','e','.','c','o','m',0,
+    'd','e','l','a','w','a','r','e','o','n','l','i','n','e','.','c','o','m',0,
+    'w','p','f','o','r','o','.','c','o','m',0,
+    'e','x','p','a','t','i','c','a','.','c','o','m',0,
+    'a','n','y','f','l','i','p','.','c','o','m',0,
+    'i','n','f','i','n','e','o','n','.','c','o','m',0,
+    'a','r','d','m','e','d','i','a','t','h','e','k','.','d','e',0,
+    'n','t','l','w','o','r','l','d','.','c','o','m',0,
+    'd','a','t','i','n','g','m','e','n','t','o','r','.','o','r','g',0,
+    'm','e','t','r','o','t','i','m','e','s','.','c','o','m',0,
+    'p','o','l','l','d','a','d','d','y','.','c','o','m',0,
+    'a','u','d','i','o','m','a','c','k','.','c','o','m',0,
+    't','o','m','s','k','.','r','u',0,
+    'a','d','r','.','o','r','g',0,
+    'w','c','v','b','.','c','o','m',0,
+    'c','a','s','i','o','.','c','o','m',0,
+    'b','g','s','u','.','e','d','u',0,
+    's','p','e','c','t','r','u','m','l','o','c','a','l','n','e','w','s','.','c','o','m',0,
+    'j','w','.','o','r','g',0,
+    'h','a','m','b','u','r','g','.','d','e',0,
+    '1','2','3','0','6','.','c','n',0,
+    'j','w','p','l','a','y','e','r','.','c','o','m',0,
+    'm','c','c','l','a','t','c','h','y','d','c','.','c','o','m',0,
+    'i','a','.','u','s',0,
+    'c','y','o','l','.','c','o','m',0,
+    'p','r','o','t','o','c','o','l','.','c','o','m',0,
+    'd','o','u','y','i','n','.','c','o','m',0,
+    'm','i','x','i','.','j','p',0,
+    'c','t','a','n','.','o','r','g',0,
+    'p','x','f','.','i','o',0,
+    'p','e','t','m','d','.','c','o','m',0,
+    't','v','-','h','d','-','1','.','o','r','g',0,
+    'b','a','t','m','a','n','a','p','o','l','l','o','.','r','u',0,
+    'h','u','l','k','s','h','a','r','e','.','c','o','m',0,
+    'd','l','r','.','d','e',0,
+    't','h','e','p','i','o','n','e','e','r','w','o','m','a','n','.','c','o','m',0,
+    'w','o','o','t','h','e','m','e','s','.','c','o','m',0,
+    's','l','u','.','e','d','u',0,
+    'm','a','r','t','i','n','d','a','l','e','.','c','o','m',0,
+    'n','e','s','p','r','e','s','s','o','.','c','o','m',0,
+    'j','u','n','i','p','e','r','.','n','e','t',0,
+    'e','e','t','i','m','e','s','.','c','o','m',0,
+    'h','y','p','o','t','h','e','s','e','s','.','o','r','g',0,
+    'd','r','.','d','k',0,
+    'w','i','n','e','h','q','.','o','r','g',0,
+    'a','c','t','.','o','r','g',0,
+    'r','o','b','b','r','e','p','o','r','t','.','c','o','m',0,
+    'c','o','m','i','n','g','s','o','o','n','.','n','e','t',0,
+    'c','o','l','o','u','r','l','o','v','e','r','s','.','c','o','m',0,
+    'r','t','l','.','d','e',0,
+    'u','c','d','.','i','e',0,
+    'c','h','a','t','h','a','m','h','o','u','s','e','.','o','r','g',0,
+    'm','a','s','t','o','d','o','n','.','s','o','c','i','a','l',0,
+    'p','r','e','s','s','e','p','o','r','t','a','l','.','d','e',0,
+    'j','m','u','.','e','d','u',0,
+    'p','o','s','h','m','a','r','k','.','c','o','m',0,
+    't','r','e','z','o','r','.','i','o',0,
+    'm','i','g','r','a','t','i','o','n','p','o','l','i','c','y','.','o','r','g',0,
+    'f','r','a','n','c','e','b','l','e','u','.','f','r',0,
+    'p','r','e','p','l','y','.','c','o','m',0,
+    '2','t','r','a','c','k','.','i','n','f','o',0,
+    'v','i','r','g','i','n','m','e','d','i','a','.','c','o','m',0,
+    'u','b','u','n','t','u','f','o','r','u','m','s','.','o','r','g',0,
+    'l','a','b','i','e','n','n','a','l','e','.','o','r','g',0,
+    'a','b','c','a','c','t','i','o','n','n','e','w','s','.','c','o','m',0,
+    'b','o','s','t','o','n','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    'o','p','e','n','b','s','d','.','o','r','g',0,
+    'w','o','n','d','e','r','p','l','u','g','i','n','.','c','o','m',0,
+    'g','o','o','d','t','h','e','r','a','p','y','.','o','r','g',0,
+    'f','o','x','2','n','o','w','.','c','o','m',0,
+    'l','o','o','k','b','o','o','k','.','n','u',0,
+    'a','t','w','.','h','u',0,
+    'n','i','e','m','a','n','l','a','b','.','o','r','g',0,
+    'n','y','1','.','c','o','m',0,
+    'i','n','m','o','t','i','o','n','h','o','s','t','i','n','g','.','c','o','m',0,
+    'o','n','e','t','r','u','s','t','.','c','o','m',0,
+    'z','i','p','p','i','a','.','c','o','m',0,
+    'z','e','b','r','a','.','c','o','m',0,
+    'w','h','y','y','.','o','r','g',0,
+    'o','s','t','i','.','g','o','v',0,
+    'n','e','a','.','o','r','g',0,
+    's','c','h','w','a','b','.','c','o','m',0,
+    'w','a','l','k','s','c','o','r','e','.','c','o','m',0,
+    'k','o','m','p','a','s','.','c','o','m',0,
+    'n','a','t','i','o','n','m','a','s','t','e','r','.','c','o','m',0,
+    'g','a','d','g','e','t','s','3','6','0','.','c','o','m',0,
+    's','e','v','e','n','t','e','e','n','.','c','o','m',0,
+    'd','m','m','.','c','o','m',0,
+    'r','a','d','i','o','p','u','b','l','i','c','.','c','o','m',0,
+    'a','g','p','d','.','e','s',0,
+    's','q','u','a','r','e','b','l','o','g','s','.','n','e','t',0,
+    's','y','m','p','a','t','i','c','o','.','c','a',0,
+    's','c','o','t','u','s','b','l','o','g','.','c','o','m',0,
+    'b','o','s','e','.','c','o','m',0,
+    'v','i','r','g','i','l','i','o','.','i','t',0,
+    'c','o','p','y','s','c','a','p','e','.','c','o','m',0,
+    'a','c','t','i','v','e','s','t','a','t','e','.','c','o','m',0,
+    't','h','e','m','i','f','y','.','m','e',0,
+    't','h','e','d','a','i','l','y','s','t','a','r','.','n','e','t',0,
+    'k','i','n','o','p','o','i','s','k','.','r','u',0,
+    'd','e','c','c','a','n','c','h','r','o','n','i','c','l','e','.','c','o','m',0,
+    'w','w','n','o','r','t','o','n','.','c','o','m',0,
+    'o','n','e','p','l','u','s','.','c','o','m',0,
+    'o','r','b','i','t','z','.','c','o','m',0,
+    'p','o','r','c','h','.','c','o','m',0,
+    'u','p','v','.','e','s',0,
+    'm','p','a','a','.','o','r','g',0,
+    'w','t','s','p','.','c','o','m',0,
+    'x','a','n','g','a','.','c','o','m',0,
+    'm','y','s','w','i','t','z','e','r','l','a','n','d','.','c','o','m',0,
+    'e','x','p','a','n','s','i','o','n','.','c','o','m',0,
+    'r','e','t','a','i','l','d','i','v','e','.','c','o','m',0,
+    'e','d','g','e','s','u','i','t','e','.','n','e','t',0,
+    'g','i','g','a','b','y','t','e','.','c','o','m',0,
+    'r','a','v','e','l','r','y','.','c','o','m',0,
+    't','h','e','m','a','r','y','s','u','e','.','c','o','m',0,
+    'w','k','y','c','.','c','o','m',0,
+    'k','i','r','o','7','.','c','o','m',0,
+    't','h','i','n','g','l','i','n','k','.','c','o','m',0,
+    'e','p','i','k','.','c','o','m',0,
+    's','a','n','d','i','e','g','o','.','e','d','u',0,
+    'm','u','n','.','c','a',0,
+    'g','h','a','c','k','s','.','n','e','t',0,
+    's','l','i','c','k','d','e','a','l','s','.','n','e','t',0,
+    'w','h','i','t','e','p','a','g','e','s','.','c','o','m',0,
+    'b','u','f','f','.','l','y',0,
+    'e','m','b','e','d','l','y','.','c','o','m',0,
+    'u','n','b','o','u','n','c','e','.','c','o','m',0,
+    't','h','e','l','a','d','d','e','r','s','.','c','o','m',0,
+    'g','o','o','p','.','c','o','m',0,
+    'l','e','a','f','l','y','.','c','o','m',0,
+    'f','i','n','a','l','f','a','n','t','a','s','y','x','i','v','.','c','o','m',0,
+    'n','a','b','b','l','e','.','c','o','m',0,
+    'v','i','s','i','t','l','o','n','d','o','n','.','c','o','m',0,
+    'b','o','o','t','s','t','r','a','p','m','a','d','e','.','c','o','m',0,
+    'm','e','t','a','c','p','a','n','.','o','r','g',0,
+    'j','c','r','e','w','.','c','o','m',0,
+    'e','s','s','a','y','s','w','r','i','t','i','n','g','.','o','r','g',0,
+    's','t','e','r','e','o','g','u','m','.','c','o','m',0,
+    'g','e','t','y','o','u','r','g','u','i','d','e','.','c','o','m',0,
+    'j','e','k','y','l','l','r','b','.','c','o','m',0,
+    'f','o','n','t','s','q','u','i','r','r','e','l','.','c','o','m',0,
+    'j','p','m','o','r','g','a','n','c','h','a','s','e','.','c','o','m',0,
+    'l','i','s','t','e','n','n','o','t','e','s','.','c','o','m',0,
+    'h','y','u','n','d','a','i','.','c','o','m',0,
+    'l','i','t','h','u','b','.','c','o','m',0,
+    'm','o','u','n','t','s','i','n','a','i','.','o','r','g',0,
+    'v','e','r','c','e','l','.','a','p','p',0,
+    'r','o','y','a','l','c','a','r','i','b','b','e','a','n','.','c','o','m',0,
+    'm','e','d','i','a','b','i','s','t','r','o','.','c','o','m',0,
+    'b','i','g','g','e','r','p','o','c','k','e','t','s','.','c','o','m',0,
+    'b','u','y','b','i','t','c','o','i','n','w','o','r','l','d','w','i','d','e','.','c','o','m',0,
+    'm','u','l','t','i','s','c','r','e','e','n','s','i','t','e','.','c','o','m',0,
+    'p','e','e','r','j','.','c','o','m',0,
+    '1','6','p','e','r','s','o','n','a','l','i','t','i','e','s','.','c','o','m',0,
+    'n','w','i','t','i','m','e','s','.','c','o','m',0,
+    'c','o','m','p','a','n','y','.','s','i','t','e',0,
+    't','o','d','a','y','o','n','l','i','n','e','.','c','o','m',0,
+    'i','f','c','.','o','r','g',0,
+    't','r','u','s','t','w','a','v','e','.','c','o','m',0,
+    'n','e','t','w','o','r','k','f','o','r','g','o','o','d','.','c','o','m',0,
+    'c','a','k','e','r','e','s','u','m','e','.','c','o','m',0,
+    '6','t','e','.','n','e','t',0,
+    'p','h','o','e','n','i','x','n','e','w','t','i','m','e','s','.','c','o','m',0,
+    'f','a','s','h','i','o','n','i','s','t','a','.','c','o','m',0,
+    'c','o','n','t','i','n','e','n','t','a','l','.','c','o','m',0,
+    'h','a','n','d','m','a','d','e','w','r','i','t','i','n','g','.','c','o','m',0,
+    's','h','i','n','y','s','t','a','t','.','c','o','m',0,
+    'f','r','e','e','b','e','a','c','o','n','.','c','o','m',0,
+    'f','i','n','e','x','t','r','a','.','c','o','m',0,
+    'w','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    'e','p','o','.','o','r','g',0,
+    't','r','a','n','s','l','a','t','e','w','i','k','i','.','n','e','t',0,
+    'w','i','n','s','c','p','.','n','e','t',0,
+    't','i','f','f','a','n','y','.','c','o','m',0,
+    'b','i','o','o','n','e','.','o','r','g',0,
+    'c','o','n','t','r','o','l','c','.','c','o','m',0,
+    'f','r','a','n','c','e','i','n','t','e','r','.','f','r',0,
+    'a','e','t','n','a','.','c','o','m',0,
+    's','i','l','i','v','e','.','c','o','m',0,
+    't','h','e','a','r','t','n','e','w','s','p','a','p','e','r','.','c','o','m',0,
+    't','i','c','k','s','y','.','c','o','m',0,
+    'w','i','l','l','i','a','m','s','.','e','d','u',0,
+    'c','y','c','l','i','n','g','7','4','.','c','o','m',0,
+    'j','c','i','.','o','r','g',0,
+    'a','x','s','.','c','o','m',0,
+    'f','o','r','m','a','t','.','c','o','m',0,
+    's','i','m','o','n','.','c','o','m',0,
+    's','a','m','b','a','.','o','r','g',0,
+    'v','h','1','.','c','o','m',0,
+    'c','a','i','r','n','.','i','n','f','o',0,
+    't','r','u','s','t','e','.','c','o','m',0,
+    'l','e','a','r','n','r','e','l','i','g','i','o','n','s','.','c','o','m',0,
+    'o','n','e','g','r','e','e','n','p','l','a','n','e','t','.','o','r','g',0,
+    'c','h','i','p','o','t','l','e','.','c','o','m',0,
+    'b','e','f','o','r','e','i','t','s','n','e','w','s','.','c','o','m',0,
+    '5','6','.','c','o','m',0,
+    'c','a','s','t','b','o','x','.','f','m',0,
+    'k','i','n','o','t','e','a','t','r','z','a','r','y','a','.','r','u',0,
+    's','z','c','z','e','c','i','n','.','p','l',0,
+    'u','f','m','g','.','b','r',0,
+    'k','a','n','a','g','a','w','a','.','j','p',0,
+    'c','r','e','a','t','e','s','p','a','c','e','.','c','o','m',0,
+    'd','i','r','e','c','t','a','d','m','i','n','.','c','o','m',0,
+    's','e','e','t','i','c','k','e','t','s','.','c','o','m',0,
+    'b','r','a','n','d','w','a','t','c','h','.','c','o','m',0,
+    'r','e','d','c','r','o','s','s','b','l','o','o','d','.','o','r','g',0,
+    'p','u','b','h','t','m','l','5','.','c','o','m',0,
+    'r','e','c','r','e','a','t','i','o','n','.','g','o','v',0,
+    'g','l','a','a','d','.','o','r','g',0,
+    'j','u','s','.','b','r',0,
+    'm','a','t','h','s','i','s','f','u','n','.','c','o','m',0,
+    'c','h','a','b','a','d','.','o','r','g',0,
+    'j','o','o','m','a','g','.','c','o','m',0,
+    'k','i','n','g','c','o','u','n','t','y','.','g','o','v',0,
+    'a','l','-','m','o','n','i','t','o','r','.','c','o','m',0,
+    'j','u','n','e','a','u','e','m','p','i','r','e','.','c','o','m',0,
+    'g','o','v','e','r','n','i','n','g','.','c','o','m',0,
+    's','h','a','n','g','r','i','-','l','a','.','c','o','m',0,
+    'm','a','t','a','d','o','r','n','e','t','w','o','r','k','.','c','o','m',0,
+    's','h','a','z','a','m','.','c','o','m',0,
+    'g','c','s','-','w','e','b','.','c','o','m',0,
+    'a','k','.','u','s',0,
+    'a','o','n','.','c','o','m',0,
+    'o','d','y','s','e','e','.','c','o','m',0,
+    'g','m','a','n','e','t','w','o','r','k','.','c','o','m',0,
+    's','o','f','t','w','a','r','e','a','d','v','i','c','e','.','c','o','m',0,
+    'i','i','s','.','n','e','t',0,
+    'm','a','r','k','e','t','i','n','g','d','i','v','e','.','c','o','m',0,
+    'c','m','a','i','l','1','9','.','c','o','m',0,
+    'd','n','i','.','g','o','v',0,
+    'a','r','s','e','n','a','l','.','c','o','m',0,
+    't','e','l','e','r','i','k','.','c','o','m',0,
+    'h','u','d','u','s','e','r','.','g','o','v',0,
+    'd','o','c','t','o','r','s','w','i','t','h','o','u','t','b','o','r','d','e','r','s','.','o','r','g',0,
+    'b','u','s','i','n','e','s','s','o','f','a','p','p','s','.','c','o','m',0,
+    't','e','l','e','g','r','a','p','h','i','n','d','i','a','.','c','o','m',0,
+    'a','p','a','r','t','m','e','n','t','s','.','c','o','m',0,
+    'm','a','r','k','m','o','n','i','t','o','r','.','c','o','m',0,
+    'b','a','i','k','e','.','c','o','m',0,
+    'f','o','r','m','s','i','t','e','.','c','o','m',0,
+    'a','c','e','h','a','r','d','w','a','r','e','.','c','o','m',0,
+    'e','a','s','t','b','a','y','t','i','m','e','s','.','c','o','m',0,
+    'a','l','l','a','b','o','u','t','b','i','r','d','s','.','o','r','g',0,
+    't','h','e','s','t','r','a','n','g','e','r','.','c','o','m',0,
+    'g','r','a','i','n','g','e','r','.','c','o','m',0,
+    'y','e','s','k','y','.','c','o','m',0,
+    'o','p','e','n','.','e','d','u',0,
+    't','u','r','n','k','e','y','l','i','n','u','x','.','o','r','g',0,
+    'm','e','d','i','a','s','e','t','.','i','t',0,
+    'b','o','o','k','s','a','m','i','l','l','i','o','n','.','c','o','m',0,
+    'f','g','o','v','.','b','e',0,
+    'a','m','p','-','w','p','.','o','r','g',0,
+    't','x','s','t','a','t','e','.','e','d','u',0,
+    'f','e','e','.','o','r','g',0,
+    'u','p','w','o','r','t','h','y','.','c','o','m',0,
+    'b','u','r','b','e','r','r','y','.','c','o','m',0,
+    'g','o','v','e','r','n','m','e','n','t','j','o','b','s','.','c','o','m',0,
+    'i','e','l','t','s','.','o','r','g',0,
+    'k','d','d','i','.','c','o','m',0,
+    'a','r','t','n','e','w','s','.','c','o','m',0,
+    'a','u','s','t','i','n','t','e','x','a','s','.','g','o','v',0,
+    'b','u','n','g','i','e','.','n','e','t',0,
+    'v','a','n','g','u','a','r','d','.','c','o','m',0,
+    'r','a','d','a','r','o','n','l','i','n','e','.','c','o','m',0,
+    'a','m','n','e','s','t','y','u','s','a','.','o','r','g',0,
+    'c','a','t','h','o','l','i','c','n','e','w','s','a','g','e','n','c','y','.','c','o','m',0,
+    'f','o','r','e','c','a','s','t','7','.','c','o','m',0,
+    'r','o','b','i','n','h','o','o','d','.','c','o','m',0,
+    'a','p','p','a','n','n','i','e','.','c','o','m',0,
+    'c','o','c','h','r','a','n','e','l','i','b','r','a','r','y','.','c','o','m',0,
+    'k','g','w','.','c','o','m',0,
+    't','o','g','g','l','.','c','o','m',0,
+    'e','t','o','r','o','.','c','o','m',0,
+    'b','u','z','z','n','e','t','.','c','o','m',0,
+    't','v','-','t','v','-','t','v','.','o','r','g',0,
+    't','d','.','c','o','m',0,
+    'q','u','e','u','e','-','i','t','.','n','e','t',0,
+    'a','c','c','e','s','s','p','r','e','s','s','t','h','e','m','e','s','.','c','o','m',0,
+    'd','o','i','t','y','o','u','r','s','e','l','f','.','c','o','m',0,
+    'j','a','m','e','s','c','l','e','a','r','.','c','o','m',0,
+    'j','t','a','.','o','r','g',0,
+    'e','r','n','e','t','.','i','n',0,
+    'n','d','s','u','.','e','d','u',0,
+    's','u','n','d','a','n','c','e','.','o','r','g',0,
+    'g','a','m','e','s','p','y','.','c','o','m',0,
+    's','p','a','c','e','n','e','w','s','.','c','o','m',0,
+    'a','n','s','w','e','r','t','h','e','p','u','b','l','i','c','.','c','o','m',0,
+    'c','c','n','.','c','o','m',0,
+    't','h','e','o','a','t','m','e','a','l','.','c','o','m',0,
+    'p','a','r','a','m','o','u','n','t','.','c','o','m',0,
+    'c','c','l','e','a','n','e','r','.','c','o','m',0,
+    '1','8','9','.','c','n',0,
+    'a','u','s','t','r','a','l','i','a','.','c','o','m',0,
+    'u','n','c','g','.','e','d','u',0,
+    'm','y','p','l','a','t','e','.','g','o','v',0,
+    'c','a','t','h','a','y','p','a','c','i','f','i','c','.','c','o','m',0,
+    'm','a','r','k','e','t','i','n','g','w','e','e','k','.','c','o','m',0,
+    'l','e','g','i','s','c','a','n','.','c','o','m',0,
+    's','p','e','e','d','y','l','o','a','n','.','n','e','t',0,
+    'u','n','i','-','b','r','e','m','e','n','.','d','e',0,
+    'x','o','o','m','.','c','o','m',0,
+    't','o','m','.','c','o','m',0,
+    's','i','m','p','l','y','r','e','c','i','p','e','s','.','c','o','m',0,
+    'y','o','u','s','e','n','d','i','t','.','c','o','m',0,
+    'u','s','e','r','w','a','y','.','o','r','g',0,
+    'i','n','t','e','r','c','o','n','t','i','n','e','n','t','a','l','.','c','o','m',0,
+    'e','n','s','.','f','r',0,
+    'i','b','i','s','w','o','r','l','d','.','c','o','m',0,
+    'b','l','a','c','k','l','i','v','e','s','m','a','t','t','e','r','.','c','o','m',0,
+    'w','e','b','f','x','.','c','o','m',0,
+    's','k','y','s','c','r','a','p','e','r','c','i','t','y','.','c','o','m',0,
+    'a','c','a','d','e','m','i','c','.','r','u',0,
+    'i','n','v','e','s','t','o','r','p','l','a','c','e','.','c','o','m',0,
+    'e','u','r','o','p','e','1','.','f','r',0,
+    'd','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    'c','a','r','f','a','x','.','c','o','m',0,
+    'k','e','e','p','a','s','s','.','i','n','f','o',0,
+    'p','i','t','c','h','b','o','o','k','.','c','o','m',0,
+    'd','i','e','p','r','e','s','s','e','.','c','o','m',0,
+    'a','p','c','.','o','r','g',0,
+    'm','o','z','i','l','l','a','-','e','u','r','o','p','e','.','o','r','g',0,
+    'c','t','p','o','s','t','.','c','o','m',0,
+    'k','t','v','u','.','c','o','m',0,
+    'm','i','a','m','i','o','h','.','e','d','u',0,
+    'q','u','i','a','.','c','o','m',0,
+    'l','i','b','r','i','v','o','x','.','o','r','g',0,
+    'g','o','2','c','l','o','u','d','.','o','r','g',0,
+    'w','a','n','t','e','d','l','y','.','c','o','m',0,
+    'r','o','y','a','l','c','b','d','.','c','o','m',0,
+    'q','v','c','.','c','o','m',0,
+    'b','a','s','s','p','r','o','.','c','o','m',0,
+    's','p','l','i','c','e','.','c','o','m',0,
+    'g','o','t','q','u','e','s','t','i','o','n','s','.','o','r','g',0,
+    'k','e','n','n','e','d','y','-','c','e','n','t','e','r','.','o','r','g',0,
+    'a','z','f','a','m','i','l','y','.','c','o','m',0,
+    'k','s','.','g','o','v',0,
+    't','h','e','g','a','m','e','r','.','c','o','m',0,
+    'a','m','e','r','i','c','a','n','t','h','i','n','k','e','r','.','c','o','m',0,
+    'c','r','e','d','i','t','c','a','r','d','s','.','c','o','m',0,
+    'l','a','t','r','i','b','u','n','e','.','f','r',0,
+    'h','o','l','a','.','c','o','m',0,
+    'a','u','t','o','w','e','e','k','.','c','o','m',0,
+    't','i','s','c','a','l','i','.','i','t',0,
+    'w','k','o','.','a','t',0,
+    'w','e','w','o','r','k','.','c','o','m',0,
+    'f','a','r','k','.','c','o','m',0,
+    'm','a','d','m','i','m','i','.','c','o','m',0,
+    'n','i','r','s','o','f','t','.','n','e','t',0,
+    'm','y','m','i','n','i','f','a','c','t','o','r','y','.','c','o','m',0,
+    's','u','d','o','u','e','s','t','.','f','r',0,
+    'h','k','t','d','c','.','c','o','m',0,
+    'v','o','l','u','n','t','e','e','r','m','a','t','c','h','.','o','r','g',0,
+    'e','l','t','e','.','h','u',0,
+    'u','t','s','a','.','e','d','u',0,
+    'c','e','r','v','a','n','t','e','s','.','e','s',0,
+    't','r','e','k','b','i','k','e','s','.','c','o','m',0,
+    'w','e','s','l','e','y','a','n','.','e','d','u',0,
+    'c','r','e','d','i','t','k','a','r','m','a','.','c','o','m',0,
+    'm','u','n','d','o','d','e','p','o','r','t','i','v','o','.','c','o','m',0,
+    'a','s','i','c','s','.','c','o','m',0,
+    'n','b','c','o','l','y','m','p','i','c','s','.','c','o','m',0,
+    'g','m','p','g','.','o','r','g',0,
+    'f','f','m','p','e','g','.','o','r','g',0,
+    't','r','i','b','u','n','n','e','w','s','.','c','o','m',0,
+    'i','i','s','d','.','o','r','g',0,
+    'm','e','d','i','a','p','a','r','t','.','f','r',0,
+    'a','m','e','r','i','c','a','n','b','a','n','k','e','r','.','c','o','m',0,
+    't','a','l','l','a','h','a','s','s','e','e','.','c','o','m',0,
+    'l','a','c','i','t','y','.','o','r','g',0,
+    'f','i','l','m','f','r','e','e','w','a','y','.','c','o','m',0,
+    'a','w','i','n','.','c','o','m',0,
+    'v','e','n','n','g','a','g','e','.','c','o','m',0,
+    'u','n','i','r','i','o','j','a','.','e','s',0,
+    'i','c','o','n','f','i','n','d','e','r','.','c','o','m',0,
+    'm','y','t','h','e','m','.','e','s',0,
+    'r','o','c','h','e','.','c','o','m',0,
+    'j','e','n','k','i','n','s','.','i','o',0,
+    'a','v','i','d','.','c','o','m',0,
+    't','o','d','o','i','s','t','.','c','o','m',0,
+    'i','f','.','u','a',0,
+    'v','r','t','.','b','e',0,
+    'r','o','a','n','o','k','e','.','c','o','m',0,
+    'h','o','v','e','r','.','c','o','m',0,
+    'u','n','i','-','t','r','i','e','r','.','d','e',0,
+    'j','a','p','a','n','-','g','u','i','d','e','.','c','o','m',0,
+    'w','e','b','s','e','l','f','.','n','e','t',0,
+    'u','n','t','a','p','p','d','.','c','o','m',0,
+    'c','s','-','c','a','r','t','.','c','o','m',0,
+    'f','r','e','s','h','m','e','a','t','.','n','e','t',0,
+    't','h','e','t','r','a','i','n','l','i','n','e','.','c','o','m',0,
+    's','i','m','p','l','y','h','i','r','e','d','.','c','o','m',0,
+    'o','k','l','a','h','o','m','a','n','.','c','o','m',0,
+    'z','a','c','k','s','.','c','o','m',0,
+    's','i','p','r','i','.','o','r','g',0,
+    'p','r','e','s','s','-','c','r','e','w','.','c','o','m',0,
+    'n','o','v','a','y','a','g','a','z','e','t','a','.','r','u',0,
+    's','o','l','i','d','w','o','r','k','s','.','c','o','m',0,
+    'u','n','i','-','m','a','i','n','z','.','d','e',0,
+    'p','a','s','s','k','e','y','.','c','o','m',0,
+    't','r','i','b','e','.','s','o',0,
+    'h','i','n','e','t','.','n','e','t',0,
+    'c','a','r','e','c','r','e','d','i','t','.','c','o','m',0,
+    'k','y','o','d','o','n','e','w','s','.','n','e','t',0,
+    't','o','p','f','o','r','e','i','g','n','b','r','i','d','e','s','.','c','o','m',0,
+    'c','o','l','g','a','t','e','.','c','o','m',0,
+    'x','i','n','m','i','n','.','c','n',0,
+    'w','e','b','c','i','n','d','a','r','i','o','.','c','o','m',0,
+    'c','l','a','r','i','o','n','l','e','d','g','e','r','.','c','o','m',0,
+    'f','i','.','i','t',0,
+    'l','i','n','u','x','j','o','u','r','n','a','l','.','c','o','m',0,
+    'w','h','a','t','t','o','e','x','p','e','c','t','.','c','o','m',0,
+    'b','l','e','e','d','i','n','g','c','o','o','l','.','c','o','m',0,
+    'l','a','-','c','r','o','i','x','.','c','o','m',0,
+    'p','i','x','1','1','.','c','o','m',0,
+    'a','c','t','i','v','e','r','a','i','n','.','c','o','m',0,
+    'u','m','w','e','l','t','b','u','n','d','e','s','a','m','t','.','d','e',0,
+    'f','a','t','h','e','r','l','y','.','c','o','m',0,
+    'f','l','o','r','i','d','a','t','o','d','a','y','.','c','o','m',0,
+    'n','e','w','s','o','k','.','c','o','m',0,
+    'a','l','t','u','r','l','.','c','o','m',0,
+    'j','o','e','l','o','n','s','o','f','t','w','a','r','e','.','c','o','m',0,
+    'g','e','n','i','.','c','o','m',0,
+    'w','h','a','t','w','g','.','o','r','g',0,
+    'f','e','c','.','g','o','v',0,
+    't','h','e','a','m','e','r','i','c','a','n','c','o','n','s','e','r','v','a','t','i','v','e','.','c','o','m',0,
+    'h','a','l','l','m','a','r','k','.','c','o','m',0,
+    'r','i','k','e','n','.','j','p',0,
+    'o','p','p','o','.','c','o','m',0,
+    'c','r','o','s','s','r','e','f','.','o','r','g',0,
+    'v','i','a','m','i','c','h','e','l','i','n','.','c','o','m',0,
+    'y','m','a','w','s','.','c','o','m',0,
+    'd','i','g','i','t','a','l','-','p','h','o','t','o','g','r','a','p','h','y','-','s','c','h','o','o','l','.','c','o','m',0,
+    'c','m','a','j','.','c','a',0,
+    'c','s','u','s','.','e','d','u',0,
+    'i','n','f','o','g','r','.','a','m',0,
+    'e','l','c','o','m','e','r','c','i','o','.','p','e',0,
+    'j','s','s','o','r','.','c','o','m',0,
+    'f','i','n','a','n','c','i','a','l','c','o','n','t','e','n','t','.','c','o','m',0,
+    'm','i','l','e','n','i','o','.','c','o','m',0,
+    't','m','w','e','b','.','r','u',0,
+    's','k','y','a','n','d','t','e','l','e','s','c','o','p','e','.','o','r','g',0,
+    's','c','a','r','y','m','o','m','m','y','.','c','o','m',0,
+    'e','m','c','.','c','o','m',0,
+    'b','c','z','.','c','o','m',0,
+    'f','o','u','r','m','i','l','a','b','.','c','h',0,
+    'b','m','w','g','r','o','u','p','.','c','o','m',0,
+    'm','a','l','a','y','m','a','i','l','.','c','o','m',0,
+    'f','r','e','e','m','u','s','i','c','a','r','c','h','i','v','e','.','o','r','g',0,
+    'm','s','d','m','a','n','u','a','l','s','.','c','o','m',0,
+    'l','a','n','c','a','s','t','e','r','o','n','l','i','n','e','.','c','o','m',0,
+    'b','r','a','v','e','n','e','t','.','c','o','m',0,
+    's','g','s','.','c','o','m',0,
+    'r','i','v','e','r','f','r','o','n','t','t','i','m','e','s','.','c','o','m',0,
+    's','c','h','e','d','.','c','o','m',0,
+    'm','a','t','e','r','i','a','l','.','i','o',0,
+    'm','a','n','d','a','r','i','n','o','r','i','e','n','t','a','l','.','c','o','m',0,
+    'r','e','a','d','w','r','i','t','e','w','e','b','.','c','o','m',0,
+    'c','o','m','m','e','r','c','i','a','l','a','p','p','e','a','l','.','c','o','m',0,
+    'c','h','e','z','.','c','o','m',0,
+    't','u','-','c','h','e','m','n','i','t','z','.','d','e',0,
+    'w','i','t','h','2','.','n','e','t',0,
+    'p','x','h','e','r','e','.','c','o','m',0,
+    'i','t','1','6','8','.','c','o','m',0,
+    'c','y','b','e','r','c','i','t','i','.','b','i','z',0,
+    'd','a','a','d','.','d','e',0,
+    '2','0','m','i','n','.','c','h',0,
+    'c','l','i','c','k','4','r','.','c','o','m',0,
+    'l','i','b','.','r','u',0,
+    'r','e','g','n','u','m','.','r','u',0,
+    'a','d','o','b','e','c','o','n','n','e','c','t','.','c','o','m',0,
+    'f','a','m','i','l','y','d','o','c','t','o','r','.','o','r','g',0,
+    'a','s','s','e','t','s','.','k','p','m','g',0,
+    'g','e','o','g','e','b','r','a','.','o','r','g',0,
+    'd','l','i','n','k','.','c','o','m',0,
+    'd','v','i','d','s','h','u','b','.','n','e','t',0,
+    'b','m','w','.','c','o','m',0,
+    'c','e','n','g','a','g','e','.','c','o','m',0,
+    'a','l','e','t','e','i','a','.','o','r','g',0,
+    'w','p','m','l','.','o','r','g',0,
+    'd','i','c','e','.','c','o','m',0,
+    'l','u','l','u','l','e','m','o','n','.','c','o','m',0,
+    'c','p','j','.','o','r','g',0,
+    'l','a','m','a','g','.','c','o','m',0,
+    'u','p','m','c','.','c','o','m',0,
+    'k','a','r','e','1','1','.','c','o','m',0,
+    's','c','i','a','m','.','c','o','m',0,
+    't','h','e','c','a','n','a','d','i','a','n','e','n','c','y','c','l','o','p','e','d','i','a','.','c','a',0,
+    'u','n','i','t','e','d','-','d','o','m','a','i','n','s','.','d','e',0,
+    'm','a','n','g','o','.','c','o','m',0,
+    'i','n','s','e','e','.','f','r',0,
+    'u','s','a','l','.','e','s',0,
+    'i','g','i','-','g','l','o','b','a','l','.','c','o','m',0,
+    'm','o','d','e','r','n','h','e','a','l','t','h','c','a','r','e','.','c','o','m',0,
+    'a','t','p','t','o','u','r','.','c','o','m',0,
+    'h','e','r','m','e','s','.','c','o','m',0,
+    'e','s','c','a','p','i','s','t','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    'g','o','l','f','.','c','o','m',0,
+    'f','l','s','e','n','a','t','e','.','g','o','v',0,
+    'l','o','n','d','o','n','s','t','o','c','k','e','x','c','h','a','n','g','e','.','c','o','m',0,
+    'v','a','l','u','e','w','a','l','k','.','c','o','m',0,
+    'j','e','t','b','l','u','e','.','c','o','m',0,
+    't','3','.','c','o','m',0,
+    'a','l','l','t','h','a','t','s','i','n','t','e','r','e','s','t','i','n','g','.','c','o','m',0,
+    'f','p','d','f','.','o','r','g',0,
+    'g','o','o','d','.','i','s',0,
+    'n','a','a','c','p','.','o','r','g',0,
+    'o','r','s','t','.','e','d','u',0,
+    'p','e','r','e','z','h','i','l','t','o','n','.','c','o','m',0,
+    's','o','n','o','s','.','c','o','m',0,
+    'e','n','o','t','e','s','.','c','o','m',0,
+    'a','.','c','o',0,
+    'a','d','o','r','a','m','a','.','c','o','m',0,
+    'f','r','e','s','n','o','b','e','e','.','c','o','m',0,
+    't','h','e','f','a','.','c','o','m',0,
+    'v','g','.','n','o',0,
+    'm','a','r','c','h','o','f','d','i','m','e','s','.','o','r','g',0,
+    'd','i','s','c','o','u','r','s','e','.','o','r','g',0,
+    'w','x','y','z','.','c','o','m',0,
+    'd','e','t','i','k','.','c','o','m',0,
+    'p','c','a','.','s','t',0,
+    'p','a','r','a','l','y','m','p','i','c','.','o','r','g',0,
+    'm','o','t','h','e','r','e','a','r','t','h','n','e','w','s','.','c','o','m',0,
+    'b','u','i','l','t','i','n','.','c','o','m',0,
+    'j','o','o','m','s','h','a','p','e','r','.','c','o','m',0,
+    's','i','t','e','m','e','t','e','r','.','c','o','m',0,
+    's','h','o','p','b','o','p','.','c','o','m',0,
+    'm','e','r','c','a','r','i','.','c','o','m',0,
+    'e','i','b','.','o','r','g',0,
+    'p','h','y','s','o','r','g','.','c','o','m',0,
+    'b','i','t','c','o','i','n','m','a','g','a','z','i','n','e','.','c','o','m',0,
+    'w','c','p','o','.','c','o','m',0,
+    'c','o','m','m','o','n','w','e','a','l','t','h','f','u','n','d','.','o','r','g',0,
+    'm','t','s','u','.','e','d','u',0,
+    'o','p','e','n','i','d','.','n','e','t',0,
+    'd','o','i','n','g','b','u','s','i','n','e','s','s','.','o','r','g',0,
+    'w','h','o','i','.','e','d','u',0,
+    'g','o','o','d','m','e','n','p','r','o','j','e','c','t','.','c','o','m',0,
+    'p','a','p','e','r','w','r','i','t','i','n','g','s','.','c','o','m',0,
+    'a','n','c','i','e','n','t','-','o','r','i','g','i','n','s','.','n','e','t',0,
+    'a','r','c','h','i','t','i','z','e','r','.','c','o','m',0,
+    't','h','i','n','k','u','p','t','h','e','m','e','s','.','c','o','m',0,
+    'a','u','t','o','r','i','t','e','i','t','p','e','r','s','o','o','n','s','g','e','g','e','v','e','n','s','.','n','l',0,
+    'p','l','a','y','b','u','z','z','.','c','o','m',0,
+    '1','2','3','f','o','r','m','b','u','i','l','d','e','r','.','c','o','m',0,
+    'm','u','s','i','c','b','r','a','i','n','z','.','o','r','g',0,
+    'k','s','d','k','.','c','o','m',0,
+    'v','i','d','e','o','p','r','e','s','s','.','c','o','m',0,
+    'a','l','a','s','k','a','a','i','r','.','c','o','m',0,
+    'c','h','r','i','s','t','i','a','n','b','o','o','k','.','c','o','m',0,
+    'y','o','u','c','a','n','b','o','o','k','.','m','e',0,
+    'r','o','a','d','a','n','d','t','r','a','c','k','.','c','o','m',0,
+    'c','o','m','p','t','i','a','.','o','r','g',0,
+    'w','w','u','.','e','d','u',0,
+    'h','o','w','a','r','d','.','e','d','u',0,
+    'p','h','i','l','l','y','v','o','i','c','e','.','c','o','m',0,
+    'q','u','a','n','t','a','m','a','g','a','z','i','n','e','.','o','r','g',0,
+    'i','n','t','e','r','n','e','t','l','i','v','e','s','t','a','t','s','.','c','o','m',0,
+    'j','i','n','s','h','u','j','u','.','n','e','t',0,
+    'w','a','c','o','m','.','c','o','m',0,
+    'u','c','c','.','i','e',0,
+    'h','e','l','p','s','c','o','u','t','.','c','o','m',0,
+    'p','h','i','l','a','.','g','o','v',0,
+    'f','e','s','t','i','v','a','l','-','c','a','n','n','e','s','.','c','o','m',0,
+    'v','o','d','a','f','o','n','e','.','c','o','m',0,
+    'r','a','r','l','a','b','.','c','o','m',0,
+    't','h','e','g','a','t','e','w','a','y','p','u','n','d','i','t','.','c','o','m',0,
+    'y','j','t','a','g','.','j','p',0,
+    'r','g','j','.','c','o','m',0,
+    'f','o','x','6','n','o','w','.','c','o','m',0,
+    'b','o','o','k','r','i','o','t','.','c','o','m',0,
+    'e','e','n','e','w','s','.','n','e','t',0,
+    'a','c','r','o','n','y','m','f','i','n','d','e','r','.','c','o','m',0,
+    'w','f','t','v','.','c','o','m',0,
+    'm','i','x','p','a','n','e','l','.','c','o','m',0,
+    'd','i','v','e','p','h','o','t','o','g','u','i','d','e','.','c','o','m',0,
+    'm','y','b','l','u','e','h','o','s','t','.','m','e',0,
+    's','l','i','d','e','s','e','r','v','e','.','c','o','m',0,
+    'k','c','r','w','.','c','o','m',0,
+    'r','u','h','r','-','u','n','i','-','b','o','c','h','u','m','.','d','e',0,
+    'f','l','o','r','i','d','a','h','e','a','l','t','h','.','g','o','v',0,
+    'h','s','-','s','i','t','e','s','.','c','o','m',0,
+    'h','e','l','l','o','g','i','g','g','l','e','s','.','c','o','m',0,
+    'i','r','e','n','a','.','o','r','g',0,
+    'p','a','y','f','o','r','e','s','s','a','y','.','n','e','t',0,
+    'c','u','r','s','e','f','o','r','g','e','.','c','o','m',0,
+    't','h','e','s','m','o','k','i','n','g','g','u','n','.','c','o','m',0,
+    'f','a','s','t','w','e','b','.','c','o','m',0,
+    'l','e','s','o','i','r','.','b','e',0,
+    'y','a','.','r','u',0,
+    'b','i','l','l','i','n','g','s','g','a','z','e','t','t','e','.','c','o','m',0,
+    't','i','n','e','y','e','.','c','o','m',0,
+    't','h','e','b','u','l','l','e','t','i','n','.','o','r','g',0,
+    'g','o','l','e','m','.','d','e',0,
+    'p','r','o','p','r','o','f','s','.','c','o','m',0,
+    'i','a','b','.','c','o','m',0,
+    'q','u','e','s','t','i','a','.','c','o','m',0,
+    'j','i','j','i','.','c','o','m',0,
+    'b','e','a','c','o','n','j','o','u','r','n','a','l','.','c','o','m',0,
+    'y','r','.','n','o',0,
+    's','t','r','a','i','g','h','t','d','o','p','e','.','c','o','m',0,
+    'i','d','e','a','l','i','s','t','.','o','r','g',0,
+    'd','e','c','i','d','e','r','.','c','o','m',0,
+    'k','s','u','.','e','d','u',0,
+    'y','a','m','l','.','o','r','g',0,
+    'm','e','t','l','i','f','e','.','c','o','m',0,
+    'k','c','r','a','.','c','o','m',0,
+    's','a','l','v','a','t','i','o','n','a','r','m','y','.','o','r','g',0,
+    's','a','a','t','c','h','i','a','r','t','.','c','o','m',0,
+    'w','z','.','c','z',0,
+    'g','e','t','p','a','i','n','t','.','n','e','t',0,
+    'e','x','p','e','r','t','i','s','e','.','c','o','m',0,
+    'u','n','i','p','d','.','i','t',0,
+    'l','o','n','d','o','n','.','e','d','u',0,
+    'd','a','l','l','a','s','o','b','s','e','r','v','e','r','.','c','o','m',0,
+    'q','i','a','n','l','o','n','g','.','c','o','m',0,
+    'a','u','t','h','0','.','c','o','m',0,
+    'g','a','s','b','u','d','d','y','.','c','o','m',0,
+    'f','u','t','u','r','a','-','s','c','i','e','n','c','e','s','.','c','o','m',0,
+    'n','a','t','i','o','n','a','l','m','s','s','o','c','i','e','t','y','.','o','r','g',0,
+    'i','n','f','o','r','m','s','.','o','r','g',0,
+    'o','u','t','b','r','a','i','n','.','c','o','m',0,
+    'g','l','o','b','a','l','s','o','u','r','c','e','s','.','c','o','m',0,
+    'e','x','p','r','e','s','s','v','p','n','.','c','o','m',0,
+    'u','c','d','e','n','v','e','r','.','e','d','u',0,
+    'p','r','i','c','e','l','i','n','e','.','c','o','m',0,
+    'u','s','h','i','s','t','o','r','y','.','o','r','g',0,
+    'o','m','n','i','h','o','t','e','l','s','.','c','o','m',0,
+    'a','l','l','p','o','s','t','e','r','s','.','c','o','m',0,
+    'w','i','z','a','r','d','i','n','g','w','o','r','l','d','.','c','o','m',0,
+    'n','e','h','.','g','o','v',0,
+    'm','a','r','k','e','t','w','i','r','e','.','c','o','m',0,
+    'p','r','v','.','p','l',0,
+    'n','c','t','m','.','o','r','g',0,
+    'f','r','.','d','e',0,
+    'h','e','a','l','t','h','d','a','y','.','c','o','m',0,
+    'c','a','t','h','o','l','i','c','.','o','r','g',0,
+    'p','e','o','p','l','e','-','p','r','e','s','s','.','o','r','g',0,
+    'u','b','e','r','g','i','z','m','o','.','c','o','m',0,
+    'h','e','a','l','t','h','c','a','r','e','i','t','n','e','w','s','.','c','o','m',0,
+    'm','o','n','s','t','e','r','s','a','n','d','c','r','i','t','i','c','s','.','c','o','m',0,
+    'e','n','t','e','r','p','r','i','s','e','.','c','o','m',0,
+    'u','n','i','p','i','.','i','t',0,
+    'g','v','a','.','e','s',0,
+    'b','r','y','n','m','a','w','r','.','e','d','u',0,
+    'z','b','l','o','g','c','n','.','c','o','m',0,
+    'c','i','t','i','g','r','o','u','p','.','c','o','m',0,
+    'p','o','e','m','h','u','n','t','e','r','.','c','o','m',0,
+    'k','i','.','s','e',0,
+    'a','m','h','e','r','s','t','.','e','d','u',0,
+    'b','a','r','c','e','l','o','n','a','.','c','a','t',0,
+    'k','i','r','k','u','s','r','e','v','i','e','w','s','.','c','o','m',0,
+    'd','o','n','a','l','d','j','t','r','u','m','p','.','c','o','m',0,
+    'k','a','n','t','a','r','.','c','o','m',0,
+    'i','n','d','e','x','m','u','n','d','i','.','c','o','m',0,
+    'p','h','p','-','f','i','g','.','o','r','g',0,
+    'u','c','l','a','h','e','a','l','t','h','.','o','r','g',0,
+    'g','o','o','g','l','e','s','o','u','r','c','e','.','c','o','m',0,
+    'w','e','b','k','i','t','.','o','r','g',0,
+    'g','e','o','l','o','g','y','.','c','o','m',0,
+    'j','o','u','r','n','a','l','d','u','n','e','t','.','c','o','m',0,
+    'q','o','o','h','.','m','e',0,
+    'w','o','o','t','.','c','o','m',0,
+    'p','u','l','i','t','z','e','r','.','o','r','g',0,
+    'o','v','e','r','c','a','s','t','.','f','m',0,
+    'f','o','x','5','a','t','l','a','n','t','a','.','c','o','m',0,
+    'b','c','o','v','e','.','m','e',0,
+    'u','n','i','r','o','m','a','1','.','i','t',0,
+    's','p','e','c','t','r','u','m','.','c','o','m',0,
+    't','u','-','d','a','r','m','s','t','a','d','t','.','d','e',0,
+    'v','i','r','t','u','a','l','m','i','n','.','c','o','m',0,
+    'a','c','l','.','g','o','v',0,
+    'c','g','i','a','r','.','o','r','g',0,
+    'h','a','w','a','i','i','n','e','w','s','n','o','w','.','c','o','m',0,
+    't','r','i','p','.','c','o','m',0,
+    's','i','u','.','e','d','u',0,
+    'g','u','t','t','m','a','c','h','e','r','.','o','r','g',0,
+    'w','e','i','g','h','t','w','a','t','c','h','e','r','s','.','c','o','m',0,
+    'f','i','s','h','k','i','.','n','e','t',0,
+    'a','b','c','h','i','n','a','.','c','o','m',0,
+    'a','s','c','o','p','u','b','s','.','o','r','g',0,
+    'm','e','t','a','p','r','e','s','s','.','c','o','m',0,
+    'i','d','a','h','o','s','t','a','t','e','s','m','a','n','.','c','o','m',0,
+    'c','a','m','p','-','f','i','r','e','.','j','p',0,
+    'w','w','w','.','r','o','y','a','l','.','u','k',0,
+    'l','e','g','a','l','z','o','o','m','.','c','o','m',0,
+    't','o','y','s','r','u','s','.','c','o','m',0,
+    's','a','f','e','r','-','n','e','t','w','o','r','k','i','n','g','.','o','r','g',0,
+    'g','o','o','d','r','x','.','c','o','m',0,
+    's','m','i','t','h','.','e','d','u',0,
+    'c','r','o','s','s','w','a','l','k','.','c','o','m',0,
+    'w','e','b','s','i','t','e','2','.','m','e',0,
+    's','a','n','t','e','.','f','r',0,
+    's','e','p','t','c','a','s','i','n','o','.','c','o','m',0,
+    'u','q','a','m','.','c','a',0,
+    'd','a','i','l','y','s','i','g','n','a','l','.','c','o','m',0,
+    'f','r','a','n','c','e','c','u','l','t','u','r','e','.','f','r',0,
+    't','v','z','v','e','z','d','a','.','r','u',0,
+    'w','a','s','e','d','a','.','j','p',0,
+    'p','e','t','c','o','.','c','o','m',0,
+    'e','x','p','r','e','s','s','n','e','w','s','.','c','o','m',0,
+    'd','e','s','e','r','t','s','u','n','.','c','o','m',0,
+    'c','l','i','m','a','t','e','.','g','o','v',0,
+    's','s','e','n','s','e','.','c','o','m',0,
+    'p','r','o','c','o','n','.','o','r','g',0,
+    'g','l','o','s','b','e','.','c','o','m',0,
+    'h','a','c','k','s','t','e','r','.','i','o',0,
+    'e','o','l','.','c','n',0,
+    'r','e','s','t','a','u','r','a','n','t','g','u','r','u','.','c','o','m',0,
+    'a','l','l','e','v','e','n','t','s','.','i','n',0,
+    'h','o','p','i','n','.','c','o','m',0,
+    'm','e','t','r','o','.','u','s',0,
+    'p','o','t','t','e','r','y','b','a','r','n','.','c','o','m',0,
+    'd','m','v','.','o','r','g',0,
+    'n','y','c','g','o','v','p','a','r','k','s','.','o','r','g',0,
+    'm','i','n','i','c','l','i','p','.','c','o','m',0,
+    's','i','n','a','i','m','g','.','c','n',0,
+    'm','a','r','k','e','t','b','e','a','t','.','c','o','m',0,
+    't','u','r','n','e','r','.','c','o','m',0,
+    'c','o','s','c','h','e','d','u','l','e','.','c','o','m',0,
+    'u','n','i','o','n','l','e','a','d','e','r','.','c','o','m',0,
+    'd','u','k','e','u','p','r','e','s','s','.','e','d','u',0,
+    'e','d','m','o','n','t','o','n','j','o','u','r','n','a','l','.','c','o','m',0,
+    'g','o','c','o','m','i','c','s','.','c','o','m',0,
+    '5','1','c','t','o','.','c','o','m',0,
+    'g','u','b','.','u','y',0,
+    'c','o','x','.','n','e','t',0,
+    'a','r','a','b','i','a','n','b','u','s','i','n','e','s','s','.','c','o','m',0,
+    'f','6','s','.','c','o','m',0,
+    'm','e','d','i','a','-','a','m','a','z','o','n','.','c','o','m',0,
+    'r','i','v','a','l','s','.','c','o','m',0,
+    'u','n','i','b','a','s','.','c','h',0,
+    'p','e','n','n','y','-','a','r','c','a','d','e','.','c','o','m',0,
+    'l','i','n','t','e','r','n','a','u','t','e','.','c','o','m',0,
+    'v','a','l','u','e','c','o','m','m','e','r','c','e','.','c','o','m',0,
+    'u','d','a','y','t','o','n','.','e','d','u',0,
+    'f','r','e','a','k','o','n','o','m','i','c','s','.','c','o','m',0,
+    'a','s','s','e','m','b','l','e','e','-','n','a','t','i','o','n','a','l','e','.','f','r',0,
+    'p','e','p','s','i','c','o','.','c','o','m',0,
+    'c','l','i','c','k','z','.','c','o','m',0,
+    'l','a','d','e','p','e','c','h','e','.','f','r',0,
+    'b','e','s','t','p','l','a','c','e','s','.','n','e','t',0,
+    't','c','m','.','c','o','m',0,
+    'm','u','s','i','c','r','a','d','a','r','.','c','o','m',0,
+    'w','e','b','d','e','s','i','g','n','e','r','d','e','p','o','t','.','c','o','m',0,
+    't','h','e','s','u','n','.','i','e',0,
+    'r','e','d','s','t','a','t','e','.','c','o','m',0,
+    'i','r','i','s','h','m','i','r','r','o','r','.','i','e',0,
+    'b','e','t','t','e','r','h','e','l','p','.','c','o','m',0,
+    'a','r','t','m','i','g','h','t','.','c','o','m',0,
+    'j','o','t','f','o','r','m','e','u','.','c','o','m',0,
+    'p','h','y','s','i','c','s','w','o','r','l','d','.','c','o','m',0,
+    'f','u','e','l','e','c','o','n','o','m','y','.','g','o','v',0,
+    'c','n','z','z','.','c','o','m',0,
+    'u','l','t','i','p','r','o','.','c','o','m',0,
+    'k','v','u','e','.','c','o','m',0,
+    'b','i','z','r','a','t','e','.','c','o','m',0,
+    'f','o','x','i','t','.','c','o','m',0,
+    't','v','.','c','o','m',0,
+    's','c','i','m','a','g','o','j','r','.','c','o','m',0,
+    't','a','l','k','s','p','o','r','t','.','c','o','m',0,
+    'a','k','a','m','a','i','z','e','d','.','n','e','t',0,
+    'j','a','l','a','n','.','n','e','t',0,
+    'k','f','o','r','.','c','o','m',0,
+    'w','e','l','i','v','e','s','e','c','u','r','i','t','y','.','c','o','m',0,
+    'r','e','l','i','g','i','o','n','n','e','w','s','.','c','o','m',0,
+    'b','l','a','c','k','e','n','t','e','r','p','r','i','s','e','.','c','o','m',0,
+    's','p','o','r','t','s','n','e','t','.','c','a',0,
+    'h','i','k','v','i','s','i','o','n','.','c','o','m',0,
+    'j','s','o','n','.','o','r','g',0,
+    't','h','e','m','e','p','a','l','a','c','e','.','c','o','m',0,
+    's','u','g','a','r','-','d','a','d','d','i','e','s','.','u','s',0,
+    'b','l','o','g','g','.','s','e',0,
+    'd','r','a','f','t','k','i','n','g','s','.','c','o','m',0,
+    'c','o','o','k','i','n','g','l','i','g','h','t','.','c','o','m',0,
+    't','i','m','e','s','o','f','i','n','d','i','a','.','c','o','m',0,
+    'l','o','o','p','n','e','t','.','c','o','m',0,
+    't','a','r','i','n','g','a','.','n','e','t',0,
+    'o','p','e','n','c','l','i','p','a','r','t','.','o','r','g',0,
+    'y','a','n','k','o','d','e','s','i','g','n','.','c','o','m',0,
+    'n','x','t','b','o','o','k','.','c','o','m',0,
+    't','h','i','n','k','q','u','e','s','t','.','o','r','g',0,
+    'e','s','l','g','a','m','i','n','g','.','c','o','m',0,
+    'c','o','n','s','t','i','t','u','t','i','o','n','c','e','n','t','e','r','.','o','r','g',0,
+    's','h','o','r','l','.','c','o','m',0,
+    'v','n','.','u','a',0,
+    'c','h','o','o','s','e','m','y','p','l','a','t','e','.','g','o','v',0,
+    'm','e','l','i','a','.','c','o','m',0,
+    'b','a','n','d','s','i','n','t','o','w','n','.','c','o','m',0,
+    'm','a','i','l','-','o','r','d','e','r','-','b','r','i','d','e','.','n','e','t',0,
+    'n','e','w','s','5','c','l','e','v','e','l','a','n','d','.','c','o','m',0,
+    'v','i','s','m','e','.','c','o',0,
+    'a','s','p','e','n','i','n','s','t','i','t','u','t','e','.','o','r','g',0,
+    'a','r','c','o','r','.','d','e',0,
+    'k','r','a','k','e','n','.','c','o','m',0,
+    'f','r','e','d','d','i','e','m','a','c','.','c','o','m',0,
+    'c','a','b','a','n','o','v','a','.','c','o','m',0,
+    'u','f','c','.','c','o','m',0,
+    'a','f','s','p','.','o','r','g',0,
+    'u','n','i','-','l','j','.','s','i',0,
+    'b','i','g','n','e','w','s','n','e','t','w','o','r','k','.','c','o','m',0,
+    's','h','a','r','e','c','a','r','e','.','c','o','m',0,
+    'w','n','y','c','s','t','u','d','i','o','s','.','o','r','g',0,
+    'u','n','i','-','h','a','n','n','o','v','e','r','.','d','e',0,
+    'm','y','k','a','j','a','b','i','.','c','o','m',0,
+    'a','i','c','h','i','.','j','p',0,
+    'r','d','c','u','.','b','e',0,
+    'f','f','m','.','t','o',0,
+    'r','e','s','c','u','e','.','o','r','g',0,
+    'k','i','d','n','e','y','.','o','r','g',0,
+    'o','e','d','.','c','o','m',0,
+    'i','n','t','e','r','n','e','t','.','c','o','m',0,
+    't','h','o','m','a','n','n','.','d','e',0,
+    'g','r','c','.','c','o','m',0,
+    'm','a','t','c','h','.','c','o','m',0,
+    'r','e','n','e','w','a','b','l','e','e','n','e','r','g','y','w','o','r','l','d','.','c','o','m',0,
+    'a','b','c','n','e','w','s','.','c','o','m',0,
+    'h','a','r','b','o','r','f','r','e','i','g','h','t','.','c','o','m',0,
+    'b','r','i','g','h','t','b','r','i','d','e','s','.','o','r','g',0,
+    'w','p','t','v','.','c','o','m',0,
+    'f','l','o','c','k','.','c','o','m',0,
+    'x','h','a','m','s','t','e','r','.','c','o','m',0,
+    'i','s','p','o','t','.','t','v',0,
+    'w','h','o','w','h','a','t','w','e','a','r','.','c','o','m',0,
+    'l','u','s','h','.','c','o','m',0,
+    's','p','a','r','k','p','e','o','p','l','e','.','c','o','m',0,
+    'g','o','f','u','n','d','.','m','e',0,
+    'u','s','f','c','a','.','e','d','u',0,
+    's','c','e','n','e','7','.','c','o','m',0,
+    'i','x','i','g','u','a','.','c','o','m',0,
+    'm','o','d','e','r','n','a','t','x','.','c','o','m',0,
+    't','o','l','e','d','o','b','l','a','d','e','.','c','o','m',0,
+    's','h','i','z','u','o','k','a','.','j','p',0,
+    'm','e','n','a','f','n','.','c','o','m',0,
+    'j','m','i','r','.','o','r','g',0,
+    'i','n','f','o','r','m','i','t','.','c','o','m',0,
+    'p','e','r','a','i','c','h','i','.','c','o','m',0,
+    'v','i','l','l','a','n','o','v','a','.','e','d','u',0,
+    'd','w','e','l','l','.','c','o','m',0,
+    'r','i','v','m','.','n','l',0,
+    'c','l','u','b','h','o','u','s','e','.','c','o','m',0,
+    'g','l','o','b','a','l','.','a','b','b',0,
+    'b','i','z','c','o','m','m','u','n','i','t','y','.','c','o','m',0,
+    'p','u','b','l','i','c','o','.','e','s',0,
+    'b','e','a','x','y','.','c','o','m',0,
+    'm','o','b','i','l','e','.','d','e',0,
+    'a','d','v','f','n','.','c','o','m',0,
+    'b','c','o','r','p','o','r','a','t','i','o','n','.','n','e','t',0,
+    'i','n','d','i','a','t','v','n','e','w','s','.','c','o','m',0,
+    's','t','e','i','n','b','e','r','g','.','n','e','t',0,
+    'i','g','g','.','m','e',0,
+    'd','a','i','l','y','p','r','e','s','s','.','c','o','m',0,
+    'm','e','d','i','c','a','i','d','.','g','o','v',0,
+    's','t','u','b','h','u','b','.','c','o','m',0,
+    'r','e','m','a','x','.','c','o','m',0,
+    'w','e','b','p','a','g','e','t','e','s','t','.','o','r','g',0,
+    'i','o','s','p','r','e','s','s','.','c','o','m',0,
+    's','e','l','f','r','i','d','g','e','s','.','c','o','m',0,
+    'b','u','d','d','y','p','r','e','s','s','.','o','r','g',0,
+    'e','y','o','u','c','m','s','.','c','o','m',0,
+    't','i','c','k','e','t','l','e','a','p','.','c','o','m',0,
+    '1','1','0','m','b','.','c','o','m',0,
+    'w','a','l','l','p','a','p','e','r','.','c','o','m',0,
+    'm','e','m','b','e','r','c','l','i','c','k','s','.','n','e','t',0,
+    '1','s','t','d','i','b','s','.','c','o','m',0,
+    'a','p','p','s','t','a','t','e','.','e','d','u',0,
+    'e','b','a','y','-','k','l','e','i','n','a','n','z','e','i','g','e','n','.','d','e',0,
+    'w','j','x','.','c','n',0,
+    'e','l','l','e','n','m','a','c','a','r','t','h','u','r','f','o','u','n','d','a','t','i','o','n','.','o','r','g',0,
+    'u','i','.','c','o','m',0,
+    'e','n','c','h','a','n','t','e','d','l','e','a','r','n','i','n','g','.','c','o','m',0,
+    'k','e','w','.','o','r','g',0,
+    'b','o','s','c','h','.','c','o','m',0,
+    'e','s','p','a','c','e','n','e','t','.','c','o','m',0,
+    'h','o','t','m','a','r','t','.','c','o','m',0,
+    'u','n','i','-','r','e','g','e','n','s','b','u','r','g','.','d','e',0,
+    'c','e','l','e','b','r','i','t','y','n','e','t','w','o','r','t','h','.','c','o','m',0,
+    'f','a','n','s','i','d','e','d','.','c','o','m',0,
+    's','o','l','a','r','w','i','n','d','s','.','c','o','m',0,
+    'd','a','v','e','r','a','m','s','e','y','.','c','o','m',0,
+    's','t','y','l','e','c','r','a','z','e','.','c','o','m',0,
+    'g','r','e','e','n','t','e','c','h','m','e','d','i','a','.','c','o','m',0,
+    'p','l','a','y','b','o','y','.','c','o','m',0,
+    'n','e','t','h','o','u','s','e','.','r','u',0,
+    'l','n','k','s','.','g','d',0,
+    'm','a','r','k','e','t','i','n','g','p','r','o','f','s','.','c','o','m',0,
+    'p','u','n','c','h','n','g','.','c','o','m',0,
+    'v','e','e','a','m','.','c','o','m',0,
+    't','h','i','s','i','s','c','o','l','o','s','s','a','l','.','c','o','m',0,
+    'w','e','a','r','e','s','o','c','i','a','l','.','c','o','m',0,
+    'w','t','t','w','.','c','o','m',0,
+    's','f','r','.','f','r',0,
+    '3','6','0','c','i','t','i','e','s','.','n','e','t',0,
+    'r','o','s','p','o','t','r','e','b','n','a','d','z','o','r','.','r','u',0,
+    'a','b','c','1','1','.','c','o','m',0,
+    'd','i','v','x','.','c','o','m',0,
+    'c','u','s','t','o','m','-','r','o','m','s','.','c','o','m',0,
+    'b','l','o','g','m','u','r','a','.','c','o','m',0,
+    'p','t','c','.','c','o','m',0,
+    'n','a','h','b','.','o','r','g',0,
+    'u','s','m','.','e','d','u',0,
+    'c','m','s','w','i','r','e','.','c','o','m',0,
+    'w','t','h','r','.','c','o','m',0,
+    'b','o','i','s','e','s','t','a','t','e','.','e','d','u',0,
+    'h','i','s','t','o','r','y','n','e','t','.','c','o','m',0,
+    'j','c','p','.','o','r','g',0,
+    'u','n','i','-','k','i','e','l','.','d','e',0,
+    'm','a','i','l','o','r','d','e','r','b','r','i','d','e','s','a','d','v','i','s','o','r','.','c','o','m',0,
+    'w','o','w','h','e','a','d','.','c','o','m',0,
+    'y','o','u','r','d','o','m','a','i','n','.','c','o','m',0,
+    'r','e','s','e','a','r','c','h','.','n','e','t',0,
+    'j','o','e','b','i','d','e','n','.','c','o','m',0,
+    'l','a','t','e','r','c','e','r','a','.','c','o','m',0,
+    's','t','a','t','i','s','t','i','c','b','r','a','i','n','.','c','o','m',0,
+    'b','r','i','g','h','t','s','i','d','e','.','m','e',0,
+    'n','e','t','b','e','a','n','s','.','o','r','g',0,
+    'v','e','v','o','.','c','o','m',0,
+    'a','f','t','e','n','p','o','s','t','e','n','.','n','o',0,
+    'e','v','e','n','t','s','c','l','o','u','d','.','c','o','m',0,
+    'r','e','n','s','e','.','c','o','m',0,
+    'd','e','e','p','m','i','n','d','.','c','o','m',0,
+    'a','l','l','b','u','s','i','n','e','s','s','.','c','o','m',0,
+    'd','e','f','i','n','i','t','i','o','n','s','.','n','e','t',0,
+    'p','e','n','n','m','e','d','i','c','i','n','e','.','o','r','g',0,
+    'e','c','u','.','e','d','u',0,
+    'm','u','s','e','o','d','e','l','p','r','a','d','o','.','e','s',0,
+    'd','e','e','r','e','.','c','o','m',0,
+    'f','o','t','k','i','.','c','o','m',0,
+    's','y','t','e','s','.','n','e','t',0,
+    'l','a','i','s','t','.','c','o','m',0,
+    'l','a','r','a','c','a','s','t','s','.','c','o','m',0,
+    'a','d','u','l','t','s','w','i','m','.','c','o','m',0,
 };
+
+constexpr uint32_t TopDomainOffsets[] = {
+    0,11,24,36,48,62,75,85,99,113,127,148,157,171,181,192,
+    199,206,216,229,240,255,267,277,288,301,311,322,335,346,353,361,
+    373,384,398,413,420,431,442,447,455,465,475,487,499,515,527,543,
+    563,571,583,591,603,613,624,634,649,657,668,674,682,689,707,719,
+    731,750,760,781,792,803,817,829,838,846,854,868,878,886,896,905,
+    925,935,943,951,958,966,977,984,995,1008,1016,1032,1041,1056,1073,1086,
+    1095,1103,1110,1121,1130,1139,1154,1167,1176,1184,1192,1204,1217,1234,1249,1258,
+    1268,1275,1283,1295,1307,1317,1325,1332,1351,1359,1381,1394,1409,1422,1428,1437,
+    1450,1461,1468,1480,1490,1502,1511,1527,1542,1551,1566,1574,1584,1594,1607,1623,
+    1635,1658,1670,1682,1694,1701,1709,1727,1743,1757,1771,1779,1793,1803,1816,1832,
+    1842,1858,1871,1887,1903,1915,1929,1940,1956,1973,1984,1998,2004,2016,2023,2033,
+    2041,2053,2069,2080,2088,2100,2114,2128,2140,2155,2164,2176,2196,2209,2219,2242,
+    2253,2270,2281,2294,2305,2319,2331,2339,2347,2357,2369,2381,2391,2400,2412,2429,
+    2439,2454,2469,2483,2491,2499,2510,2522,2536,2550,2561,2574,2587,2597,2613,2628,
+    2643,2660,2670,2680,2695,2712,2727,2736,2752,2767,2776,2785,2795,2803,2816,2826,
+    2838,2849,2857,2864,2873,2881,2892,2900,2910,2930,2943,2956,2968,2980,2992,3001,
+    3014,3034,3043,3055,3065,3076,3092,3102,3113,3121,3137,3149,3164,3182,3195,3204,
+    3218,3231,3243,3254,3263,3274,3286,3294,3305,3327,3335,3344,3357,3369,3379,3391,
+    3405,3413,3421,3434,3440,3460,3469,3480,3493,3505,3522,3532,3544,3556,3569,3577,
+    3590,3603,3619,3630,3647,3670,3679,3690,3705,3725,3734,3745,3752,3762,3776,3784,
+    3796,3814,3825,3833,3844,3852,3860,3868,3875,3884,3901,3910,3926,3933,3948,3961,
+    3979,3995,4004,4022,4033,4040,4051,4059,4070,4085,4101,4111,4121,4132,4151,4167,
+    4178,4192,4208,4220,4233,4243,4254,4269,4279,4290,4306,4313,4329,4339,4347,4362,
+    4371,4384,4392,4404,4415,4424,4432,4444,4455,4471,4492,4500,4511,4522,4534,4545,
+    4559,4568,4586,4601,4609,4617,4628,4638,4646,4665,4676,4691,4697,4705,4718,4727,
+    4734,4740,4747,4759,4779,4794,4808,4826,4841,4849,4862,4879,4888,4903,4916,4924,
+    4932,4945,4963,4976,4987,4995,5006,5021,5032,5037,5047,5059,5069,5084,5093,5103,
+    5120,5136,5150,5158,5166,5178,5187,5196,5206,5228,5239,5246,5263,5274,5286,5295,
+    5303,5314,5329,5343,5359,5377,5393,5402,5409,5420,5428,5448,5465,5473,5487,5500,
+    5513,5524,5531,5553,5568,5576,5589,5601,5609,5621,5635,5647,5654,5667,5680,5695,
+    5704,5716,5728,5736,5747,5759,5768,5779,5796,5802,5822,5832,5846,5855,5863,5877,
+    5889,5907,5919,5929,5946,5964,5983,5992,6007,6015,6027,6039,6047,6061,6070,6080,
+    6089,6099,6110,6121,6129,6137,6147,6158,6172,6182,6200,6210,6223,6241,6252,6268,
+    6289,6299,6315,6330,6343,6352,6363,6376,6390,6404,6418,6426,6437,6445,6463,6476,
+    6491,6497,6508,6521,6534,6545,6556,6570,6578,6591,6603,6617,6631,6637,6645,6656,
+    6666,6675,6685,6700,6714,6722,6730,6741,6754,6768,6779,6789,6796,6805,6817,6825,
+    6836,6844,6860,6876,6887,6903,6912,6921,6931,6951,6973,6981,6987,6997,7011,7020,
+    7029,7038,7048,7055,7062,7075,7083,7096,7104,7121,7135,7153,7161,7172,7186,7194,
+    7207,7222,7230,7238,7253,7263,7283,7295,7306,7316,7329,7337,7352,7367,7375,7384,
+    7397,7406,7416,7431,7440,7447,7462,7474,7490,7500,7510,7523,7538,7548,7563,7583,
+    7596,7611,7625,7634,7641,7652,7663,7677,7689,7703,7711,7723,7732,7742,7753,7765,
+    7784,7792,7800,7816,7824,7838,7853,7863,7874,7886,7895,7903,7922,7937,7949,7961,
+    7971,7978,7986,7995,8003,8013,8022,8033,8041,8049,8065,8074,8082,8095,8111,8120,
+    8134,8142,8155,8172,8185,8194,8206,8216,8230,8240,8250,8269,8278,8292,8309,8326,
+    8335,8353,8366,8375,8390,8399,8410,8424,8435,8448,8460,8468,8478,8487,8496,8511,
+    8526,8535,8545,8556,8571,8579,8587,8595,8612,8619,8629,8642,8653,8663,8675,8692,
+    8701,8710,8719,8739,8751,8761,8772,8784,8800,8816,8833,8844,8853,8869,8876,8892,
+    8912,8925,8936,8948,8956,8970,8983,8998,9016,9032,9040,9052,9059,9069,9086,9096,
+    9109,9119,9139,9146,9160,9171,9185,9198,9210,9225,9235,9247,9256,9263,9272,9284,
+    9302,9321,9331,9344,9356,9366,9372,9386,9405,9415,9433,9445,9453,9460,9468,9476,
+    9482,9498,9510,9520,9530,9545,9559,9575,9591,9598,9609,9616,9630,9642,9655,9668,
+    9682,9695,9705,9713,9733,9745,9754,9764,9776,9797,9806,9821,9840,9848,9859,9878,
+    9892,9909,9920,9927,9942,9957,9980,9995,10003,10017,10029,10045,10058,10069,10086,10095,
+    10107,10118,10136,10142,10154,10162,10171,10188,10198,10207,10217,10231,10248,10258,10266,10278,
+    10292,10301,10315,10334,10348,10365,10378,10390,10409,10423,10441,10456,10467,10488,10501,10511,
+    10520,10532,10539,10553,10564,10579,10594,10608,10622,10630,10638,10645,10658,10670,10685,10696,
+    10704,10711,10719,10736,10747,10762,10778,10789,10797,10806,10813,10825,10839,10860,10872,10880,
+    10892,10898,10911,10925,10942,10950,10963,10971,10981,10996,11006,11019,11037,11053,11065,11076,
+    11085,11102,11113,11125,11139,11153,11161,11177,11186,11203,11221,11241,11255,11272,11284,11292,
+    11300,11308,11320,11328,11339,11347,11355,11368,11385,11393,11405,11418,11428,11438,11453,11468,
+    11476,11492,11513,11532,11545,11553,11565,11579,11596,11611,11635,11642,11657,11671,11682,11705,
+    11720,11735,11751,11759,11769,11778,11792,11804,11820,11837,11845,11858,11872,11887,11900,11911,
+    11919,11927,11940,11954,11969,11985,11992,12001,12011,12025,12034,12042,12055,12063,12073,12082,
+    12098,12106,12115,12127,12134,12149,12157,12169,12180,12189,12203,12218,12227,12248,12268,12282,
+    12296,12310,12326,12338,12352,12363,12376,12390,12403,12411,12433,12444,12451,12472,12479,12492,
+    12506,12516,12527,12539,12551,12564,12581,12593,12607,12615,12624,12637,12651,12667,12680,12692,
+    12702,12714,12723,12730,12743,12752,12761,12771,12779,12787,12794,12808,12823,12829,12837,12848,
+    12873,12885,12903,12922,12941,12949,12965,12987,12998,13015,13023,13032,13051,13059,13069,13082,
+    13090,13097,13113,13126,13141,13153,13164,13172,13183,13191,13202,13215,13229,13237,13249,13259,
+    13271,13280,13291,13308,13323,13332,13350,13357,13368,13383,13393,13408,13421,13433,13445,13456,
+    13468,13480,13492,13501,13511,13523,13536,13553,13564,13577,13589,13601,13612,13623,13642,13653,
+    13672,13686,13694,13705,13723,13736,13752,13767,13775,13783,13791,13807,13820,13831,13837,13846,
+    13858,13874,13884,13891,13900,13911,13927,13934,13948,13975,13989,14000,14007,14020,14034,14048,
+    14056,14070,14082,14098,14113,14125,14143,14159,14167,14178,14193,14210,14222,14235,14245,14259,
+    14270,14283,14298,14307,14315,14332,14347,14361,14384,14398,14413,14424,14431,14443,14457,14466,
+    14477,14486,14498,14510,14518,14527,14538,14551,14568,14575,14581,14593,14610,14618,14632,14650,
+    14658,14673,14686,14695,14702,14717,14733,14749,14760,14767,14779,14795,14806,14815,14828,14840,
+    14859,14871,14884,14898,14910,14916,14927,14938,14952,14963,14980,14997,15009,15019,15030,15036,
+    15049,15069,15076,15089,15104,15115,15122,15136,15144,15157,15166,15179,15189,15199,15214,15222,
+    15235,15256,15269,15277,15297,15311,15324,15340,15350,15361,15374,15389,15398,15412,15420,15436,
+    15448,15463,15474,15484,15495,15514,15525,15532,15543,15560,15575,15583,15591,15616,15627,15645,
+    15655,15663,15671,15691,15704,15716,15731,15739,15745,15751,15763,15777,15795,15813,15825,15840,
+    15848,15863,15875,15891,15906,15924,15935,15947,15954,15971,15981,15990,16008,16029,16047,16061,
+    16083,16090,16103,16113,16122,16136,16152,16163,16179,16202,16214,16225,16238,16260,16269,16283,
+    16297,16304,16312,16325,16339,16349,16364,16374,16388,16397,16407,16415,16432,16440,16453,16475,
+    16483,16499,16510,16517,16525,16545,16553,16566,16573,16581,16591,16599,16617,16629,16640,16655,
+    16665,16682,16698,16711,16728,16742,16750,16763,16780,16794,16807,16820,16828,16836,16847,16863,
+    16871,16893,16901,16918,16933,16943,16953,16963,16976,16983,17003,17010,17022,17047,17062,17079,
+    17086,17103,17115,17128,17142,17156,17165,17173,17188,17202,17210,17226,17242,17255,17264,17276,
+    17286,17301,17316,17329,17350,17364,17378,17393,17402,17410,17421,17431,17442,17456,17468,17482,
+    17498,17510,17524,17538,17550,17558,17565,17579,17590,17606,17616,17630,17640,17653,17663,17679,
+    17696,17707,17720,17728,17741,17752,17763,17775,17783,17789,17804,17810,17818,17825,17839,17855,
+    17867,17887,17898,17906,17919,17928,17934,17946,17956,17969,17980,17991,18006,18019,18038,18059,
+    18067,18080,18097,18105,18120,18131,18138,18153,18164,18175,18189,18201,18218,18232,18246,18266,
+    18274,18288,18297,18308,18326,18346,18361,18369,18383,18396,18408,18420,18432,18448,18457,18464,
+    18473,18484,18494,18505,18519,18532,18539,18557,18570,18584,18594,18603,18617,18627,18636,18645,
+    18662,18682,18698,18707,18720,18729,18737,18752,18766,18774,18785,18798,18805,18816,18830,18841,
+    18859,18871,18879,18891,18898,18910,18918,18936,18955,18970,18980,18992,19007,19021,19031,19042,
+    19057,19065,19083,19097,19112,19122,19133,19146,19167,19186,19197,19205,19217,19226,19239,19252,
+    19264,19273,19281,19294,19309,19319,19332,19348,19363,19384,19402,19414,19431,19444,19462,19468,
+    19479,19486,19500,19512,19522,19534,19549,19563,19571,19589,19603,19618,19629,19639,19650,19662,
+    19671,19685,19695,19719,19733,19745,19766,19776,19786,19800,19808,19820,19838,19849,19854,19867,
+    19880,19888,19901,19917,19924,19938,19951,19959,19974,19990,19999,20007,20023,20030,20041,20051,
+    20072,20085,20102,20118,20132,20142,20149,20167,20184,20194,20204,20217,20226,20234,20242,20252,
+    20262,20271,20288,20295,20302,20317,20337,20355,20362,20371,20379,20394,20405,20415,20424,20430,
+    20444,20463,20471,20481,20490,20507,20521,20532,20544,20558,20579,20592,20613,20627,20636,20652,
+    20663,20673,20689,20701,20711,20731,20748,20765,20778,20788,20798,20810,20824,20838,20849,20857,
+    20869,20878,20891,20902,20911,20920,20927,20939,20951,20967,20982,20996,21009,21023,21039,21055,
+    21062,21077,21088,21097,21109,21119,21126,21141,21154,21160,21174,21183,21198,21219,21235,21244,
+    21262,21271,21293,21304,21317,21338,21353,21375,21393,21405,21416,21423,21433,21441,21454,21466,
+    21480,21492,21511,21520,21528,21539,21548,21558,21572,21587,21599,21608,21623,21632,21645,21661,
+    21671,21687,21701,21709,21717,21733,21743,21754,21771,21780,21799,21810,21823,21831,21850,21864,
+    21875,21887,21902,21917,21929,21940,21948,21966,21979,21988,21996,22011,22026,22041,22056,22067,
+    22082,22094,22103,22116,22139,22147,22154,22166,22175,22191,22206,22219,22227,22241,22249,22270,
+    22285,22300,22317,22333,22347,22354,22365,22374,22384,22395,22412,22428,22438,22452,22464,22476,
+    22494,22508,22515,22521,22529,22541,22557,22569,22578,22584,22601,22612,22627,22637,22649,22657,
+    22665,22674,22685,22696,22704,22720,22730,22742,22761,22782,22798,22815,22828,22835,22846,22857,
+    22869,22883,22898,22920,22927,22937,22954,22969,22988,23005,23013,23022,23036,23051,23071,23093,
+    23099,23111,23122,23143,23152,23165,23179,23191,23206,23219,23227,23243,23250,23273,23288,23302,
+    23314,23326,23342,23356,23371,23383,23391,23402,23420,23432,23454,23462,23473,23486,23496,23519,
+    23527,23538,23550,23562,23575,23583,23597,23613,23624,23636,23643,23657,23676,23692,23704,23722,
+    23737,23747,23758,23769,23786,23797,23808,23819,23840,23857,23865,23878,23887,23896,23912,23926,
+    23940,23962,23972,23979,23991,24003,24014,24028,24038,24052,24070,24080,24094,24107,24122,24129,
+    24137,24150,24162,24177,24193,24204,24217,24236,24245,24261,24282,24296,24310,24322,24333,24341,
+    24350,24367,24389,24398,24416,24434,24452,24466,24474,24488,24498,24514,24529,24550,24562,24570,
+    24583,24597,24611,24628,24637,24646,24656,24667,24677,24687,24706,24717,24731,24748,24757,24768,
+    24786,24802,24809,24816,24827,24837,24845,24863,24874,24890,24908,24917,24930,24945,24963,24978,
+    24988,25001,25016,25031,25046,25058,25069,25082,25091,25097,25107,25122,25141,25162,25174,25186,
+    25198,25215,25229,25237,25250,25270,25283,25298,25304,25324,25337,25352,25368,25385,25394,25404,
+    25422,25431,25442,25459,25472,25491,25506,25524,25535,25547,25561,25571,25581,25594,25601,25612,
+    25625,25634,25649,25659,25674,25686,25694,25703,25719,25731,25743,25750,25762,25774,25784,25797,
+    25817,25826,25834,25846,25864,25878,25893,25901,25914,25934,25964,25983,25999,26014,26028,26035,
+    26043,26051,26064,26075,26089,26103,26111,26133,26149,26163,26170,26179,26191,26201,26217,26228,
+    26238,26247,26255,26265,26278,26292,26303,26320,26330,26344,26357,26371,26383,26390,26402,26409,
+    26416,26433,26446,26458,26469,26483,26501,26516,26532,26547,26564,26574,26581,26588,26610,26621,
+    26631,26643,26654,26670,26678,26687,26694,26706,26715,26727,26734,26748,26757,26766,26779,26790,
+    26804,26812,26822,26832,26843,26852,26866,26877,26889,26900,26912,26924,26937,26950,26966,26981,
+    27006,27020,27034,27046,27065,27072,27084,27093,27108,27127,27141,27157,27167,27180,27199,27209,
+    27222,27235,27248,27258,27273,27281,27293,27305,27317,27327,27337,27353,27367,27381,27396,27406,
+    27419,27435,27442,27454,27471,27482,27504,27513,27531,27545,27558,27568,27582,27594,27604,27613,
+    27619,27628,27641,27655,27666,27678,27686,27693,27705,27717,27734,27742,27756,27764,27778,27784,
+    27801,27818,27834,27847,27867,27882,27898,27912,27924,27934,27945,27959,27965,27976,27991,28003,
+    28016,28034,28049,28063,28073,28082,28103,28114,28126,28142,28161,28178,28191,28204,28218,28226,
+    28240,28261,28282,28294,28307,28313,28323,28337,28351,28365,28373,28381,28388,28394,28410,28421,
+    28428,28436,28448,28457,28467,28477,28495,28508,28525,28542,28555,28566,28577,28586,28594,28608,
+    28624,28634,28648,28656,28667,28683,28694,28706,28723,28742,28759,28769,28780,28806,28817,28827,
+    28844,28858,28875,28885,28901,28912,28925,28933,28947,28962,28979,28990,29001,29016,29025,29032,
+    29041,29050,29057,29065,29086,29094,29111,29125,29133,29145,29164,29176,29184,29200,29222,29231,
+    29243,29251,29269,29288,29301,29319,29326,29341,29354,29373,29384,29391,29403,29410,29425,29437,
+    29454,29463,29480,29493,29506,29520,29531,29548,29567,29580,29591,29608,29616,29631,29642,29655,
+    29666,29682,29693,29706,29720,29733,29751,29767,29789,29796,29805,29819,29832,29845,29860,29875,
+    29890,29898,29909,29917,29929,29939,29949,29971,29982,29990,30003,30011,30018,30034,30050,30060,
+    30078,30085,30094,30101,30111,30122,30135,30149,30160,30168,30181,30194,30202,30214,30231,30242,
+    30257,30277,30287,30298,30314,30321,30335,30347,30360,30371,30380,30395,30409,30420,30434,30448,
+    30469,30485,30500,30515,30528,30543,30554,30565,30577,30594,30602,30620,30641,30659,30677,30686,
+    30697,30717,30736,30743,30765,30777,30787,30803,30814,30832,30847,30864,30882,30891,30906,30927,
+    30957,30966,30975,30991,31009,31021,31030,31052,31068,31087,31097,31112,31129,31143,31163,31178,
+    31192,31212,31224,31244,31252,31262,31273,31283,31295,31308,31318,31326,31339,31350,31359,31368,
+    31382,31389,31398,31406,31422,31430,31449,31460,31468,31484,31496,31510,31523,31538,31551,31567,
+    31583,31593,31608,31620,31628,31641,31649,31658,31676,31698,31705,31714,31723,31742,31757,31770,
+    31780,31791,31801,31811,31820,31830,31849,31866,31879,31892,31901,31911,31918,31928,31943,31959,
+    31967,31978,31993,32005,32021,32034,32047,32066,32078,32093,32102,32113,32131,32144,32155,32163,
+    32174,32182,32191,32200,32211,32224,32237,32255,32269,32282,32300,32309,32319,32327,32341,32349,
+    32361,32373,32386,32397,32405,32415,32423,32434,32446,32465,32481,32491,32504,32521,32530,32538,
+    32554,32571,32595,32602,32620,32635,32643,32662,32670,32677,32695,32707,32716,32731,32739,32761,
+    32771,32780,32795,32814,32829,32842,32863,32879,32892,32902,32912,32921,32937,32945,32955,32965,
+    32977,32987,33002,33012,33023,33038,33050,33063,33077,33087,33099,33121,33130,33143,33156,33171,
+    33181,33198,33206,33218,33225,33240,33260,33269,33279,33295,33308,33321,33335,33342,33356,33364,
+    33376,33392,33400,33419,33428,33446,33466,33476,33488,33496,33511,33522,33535,33549,33559,33565,
+    33578,33589,33608,33618,33628,33636,33651,33663,33674,33684,33703,33709,33726,33741,33750,33758,
+    33769,33777,33783,33796,33808,33828,33835,33847,33855,33873,33886,33894,33907,33920,33931,33952,
+    33961,33976,33989,33999,34014,34032,34040,34050,34060,34070,34088,34102,34111,34125,34142,34160,
+    34178,34188,34206,34214,34223,34240,34259,34274,34284,34302,34312,34329,34345,34359,34386,34396,
+    34407,34424,34439,34448,34459,34475,34484,34494,34504,34519,34531,34539,34557,34572,34583,34600,
+    34613,34627,34635,34652,34673,34690,34698,34705,34713,34726,34741,34756,34766,34782,34797,34813,
+    34831,34845,34866,34874,34887,34895,34906,34923,34940,34951,34971,34982,34995,35021,35033,35044,
+    35055,35069,35081,35102,35111,35121,35129,35137,35145,35160,35175,35192,35210,35218,35232,35243,
+    35257,35269,35277,35292,35302,35316,35323,35348,35356,35369,35381,35404,35414,35427,35440,35456,
+    35464,35482,35495,35504,35513,35519,35534,35545,35559,35569,35588,35601,35613,35627,35640,35652,
+    35658,35673,35692,35709,35716,35724,35735,35747,35761,35775,35786,35810,35825,35843,35859,35869,
+    35881,35897,35908,35925,35942,35951,35962,35982,35993,36007,36017,36027,36041,36055,36067,36082,
+    36097,36114,36120,36134,36147,36153,36168,36176,36184,36201,36218,36243,36261,36272,36286,36298,
+    36312,36324,36337,36347,36360,36370,36385,36397,36410,36422,36438,36455,36468,36487,36505,36523,
+    36537,36549,36557,36563,36571,36583,36598,36617,36636,36644,36651,36670,36681,36689,36700,36710,
+    36717,36725,36743,36756,36770,36778,36788,36798,36809,36818,36830,36837,36855,36863,36878,36888,
+    36896,36907,36920,36934,36942,36952,36962,36976,36988,36997,37003,37010,37024,37040,37048,37056,
+    37069,37080,37091,37098,37106,37116,37126,37138,37151,37164,37171,37189,37199,37208,37218,37233,
+    37246,37264,37273,37288,37297,37318,37329,37344,37356,37371,37380,37393,37402,37409,37418,37427,
+    37433,37442,37455,37462,37468,37485,37494,37502,37514,37531,37540,37557,37570,37597,37606,37623,
+    37630,37647,37659,37666,37673,37681,37695,37708,37715,37722,37735,37753,37765,37774,37787,37802,
+    37822,37834,37842,37855,37869,37877,37891,37905,37919,37928,37945,37954,37970,37990,38005,38021,
+    38035,38042,38053,38064,38072,38083,38096,38116,38134,38147,38158,38172,38182,38197,38208,38220,
+    38233,38242,38255,38264,38279,38295,38313,38324,38334,38349,38361,38368,38381,38394,38413,38426,
+    38440,38449,38456,38474,38483,38498,38521,38534,38546,38568,38581,38592,38602,38613,38623,38636,
+    38650,38663,38675,38685,38693,38702,38721,38734,38745,38761,38769,38777,38786,38807,38817,38833,
+    38855,38878,38887,38905,38921,38929,38944,38965,38974,38991,39009,39020,39027,39049,39062,39069,
+    39083,39096,39105,39131,39143,39157,39163,39178,39198,39213,39226,39234,39242,39264,39281,39294,
+    39314,39331,39345,39352,39364,39378,39396,39407,39419,39435,39452,39463,39478,39493,39503,39516,
+    39530,39539,39553,39570,39579,39595,39608,39617,39627,39633,39646,39657,39665,39683,39695,39710,
+    39720,39733,39746,39757,39768,39776,39789,39806,39822,39834,39847,39855,39862,39878,39888,39911,
+    39924,39935,39945,39962,39971,39979,39987,39997,40010,40029,40041,40058,40066,40074,40088,40095,
+    40103,40127,40141,40155,40171,40183,40202,40220,40226,40235,40247,40262,40280,40293,40307,40321,
+    40329,40343,40354,40371,40380,40396,40416,40430,40438,40456,40476,40484,40497,40513,40528,40543,
+    40557,40572,40580,40596,40616,40626,40636,40650,40665,40679,40689,40696,40704,40725,40736,40744,
+    40759,40768,40780,40810,40826,40845,40863,40886,40896,40914,40931,40947,40957,40973,40996,41006,
+    41015,41027,41035,41059,41067,41082,41099,41113,41131,41142,41156,41169,41182,41195,41209,41215,
+    41232,41244,41253,41265,41277,41293,41306,41315,41328,41347,41359,41367,41379,41387,41400,41408,
+    41421,41431,41447,41456,41467,41478,41497,41508,41516,41529,41539,41556,41580,41590,41603,41620,
+    41631,41648,41665,41678,41700,41720,41730,41739,41753,41775,41795,41805,41817,41837,41854,41870,
+    41885,41899,41910,41922,41930,41945,41957,41975,41988,41997,42012,42027,42043,42056,42065,42076,
+    42083,42104,42118,42132,42146,42156,42163,42177,42190,42208,42227,42242,42256,42275,42293,42308,
+    42319,42329,42338,42357,42367,42380,42393,42412,42422,42430,42457,42472,42487,42504,42512,42530,
+    42539,42553,42564,42576,42586,42601,42615,42628,42643,42655,42664,42674,42689,42697,42707,42724,
+    42742,42756,42767,42786,42800,42811,42828,42843,42852,42873,42890,42902,42911,42921,42932,42950,
+    42956,42967,42980,42988,43003,43015,43030,43046,43061,43072,43080,43091,43108,43117,43126,43137,
+    43148,43163,43173,43188,43203,43219,43228,43235,43249,43260,43276,43292,43307,43324,43333,43345,
+    43358,43366,43373,43393,43414,43434,43447,43455,43468,43477,43499,43511,43528,43538,43549,43559,
+    43579,43587,43600,43620,43631,43645,43657,43672,43682,43690,43702,43716,43727,43743,43755,43766,
+    43776,43796,43809,43823,43830,43836,43846,43858,43867,43878,43892,43902,43913,43925,43941,43950,
+    43966,43975,43987,43996,44007,44014,44026,44037,44047,44058,44066,44079,44087,44096,44105,44122,
+    44138,44157,44167,44178,44194,44218,44239,44251,44261,44272,44295,44309,44320,44333,44344,44352,
+    44359,44366,44377,44385,44398,44418,44430,44437,44446,44453,44464,44479,44494,44502,44515,44523,
+    44534,44548,44559,44576,44593,44609,44624,44638,44644,44654,44671,44680,44699,44708,44720,44733,
+    44742,44755,44770,44786,44796,44810,44831,44840,44851,44864,44891,44908,44920,44931,44941,44957,
+    44970,44989,44999,45027,45039,45056,45073,45086,45102,45122,45133,45147,45167,45192,45209,45219,
+    45230,45240,45256,45264,45273,45283,45300,45308,45335,45347,45358,45368,45381,45395,45410,45422,
+    45432,45447,45455,45466,45479,45495,45507,45513,45524,45531,45544,45555,45566,45584,45595,45612,
+    45621,45628,45644,45655,45663,45678,45693,45702,45715,45722,45730,45748,45757,45775,45789,45802,
+    45812,45819,45827,45851,45867,45876,45888,45904,45917,45929,45936,45947,45968,45979,45991,46016,
+    46030,46045,46051,46067,46075,46084,46092,46107,46120,46130,46149,46168,46178,46186,46204,46218,
+    46230,46249,46263,46278,46293,46308,46318,46326,46338,46352,46364,46382,46390,46399,46419,46426,
+    46438,46451,46460,46477,46496,46509,46524,46537,46553,46573,46589,46605,46619,46632,46645,46657,
+    46672,46683,46690,46707,46716,46722,46735,46741,46748,46766,46779,46789,46799,46813,46830,46850,
+    46862,46873,46888,46904,46917,46933,46948,46958,46974,46986,46999,47016,47032,47045,47063,47079,
+    47089,47108,47125,47137,47153,47160,47172,47187,47199,47211,47220,47231,47249,47257,47270,47287,
+    47302,47318,47329,47346,47359,47376,47386,47394,47404,47418,47433,47445,47455,47466,47478,47486,
+    47500,47507,47515,47525,47534,47550,47566,47575,47589,47607,47622,47632,47642,47656,47664,47677,
+    47709,47724,47742,47759,47771,47780,47788,47805,47819,47841,47864,47874,47888,47900,47911,47920,
+    47935,47954,47963,47978,47994,48008,48022,48032,48045,48059,48067,48084,48093,48105,48123,48138,
+    48157,48165,48181,48191,48207,48220,48232,48255,48276,48296,48308,48320,48329,48337,48357,48369,
+    48383,48396,48404,48412,48423,48439,48454,48465,48478,48496,48509,48517,48528,48545,48554,48565,
+    48581,48588,48601,48624,48649,48663,48674,48686,48695,48709,48717,48730,48739,48750,48765,48786,
+    48798,48808,48828,48835,48841,48854,48865,48880,48894,48907,48919,48929,48937,48959,48975,49002,
+    49011,49021,49034,49044,49053,49066,49085,49094,49106,49122,49137,49149,49161,49172,49187,49202,
+    49219,49227,49241,49255,49273,49285,49295,49311,49318,49335,49351,49367,49380,49392,49407,49416,
+    49430,49441,49453,49460,49474,49490,49510,49521,49536,49544,49553,49568,49578,49595,49603,49614,
+    49623,49640,49653,49664,49683,49697,49712,49723,49729,49747,49761,49781,49793,49809,49820,49838,
+    49857,49869,49886,49900,49909,49916,49928,49946,49958,49969,49985,49992,50003,50017,50031,50051,
+    50060,50077,50084,50099,50112,50126,50148,50157,50168,50179,50192,50203,50214,50225,50237,50246,
+    50265,50285,50295,50307,50321,50337,50346,50353,50369,50382,50396,50414,50429,50438,50453,50476,
+    50485,50492,50504,50516,50530,50545,50562,50579,50587,50598,50623,50630,50646,50666,50672,50693,
+    50706,50717,50726,50735,50746,50769,50786,50798,50809,50823,50838,50856,50864,50873,50882,50891,
+    50906,50920,50929,50942,50951,50965,50978,50993,51008,51023,51031,51052,51069,51080,51091,51101,
+    51110,51115,51124,51145,51154,51171,51179,51193,51206,51223,51235,51247,51262,51280,51291,51301,
+    51310,51320,51331,51345,51359,51374,51393,51404,51417,51429,51442,51458,51471,51488,51503,51517,
+    51531,51540,51548,51557,51567,51576,51598,51605,51616,51625,51638,51654,51660,51669,51682,51693,
+    51701,51710,51717,51727,51739,51755,51769,51776,51796,51810,51818,51833,51847,51859,51871,51886,
+    51892,51903,51911,51926,51941,51958,51965,51972,51989,52005,52021,52029,52042,52052,52072,52086,
+    52097,52109,52125,52142,52157,52175,52194,52206,52223,52239,52251,52263,52270,52284,52292,52312,
+    52325,52336,52346,52355,52364,52372,52383,52397,52408,52425,52440,52454,52462,52478,52486,52502,
+    52515,52530,52539,52551,52565,52581,52592,52609,52622,52642,52655,52667,52678,52688,52695,52704,
+    52713,52723,52741,52755,52770,52784,52797,52809,52824,52833,52843,52857,52866,52879,52886,52897,
+    52912,52927,52935,52947,52960,52975,52984,52995,53015,53026,53042,53060,53073,53083,53101,53115,
+    53132,53145,53162,53180,53196,53208,53219,53234,53245,53264,53280,53298,53322,53342,53352,53372,
+    53385,53398,53414,53422,53436,53455,53470,53478,53498,53514,53530,53550,53564,53579,53592,53606,
+    53614,53632,53643,53655,53666,53679,53694,53704,53715,53735,53746,53759,53773,53781,53789,53800,
+    53810,53820,53828,53839,53850,53869,53888,53901,53919,53926,53937,53955,53967,53975,53987,54003,
+    54019,54034,54049,54067,54080,54095,54105,54112,54127,54138,54149,54164,54179,54196,54210,54225,
+    54244,54255,54267,54273,54281,54292,54307,54326,54334,54352,54364,54372,54384,54396,54408,54434,
+    54453,54472,54487,54503,54513,54526,54542,54559,54577,54593,54606,54616,54625,54642,54654,54672,
+    54680,54691,54703,54711,54724,54737,54756,54766,54775,54787,54803,54814,54827,54843,54858,54881,
+    54895,54909,54922,54942,54950,54960,54970,54982,54995,55002,55015,55037,55054,55069,55077,55086,
+    55095,55108,55120,55134,55154,55162,55177,55191,55204,55211,55225,55234,55246,55264,55282,55295,
+    55310,55324,55333,55341,55359,55373,55385,55406,55413,55427,55448,55458,55477,55489,55507,55518,
+    55532,55543,55556,55570,55584,55592,55611,55622,55631,55643,55652,55665,55678,55691,55704,55712,
+    55724,55735,55752,55771,55784,55791,55804,55824,55840,55853,55862,55875,55886,55893,55904,55913,
+    55925,55937,55955,55967,55977,55996,56004,56013,56026,56040,56053,56069,56088,56098,56114,56123,
+    56134,56149,56158,56171,56190,56206,56217,56233,56242,56255,56267,56282,56292,56302,56313,56322,
+    56334,56340,56347,56359,56369,56382,56398,56410,56422,56434,56448,56465,56481,56495,56505,56515,
+    56530,56546,56561,56574,56586,56595,56605,56620,56634,56655,56667,56677,56693,56711,56717,56734,
+    56751,56768,56781,56791,56806,56825,56838,56855,56866,56877,56896,56905,56916,56924,56952,56965,
+    56974,56983,56996,57012,57022,57053,57061,57070,57080,57094,57104,57125,57137,57146,57166,57181,
+    57189,57197,57210,57223,57237,57258,57273,57293,57306,57314,57334,57344,57356,57377,57394,57415,
+    57424,57439,57449,57460,57470,57484,57492,57501,57513,57520,57530,57547,57564,57576,57589,57599,
+    57612,57620,57632,57644,57653,57662,57676,57684,57694,57703,57714,57724,57751,57769,57779,57788,
+    57796,57811,57832,57844,57855,57876,57885,57898,57922,57936,57948,57955,57979,57988,57996,58006,
+    58015,58031,58041,58052,58057,58069,58083,58093,58099,58116,58130,58139,58149,58156,58171,58191,
+    58203,58218,58232,58244,58256,58264,58276,58296,58305,58326,58335,58346,58364,58373,58392,58410,
+    58430,58445,58463,58493,58506,58525,58541,58550,58565,58579,58597,58611,58628,58640,58648,58659,
+    58675,58694,58716,58729,58739,58746,58760,58770,58790,58803,58814,58835,58844,58852,58864,58877,
+    58888,58906,58915,58928,58947,58961,58976,58985,59004,59022,59035,59052,59062,59078,59093,59111,
+    59123,59133,59139,59159,59170,59186,59195,59208,59216,59228,59237,59255,59261,59278,59291,59303,
+    59311,59320,59332,59341,59359,59374,59380,59393,59407,59416,59427,59446,59459,59469,59482,59502,
+    59524,59536,59549,59567,59582,59595,59609,59623,59638,59653,59672,59680,59695,59702,59711,59717,
+    59731,59744,59761,59775,59796,59819,59834,59843,59850,59863,59875,59889,59904,59910,59922,59936,
+    59954,59971,59982,59997,60009,60024,60041,60052,60064,60081,60089,60098,60111,60123,60139,60148,
+    60160,60173,60189,60204,60212,60222,60240,60249,60257,60272,60291,60302,60314,60327,60341,60360,
+    60373,60386,60400,60412,60433,60444,60454,60468,60480,60489,60504,60512,60528,60545,60557,60567,
+    60577,60593,60607,60619,60630,60641,60652,60664,60671,60690,60703,60713,60722,60738,60746,60762,
+    60775,60786,60801,60812,60827,60843,60858,60878,60891,60901,60908,60916,60936,60944,60961,60972,
+    60982,60999,61015,61033,61045,61062,61085,61097,61108,61121,61136,61144,61159,61180,61190,61203,
+    61218,61233,61246,61260,61277,61293,61302,61314,61323,61335,61345,61352,61366,61380,61394,61404,
+    61413,61432,61449,61469,61482,61496,61505,61521,61538,61547,61562,61579,61596,61608,61620,61636,
+    61652,61664,61679,61693,61716,61726,61732,61750,61760,61776,61797,61816,61825,61844,61853,61864,
+    61879,61892,61900,61909,61919,61938,61952,61968,61984,61997,62006,62014,62021,62032,62043,62051,
+    62064,62075,62083,62093,62118,62130,62148,62165,62174,62184,62197,62206,62222,62231,62247,62257,
+    62267,62278,62289,62303,62319,62331,62342,62351,62364,62377,62391,62401,62409,62423,62434,62451,
+    62462,62472,62482,62492,62509,62525,62539,62546,62561,62574,62586,62596,62612,62625,62640,62655,
+    62667,62682,62692,62706,62723,62735,62748,62770,62777,62806,62813,62835,62843,62853,62867,62879,
+    62897,62919,62932,62947,62962,62977,62996,63008,63020,63028,63047,63059,63069,63088,63104,63113,
+    63120,63134,63153,63163,63172,63188,63201,63209,63218,63226,63238,63247,63262,63277,63285,63297,
+    63324,63336,63351,63364,63377,63391,63410,63424,63437,63446,63461,63477,63487,63500,63516,63532,
+    63549,63557,63574,63584,63594,63604,63614,63628,63642,
+};
+
+constexpr size_t TopDomainCount = sizeof(TopDomainOffsets) / sizeof(TopDomainOffsets[0]) - 1;
+static_assert(sizeof(TopDomainNames) == TopDomainOffsets[TopDomainCount], "Index doesn't match the names");
+
+// The i-th domain, by rank (0 based), which is also null terminated.
+constexpr std::string_view TopDomain(size_t i) {
+    return {TopDomainNames + TopDomainOffsets[i], TopDomainOffsets[i + 1] - TopDomainOffsets[i] - 1};
+}
@@ -0,0 +1,63 @@
+# Copyright (c) Microsoft Corporation.
+# Licensed under the MIT License.
+#
+# Generates domains.hpp from domains.txt (one host name per line, '#' starts
+# a comment). The names are packed back to back into a single array, with an
+# index of offsets, so that the table needs no relocations at load time and
+# scales to lists of millions of names.
+
+import os
+
+Dir = os.path.dirname(os.path.abspath(__file__))
+
+Names = []
+with open(os.path.join(Dir, "domains.txt"), encoding="ascii") as File:
+    for Line in File:
+        Name = Line.split("#", 1)[0].strip()
+        if Name:
+            Names.append(Name)
+
+Offsets = [0]
+for Name in Names:
+    Offsets.append(Offsets[-1] + len(Name) + 1)
+
+with open(os.path.join(Dir, "domains.hpp"), "w", encoding="ascii", newline="\n") as File:
+    File.write("""/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Top-level domains - found on https://majestic.com/reports/majestic-million?s=0
+    data are processed such that root domains appear only once.
+
+    Generated by domains.py from domains.txt, so don't edit. The names are
+    packed back to back, each null terminated, with the offset of each one
+    in a separate index.
+
+--*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string_view>
+
+constexpr char TopDomainNames[] = {
+""")
+    for Name in Names:
+        File.write("    " + ",".join("'%s'" % c for c in Name) + ",0,\n")
+    File.write("};\n\nconstexpr uint32_t TopDomainOffsets[] = {\n")
+    for i in range(0, len(Offsets), 16):
+        File.write("    " + ",".join(str(Offset) for Offset in Offsets[i:i + 16]) + ",\n")
+    File.write("""};
+
+constexpr size_t TopDomainCount = sizeof(TopDomainOffsets) / sizeof(TopDomainOffsets[0]) - 1;
+static_assert(sizeof(TopDomainNames) == TopDomainOffsets[TopDomainCount], "Index doesn't match the names");
+
+// The i-th domain, by rank (0 based), which is also null terminated.
+constexpr std::string_view TopDomain(size_t i) {
+    return {TopDomainNames + TopDomainOffsets[i], TopDomainOffsets[i + 1] - TopDomainOffsets[i] - 1};
+}
+""")
@@ -0,0 +1,54 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Lock-free admission gate for connection starts. MsQuic worker threads
+    count connections in and out with a single atomic, and the scheduling
+    thread parks on that atomic (a futex on Linux) until the count allows it
+    to continue. Completions only wake the scheduling thread while it's
+    parked.
+
+--*/
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+
+struct ReachGate {
+    // Number of currently active connections.
+    std::atomic<uint32_t> ActiveCount {0};
+    // Set while the scheduling thread is blocked (or about to block) waiting on
+    // ActiveCount. Only the waiter clears it, once it's awake again.
+    std::atomic<bool> Waiting {false};
+    // Number of times the scheduling thread was woken up (scheduling thread only).
+    uint64_t WakeupCount {0};
+    void Inc() {
+        ActiveCount.fetch_add(1);
+    }
+    void Dec() {
+        ActiveCount.fetch_sub(1);
+        if (Waiting.load()) {
+            ActiveCount.notify_one();
+        }
+    }
+    // Waits until the predicate is true for the active count. Only one thread
+    // may wait at a time.
+    template<typename Predicate>
+    void Wait(Predicate Ready) {
+        uint32_t Count;
+        while (!Ready(Count = ActiveCount.load())) {
+            Waiting.store(true);
+            // Recheck to avoid a lost wake up: a Dec from here on either
+            // changes the count waited on or sees Waiting set and notifies.
+            if (!Ready(Count = ActiveCount.load())) {
+                ActiveCount.wait(Count);
+                ++WakeupCount;
+            }
+            Waiting.store(false);
+        }
+    }
+};
@@ -0,0 +1,86 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Incremental reading of host name lists, either memory mapped from a file
+    or streamed from stdin, so that probing can start before the whole list
+    is read, and memory use doesn't grow with the size of the list.
+
+--*/
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <memory>
+#include <msquic.hpp>
+#include "mapfile.hpp"
+
+#define INPUT_MAX_LINE              1024        // Longest line read from stdin (longer ones are skipped)
+
+// Reads host names, one per line. Empty lines and '#' comments are skipped.
+class ReachHostReader {
+public:
+    // A file name of '-' reads from stdin.
+    ReachHostReader(_In_z_ const char* FileName) {
+        if (strcmp(FileName, "-")) {
+            File.reset(new ReachMappedFile(FileName));
+            if (!File->IsValid()) return;
+            File->AdviseSequential();
+            Valid = true;
+        } else {
+            Valid = true;
+        }
+    }
+    bool IsValid() const { return Valid; }
+    // Only files can be read more than once.
+    bool CanRewind() const { return File != nullptr; }
+    void Rewind() { Offset = 0; }
+    // Gets the next line, without comments and surrounding white space, as a
+    // view (not null terminated) that is valid until the next call.
+    bool Next(_Out_ const char*& Line, _Out_ size_t& Length) {
+        while (Read(Line, Length)) {
+            auto Comment = (const char*)memchr(Line, '#', Length);
+            if (Comment) Length = (size_t)(Comment - Line);
+            while (Length && isspace((uint8_t)*Line)) { ++Line; --Length; }
+            while (Length && isspace((uint8_t)Line[Length - 1])) --Length;
+            if (Length) return true;
+        }
+        return false;
+    }
+private:
+    // Gets the next raw line, in place in the mapping, or in the line buffer.
+    bool Read(_Out_ const char*& Line, _Out_ size_t& Length) {
+        if (File) {
+            if (Offset >= File->Size) return false;
+            Line = File->Data + Offset;
+            auto End = (const char*)memchr(Line, '\n', File->Size - Offset);
+            Length = End ? (size_t)(End - Line) : File->Size - Offset;
+            Offset += Length + 1;
+            return true;
+        }
+        while (fgets(Buffer, sizeof(Buffer), stdin)) {
+            Length = strlen(Buffer);
+            if (Length && Buffer[Length - 1] == '\n') {
+                Line = Buffer;
+                return true;
+            }
+            if (feof(stdin)) { // Last line, without a newline
+                Line = Buffer;
+                return true;
+            }
+            // Too long for the buffer, so skip the rest of the line.
+            int c;
+            while ((c = getchar()) != EOF && c != '\n');
+        }
+        return false;
+    }
+    bool Valid {false};
+    std::unique_ptr<ReachMappedFile> File;
+    size_t Offset {0};
+    char Buffer[INPUT_MAX_LINE];
+};
@@ -0,0 +1,86 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Read-only memory mapping of a whole file.
+
+--*/
+
+#pragma once
+
+#include <stddef.h>
+#include <msquic.hpp>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+class ReachMappedFile {
+public:
+    const char* Data {nullptr};
+    size_t Size {0};
+    ReachMappedFile(_In_z_ const char* FileName) {
+#ifdef _WIN32
+        File = CreateFileA(FileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (File == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER FileSize;
+        if (!GetFileSizeEx(File, &FileSize)) return;
+        Valid = true;
+        if (FileSize.QuadPart == 0) return; // Empty files can't be mapped
+        Mapping = CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!Mapping) { Valid = false; return; }
+        Data = (const char*)MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!Data) { Valid = false; return; }
+        Size = (size_t)FileSize.QuadPart;
+#else
+        int File = open(FileName, O_RDONLY);
+        if (File < 0) return;
+        struct stat Stat;
+        if (fstat(File, &Stat) == 0) {
+            Valid = true;
+            if (Stat.st_size > 0) { // Empty files can't be mapped
+                auto Mapped = mmap(nullptr, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+                if (Mapped == MAP_FAILED) {
+                    Valid = false;
+                } else {
+                    Data = (const char*)Mapped;
+                    Size = (size_t)Stat.st_size;
+                }
+            }
+        }
+        close(File); // The mapping keeps its own reference
+#endif
+    }
+    ~ReachMappedFile() {
+#ifdef _WIN32
+        if (Data) UnmapViewOfFile(Data);
+        if (Mapping) CloseHandle(Mapping);
+        if (File != INVALID_HANDLE_VALUE) CloseHandle(File);
+#else
+        if (Data) munmap((void*)Data, Size);
+#endif
+    }
+    ReachMappedFile(const ReachMappedFile&) = delete;
+    ReachMappedFile& operator=(const ReachMappedFile&) = delete;
+    bool IsValid() const { return Valid; }
+    // Hints that the file is read once from start to end, so that the pages
+    // already read can be dropped early.
+    void AdviseSequential() {
+#ifndef _WIN32
+        if (Data) madvise((void*)Data, Size, MADV_SEQUENTIAL);
+#endif
+    }
+private:
+    bool Valid {false};
+#ifdef _WIN32
+    HANDLE File {INVALID_HANDLE_VALUE};
+    HANDLE Mapping {nullptr};
+#endif
+};
@@ -0,0 +1,183 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Host name normalization (lowercase, no trailing dot, IDNs as punycode)
+    and the set used to probe each normalized host name only once.
+
+--*/
+
+#pragma once
+
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
+#include <bit>
+#include <string>
+#include <vector>
+
+#define HOST_MAX_LENGTH             253         // Longest valid DNS name (without the trailing dot)
+#define HOST_MAX_LABEL              63          // Longest valid DNS label
+
+// Decodes one UTF-8 code point, returning false if it isn't valid UTF-8.
+inline bool ReachDecodeUtf8(const char*& Data, const char* End, uint32_t& CodePoint) {
+    auto Byte = (uint8_t)*Data++;
+    uint32_t Extra;
+    if (Byte < 0x80) { CodePoint = Byte; return true; }
+    else if ((Byte & 0xE0) == 0xC0) { CodePoint = Byte & 0x1F; Extra = 1; }
+    else if ((Byte & 0xF0) == 0xE0) { CodePoint = Byte & 0x0F; Extra = 2; }
+    else if ((Byte & 0xF8) == 0xF0) { CodePoint = Byte & 0x07; Extra = 3; }
+    else return false;
+    if ((size_t)(End - Data) < Extra) return false;
+    for (uint32_t i = 0; i < Extra; ++i) {
+        Byte = (uint8_t)*Data++;
+        if ((Byte & 0xC0) != 0x80) return false;
+        CodePoint = (CodePoint << 6) | (Byte & 0x3F);
+    }
+    static const uint32_t Minimum[] = {0, 0x80, 0x800, 0x10000};
+    return CodePoint >= Minimum[Extra] && CodePoint <= 0x10FFFF && (CodePoint < 0xD800 || CodePoint > 0xDFFF);
+}
+
+// Appends the punycode (RFC 3492) form of a label, with its 'xn--' prefix.
+inline bool ReachPunycode(const std::vector<uint32_t>& Label, std::string& Out) {
+    const uint32_t Base = 36, TMin = 1, TMax = 26, Skew = 38, Damp = 700;
+    auto Digit = [](uint32_t d) { return (char)(d < 26 ? 'a' + d : '0' + d - 26); };
+    auto Adapt = [&](uint32_t Delta, uint32_t Points, bool First) {
+        Delta = First ? Delta / Damp : Delta / 2;
+        Delta += Delta / Points;
+        uint32_t k = 0;
+        while (Delta > ((Base - TMin) * TMax) / 2) { Delta /= Base - TMin; k += Base; }
+        return k + (Base - TMin + 1) * Delta / (Delta + Skew);
+    };
+    auto Start = Out.size();
+    Out += "xn--";
+    uint32_t Basic = 0;
+    for (auto c : Label) if (c < 0x80) { Out += (char)c; ++Basic; }
+    if (Basic) Out += '-';
+    uint32_t n = 0x80, Delta = 0, Bias = 72, Handled = Basic;
+    while (Handled < Label.size()) {
+        uint32_t m = UINT32_MAX;
+        for (auto c : Label) if (c >= n && c < m) m = c;
+        if ((uint64_t)Delta + (uint64_t)(m - n) * (Handled + 1) > UINT32_MAX) return false;
+        Delta += (m - n) * (Handled + 1);
+        n = m;
+        for (auto c : Label) {
+            if (c < n && ++Delta == 0) return false;
+            if (c != n) continue;
+            auto q = Delta;
+            for (uint32_t k = Base; ; k += Base) {
+                auto t = k <= Bias ? TMin : k >= Bias + TMax ? TMax : k - Bias;
+                if (q < t) break;
+                Out += Digit(t + (q - t) % (Base - t));
+                q = (q - t) / (Base - t);
+            }
+            Out += Digit(q);
+            Bias = Adapt(Delta, Handled + 1, Handled == Basic);
+            Delta = 0;
+            ++Handled;
+        }
+        ++Delta;
+        ++n;
+    }
+    return Out.size() - Start <= HOST_MAX_LABEL;
+}
+
+// Lowercases the letters of the ASCII, Latin-1, Greek and Cyrillic blocks, which
+// cover most IDNs seen in practice. Full IDNA (UTS #46) mapping and
+// normalization would need the Unicode tables.
+inline uint32_t ReachLowerCase(uint32_t c) {
+    if ((c >= 'A' && c <= 'Z') || (c >= 0xC0 && c <= 0xDE && c != 0xD7) ||
+        (c >= 0x391 && c <= 0x3A9 && c != 0x3A2) || (c >= 0x410 && c <= 0x42F)) return c + 0x20;
+    if (c >= 0x400 && c <= 0x40F) return c + 0x50;
+    return c;
+}
+
+// Normalizes a host name in place: lowercase, without a trailing dot, and with
+// internationalized labels in their ASCII (punycode) form. Returns false if the
+// name isn't a valid host name.
+inline bool ReachNormalizeHostName(std::string& HostName) {
+    std::string Out;
+    std::vector<uint32_t> Label;
+    bool Ascii = true;
+    auto EndLabel = [&]() {
+        if (Label.empty() || Label.size() > HOST_MAX_LABEL * 4) return false;
+        if (Ascii) {
+            if (Label.size() > HOST_MAX_LABEL) return false;
+            for (auto c : Label) Out += (char)c;
+        } else if (!ReachPunycode(Label, Out)) {
+            return false;
+        }
+        Label.clear();
+        Ascii = true;
+        return true;
+    };
+    const char* Data = HostName.data();
+    const char* End = Data + HostName.size();
+    while (Data < End) {
+        uint32_t c;
+        if (!ReachDecodeUtf8(Data, End, c)) return false;
+        if (c == '.' || c == 0x3002 || c == 0xFF0E || c == 0xFF61) { // Including the IDNA full stops
+            if (!EndLabel()) return false;
+            if (Data == End) break; // A trailing dot
+            Out += '.';
+            continue;
+        }
+        if (c <= ' ' || c == 0x7F) return false;
+        c = ReachLowerCase(c);
+        if (c >= 0x80) Ascii = false;
+        Label.push_back(c);
+    }
+    if (!Label.empty() && !EndLabel()) return false;
+    if (Out.empty() || Out.size() > HOST_MAX_LENGTH) return false;
+    HostName = std::move(Out);
+    return true;
+}
+
+// Stable (across runs and platforms) FNV-1a hash of the case-insensitive host name.
+inline uint64_t ReachHashHostName(const char* HostName) {
+    uint64_t Hash = 0xcbf29ce484222325ull;
+    for (; *HostName; ++HostName) {
+        Hash ^= (uint8_t)tolower((uint8_t)*HostName);
+        Hash *= 0x100000001b3ull;
+    }
+    return Hash;
+}
+
+// Open addressing (linear probing) set of 64-bit host name hashes. Only the
+// hashes are kept, so that memory doesn't grow with the length of the names;
+// with a million names, the chance of any collision is around 1 in 10^7.
+class ReachHostSet {
+public:
+    // Returns false if the hash was already in the set.
+    bool Insert(uint64_t Hash) {
+        if (!Hash) Hash = 1; // Zero marks empty slots
+        if (2 * (Count + 1) > Slots.size()) Grow();
+        auto Mask = Slots.size() - 1;
+        for (auto i = Index(Hash); ; i = (i + 1) & Mask) {
+            if (Slots[i] == Hash) return false;
+            if (!Slots[i]) {
+                Slots[i] = Hash;
+                ++Count;
+                return true;
+            }
+        }
+    }
+    size_t Size() const { return Count; }
+private:
+    size_t Index(uint64_t Hash) const {
+        return (size_t)((Hash * 0x9E3779B97F4A7C15ull) >> Shift); // Fibonacci hashing mixes the bits
+    }
+    void Grow() {
+        std::vector<uint64_t> Old(Slots.size() ? Slots.size() * 2 : 1024, 0);
+        Old.swap(Slots);
+        Shift = 64 - (uint32_t)std::countr_zero(Slots.size());
+        Count = 0;
+        for (auto Hash : Old) if (Hash) Insert(Hash);
+    }
+    std::vector<uint64_t> Slots;
+    size_t Count {0};
+    uint32_t Shift {64};
+};
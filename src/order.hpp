@@ -0,0 +1,131 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Reordering of hosts before they're probed, so that hosts served by the
+    same operator (like the most popular domains, many of which are on the
+    same front ends) don't go out back-to-back. Reordering is done over a
+    bounded window, so that it works on streamed host lists, and only depends
+    on the order hosts are added (and the seed), so that runs are reproducible.
+
+--*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <msquic.hpp>
+
+#define ORDER_WINDOW                4096        // Hosts held back to be reordered
+#define ORDER_RESOLVED_WINDOW       1024        // Resolved hosts held back to be reordered by address
+
+// Seeded pseudo-random numbers (SplitMix64), the same on every platform.
+class ReachRandom {
+public:
+    ReachRandom(uint64_t Seed) : State(Seed) { }
+    uint64_t Next() {
+        uint64_t z = (State += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+private:
+    uint64_t State;
+};
+
+// Returns the items in a random order. If no more than the window is added
+// before the first Pop, the order is a uniformly random permutation.
+template<typename T>
+class ReachShuffler {
+public:
+    ReachShuffler(uint64_t Seed) : Random(Seed) { }
+    size_t Size() const { return Items.size(); }
+    bool Empty() const { return Items.empty(); }
+    void Push(T&& Item) { Items.push_back(std::move(Item)); }
+    T Pop() {
+        std::swap(Items[(size_t)(Random.Next() % Items.size())], Items.back());
+        T Item = std::move(Items.back());
+        Items.pop_back();
+        return Item;
+    }
+private:
+    ReachRandom Random;
+    std::vector<T> Items;
+};
+
+// Returns the items round-robin across their keys, and in the order they were
+// added for each key.
+template<typename T>
+class ReachInterleaver {
+public:
+    size_t Size() const { return Count; }
+    bool Empty() const { return !Count; }
+    void Push(uint64_t Key, T&& Item) {
+        auto& Group = Groups[Key];
+        if (Group.empty()) Ring.push_back(Key);
+        Group.push_back(std::move(Item));
+        ++Count;
+    }
+    T Pop() {
+        auto Key = Ring.front();
+        Ring.pop_front();
+        auto Group = Groups.find(Key);
+        T Item = std::move(Group->second.front());
+        Group->second.pop_front();
+        if (Group->second.empty()) Groups.erase(Group);
+        else Ring.push_back(Key);
+        --Count;
+        return Item;
+    }
+private:
+    std::unordered_map<uint64_t, std::deque<T>> Groups;
+    std::deque<uint64_t> Ring; // Keys with items, in the order they're next served
+    size_t Count {0};
+};
+
+// The registrable domain of a (normalized) host name, like 'example.co.uk' for
+// 'www.example.co.uk'. Without the Public Suffix List, this is approximated as
+// the last two labels, or three if the second to last one is a common second
+// level domain under a country code. Address literals are returned whole.
+inline std::string_view ReachRegistrableDomain(std::string_view HostName) {
+    static const char* SecondLevels[] = {"ac", "co", "com", "edu", "go", "gob", "gov", "mil", "ne", "net", "or", "org"};
+    auto Last = HostName.rfind('.');
+    if (Last == std::string_view::npos || Last == 0 || HostName.find(':') != std::string_view::npos ||
+        strchr("0123456789", HostName.back())) { // Top-level domains don't end in a digit
+        return HostName;
+    }
+    auto Second = HostName.rfind('.', Last - 1);
+    if (Second == std::string_view::npos) return HostName;
+    if (HostName.size() - Last - 1 == 2 && Second > 0) {
+        auto Label = HostName.substr(Second + 1, Last - Second - 1);
+        for (auto Level : SecondLevels) {
+            if (Label == Level) {
+                auto Third = HostName.rfind('.', Second - 1);
+                return Third == std::string_view::npos ? HostName : HostName.substr(Third + 1);
+            }
+        }
+    }
+    return HostName.substr(Second + 1);
+}
+
+// The /24 (IPv4) or /48 (IPv6) prefix of an address, which usually covers the
+// front ends of one operator's point of presence.
+inline uint64_t ReachAddressPrefix(_In_ const QuicAddr& Address) {
+    uint64_t Prefix = 0;
+    if (Address.GetFamily() == QUIC_ADDRESS_FAMILY_INET) {
+        memcpy(&Prefix, &Address.SockAddr.Ipv4.sin_addr, 3);
+        Prefix |= 4ull << 56;
+    } else if (Address.GetFamily() == QUIC_ADDRESS_FAMILY_INET6) {
+        memcpy(&Prefix, &Address.SockAddr.Ipv6.sin6_addr, 6);
+        Prefix |= 6ull << 56;
+    }
+    return Prefix;
+}
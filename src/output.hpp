@@ -0,0 +1,212 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Asynchronous output for per-host results. Records are pushed from the
+    MsQuic worker threads onto a lock-free queue and formatted and written in
+    batches by a dedicated writer thread, so a slow terminal, pipe or file
+    never stalls QUIC processing.
+
+--*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Bounded lock-free multi-producer queue (Vyukov). Each cell carries a
+// sequence number that tells producers and the consumer whose turn it is.
+template<typename T>
+class ReachQueue {
+public:
+    explicit ReachQueue(size_t Capacity) : Cells(new Cell[Capacity]), Mask(Capacity - 1) {
+        for (size_t i = 0; i < Capacity; ++i) Cells[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+    size_t Capacity() const { return Mask + 1; }
+    bool TryPush(const T& Value) {
+        auto Position = EnqueuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            auto& Cell = Cells[Position & Mask];
+            auto Sequence = Cell.Sequence.load(std::memory_order_acquire);
+            auto Diff = (intptr_t)Sequence - (intptr_t)Position;
+            if (Diff == 0) {
+                if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed)) {
+                    Cell.Value = Value;
+                    Cell.Sequence.store(Position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (Diff < 0) {
+                return false; // Full
+            } else {
+                Position = EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    // Single consumer only.
+    bool Empty() const {
+        return (intptr_t)Cells[DequeuePosition & Mask].Sequence.load(std::memory_order_acquire) - (intptr_t)(DequeuePosition + 1) < 0;
+    }
+    bool TryPop(T& Value) {
+        auto& Cell = Cells[DequeuePosition & Mask];
+        if ((intptr_t)Cell.Sequence.load(std::memory_order_acquire) - (intptr_t)(DequeuePosition + 1) < 0) {
+            return false; // Empty
+        }
+        Value = Cell.Value;
+        Cell.Sequence.store(DequeuePosition + Mask + 1, std::memory_order_release);
+        ++DequeuePosition;
+        return true;
+    }
+private:
+    struct Cell {
+        std::atomic<size_t> Sequence;
+        T Value;
+    };
+    std::unique_ptr<Cell[]> Cells;
+    size_t Mask;
+    alignas(64) std::atomic<size_t> EnqueuePosition {0};
+    alignas(64) size_t DequeuePosition {0};
+};
+
+// Drains records on a dedicated thread and writes them to one or more sinks,
+// each with its own formatting, in large batches. A sink with a flush interval
+// is only written when its buffer fills up or the interval has passed, so that
+// files get few large writes, while still being readable during long runs.
+//
+// Producers never block: the (single) scheduling thread reserves room for a
+// record before starting the work that produces it, so if the writer falls
+// behind it is the scheduler that waits, not the MsQuic worker threads. The
+// writer thread sleeps while there's nothing to write, and producers only
+// wake it when it's actually asleep.
+template<typename T>
+class ReachWriter {
+public:
+    using FormatFn = size_t (*)(const T& Record, char* Buffer, size_t Length);
+    static constexpr size_t BufferSize = 64 * 1024;
+
+    explicit ReachWriter(size_t Capacity) : Queue(Capacity) { }
+    ~ReachWriter() { Stop(); }
+
+    // Adds an output. Must be called before Start.
+    void AddSink(FILE* File, FormatFn Format, uint32_t FlushIntervalMs = 0) {
+        Sinks.push_back({File, Format, std::unique_ptr<char[]>(new char[BufferSize]), 0,
+            std::chrono::milliseconds(FlushIntervalMs), Clock::now()});
+    }
+    void Start() { Thread = std::thread([this]() { Run(); }); }
+
+    // Drains everything pushed so far, then stops the writer thread.
+    void Stop() {
+        if (!Thread.joinable()) return;
+        Stopping = true;
+        Wake();
+        Thread.join();
+    }
+
+    // Scheduling thread only: waits for room for one more record.
+    void Reserve() {
+        uint32_t Count;
+        while ((Count = Reserved.load()) >= Queue.Capacity()) {
+            Waiting.store(true);
+            if ((Count = Reserved.load()) < Queue.Capacity()) {
+                Waiting.store(false);
+                break;
+            }
+            Reserved.wait(Count);
+        }
+        Reserved.fetch_add(1);
+    }
+    // Gives back a reservation that won't be used.
+    void Unreserve() { Release(1); }
+    // Never blocks, given a prior Reserve.
+    void Push(const T& Record) {
+        while (!Queue.TryPush(Record)) std::this_thread::yield(); // Not reached with reservations
+        Wake();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    struct Sink {
+        FILE* File;
+        FormatFn Format;
+        std::unique_ptr<char[]> Buffer;
+        size_t Length;
+        Clock::duration FlushInterval;
+        Clock::time_point LastFlush;
+    };
+    void Release(uint32_t Count) {
+        Reserved.fetch_sub(Count);
+        if (Waiting.load() && Waiting.exchange(false)) {
+            Reserved.notify_one();
+        }
+    }
+    void Run() {
+        T Record;
+        while (true) {
+            auto Done = Stopping.load(); // Sampled before draining, so nothing pushed before Stop is lost
+            uint32_t Count = 0;
+            while (Queue.TryPop(Record)) {
+                for (auto& Sink : Sinks) {
+                    if (BufferSize - Sink.Length < BufferSize / 4) Flush(Sink);
+                    Sink.Length += Sink.Format(Record, Sink.Buffer.get() + Sink.Length, BufferSize - Sink.Length);
+                }
+                if (++Count == 1024) {
+                    Release(Count);
+                    Count = 0;
+                }
+            }
+            if (Count) Release(Count);
+            auto Now = Clock::now();
+            auto Deadline = Clock::time_point::max(); // The next flush of a sink holding back output
+            for (auto& Sink : Sinks) {
+                if (Done || Now - Sink.LastFlush >= Sink.FlushInterval) Flush(Sink);
+                else if (Sink.Length && Sink.LastFlush + Sink.FlushInterval < Deadline) Deadline = Sink.LastFlush + Sink.FlushInterval;
+            }
+            if (Done) break;
+            Sleep(Deadline);
+        }
+    }
+    // Sleeps until a record is pushed, Stop is called or the deadline passes.
+    void Sleep(Clock::time_point Deadline) {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        Sleeping.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst); // Pairs with the one in Wake
+        if (Queue.Empty() && !Stopping.load()) {
+            auto Woken = [this]() { return !Sleeping.load(); };
+            if (Deadline == Clock::time_point::max()) WakeEvent.wait(Lock, Woken);
+            else WakeEvent.wait_until(Lock, Deadline, Woken);
+        }
+        Sleeping.store(false);
+    }
+    void Wake() {
+        std::atomic_thread_fence(std::memory_order_seq_cst); // The record (or Stopping) is visible before Sleeping is read
+        if (Sleeping.load() && Sleeping.exchange(false)) {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            WakeEvent.notify_one();
+        }
+    }
+    static void Flush(Sink& Sink) {
+        if (!Sink.Length) return;
+        fwrite(Sink.Buffer.get(), 1, Sink.Length, Sink.File);
+        fflush(Sink.File);
+        Sink.Length = 0;
+        Sink.LastFlush = Clock::now();
+    }
+    ReachQueue<T> Queue;
+    std::vector<Sink> Sinks;
+    std::atomic<uint32_t> Reserved {0};
+    std::atomic<bool> Waiting {false};
+    std::atomic<bool> Stopping {false};
+    std::atomic<bool> Sleeping {false};
+    std::mutex Mutex;
+    std::condition_variable WakeEvent;
+    std::thread Thread;
+};
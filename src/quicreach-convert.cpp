@@ -0,0 +1,92 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Converts a quicreach --out-log binary record log to CSV or JSON Lines, in
+    the same format as --out-hosts (with the probe times).
+
+--*/
+
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include <stdio.h>
+#include <string.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "reachlog.hpp"
+
+#define CONVERT_BUFFER_SIZE         (64 * 1024)
+
+int main(int argc, char **argv) {
+    if (argc < 2 || !strcmp(argv[1], "-?") || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help")) {
+        printf("usage: quicreach-convert <log> [options...]\n"
+               " -h, --help             Prints this help text\n"
+               " -j, --json             Writes JSON Lines (def=CSV)\n"
+               " -o, --out <file>       Writes to the file (def=stdout)\n"
+              );
+        return 1;
+    }
+
+    const char* LogFile = nullptr;
+    const char* OutFile = nullptr;
+    bool Json = false;
+    for (int i = 1; i < argc; ++i) {
+        if (argv[i][0] != '-') {
+            LogFile = argv[i];
+
+        } else if (!strcmp(argv[i], "--json") || !strcmp(argv[i], "-j")) {
+            Json = true;
+
+        } else if (!strcmp(argv[i], "--out") || !strcmp(argv[i], "-o")) {
+            if (++i >= argc) { printf("Missing file name\n"); return 1; }
+            OutFile = argv[i];
+        }
+    }
+    if (!LogFile) { printf("Missing log file\n"); return 1; }
+
+    std::unique_ptr<ReachLogReader> Reader(new ReachLogReader(LogFile)); // Too large for the stack
+    if (!Reader->IsValid()) { printf("Not a quicreach log: %s\n", LogFile); return 1; }
+    FILE* Out = OutFile ? fopen(OutFile, "w") : stdout;
+    if (!Out) { printf("Failed to open output file: %s\n", OutFile); return 1; }
+    if (!Json) fputs(ReachLogCsvHeader, Out);
+
+    std::vector<std::string> Names; // Indexed by host id
+    std::unique_ptr<char[]> Buffer(new char[CONVERT_BUFFER_SIZE]);
+    size_t Length = 0;
+    uint64_t Records = 0;
+    uint16_t Type;
+    while ((Type = Reader->Next())) {
+        if (Type == ReachLogEntryName) {
+            if (Reader->HostId >= Names.size()) Names.resize((size_t)Reader->HostId + 1);
+            Names[Reader->HostId] = Reader->Name;
+            continue;
+        }
+        const auto& Record = Reader->Record;
+        char Unknown[16];
+        const char* Name = Unknown;
+        if (Record.HostId < Names.size() && !Names[Record.HostId].empty()) {
+            Name = Names[Record.HostId].c_str();
+        } else {
+            snprintf(Unknown, sizeof(Unknown), "#%u", Record.HostId); // Its name entry is missing
+        }
+        if (CONVERT_BUFFER_SIZE - Length < CONVERT_BUFFER_SIZE / 4) {
+            fwrite(Buffer.get(), 1, Length, Out);
+            Length = 0;
+        }
+        Length += Json ?
+            ReachLogFormatJson(Record, Name, Buffer.get() + Length, CONVERT_BUFFER_SIZE - Length) :
+            ReachLogFormatCsv(Record, Name, Buffer.get() + Length, CONVERT_BUFFER_SIZE - Length);
+        ++Records;
+    }
+    fwrite(Buffer.get(), 1, Length, Out);
+
+    if (OutFile) {
+        fclose(Out);
+        printf("%llu record(s) written to %s\n", (unsigned long long)Records, OutFile);
+    }
+    return 0;
+}
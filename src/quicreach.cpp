@@ -10,14 +10,36 @@
 #define QUICREACH_VERSION_ONLY 1
 
 #include <stdio.h>
+#include <ctype.h>
 #include <thread>
 #include <vector>
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
+#include <chrono>
+#include <memory>
+#include <iterator>
+#include <queue>
+#include <functional>
+#include <bit>
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 #include <msquic.hpp>
 #include "quicreach.ver"
 #include "domains.hpp"
+#include "reach.hpp"
+#include "gate.hpp"
+#include "counters.hpp"
+#include "output.hpp"
+#include "resolve.hpp"
+#include "dns.hpp"
+#include "input.hpp"
+#include "normalize.hpp"
+#include "target.hpp"
+#include "order.hpp"
+#include "reachlog.hpp"
 
 #ifdef _WIN32
 #define QUIC_CALL __cdecl
@@ -34,23 +56,82 @@ const MsQuicApi* MsQuic;
 #define LOW_AMPLIFICATION_LIMIT     3.0         // Limit as specified by the QUIC spec
 #define HIGH_AMPLIFICATION_LIMIT    5.0         // Higher limit that seems to be practically used
 
+#define PACING_SPIN_US              1000        // Spin (instead of sleep) for the last part of a pacing wait
+
+#define RESOLVE_LOOKAHEAD           4           // Lookups kept queued ahead of the scheduler, per resolver thread
+#define RESOLVE_HORIZON_MS          1000        // How far ahead of its due time a host is resolved in continuous mode
+
+#define OUTPUT_FLUSH_INTERVAL_MS    1000        // How often buffered --out-hosts and --out-log results are written
+
+#define HEDGE_MIN_SAMPLES           20          // Minimum TIME_H samples before '--hedge auto' uses their p95
+
+#define ADAPTIVE_MAX_WINDOW         8192        // Upper bound for the adaptive parallel window
+#define ADAPTIVE_MIN_SAMPLES        16          // Minimum completed connections per adaptive epoch
+#define ADAPTIVE_TIMEOUT_RATE       0.05        // Timeout rate above which the window is reduced
+#define ADAPTIVE_INFLATION          2.0         // Handshake time inflation above which the window is reduced
+#define ADAPTIVE_INCREASE           8           // Additive window increase per uncongested epoch
+
 const uint32_t SupportedVersions[] = {QUIC_VERSION_1, QUIC_VERSION_2};
 const MsQuicVersionSettings VersionSettings(SupportedVersions, 2);
 
+// Indexed by QUIC_EXECUTION_PROFILE.
+const char* ProfileNames[] = {"lowlat", "maxtput", "scavenger", "realtime"};
+
+// The order hosts are probed in.
+enum class ReachOrder {
+    List,    // As given: the hostname args, the top-level domains by rank, then --input
+    Shuffle, // Shuffled with --seed
+    Prefix,  // Round-robin across the /24 (or /48) prefixes of the resolved addresses
+    Domain,  // Round-robin across the registrable domains
+};
+const char* OrderNames[] = {"list", "shuffle", "prefix", "domain"};
+
 struct ReachConfig {
     bool PrintStatistics {false};
     bool RequireAll {false};
-    std::vector<const char*> HostNames;
+    bool FailFast {false};
+    std::vector<ReachTarget> Targets;
+    size_t TopBegin {0}; // Range of TopDomains to test, after the Targets
+    size_t TopEnd {0};
+    const char* InputFile {nullptr};
+    std::unique_ptr<ReachHostReader> Input; // Streamed each round, after the Targets
     QuicAddr Address;
     QuicAddr SourceAddress;
     uint32_t Parallel {1};
+    bool Adaptive {false};
+    uint32_t Registrations {1};
+    uint32_t Resolvers {64};
+    QuicAddr DnsServer; // Queried directly, instead of the system resolver
+    bool ConfDns {false}; // The DNS server is read from resolv.conf
+    const char* DnsCacheFile {nullptr};
+    std::vector<const char*> Mappings; // --resolve args
+    const char* HostsFile {nullptr};
+    std::vector<QUIC_EXECUTION_PROFILE> Profiles {QUIC_EXECUTION_PROFILE_LOW_LATENCY};
     uint32_t Repeat {0};
+    bool Overlap {false};
+    bool Continuous {false};
+    uint32_t HedgeDelay {0};
+    bool HedgeAuto {false};
+    uint32_t Eyeballs {0};
+    bool FanOut {false};
+    uint32_t ShardIndex {0};
+    uint32_t ShardCount {1};
+    ReachOrder Order {ReachOrder::List};
+    uint64_t Seed {0};
+    bool Merge {false};
+    std::vector<const char*> MergeFiles;
+    uint32_t Rate {0};
+    uint32_t Burst {1};
     uint32_t Timeout {1000};
     uint16_t Port {443};
     MsQuicAlpn Alpn {"h3"};
+    const char* AlpnName {"h3"};
     MsQuicSettings Settings;
     QUIC_CREDENTIAL_FLAGS CredFlags {QUIC_CREDENTIAL_FLAG_CLIENT};
     const char* OutCsvFile {nullptr};
+    const char* OutHostsFile {nullptr};
+    bool OutHostsJson {false}; // JSON Lines instead of CSV
+    const char* OutLogFile {nullptr};
     ReachConfig() { }
     void Set() {
         Settings.SetDisconnectTimeoutMs(Timeout);
@@ -62,102 +143,413 @@ struct ReachConfig {
     }
 } Config;
 
-struct ReachResults {
-    std::atomic<uint32_t> TotalCount {0};
-    std::atomic<uint32_t> ReachableCount {0};
-    std::atomic<uint32_t> TooMuchCount {0};
-    std::atomic<uint32_t> WayTooMuchCount {0};
-    std::atomic<uint32_t> MultiRttCount {0};
-    std::atomic<uint32_t> RetryCount {0};
-    std::atomic<uint32_t> IPv6Count {0};
-    std::atomic<uint32_t> Quicv2Count {0};
-    // Number of currently active connections.
-    uint32_t ActiveCount {0};
-    // Synchronization for active count.
-    std::mutex Mutex;
-    std::condition_variable NotifyEvent;
-    void WaitForActiveCount() {
-        while (ActiveCount >= Config.Parallel) {
-            std::unique_lock<std::mutex> lock(Mutex);
-            NotifyEvent.wait(lock, [this]() { return ActiveCount < Config.Parallel; });
+// AIMD controller for the number of parallel connections, fed by completed connections.
+struct ReachController {
+    // Samples for the current epoch (written by worker threads).
+    std::atomic<uint32_t> Completed {0};
+    std::atomic<uint32_t> TimedOut {0};
+    std::atomic<uint32_t> Handshakes {0};
+    std::atomic<uint64_t> HandshakeTimeUs {0};
+    // Controller state (scheduling thread only).
+    uint32_t Window {1};
+    bool SlowStart {true};
+    double BaseHandshakeTimeUs {0};
+    std::chrono::steady_clock::time_point StartTime {std::chrono::steady_clock::now()};
+    void OnSample(bool WasTimedOut, uint64_t HandshakeUs) {
+        if (WasTimedOut) {
+            TimedOut++;
+        } else if (HandshakeUs) {
+            Handshakes++;
+            HandshakeTimeUs += HandshakeUs;
         }
+        Completed++;
     }
-    void WaitForAll() {
-        while (ActiveCount) {
-            std::unique_lock<std::mutex> lock(Mutex);
-            NotifyEvent.wait(lock, [this]() { return ActiveCount == 0; });
+    uint32_t Update() {
+        if (!Config.Adaptive) return Config.Parallel;
+        if (Completed.load() < (Window > ADAPTIVE_MIN_SAMPLES ? Window : ADAPTIVE_MIN_SAMPLES)) return Window;
+
+        // Close out the epoch. The counters are read individually so samples
+        // racing with the reset may land in either epoch, which is fine.
+        auto EpochCompleted = Completed.exchange(0);
+        auto EpochTimedOut = TimedOut.exchange(0);
+        auto EpochHandshakes = Handshakes.exchange(0);
+        auto EpochHandshakeTimeUs = HandshakeTimeUs.exchange(0);
+
+        auto TimeoutRate = (double)EpochTimedOut / (double)EpochCompleted;
+        auto AverageUs = EpochHandshakes ? (double)EpochHandshakeTimeUs / (double)EpochHandshakes : 0.0;
+        if (AverageUs != 0.0 && (BaseHandshakeTimeUs == 0.0 || AverageUs < BaseHandshakeTimeUs)) {
+            BaseHandshakeTimeUs = AverageUs;
+        }
+        auto Inflation = BaseHandshakeTimeUs != 0.0 ? AverageUs / BaseHandshakeTimeUs : 1.0;
+
+        auto OldWindow = Window;
+        if (TimeoutRate > ADAPTIVE_TIMEOUT_RATE || Inflation > ADAPTIVE_INFLATION) {
+            SlowStart = false;
+            Window = Window > 1 ? Window / 2 : 1;
+        } else {
+            Window = SlowStart ? Window * 2 : Window + ADAPTIVE_INCREASE;
+            if (Window > ADAPTIVE_MAX_WINDOW) Window = ADAPTIVE_MAX_WINDOW;
+        }
+        if (Window != OldWindow) {
+            auto ElapsedMs = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - StartTime).count();
+            printf("[%6u.%03u s] parallel %4u -> %4u (%4.1f%% timeouts, %u.%03u ms handshake, %.2fx)\n",
+                ElapsedMs / 1000, ElapsedMs % 1000, OldWindow, Window, TimeoutRate * 100.0,
+                (uint32_t)AverageUs / 1000, (uint32_t)AverageUs % 1000, Inflation);
         }
+        return Window;
     }
-    void IncActive() {
-        std::lock_guard<std::mutex> lock(Mutex);
-        ++ActiveCount;
+};
+
+// Lock-free log-linear histogram (16 sub-buckets per power of two) of microsecond values.
+struct ReachHistogram {
+    static constexpr uint32_t SubBuckets = 16;
+    static constexpr uint32_t BucketCount = 29 * SubBuckets;
+    std::atomic<uint32_t> Counts[BucketCount] {};
+    std::atomic<uint32_t> Total {0};
+    static uint32_t Index(uint32_t Value) {
+        if (Value < SubBuckets) return Value;
+        uint32_t Log = 31 - (uint32_t)std::countl_zero(Value);
+        return (Log - 3) * SubBuckets + ((Value >> (Log - 4)) & (SubBuckets - 1));
+    }
+    static uint32_t UpperBound(uint32_t Index) {
+        if (Index < SubBuckets) return Index;
+        uint32_t Shift = Index / SubBuckets - 1;
+        return ((SubBuckets + Index % SubBuckets + 1) << Shift) - 1;
     }
-    void DecActive() {
-        std::unique_lock<std::mutex> lock(Mutex);
-        ActiveCount--;
-        NotifyEvent.notify_all();
+    void Add(uint32_t Value) {
+        Counts[Index(Value)].fetch_add(1, std::memory_order_relaxed);
+        Total.fetch_add(1, std::memory_order_relaxed);
+    }
+    uint32_t Quantile(double Quantile) const {
+        auto Target = (uint32_t)(Quantile * (double)Total.load(std::memory_order_relaxed));
+        uint32_t Sum = 0;
+        for (uint32_t i = 0; i < BucketCount; ++i) {
+            Sum += Counts[i].load(std::memory_order_relaxed);
+            if (Sum > Target) return UpperBound(i);
+        }
+        return UpperBound(BucketCount - 1);
+    }
+};
+
+enum class ReachCounter {
+    Total, Reachable, TooMuch, WayTooMuch, MultiRtt, Retry, IPv6, Quicv2, Hedged, HedgeWon,
+    Raced, RaceIPv6Won, RaceIPv4Won, RaceBoth, RaceIPv6Faster,
+    Resolved, Unresolved, ResolveTimeUs,
+    Count
+};
+
+struct ReachResults {
+    ReachCounters<ReachCounter> Counters;
+    void Add(ReachCounter Counter, uint64_t Value = 1) { Counters.Add(Counter, Value); }
+    uint64_t Get(ReachCounter Counter) const { return Counters.Get(Counter); }
+    // Distribution of TIME_H, the time to connect, used for '--hedge auto'.
+    ReachHistogram HandshakeTimes;
+    // Feedback for the adaptive parallel window.
+    ReachController Controller;
+    // Active connections, which the scheduling thread waits on.
+    ReachGate Gate;
+    // Set (once) to stop scheduling any more connections.
+    std::atomic<bool> Cancelled {false};
+    // Number of (unique) hosts in the (first round of the) list, and those
+    // skipped as duplicates or invalid (scheduling thread only).
+    uint64_t HostCount {0};
+    uint64_t Duplicates {0};
+    uint64_t Invalid {0};
+    std::mutex CancelMutex;
+    std::condition_variable CancelEvent;
+    void Cancel() {
+        {
+            std::lock_guard<std::mutex> lock(CancelMutex);
+            Cancelled = true;
+        }
+        CancelEvent.notify_all();
+    }
+    // Sleeps until the given time, or until the run is cancelled.
+    template<typename TimePoint>
+    bool SleepUntil(const TimePoint& Time) {
+        std::unique_lock<std::mutex> lock(CancelMutex);
+        return !CancelEvent.wait_until(lock, Time, [this]() { return Cancelled.load(); });
+    }
+    // The waits below return early if the run is cancelled. The cancelling
+    // connection is always still active, so its completion wakes the waiter.
+    void WaitForActiveCount() {
+        Gate.Wait([this](uint32_t Count) { return Cancelled || Count < Controller.Update(); });
+    }
+    void WaitForAll() {
+        Gate.Wait([this](uint32_t Count) { return Cancelled || Count == 0; });
     }
+    void WaitForDrain() {
+        Gate.Wait([](uint32_t Count) { return Count == 0; });
+    }
+    void IncActive() { Gate.Inc(); }
+    void DecActive() { Gate.Dec(); }
 } Results;
 
-void AddHostName(char* arg) {
+// Token bucket (GCRA) pacer for connection starts, used when a rate is configured.
+struct ReachPacer {
+    using Clock = std::chrono::steady_clock;
+    Clock::duration Interval {0};
+    Clock::duration Tolerance {0};
+    Clock::time_point First;
+    Clock::time_point Last;
+    Clock::time_point Theoretical; // Theoretical arrival time of the next token
+    uint64_t StartCount {0};
+    uint64_t SlipTotalUs {0};
+    uint64_t SlipMaxUs {0};
+    ReachPacer() {
+        Interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / (double)Config.Rate));
+        Tolerance = Interval * (Config.Burst ? Config.Burst - 1 : 0);
+        First = Last = Theoretical = Clock::now();
+    }
+    void Wait() {
+        auto Due = Theoretical - Tolerance;
+        auto Now = Clock::now();
+        if (Due > Now) {
+            // Sleep for most of the interval and spin for the rest to hit the due time precisely.
+            auto Spin = std::chrono::microseconds(PACING_SPIN_US);
+            if (Due - Now > Spin && !Results.SleepUntil(Due - Spin)) return;
+            while ((Now = Clock::now()) < Due) {
+                if (Results.Cancelled) return;
+                std::this_thread::yield();
+            }
+            auto SlipUs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(Now - Due).count();
+            SlipTotalUs += SlipUs;
+            if (SlipUs > SlipMaxUs) SlipMaxUs = SlipUs;
+        }
+        Theoretical = (Theoretical > Now ? Theoretical : Now) + Interval;
+        if (!StartCount++) First = Now;
+        Last = Now;
+    }
+    void Print() const {
+        auto ElapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(Last - First).count();
+        auto Ideal = First + Interval * (StartCount > Config.Burst ? StartCount - Config.Burst : 0);
+        auto BehindUs = Last > Ideal ? std::chrono::duration_cast<std::chrono::microseconds>(Last - Ideal).count() : 0;
+        printf("%4.1f connection(s) per second achieved (%u requested)\n",
+            ElapsedUs && StartCount > 1 ? (double)(StartCount - 1) * 1000000.0 / (double)ElapsedUs : 0.0,
+            Config.Rate);
+        printf("%4u.%03u ms average pacing slip, %u.%03u ms max, %u.%03u ms behind schedule\n",
+            (uint32_t)(SlipTotalUs / (StartCount ? StartCount : 1) / 1000), (uint32_t)(SlipTotalUs / (StartCount ? StartCount : 1) % 1000),
+            (uint32_t)(SlipMaxUs / 1000), (uint32_t)(SlipMaxUs % 1000),
+            (uint32_t)(BehindUs / 1000), (uint32_t)(BehindUs % 1000));
+    }
+};
+
+bool AddHostName(char* arg) {
     // Parse hostname(s), treating '*' as all top-level domains.
     if (!strcmp(arg, "*")) {
-        for (const auto& Domain : TopDomains) {
-            Config.HostNames.push_back(Domain);
-        }
-    } else {
-        char* HostName = arg;
-        do {
-            char* End = strchr(HostName, ',');
-            if (End) *End = '\0';
-            Config.HostNames.push_back(HostName);
-            if (!End) break;
-            HostName = End + 1;
-        } while (true);
+        Config.TopBegin = 0;
+        Config.TopEnd = TopDomainCount;
+        return true;
     }
+    char* HostName = arg;
+    do {
+        char* End = strchr(HostName, ',');
+        ReachTarget Target;
+        if (!ReachParseTarget(HostName, End ? (size_t)(End - HostName) : strlen(HostName), Target)) {
+            printf("Invalid hostname arg: %s\n", HostName); return false;
+        }
+        Config.Targets.push_back(Target);
+        if (!End) break;
+        HostName = End + 1;
+    } while (true);
+    return true;
 }
 
+bool InShard(_In_z_ const char* HostName) {
+    return Config.ShardCount <= 1 || ReachHashHostName(HostName) % Config.ShardCount == Config.ShardIndex;
+}
+
+// The hosts of one round: the hostname args, then the selected top-level
+// domains, then those read from --input. Each host name is normalized, and
+// only returned the first time, if it's in this shard. With --order shuffle or
+// domain, hosts are reordered over a window of ORDER_WINDOW hosts.
+struct ReachHostSource {
+    size_t Next {0}; // Index of the next host
+    uint64_t Duplicates {0};
+    uint64_t Invalid {0};
+    ReachHostSource() {
+        if (Config.Input && Config.Input->CanRewind()) Config.Input->Rewind();
+    }
+    bool Get(_Out_ ReachTarget& Target) {
+        if (Config.Order == ReachOrder::Shuffle) {
+            while (Shuffled.Size() < ORDER_WINDOW && Filter(Target)) Shuffled.Push(std::move(Target));
+            if (Shuffled.Empty()) return false;
+            Target = Shuffled.Pop();
+        } else if (Config.Order == ReachOrder::Domain) {
+            while (Interleaved.Size() < ORDER_WINDOW && Filter(Target)) {
+                auto Key = std::hash<std::string_view>()(ReachRegistrableDomain(Target.HostName));
+                Interleaved.Push(Key, std::move(Target));
+            }
+            if (Interleaved.Empty()) return false;
+            Target = Interleaved.Pop();
+        } else if (!Filter(Target)) {
+            return false;
+        }
+        ++Next;
+        return true;
+    }
+private:
+    bool Filter(_Out_ ReachTarget& Target) {
+        while (Read(Target)) {
+            if (Target.Port == Config.Port) Target.Port = 0;
+            if (Target.Alpn == Config.AlpnName) Target.Alpn.clear();
+            if (!ReachNormalizeHostName(Target.HostName)) {
+                ++Invalid;
+            } else if (InShard(Target.HostName.c_str())) {
+                if (Seen.Insert(ReachHashTarget(Target))) return true;
+                ++Duplicates;
+            }
+        }
+        return false;
+    }
+    bool Read(_Out_ ReachTarget& Target) {
+        if (Arg < Config.Targets.size()) {
+            Target = Config.Targets[Arg++];
+            return true;
+        }
+        if (Top < Config.TopEnd) {
+            Target.HostName = TopDomain(Top++);
+            Target.Interval = 0;
+            return true;
+        }
+        const char* Line;
+        size_t Length;
+        while (Config.Input && Config.Input->Next(Line, Length)) {
+            if (ReachParseTarget(Line, Length, Target)) return true;
+            ++Invalid;
+        }
+        return false;
+    }
+    size_t Arg {0};
+    size_t Top {Config.TopBegin};
+    ReachHostSet Seen;
+    ReachShuffler<ReachTarget> Shuffled {Config.Seed};
+    ReachInterleaver<ReachTarget> Interleaved;
+};
+
 bool ParseConfig(int argc, char **argv) {
     if (argc < 2 || !strcmp(argv[1], "-?") || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help")) {
         printf("usage: quicreach <hostname(s)> [options...]\n"
+               "  Each hostname may be followed by :<port> and /<alpn> (def=--port and --alpn)\n"
                " -a, --alpn <alpn>      The ALPN to use for the handshake (def=h3)\n"
                " -b, --built-in-val     Use built-in TLS validation logic\n"
+               "     --burst <num>      The number of connections --rate may start back-to-back (def=1)\n"
                " -c, --csv <file>       Writes CSV results to the given file\n"
+               " -C, --continuous       Probe each host every --repeat (or host@<ms>) interval\n"
+               " -d, --resolvers <num>  The number of parallel name resolutions (def=64, 0=by MsQuic)\n"
+               " -D, --dns <address>    Queries the DNS server directly, or 'conf' for resolv.conf's (def=system resolver)\n"
+               "     --dns-cache <file> Loads and saves resolved addresses, for their TTL, in the file\n"
+               " -E, --eyeballs <time>  Race IPv6 against IPv4, started N ms later (RFC 8305 uses 250)\n"
+               " -f, --fail-fast        Stop at the first unreachable host (implies --req-all)\n"
+               " -F, --fan-out          Also probe every other address a host resolves to, once per address\n"
                " -h, --help             Prints this help text\n"
+               " -H, --hedge <time>     Start a second attempt if not connected after N ms (or 'auto')\n"
+               "     --hosts <file>     Uses the addresses of a hosts file for the host names in it\n"
                " -i, --ip <address>     The IP address to use\n"
-               " -l, --parallel <num>   The numer of parallel hosts to test at once (def=1)\n"
+               "     --input <file>     Reads more hostnames, one per line, from the file (or '-' for stdin)\n"
+               " -l, --parallel <num>   The numer of parallel hosts to test at once (def=1, or 'auto')\n"
                " -m, --mtu <mtu>        The initial (IPv6) MTU to use (def=1288)\n"
+               " -M, --merge            Sums the --csv summary counts of --shard runs, from files given as positional args (no per-host results)\n"
+               " -o, --overlap          Overlap --repeat rounds instead of skipping overruns\n"
+               "     --out-hosts <file> Writes per-host results to the file (JSON Lines if it ends in .jsonl, else CSV)\n"
+               "     --out-log <file>   Appends a binary record of each probe to the file (see quicreach-convert)\n"
+               "     --order <order>    The order to probe hosts in: list, shuffle, prefix (round-robin across\n"
+               "                        /24 or /48 address prefixes) or domain (across registrable domains)\n"
                " -p, --port <port>      The UDP port to use (def=443)\n"
+               " -P, --profile <name>   Execution profile(s) (lowlat, maxtput, scavenger, realtime)\n"
                " -r, --req-all          Require all hostnames to succeed\n"
-               " -R, --repeat <time>    Repeat the requests event N milliseconds\n"
+               "     --resolve <map>    Uses the address(es) of a host:port:addr[,addr] mapping (port may be '*')\n"
+               "     --rate <num>       Paces connection starts to N per second\n"
+               " -R, --repeat <time>    Repeat the requests every N milliseconds\n"
                " -s, --stats            Print connection statistics\n"
                " -S, --source <address> Specify a source IP address\n"
+               "     --seed <num>       The seed for '--order shuffle' (def=0)\n"
+               "     --shard <i/n>      Only test the i-th of n stable partitions of the hostnames\n"
                " -t, --timeout <time>   Timeout in milliseconds to wait for each handshake\n"
+               "     --top <num>        Test the N highest ranked top-level domains (like '*' for all)\n"
+               "     --range <a:b>      Test the top-level domains ranked a to b (from 1, inclusive)\n"
                " -u, --unsecure         Allows unsecure connections\n"
                " -v, --version          Prints out the version\n"
+               " -w, --workers <num>    The number of registrations to split hosts across (def=1)\n"
               );
         return false;
     }
 
+    std::vector<char*> Positional;
     for (int i = 1; i < argc; ++i) {
         if (argv[i][0] != '-') {
-            AddHostName(argv[i]);
+            Positional.push_back(argv[i]);
 
         } else if (!strcmp(argv[i], "--alpn") || !strcmp(argv[i], "-a")) {
             if (++i >= argc) { printf("Missing ALPN string\n"); return false; }
             Config.Alpn = argv[i];
+            Config.AlpnName = argv[i];
 
         } else if (!strcmp(argv[i], "--built-in-val") || !strcmp(argv[i], "-b")) {
             Config.CredFlags |= QUIC_CREDENTIAL_FLAG_USE_TLS_BUILTIN_CERTIFICATE_VALIDATION;
 
+        } else if (!strcmp(argv[i], "--burst")) {
+            if (++i >= argc) { printf("Missing burst number\n"); return false; }
+            Config.Burst = (uint32_t)atoi(argv[i]);
+
+        } else if (!strcmp(argv[i], "--continuous") || !strcmp(argv[i], "-C")) {
+            Config.Continuous = true;
+
         } else if (!strcmp(argv[i], "--csv") || !strcmp(argv[i], "-c")) {
             if (++i >= argc) { printf("Missing file name\n"); return false; }
             Config.OutCsvFile = argv[i];
 
+        } else if (!strcmp(argv[i], "--resolvers") || !strcmp(argv[i], "-d")) {
+            if (++i >= argc) { printf("Missing resolver number\n"); return false; }
+            Config.Resolvers = (uint32_t)atoi(argv[i]);
+
+        } else if (!strcmp(argv[i], "--dns") || !strcmp(argv[i], "-D")) {
+            if (++i >= argc) { printf("Missing DNS server\n"); return false; }
+            if (!strcmp(argv[i], "conf")) {
+                Config.ConfDns = true;
+            } else if (!QuicAddrFromString(argv[i], DNS_PORT, &Config.DnsServer.SockAddr)) {
+                printf("Invalid DNS server arg\n"); return false;
+            }
+
+        } else if (!strcmp(argv[i], "--dns-cache")) {
+            if (++i >= argc) { printf("Missing file name\n"); return false; }
+            Config.DnsCacheFile = argv[i];
+
+        } else if (!strcmp(argv[i], "--eyeballs") || !strcmp(argv[i], "-E")) {
+            if (++i >= argc) { printf("Missing eyeballs delay\n"); return false; }
+            Config.Eyeballs = (uint32_t)atoi(argv[i]);
+            if (!Config.Eyeballs) { printf("Invalid eyeballs delay\n"); return false; }
+
+        } else if (!strcmp(argv[i], "--fail-fast") || !strcmp(argv[i], "-f")) {
+            Config.RequireAll = true;
+            Config.FailFast = true;
+
+        } else if (!strcmp(argv[i], "--fan-out") || !strcmp(argv[i], "-F")) {
+            Config.FanOut = true;
+
+        } else if (!strcmp(argv[i], "--hedge") || !strcmp(argv[i], "-H")) {
+            if (++i >= argc) { printf("Missing hedge delay\n"); return false; }
+            if (!strcmp(argv[i], "auto")) {
+                Config.HedgeAuto = true;
+            } else {
+                Config.HedgeDelay = (uint32_t)atoi(argv[i]);
+            }
+
+        } else if (!strcmp(argv[i], "--hosts")) {
+            if (++i >= argc) { printf("Missing file name\n"); return false; }
+            Config.HostsFile = argv[i];
+
+        } else if (!strcmp(argv[i], "--merge") || !strcmp(argv[i], "-M")) {
+            Config.Merge = true;
+
         } else if (!strcmp(argv[i], "--mtu") || !strcmp(argv[i], "-m")) {
             if (++i >= argc) { printf("Missing MTU value\n"); return false; }
             Config.Settings.SetMinimumMtu((uint16_t)atoi(argv[i]));
 
+        } else if (!strcmp(argv[i], "--input")) {
+            if (++i >= argc) { printf("Missing file name\n"); return false; }
+            Config.InputFile = argv[i];
+
         } else if (!strcmp(argv[i], "--ip") || !strcmp(argv[i], "-i")) {
             if (++i >= argc) { printf("Missing IP address\n"); return false; }
             if (!QuicAddrFromString(argv[i], 0, &Config.Address.SockAddr)) {
@@ -166,15 +558,65 @@ bool ParseConfig(int argc, char **argv) {
 
         } else if (!strcmp(argv[i], "--parallel") || !strcmp(argv[i], "-l")) {
             if (++i >= argc) { printf("Missing parallel number\n"); return false; }
-            Config.Parallel = (uint32_t)atoi(argv[i]);
+            if (!strcmp(argv[i], "auto")) {
+                Config.Adaptive = true;
+            } else {
+                Config.Parallel = (uint32_t)atoi(argv[i]);
+            }
+
+        } else if (!strcmp(argv[i], "--overlap") || !strcmp(argv[i], "-o")) {
+            Config.Overlap = true;
+
+        } else if (!strcmp(argv[i], "--order")) {
+            if (++i >= argc) { printf("Missing order\n"); return false; }
+            size_t j = 0;
+            while (j < std::size(OrderNames) && strcmp(argv[i], OrderNames[j])) ++j;
+            if (j == std::size(OrderNames)) { printf("Invalid order: %s\n", argv[i]); return false; }
+            Config.Order = (ReachOrder)j;
+
+        } else if (!strcmp(argv[i], "--out-hosts")) {
+            if (++i >= argc) { printf("Missing file name\n"); return false; }
+            Config.OutHostsFile = argv[i];
+            auto Length = strlen(argv[i]);
+            Config.OutHostsJson = Length >= 6 && !strcmp(argv[i] + Length - 6, ".jsonl");
+
+        } else if (!strcmp(argv[i], "--out-log")) {
+            if (++i >= argc) { printf("Missing file name\n"); return false; }
+            Config.OutLogFile = argv[i];
 
         } else if (!strcmp(argv[i], "--port") || !strcmp(argv[i], "-p")) {
             if (++i >= argc) { printf("Missing port number\n"); return false; }
             Config.Port = (uint16_t)atoi(argv[i]);
 
+        } else if (!strcmp(argv[i], "--profile") || !strcmp(argv[i], "-P")) {
+            if (++i >= argc) { printf("Missing execution profile\n"); return false; }
+            Config.Profiles.clear();
+            char* Name = argv[i];
+            do {
+                char* End = strchr(Name, ',');
+                if (End) *End = '\0';
+                size_t j = 0;
+                while (j < std::size(ProfileNames) && strcmp(Name, ProfileNames[j])) ++j;
+                if (j == std::size(ProfileNames)) { printf("Invalid execution profile: %s\n", Name); return false; }
+                Config.Profiles.push_back((QUIC_EXECUTION_PROFILE)j);
+                if (!End) break;
+                Name = End + 1;
+            } while (true);
+
         } else if (!strcmp(argv[i], "--stats") || !strcmp(argv[i], "-s")) {
             Config.PrintStatistics = true;
 
+        } else if (!strcmp(argv[i], "--seed")) {
+            if (++i >= argc) { printf("Missing seed number\n"); return false; }
+            Config.Seed = strtoull(argv[i], nullptr, 10);
+
+        } else if (!strcmp(argv[i], "--shard")) {
+            if (++i >= argc) { printf("Missing shard arg\n"); return false; }
+            if (sscanf(argv[i], "%u/%u", &Config.ShardIndex, &Config.ShardCount) != 2 ||
+                !Config.ShardCount || Config.ShardIndex >= Config.ShardCount) {
+                printf("Invalid shard arg (expected i/n with i < n)\n"); return false;
+            }
+
         } else if (!strcmp(argv[i], "--source") || !strcmp(argv[i], "-S")) {
             if (++i >= argc) { printf("Missing source address\n"); return false; }
             if (!QuicAddrFromString(argv[i], 0, &Config.SourceAddress.SockAddr)) {
@@ -184,6 +626,23 @@ bool ParseConfig(int argc, char **argv) {
         } else if (!strcmp(argv[i], "--req-all") || !strcmp(argv[i], "-r")) {
             Config.RequireAll = true;
 
+        } else if (!strcmp(argv[i], "--range")) {
+            if (++i >= argc) { printf("Missing range arg\n"); return false; }
+            unsigned long long First, Last;
+            if (sscanf(argv[i], "%llu:%llu", &First, &Last) != 2 || !First || First > Last || First > TopDomainCount) {
+                printf("Invalid range arg (expected a:b with 1 <= a <= b, a <= %zu)\n", TopDomainCount); return false;
+            }
+            Config.TopBegin = (size_t)First - 1;
+            Config.TopEnd = std::min((size_t)Last, TopDomainCount);
+
+        } else if (!strcmp(argv[i], "--rate")) {
+            if (++i >= argc) { printf("Missing rate number\n"); return false; }
+            Config.Rate = (uint32_t)atoi(argv[i]);
+
+        } else if (!strcmp(argv[i], "--resolve")) {
+            if (++i >= argc) { printf("Missing host mapping\n"); return false; }
+            Config.Mappings.push_back(argv[i]);
+
         } else if (!strcmp(argv[i], "--repeat") || !strcmp(argv[i], "-R")) {
             if (++i >= argc) { printf("Missing repeat arg\n"); return false; }
             Config.Repeat = (uint32_t)atoi(argv[i]);
@@ -192,11 +651,78 @@ bool ParseConfig(int argc, char **argv) {
             if (++i >= argc) { printf("Missing timeout arg\n"); return false; }
             Config.Timeout = (uint32_t)atoi(argv[i]);
 
+        } else if (!strcmp(argv[i], "--top")) {
+            if (++i >= argc) { printf("Missing top number\n"); return false; }
+            Config.TopBegin = 0;
+            Config.TopEnd = std::min((size_t)strtoull(argv[i], nullptr, 10), TopDomainCount);
+
         } else if (!strcmp(argv[i], "--unsecure") || !strcmp(argv[i], "-u")) {
             Config.CredFlags |= QUIC_CREDENTIAL_FLAG_NO_CERTIFICATE_VALIDATION;
 
         } else if (!strcmp(argv[i], "--version") || !strcmp(argv[i], "-v")) {
             printf("quicreach " QUICREACH_VERSION "\n");
+
+        } else if (!strcmp(argv[i], "--workers") || !strcmp(argv[i], "-w")) {
+            if (++i >= argc) { printf("Missing worker number\n"); return false; }
+            Config.Registrations = (uint32_t)atoi(argv[i]);
+            if (!Config.Registrations) { printf("Invalid worker number\n"); return false; }
+        }
+    }
+
+    if (Config.Merge) {
+        Config.MergeFiles.assign(Positional.begin(), Positional.end());
+        return true;
+    }
+
+    for (auto Arg : Positional) {
+        if (!AddHostName(Arg)) return false;
+    }
+
+    if (Config.InputFile) {
+        Config.Input.reset(new ReachHostReader(Config.InputFile));
+        if (!Config.Input->IsValid()) { printf("Failed to open input file: %s\n", Config.InputFile); return false; }
+    }
+    if (Config.Continuous || (Config.Input && Config.Repeat && !Config.Input->CanRewind())) {
+        // Per-host schedules, or rounds over stdin (which can't be read
+        // again), need the whole list up front.
+        std::vector<ReachTarget> Targets;
+        ReachHostSource Source;
+        ReachTarget Target;
+        while (Source.Get(Target)) Targets.push_back(Target);
+        Config.Targets = std::move(Targets);
+        Results.Duplicates = Source.Duplicates;
+        Results.Invalid = Source.Invalid;
+        Config.TopBegin = Config.TopEnd = 0;
+        Config.Input.reset();
+    }
+
+    if (Config.Eyeballs && (!Config.Resolvers || Config.Address.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC)) {
+        printf("--eyeballs requires the host names to be resolved by quicreach\n"); return false;
+    }
+    if ((!Config.Mappings.empty() || Config.HostsFile) && (!Config.Resolvers || Config.Address.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC)) {
+        printf("--resolve and --hosts require the host names to be resolved by quicreach\n"); return false;
+    }
+    if (Config.FanOut && (!Config.Resolvers || Config.Address.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC)) {
+        printf("--fan-out requires the host names to be resolved by quicreach\n"); return false;
+    }
+    if (Config.FanOut && (Config.Eyeballs || Config.Repeat || Config.Continuous)) {
+        printf("--fan-out can't be combined with --eyeballs, --repeat or --continuous\n"); return false;
+    }
+    if (Config.Order == ReachOrder::Prefix && (!Config.Resolvers || Config.Address.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC)) {
+        printf("--order prefix requires the host names to be resolved by quicreach\n"); return false;
+    }
+    if (Config.Order == ReachOrder::Prefix && Config.Continuous) {
+        printf("--order prefix can't be combined with --continuous\n"); return false;
+    }
+    if ((Config.ConfDns || Config.DnsServer.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC) && Config.Resolvers > DNS_MAX_LOOKUPS) {
+        Config.Resolvers = DNS_MAX_LOOKUPS; // Leaves enough query IDs free to pick from
+    }
+
+    if (Config.Continuous) {
+        for (const auto& Target : Config.Targets) {
+            if (!Target.Interval && !Config.Repeat) {
+                printf("Continuous mode requires --repeat or a per-host interval\n"); return false;
+            }
         }
     }
 
@@ -205,115 +731,477 @@ bool ParseConfig(int argc, char **argv) {
     return true;
 }
 
-struct ReachConnection : public MsQuicConnection {
-    const char* HostName;
-    bool HandshakeComplete {false};
-    QUIC_STATISTICS_V2 Stats {0};
-    ReachConnection(
-        _In_ const MsQuicRegistration& Registration,
-        _In_ const MsQuicConfiguration& Configuration,
-        _In_ const char* HostName
-    ) : MsQuicConnection(Registration, CleanUpAutoDelete, Callback), HostName(HostName) {
-        Results.TotalCount++;
-        Results.IncActive();
-        if (IsValid() && Config.Address.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC) {
-            InitStatus = SetRemoteAddr(Config.Address);
-        }
-        if (IsValid() && Config.SourceAddress.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC) {
-            InitStatus = SetLocalAddr(Config.SourceAddress);
-        }
-        if (IsValid()) {
-            InitStatus = Start(Configuration, HostName, Config.Port);
-        }
-        if (!IsValid()) {
-            Results.DecActive();
-        }
-    }
-    static QUIC_STATUS QUIC_API Callback(
-        _In_ MsQuicConnection* _Connection,
-        _In_opt_ void* ,
-        _Inout_ QUIC_CONNECTION_EVENT* Event
-        ) noexcept {
-        auto Connection = (ReachConnection*)_Connection;
-        if (Event->Type == QUIC_CONNECTION_EVENT_CONNECTED) {
-            Connection->OnReachable();
-            Connection->Shutdown(0);
-        } else if (Event->Type == QUIC_CONNECTION_EVENT_SHUTDOWN_COMPLETE) {
-            if (!Connection->HandshakeComplete) Connection->OnUnreachable();
-            Results.DecActive();
-        } else if (Event->Type == QUIC_CONNECTION_EVENT_PEER_STREAM_STARTED) {
-            MsQuic->StreamClose(Event->PEER_STREAM_STARTED.Stream); // Shouldn't do this
-        }
-        return QUIC_STATUS_SUCCESS;
+enum class WorkerCounter {
+    Total, Reachable, HandshakeTimeUs,
+    Count
+};
+
+// A registration (with its own execution profile) and the probes assigned to it.
+struct ReachWorker {
+    uint32_t Index;
+    QUIC_EXECUTION_PROFILE Profile;
+    MsQuicRegistration Registration;
+    MsQuicConfiguration Configuration;
+    std::unordered_map<std::string, std::unique_ptr<MsQuicConfiguration>> AlpnConfigurations;
+    ReachOptions Options;
+    ReachCounters<WorkerCounter> Counters;
+    ReachWorker(uint32_t Index, QUIC_EXECUTION_PROFILE Profile) :
+        Index(Index), Profile(Profile),
+        Registration("quicreach", Profile),
+        Configuration(Registration, Config.Alpn, Config.Settings, MsQuicCredentialConfig(Config.CredFlags)) {
+        if (Configuration.IsValid()) {
+            Configuration.SetVersionSettings(VersionSettings);
+            Configuration.SetVersionNegotiationExtEnabled();
+        }
+        Options.Registration = &Registration;
+        Options.Configuration = &Configuration;
+        Options.Port = Config.Port;
+        Options.RemoteAddress = Config.Address;
+        Options.SourceAddress = Config.SourceAddress;
+        Options.HedgeDelayMs = Config.HedgeDelay;
     }
-private:
-    void OnReachable() {
-        HandshakeComplete = true;
-        Results.ReachableCount++;
-        GetStatistics(&Stats);
-        QuicAddr RemoteAddr;
-        GetRemoteAddr(RemoteAddr);
-        uint32_t Version, VersionLength = sizeof(Version);
-        GetParam(QUIC_PARAM_CONN_QUIC_VERSION, &VersionLength, &Version);
-        auto HandshakeTime = (uint32_t)(Stats.TimingHandshakeFlightEnd - Stats.TimingStart);
-        auto InitialTime = (uint32_t)(Stats.TimingInitialFlightEnd - Stats.TimingStart);
-        auto Amplification = (double)Stats.RecvTotalBytes / (double)Stats.SendTotalBytes;
-        auto TooMuch = false, MultiRtt = false;
-        auto Retry = (bool)(Stats.StatelessRetry);
-        if (Stats.SendTotalPackets != 1) {
-            MultiRtt = true;
-            Results.MultiRttCount++;
-        } else {
-            TooMuch = Amplification > LOW_AMPLIFICATION_LIMIT;
-            if (TooMuch) {
-                Results.TooMuchCount++;
-                if (Amplification > HIGH_AMPLIFICATION_LIMIT) {
-                    Results.WayTooMuchCount++;
-                }
+    bool IsValid() const { return Registration.IsValid() && Configuration.IsValid(); }
+    // The configuration for an ALPN other than --alpn is created on first use
+    // and then shared by all targets with that ALPN (scheduling thread only).
+    // Returns null if it couldn't be created.
+    const MsQuicConfiguration* GetConfiguration(_In_ const std::string& Alpn) {
+        if (Alpn.empty()) return &Configuration;
+        auto& Entry = AlpnConfigurations[Alpn];
+        if (!Entry) {
+            Entry.reset(new(std::nothrow) MsQuicConfiguration(
+                Registration, MsQuicAlpn(Alpn.c_str()), Config.Settings, MsQuicCredentialConfig(Config.CredFlags)));
+            if (!Entry) return nullptr;
+            if (Entry->IsValid()) {
+                Entry->SetVersionSettings(VersionSettings);
+                Entry->SetVersionNegotiationExtEnabled();
+            } else {
+                printf("Configuration initialization failed for ALPN %s\n", Alpn.c_str());
             }
         }
-        if (Retry) {
-            Results.RetryCount++;
-        }
-        if (RemoteAddr.GetFamily() == QUIC_ADDRESS_FAMILY_INET6) {
-            Results.IPv6Count++;
-        }
-        if (Version == QUIC_VERSION_2) {
-            Results.Quicv2Count++;
-        }
-        if (Config.PrintStatistics){
-            const char HandshakeTags[3] = {
-                TooMuch ? '!' : (MultiRtt ? '*' : ' '),
-                Retry ? 'R' : ' ',
-                '\0'};
-            QUIC_ADDR_STR AddrStr;
-            QuicAddrToString(&RemoteAddr.SockAddr, &AddrStr);
-            std::unique_lock<std::mutex> lock(Results.Mutex);
-            printf("%30s   %3u.%03u ms   %3u.%03u ms   %3u.%03u ms   %u:%u %u:%u (%2.1fx)  %4u   %4u     %s   %20s   %s\n",
-                HostName,
-                Stats.Rtt / 1000, Stats.Rtt % 1000,
-                InitialTime / 1000, InitialTime % 1000,
-                HandshakeTime / 1000, HandshakeTime % 1000,
-                (uint32_t)Stats.SendTotalPackets,
-                (uint32_t)Stats.RecvTotalPackets,
-                (uint32_t)Stats.SendTotalBytes,
-                (uint32_t)Stats.RecvTotalBytes,
-                Amplification,
-                Stats.HandshakeClientFlight1Bytes,
-                Stats.HandshakeServerFlight1Bytes,
-                Version == QUIC_VERSION_1 ? "v1" : "v2",
-                AddrStr.Address,
-                HandshakeTags);
-        }
-    }
-    void OnUnreachable() {
-        if (Config.PrintStatistics) {
-            std::unique_lock<std::mutex> lock(Results.Mutex);
-            printf("%30s\n", HostName);
+        return Entry->IsValid() ? Entry.get() : nullptr;
+    }
+    void Print(uint64_t ElapsedUs) const {
+        auto Reachable = Counters.Get(WorkerCounter::Reachable);
+        auto AverageUs = Reachable ? (uint32_t)(Counters.Get(WorkerCounter::HandshakeTimeUs) / Reachable) : 0;
+        printf("%4llu/%llu domain(s) reachable on registration %u (%s), %4.1f handshake(s) per second, %u.%03u ms average TIME_H\n",
+            (unsigned long long)Reachable, (unsigned long long)Counters.Get(WorkerCounter::Total), Index, ProfileNames[Profile],
+            ElapsedUs ? (double)Reachable * 1000000.0 / (double)ElapsedUs : 0.0,
+            AverageUs / 1000, AverageUs % 1000);
+    }
+};
+
+// Starts --repeat rounds on a fixed cadence, anchored to the first round.
+struct ReachCadence {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point Next {Clock::now()};
+    uint32_t Round {0};
+    uint32_t Overruns {0};
+    uint64_t JitterTotalUs {0};
+    uint64_t JitterMaxUs {0};
+    void BeginRound() {
+        auto Late = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - Next).count();
+        auto LateUs = Late > 0 ? (uint64_t)Late : 0;
+        if (Round++) {
+            JitterTotalUs += LateUs;
+            if (LateUs > JitterMaxUs) JitterMaxUs = LateUs;
+        }
+        if (Config.PrintStatistics && Round > 1) {
+            auto AverageUs = JitterTotalUs / (Round - 1);
+            printf("\nRound %u started %u.%03u ms late (%u.%03u ms average, %u.%03u ms max), %u overrun(s)\n",
+                Round, (uint32_t)(LateUs / 1000), (uint32_t)(LateUs % 1000),
+                (uint32_t)(AverageUs / 1000), (uint32_t)(AverageUs % 1000),
+                (uint32_t)(JitterMaxUs / 1000), (uint32_t)(JitterMaxUs % 1000), Overruns);
+        }
+    }
+    void WaitForNextRound() {
+        auto Period = std::chrono::milliseconds(Config.Repeat);
+        Next += Period;
+        auto Now = Clock::now();
+        if (Now > Next) {
+            // The previous round ran past the start of this one (and maybe
+            // more). Either start late right away (overlap), with the cadence
+            // starting over from now so missed rounds aren't caught up on, or
+            // skip to the next slot in the cadence.
+            auto Missed = (Now - Next) / Period + 1;
+            Overruns += (uint32_t)Missed;
+            Next = Config.Overlap ? Now : Next + Missed * Period;
         }
+        Results.SleepUntil(Next);
     }
 };
 
+// Fixed-size result for one host, passed from the MsQuic worker threads to
+// the output writer thread. Only what's written out is kept: the --out-log
+// record (which the --out-hosts formats are made from too), and the race
+// times that --stats rows add.
+struct ReachRecord {
+    char HostName[256];
+    ReachLogRecord Log; // The host id is left to the writer
+    bool Raced {false};
+    ReachAttempt Attempts[2];
+    ReachRecord() = default;
+    ReachRecord(
+        _In_z_ const char* Name, uint64_t StartTimeUs, _In_ const ReachResolution& Resolution,
+        _In_ const ReachResult& Result, _In_ const QuicAddr& Address, bool TooMuch, bool MultiRtt
+        ) : Raced(Result.Raced) {
+        snprintf(HostName, sizeof(HostName), "%s", Name);
+        Attempts[0] = Result.Attempts[0];
+        Attempts[1] = Result.Attempts[1];
+        const auto& Stats = Result.Stats;
+        Log = {};
+        Log.StartTimeUs = StartTimeUs;
+        Log.ElapsedUs = (uint32_t)(ReachLogTimeUs() - StartTimeUs);
+        if (Resolution.Attempted && !Resolution.Resolved) Log.Result = ReachLogUnresolved;
+        else if (Result.Reachable) Log.Result = ReachLogReachable;
+        else if (Result.TimedOut) Log.Result = ReachLogTimeout;
+        else if (QUIC_FAILED(Result.Status)) Log.Result = ReachLogError;
+        else Log.Result = ReachLogUnreachable;
+        if (Resolution.Cached) Log.Resolution = ReachLogCached;
+        else if (Resolution.Mapped) Log.Resolution = ReachLogMapped;
+        else if (Resolution.Attempted) Log.Resolution = ReachLogLookup;
+        Log.ResolveUs = Resolution.TimeUs;
+        const auto& Probed = Result.Reachable ? Result.RemoteAddr : Address;
+        if (Probed.GetFamily() == QUIC_ADDRESS_FAMILY_INET) {
+            Log.Family = 4;
+            memcpy(Log.Address, &Probed.SockAddr.Ipv4.sin_addr, 4);
+        } else if (Probed.GetFamily() == QUIC_ADDRESS_FAMILY_INET6) {
+            Log.Family = 6;
+            memcpy(Log.Address, &Probed.SockAddr.Ipv6.sin6_addr, 16);
+        }
+        Log.Port = Log.Family ? Probed.GetPort() : 0;
+        Log.Status = (uint32_t)Result.Status;
+        if (Stats.StatelessRetry) Log.Flags |= ReachLogRetry;
+        if (MultiRtt) Log.Flags |= ReachLogMultiRtt;
+        if (TooMuch) Log.Flags |= ReachLogTooMuch;
+        if (Result.Hedged) Log.Flags |= ReachLogHedged;
+        if (Result.HedgeWon) Log.Flags |= ReachLogHedgeWon;
+        if (!Result.Reachable) return;
+        Log.Version = Result.Version;
+        Log.RttUs = Stats.Rtt;
+        Log.InitialUs = Result.InitialTime();
+        Log.HandshakeUs = Result.HandshakeTime();
+        Log.SendPackets = (uint32_t)Stats.SendTotalPackets;
+        Log.RecvPackets = (uint32_t)Stats.RecvTotalPackets;
+        Log.SendBytes = (uint32_t)Stats.SendTotalBytes;
+        Log.RecvBytes = (uint32_t)Stats.RecvTotalBytes;
+        Log.ClientFlight1 = Stats.HandshakeClientFlight1Bytes;
+        Log.ServerFlight1 = Stats.HandshakeServerFlight1Bytes;
+    }
+};
+
+// An attempt's TIME_H, or a lower bound on it if it was cancelled because the
+// other attempt won the race.
+void FormatRaceTime(_In_ const ReachAttempt& Attempt, _Out_writes_(Length) char* Buffer, _In_ size_t Length) {
+    if (!Attempt.Started) {
+        snprintf(Buffer, Length, "-");
+    } else if (Attempt.Connected || Attempt.Cancelled) {
+        snprintf(Buffer, Length, "%s%u.%03u ms", Attempt.Connected ? "" : ">", Attempt.TimeUs / 1000, Attempt.TimeUs % 1000);
+    } else {
+        snprintf(Buffer, Length, "failed");
+    }
+}
+
+size_t FormatStatsRow(_In_ const ReachRecord& Record, _Out_writes_(Length) char* Buffer, _In_ size_t Length) {
+    const auto& Log = Record.Log;
+    int Written;
+    char ResolveTime[32] = "         -   ";
+    if (Log.Resolution == ReachLogCached) {
+        snprintf(ResolveTime, sizeof(ResolveTime), "%13s", "cached");
+    } else if (Log.Resolution == ReachLogMapped) {
+        snprintf(ResolveTime, sizeof(ResolveTime), "%13s", "mapped");
+    } else if (Log.Resolution == ReachLogLookup) {
+        snprintf(ResolveTime, sizeof(ResolveTime), "   %3u.%03u ms", Log.ResolveUs / 1000, Log.ResolveUs % 1000);
+    }
+    char Address[64];
+    ReachLogFormatAddress(Log, Address, sizeof(Address));
+    if (Log.Result == ReachLogUnresolved) {
+        Written = snprintf(Buffer, Length, "%30s%s   (name resolution failed)\n", Record.HostName, ResolveTime);
+    } else if (Log.Result != ReachLogReachable && Config.FanOut) {
+        Written = snprintf(Buffer, Length, "%30s%s   (%s unreachable)\n", Record.HostName, ResolveTime, Address);
+    } else if (Log.Result != ReachLogReachable) {
+        Written = snprintf(Buffer, Length, "%30s\n", Record.HostName);
+    } else {
+        const char HandshakeTags[4] = {
+            (Log.Flags & ReachLogTooMuch) ? '!' : ((Log.Flags & ReachLogMultiRtt) ? '*' : ' '),
+            (Log.Flags & ReachLogRetry) ? 'R' : ' ',
+            (Log.Flags & ReachLogHedgeWon) ? 'H' : ' ',
+            '\0'};
+        char RaceTimes[64] = "";
+        if (Record.Raced) {
+            char Ipv6Time[24], Ipv4Time[24];
+            FormatRaceTime(Record.Attempts[0], Ipv6Time, sizeof(Ipv6Time));
+            FormatRaceTime(Record.Attempts[1], Ipv4Time, sizeof(Ipv4Time));
+            snprintf(RaceTimes, sizeof(RaceTimes), "   v6 %12s   v4 %12s", Ipv6Time, Ipv4Time);
+        }
+        Written = snprintf(Buffer, Length, "%30s%s   %3u.%03u ms   %3u.%03u ms   %3u.%03u ms   %u:%u %u:%u (%2.1fx)  %4u   %4u     %s   %20s   %s%s\n",
+            Record.HostName,
+            ResolveTime,
+            Log.RttUs / 1000, Log.RttUs % 1000,
+            Log.InitialUs / 1000, Log.InitialUs % 1000,
+            Log.HandshakeUs / 1000, Log.HandshakeUs % 1000,
+            Log.SendPackets,
+            Log.RecvPackets,
+            Log.SendBytes,
+            Log.RecvBytes,
+            (double)Log.RecvBytes / (double)Log.SendBytes,
+            Log.ClientFlight1,
+            Log.ServerFlight1,
+            Log.Version == QUIC_VERSION_1 ? "v1" : "v2",
+            Address,
+            HandshakeTags,
+            RaceTimes);
+    }
+    return Written < 0 ? 0 : ((size_t)Written < Length ? (size_t)Written : Length - 1);
+}
+
+size_t FormatHostCsv(_In_ const ReachRecord& Record, _Out_writes_(Length) char* Buffer, _In_ size_t Length) {
+    return ReachLogFormatCsv(Record.Log, Record.HostName, Buffer, Length);
+}
+
+size_t FormatHostJson(_In_ const ReachRecord& Record, _Out_writes_(Length) char* Buffer, _In_ size_t Length) {
+    return ReachLogFormatJson(Record.Log, Record.HostName, Buffer, Length);
+}
+
+// Host ids of --out-log (only used on the writer thread).
+ReachLogNames LogNames;
+
+size_t FormatLogRecord(_In_ const ReachRecord& Record, _Out_writes_(Length) char* Buffer, _In_ size_t Length) {
+    auto Log = Record.Log;
+    bool Added;
+    Log.HostId = LogNames.Find(Record.HostName, Added);
+    return ReachLogEncode(Log, Added ? Record.HostName : nullptr, Buffer, Length);
+}
+
+// Formats and writes per-host results, if they're printed at all.
+std::unique_ptr<ReachWriter<ReachRecord>> Writer;
+
+void OnReachable(_In_ ReachWorker& Worker, _In_z_ const char* HostName, _In_ const ReachResolution& Resolution, _In_ const ReachResult& Result, uint64_t StartTimeUs) {
+    Results.Add(ReachCounter::Reachable);
+    const auto& Stats = Result.Stats;
+    auto HandshakeTime = Result.HandshakeTime();
+    auto Amplification = Result.Amplification();
+    auto TooMuch = false, MultiRtt = false;
+    auto Retry = (bool)(Stats.StatelessRetry);
+    Worker.Counters.Add(WorkerCounter::Reachable);
+    Worker.Counters.Add(WorkerCounter::HandshakeTimeUs, HandshakeTime);
+    if (Config.Adaptive) {
+        Results.Controller.OnSample(false, HandshakeTime);
+    }
+    if (Stats.SendTotalPackets != 1) {
+        MultiRtt = true;
+        Results.Add(ReachCounter::MultiRtt);
+    } else {
+        TooMuch = Amplification > LOW_AMPLIFICATION_LIMIT;
+        if (TooMuch) {
+            Results.Add(ReachCounter::TooMuch);
+            if (Amplification > HIGH_AMPLIFICATION_LIMIT) {
+                Results.Add(ReachCounter::WayTooMuch);
+            }
+        }
+    }
+    if (Retry) {
+        Results.Add(ReachCounter::Retry);
+    }
+    if (Result.RemoteAddr.GetFamily() == QUIC_ADDRESS_FAMILY_INET6) {
+        Results.Add(ReachCounter::IPv6);
+    }
+    if (Result.Version == QUIC_VERSION_2) {
+        Results.Add(ReachCounter::Quicv2);
+    }
+    if (Result.HedgeWon) {
+        Results.Add(ReachCounter::HedgeWon);
+    }
+    if (Config.HedgeAuto) {
+        Results.HandshakeTimes.Add(HandshakeTime);
+    }
+    if (Writer) {
+        Writer->Push(ReachRecord(HostName, StartTimeUs, Resolution, Result, Result.RemoteAddr, TooMuch, MultiRtt));
+    }
+}
+
+void OnUnreachable(_In_z_ const char* HostName, _In_ const ReachResolution& Resolution, _In_ const ReachResult& Result, uint64_t StartTimeUs) {
+    if (Results.Cancelled) {
+        // Cancelled because of an earlier failure, so don't count as unreachable.
+        if (Writer) Writer->Unreserve();
+        return;
+    }
+    if (Config.FailFast) {
+        Results.Cancel();
+    }
+    if (Config.Adaptive && (!Resolution.Attempted || Resolution.Resolved)) {
+        Results.Controller.OnSample(Result.TimedOut, 0);
+    }
+    if (Writer) {
+        Writer->Push(ReachRecord(HostName, StartTimeUs, Resolution, Result, Resolution.Address(), false, false));
+    }
+}
+
+void OnRaced(_In_ const ReachResult& Result) {
+    Results.Add(ReachCounter::Raced);
+    if (Result.Reachable) {
+        Results.Add(Result.RemoteAddr.GetFamily() == QUIC_ADDRESS_FAMILY_INET6 ? ReachCounter::RaceIPv6Won : ReachCounter::RaceIPv4Won);
+    }
+    const auto& Ipv6 = Result.Attempts[0];
+    const auto& Ipv4 = Result.Attempts[1];
+    if (Ipv6.Connected && Ipv4.Connected) {
+        Results.Add(ReachCounter::RaceBoth);
+        if (Ipv6.TimeUs < Ipv4.TimeUs) Results.Add(ReachCounter::RaceIPv6Faster);
+    }
+}
+
+// Results per remote address, for --fan-out. Entries are only added (and
+// Hosts only updated) by the scheduling thread, while the counters of the
+// (node stable) entries are updated as probes complete.
+struct ReachAddressEntry {
+    QuicAddr Address;
+    uint32_t Hosts {0}; // Number of hosts that resolved to the address
+    std::atomic<uint32_t> Probes {0};
+    std::atomic<uint32_t> Reachable {0};
+    std::atomic<uint64_t> HandshakeTimeUs {0};
+    void Add(_In_ const ReachResult& Result) {
+        ++Probes;
+        if (Result.Reachable) {
+            ++Reachable;
+            HandshakeTimeUs += Result.HandshakeTime();
+        }
+    }
+};
+
+struct ReachAddressTable {
+    std::unordered_map<std::string, ReachAddressEntry> Entries;
+    uint64_t Skipped {0}; // Addresses not probed again for another host
+    // Returns the entry for the address (and the target's port and ALPN), and
+    // whether it was just added.
+    std::pair<ReachAddressEntry*, bool> Find(_In_ const QuicAddr& Address, _In_ const ReachTarget& Target) {
+        QuicAddr Endpoint = Address;
+        Endpoint.SetPort(Target.Port ? Target.Port : Config.Port);
+        QUIC_ADDR_STR AddrStr;
+        QuicAddrToString(&Endpoint.SockAddr, &AddrStr);
+        auto [It, Added] = Entries.try_emplace(Target.Alpn.empty() ? std::string(AddrStr.Address) : std::string(AddrStr.Address) + "/" + Target.Alpn);
+        It->second.Address = Address;
+        ++It->second.Hosts;
+        return {&It->second, Added};
+    }
+    // Prints the addresses with the most failures first, or only those with
+    // any failure at all, unless everything is to be printed.
+    void Print(bool All) const {
+        std::vector<std::pair<const std::string*, const ReachAddressEntry*>> Sorted;
+        for (const auto& [Key, Entry] : Entries) {
+            if (Entry.Probes && (All || Entry.Reachable < Entry.Probes)) Sorted.push_back({&Key, &Entry});
+        }
+        std::sort(Sorted.begin(), Sorted.end(), [](const auto& A, const auto& B) {
+            auto FailedA = A.second->Probes - A.second->Reachable, FailedB = B.second->Probes - B.second->Reachable;
+            return FailedA != FailedB ? FailedA > FailedB : *A.first < *B.first;
+        });
+        uint64_t Probes = 0;
+        for (const auto& [Key, Entry] : Entries) Probes += Entry.Probes;
+        printf("\n%4llu address(es) probed, %llu redundant probe(s) skipped, %llu address(es) with failures\n",
+            (unsigned long long)Probes, (unsigned long long)Skipped,
+            (unsigned long long)std::count_if(Entries.begin(), Entries.end(), [](const auto& Pair) { return Pair.second.Reachable < Pair.second.Probes; }));
+        if (Sorted.empty()) return;
+        printf("\n%46s    HOSTS   REACHABLE       TIME_H\n", "ADDRESS");
+        for (const auto& [Key, Entry] : Sorted) {
+            uint32_t Reachable = Entry->Reachable;
+            char HandshakeTime[32] = "         -  ";
+            if (Reachable) {
+                auto AverageUs = (uint32_t)(Entry->HandshakeTimeUs / Reachable);
+                snprintf(HandshakeTime, sizeof(HandshakeTime), "%3u.%03u ms", AverageUs / 1000, AverageUs % 1000);
+            }
+            printf("%46s   %6u   %5u/%-5u   %s\n", Key->c_str(), Entry->Hosts,
+                Reachable, (uint32_t)Entry->Probes, HandshakeTime);
+        }
+    }
+} AddressTable;
+
+// The options for a probe of the target on the given worker. The configuration
+// is null if the one for the target's ALPN failed to load.
+ReachOptions ProbeOptions(_In_ ReachWorker& Worker, _In_ const ReachTarget& Target) {
+    auto Options = Worker.Options;
+    if (Target.Port) Options.Port = Target.Port;
+    Options.Configuration = Worker.GetConfiguration(Target.Alpn);
+    if (Config.HedgeAuto) {
+        Options.HedgeDelayMs =
+            Results.HandshakeTimes.Total.load(std::memory_order_relaxed) >= HEDGE_MIN_SAMPLES ?
+                Results.HandshakeTimes.Quantile(0.95) / 1000 + 1 : Config.Timeout / 4;
+    }
+    return Options;
+}
+
+// Probes a single host and accounts for the result. Holds one active slot
+// until the probe completes, and (first) room in the output queue for its
+// result, so that it is the scheduling thread that waits on slow output.
+// The host name has already been resolved, unless MsQuic is to resolve it.
+ReachTask<> ProbeHost(ReachWorker& Worker, ReachTarget Target, ReachResolution Resolution, ReachAddressEntry* Entry = nullptr) {
+    if (Writer) Writer->Reserve();
+    Results.Add(ReachCounter::Total);
+    Worker.Counters.Add(WorkerCounter::Total);
+    Results.IncActive();
+    auto Options = ProbeOptions(Worker, Target);
+    auto Name = Target.Name();
+    auto StartTimeUs = ReachLogTimeUs();
+    ReachResult Result;
+    if (Resolution.Attempted) {
+        Results.Add(Resolution.Resolved ? ReachCounter::Resolved : ReachCounter::Unresolved);
+        Results.Add(ReachCounter::ResolveTimeUs, Resolution.TimeUs);
+        Options.RemoteAddress = Resolution.Address(); // The host name is still used for SNI
+    }
+    auto Ipv6 = Resolution.Find(QUIC_ADDRESS_FAMILY_INET6);
+    auto Ipv4 = Resolution.Find(QUIC_ADDRESS_FAMILY_INET);
+    auto Race = Config.Eyeballs && Ipv6 && Ipv4;
+    if (Race) {
+        // IPv6 first, then IPv4 after the delay (or as soon as IPv6 fails).
+        Options.RemoteAddress = *Ipv6;
+        Options.AlternateAddress = *Ipv4;
+        Options.HedgeDelayMs = Config.Eyeballs;
+    }
+    if (!Options.Configuration) {
+        Result.Status = QUIC_STATUS_INVALID_PARAMETER;
+    } else if (!Resolution.Attempted || Resolution.Resolved) {
+        Result = co_await Reach(Target.HostName.c_str(), Options);
+        if (Entry) Entry->Add(Result);
+    }
+    if (Race) {
+        Result.Raced = true;
+        Result.Hedged = Result.HedgeWon = false; // Not a hedge
+        OnRaced(Result);
+    } else if (Result.Hedged) {
+        Results.Add(ReachCounter::Hedged);
+    }
+    if (Result.Reachable) {
+        OnReachable(Worker, Name.c_str(), Resolution, Result, StartTimeUs);
+    } else {
+        OnUnreachable(Name.c_str(), Resolution, Result, StartTimeUs);
+    }
+    Results.DecActive();
+}
+
+// Probes another of the addresses of a host, for --fan-out. The result only
+// goes to the per-address table and the output, so that the per-host counts
+// stay those of the first address, as without --fan-out.
+ReachTask<> ProbeAddress(ReachWorker& Worker, ReachTarget Target, QuicAddr Address, ReachAddressEntry* Entry) {
+    if (Writer) Writer->Reserve();
+    Results.IncActive();
+    auto Options = ProbeOptions(Worker, Target);
+    Options.RemoteAddress = Address; // The host name is still used for SNI
+    auto StartTimeUs = ReachLogTimeUs();
+    ReachResult Result;
+    if (Options.Configuration) {
+        Result = co_await Reach(Target.HostName.c_str(), Options);
+    }
+    Entry->Add(Result);
+    if (Config.Adaptive && !Results.Cancelled) {
+        Results.Controller.OnSample(!Result.Reachable && Result.TimedOut, Result.Reachable ? Result.HandshakeTime() : 0);
+    }
+    if (Writer && Results.Cancelled && !Result.Reachable) {
+        Writer->Unreserve();
+    } else if (Writer) {
+        auto MultiRtt = Result.Stats.SendTotalPackets != 1;
+        auto TooMuch = !MultiRtt && Result.Amplification() > LOW_AMPLIFICATION_LIMIT;
+        Writer->Push(ReachRecord(Target.Name().c_str(), StartTimeUs, ReachResolution(), Result, Address, TooMuch, MultiRtt));
+    }
+    Results.DecActive();
+}
+
 void DumpResultsToFile() {
     FILE* File = fopen(Config.OutCsvFile, "wx"); // Try to create a new file
     if (!File) {
@@ -334,73 +1222,335 @@ void DumpResultsToFile() {
     gmtime_r(&Time, &Tm);
 #endif
     strftime(UtcDateTime, sizeof(UtcDateTime), "%Y.%m.%d-%H:%M:%S", &Tm);
-    fprintf(File, "%s,%u,%u,%u,%u,%u,%u,%u,%u\n", UtcDateTime,
-        Results.TotalCount.load(), Results.ReachableCount.load(), Results.TooMuchCount.load(), Results.MultiRttCount.load(),
-        Results.RetryCount.load(), Results.IPv6Count.load(), Results.Quicv2Count.load(), Results.WayTooMuchCount.load());
+    fprintf(File, "%s,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n", UtcDateTime,
+        (unsigned long long)Results.Get(ReachCounter::Total), (unsigned long long)Results.Get(ReachCounter::Reachable), (unsigned long long)Results.Get(ReachCounter::TooMuch), (unsigned long long)Results.Get(ReachCounter::MultiRtt),
+        (unsigned long long)Results.Get(ReachCounter::Retry), (unsigned long long)Results.Get(ReachCounter::IPv6), (unsigned long long)Results.Get(ReachCounter::Quicv2), (unsigned long long)Results.Get(ReachCounter::WayTooMuch));
     fclose(File);
     printf("\nOutput written to %s\n", Config.OutCsvFile);
 }
 
+size_t LookaheadDepth(_In_opt_ ReachResolver* Resolver) {
+    return Resolver ? Resolver->Concurrency() * RESOLVE_LOOKAHEAD : 1;
+}
+
+void PrintCacheUse(_In_z_ const char* Prefix, uint64_t Lookups, uint64_t Hits, uint64_t SavedUs) {
+    printf("%s%llu/%llu name(s) found in the DNS cache (%.1f%%), %llu.%03u ms of resolution saved\n",
+        Prefix, (unsigned long long)Hits, (unsigned long long)Lookups, Lookups ? 100.0 * (double)Hits / (double)Lookups : 0.0,
+        (unsigned long long)(SavedUs / 1000), (uint32_t)(SavedUs % 1000));
+}
+
+// Probes all hosts once, or in rounds on a fixed cadence with --repeat.
+void RunRounds(std::vector<std::unique_ptr<ReachWorker>>& Workers, ReachPacer* Pacer, ReachResolver* Resolver, ReachCachingResolver* Cache) {
+    ReachCadence Cadence;
+    do {
+        Cadence.BeginRound();
+        auto Lookups = Cache ? Cache->Lookups : 0;
+        auto Hits = Cache ? Cache->Hits : 0;
+        auto SavedUs = Cache ? Cache->SavedUs : 0;
+        ReachLookahead<std::pair<size_t, ReachTarget>> Lookahead(Resolver, LookaheadDepth(Resolver));
+        ReachInterleaver<std::tuple<size_t, ReachTarget, ReachResolution>> Resolved; // For --order prefix
+        ReachHostSource Source;
+        ReachTarget Next;
+        while (!Results.Cancelled) {
+            while (!Lookahead.Full() && Source.Get(Next)) {
+                Lookahead.Push({Source.Next - 1, Next}, Next.HostName.c_str(), Next.Port ? Next.Port : Config.Port);
+            }
+            size_t i;
+            ReachTarget Target;
+            ReachResolution Resolution;
+            if (Config.Order != ReachOrder::Prefix) {
+                if (Lookahead.Empty()) break;
+                std::tie(i, Target) = Lookahead.Front();
+                Resolution = Lookahead.Pop();
+            } else if (!Lookahead.Empty() && Resolved.Size() < ORDER_RESOLVED_WINDOW) {
+                // Resolved hosts are held back, and then taken round-robin
+                // across the prefixes of their addresses.
+                std::tie(i, Target) = Lookahead.Front();
+                Resolution = Lookahead.Pop();
+                auto Prefix = Resolution.Resolved ? ReachAddressPrefix(Resolution.Address()) : 0;
+                Resolved.Push(Prefix, {i, std::move(Target), Resolution});
+                continue;
+            } else if (Resolved.Empty()) {
+                break;
+            } else {
+                std::tie(i, Target, Resolution) = Resolved.Pop();
+            }
+            if (Pacer) Pacer->Wait();
+            if (Results.Cancelled) break;
+            auto& Worker = *Workers[i % Workers.size()];
+            if (!Config.FanOut) {
+                ProbeHost(Worker, Target, Resolution).Start();
+                Results.WaitForActiveCount();
+                continue;
+            }
+            // The first address is probed as usual (even if another host
+            // shares it, as the SNI differs), the others only if no other
+            // host has already had them probed.
+            ProbeHost(Worker, Target, Resolution,
+                Resolution.Resolved ? AddressTable.Find(Resolution.Address(), Target).first : nullptr).Start();
+            Results.WaitForActiveCount();
+            for (uint32_t j = 1; j < Resolution.AddressCount && !Results.Cancelled; ++j) {
+                auto [Entry, Added] = AddressTable.Find(Resolution.Addresses[j], Target);
+                if (!Added) { ++AddressTable.Skipped; continue; }
+                if (Pacer) Pacer->Wait();
+                if (Results.Cancelled) break;
+                ProbeAddress(Worker, Target, Resolution.Addresses[j], Entry).Start();
+                Results.WaitForActiveCount();
+            }
+        }
+
+        if (Cache && Config.Repeat && Config.PrintStatistics) {
+            char Prefix[32];
+            snprintf(Prefix, sizeof(Prefix), "Round %u: ", Cadence.Round);
+            PrintCacheUse(Prefix, Cache->Lookups - Lookups, Cache->Hits - Hits, Cache->SavedUs - SavedUs);
+        }
+
+        if (Cadence.Round == 1) {
+            Results.HostCount = Source.Next;
+            Results.Duplicates += Source.Duplicates;
+            Results.Invalid += Source.Invalid;
+        }
+
+        if (!Config.Repeat || !Config.Overlap) {
+            Results.WaitForAll();
+        }
+
+        if (Config.Repeat) {
+            Cadence.WaitForNextRound();
+        }
+
+    } while (Config.Repeat && !Results.Cancelled);
+}
+
+// Probes every host on its own interval, with the initial probes spread evenly
+// over the interval, so that the load is steady and samples are evenly spaced.
+void RunContinuous(std::vector<std::unique_ptr<ReachWorker>>& Workers, ReachPacer* Pacer, ReachResolver* Resolver) {
+    using Clock = std::chrono::steady_clock;
+    using Due = std::pair<Clock::time_point, size_t>;
+    std::priority_queue<Due, std::vector<Due>, std::greater<Due>> Queue;
+    auto GetInterval = [](const ReachTarget& Target) {
+        return std::chrono::milliseconds(Target.Interval ? Target.Interval : Config.Repeat);
+    };
+    Results.HostCount = Config.Targets.size();
+    auto Start = Clock::now();
+    for (size_t i = 0; i < Config.Targets.size(); ++i) {
+        Queue.push({Start + GetInterval(Config.Targets[i]) * i / Config.Targets.size(), i});
+    }
+    ReachLookahead<Due> Lookahead(Resolver, LookaheadDepth(Resolver));
+    while (!Results.Cancelled) {
+        while (!Lookahead.Full() &&
+               (Lookahead.Empty() || Queue.top().first <= Clock::now() + std::chrono::milliseconds(RESOLVE_HORIZON_MS))) {
+            auto Next = Queue.top();
+            Queue.pop();
+            const auto& Target = Config.Targets[Next.second];
+            Lookahead.Push(Next, Target.HostName.c_str(), Target.Port ? Target.Port : Config.Port);
+            Queue.push({Next.first + GetInterval(Config.Targets[Next.second]), Next.second});
+        }
+        auto Next = Lookahead.Front();
+        if (!Results.SleepUntil(Next.first)) break;
+        auto Resolution = Lookahead.Pop();
+        if (Pacer) Pacer->Wait();
+        if (Results.Cancelled) break;
+        ProbeHost(*Workers[Next.second % Workers.size()], Config.Targets[Next.second], Resolution).Start();
+        Results.WaitForActiveCount();
+    }
+}
+
+void PrintCounts(uint64_t Attempted) {
+    printf("\n");
+    printf("%4llu domain(s) attempted\n", (unsigned long long)Attempted);
+    printf("%4llu domain(s) reachable\n", (unsigned long long)Results.Get(ReachCounter::Reachable));
+    if (Results.Get(ReachCounter::MultiRtt))
+        printf("%4llu domain(s) required multiple round trips (*)\n", (unsigned long long)Results.Get(ReachCounter::MultiRtt));
+    if (Results.Get(ReachCounter::TooMuch))
+        printf("%4llu domain(s) exceeded amplification limits (!)\n", (unsigned long long)Results.Get(ReachCounter::TooMuch));
+    if (Results.Get(ReachCounter::WayTooMuch))
+        printf("%4llu domain(s) well exceeded amplification limits (5x)\n", (unsigned long long)Results.Get(ReachCounter::WayTooMuch));
+    if (Results.Get(ReachCounter::Retry))
+        printf("%4llu domain(s) sent RETRY packets (R)\n", (unsigned long long)Results.Get(ReachCounter::Retry));
+    if (Results.Get(ReachCounter::IPv6))
+        printf("%4llu domain(s) used IPv6\n", (unsigned long long)Results.Get(ReachCounter::IPv6));
+    if (Results.Get(ReachCounter::Quicv2))
+        printf("%4llu domain(s) used QUIC v2\n", (unsigned long long)Results.Get(ReachCounter::Quicv2));
+}
+
+// Sums the last row of each shard's CSV file, so that the combined counts are
+// the same as those of a single run over all the hostnames. Only the summary
+// counters are merged: per-host results (--out-hosts, --out-log) and timing
+// distributions aren't, and the counters not in the CSV stay zero.
+bool MergeResults() {
+    for (auto FileName : Config.MergeFiles) {
+        FILE* File = fopen(FileName, "r");
+        if (!File) { printf("Failed to open input file: %s\n", FileName); return false; }
+        char Line[512], Last[512] = "";
+        while (fgets(Line, sizeof(Line), File)) {
+            if (Line[0] != '\n' && Line[0] != '\r') strcpy(Last, Line);
+        }
+        fclose(File);
+        unsigned long long Total, Reachable, TooMuch, MultiRtt, Retry, IPv6, Quicv2, WayTooMuch;
+        if (sscanf(Last, "%*[^,],%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu",
+                &Total, &Reachable, &TooMuch, &MultiRtt, &Retry, &IPv6, &Quicv2, &WayTooMuch) != 8) {
+            printf("No results found in %s\n", FileName); return false;
+        }
+        Results.Add(ReachCounter::Total, Total);
+        Results.Add(ReachCounter::Reachable, Reachable);
+        Results.Add(ReachCounter::TooMuch, TooMuch);
+        Results.Add(ReachCounter::MultiRtt, MultiRtt);
+        Results.Add(ReachCounter::Retry, Retry);
+        Results.Add(ReachCounter::IPv6, IPv6);
+        Results.Add(ReachCounter::Quicv2, Quicv2);
+        Results.Add(ReachCounter::WayTooMuch, WayTooMuch);
+    }
+    PrintCounts(Results.Get(ReachCounter::Total));
+    if (Config.OutCsvFile) DumpResultsToFile();
+    return true;
+}
+
 // TODO:
 // - MsQuic should expose HRR flag for handshake?
 // - Figure out a way to fingerprint the server implementation?
 
 bool TestReachability() {
-    MsQuicRegistration Registration("quicreach");
-    MsQuicConfiguration Configuration(Registration, Config.Alpn, Config.Settings, MsQuicCredentialConfig(Config.CredFlags));
-    if (!Configuration.IsValid()) { printf("Configuration initializtion failed!\n"); return false; }
-    Configuration.SetVersionSettings(VersionSettings);
-    Configuration.SetVersionNegotiationExtEnabled();
+    std::vector<std::unique_ptr<ReachWorker>> Workers;
+    for (uint32_t i = 0; i < Config.Registrations; ++i) {
+        Workers.emplace_back(new ReachWorker(i, Config.Profiles[i % Config.Profiles.size()]));
+        if (!Workers.back()->IsValid()) { printf("Configuration initializtion failed!\n"); return false; }
+    }
+
+    std::unique_ptr<ReachTimer> Timer;
+    if (Config.HedgeDelay || Config.HedgeAuto || Config.Eyeballs) {
+        Timer.reset(new ReachTimer());
+        for (auto& Worker : Workers) Worker->Options.Timer = Timer.get();
+    }
 
     if (Config.PrintStatistics)
-        printf("%30s          RTT       TIME_I       TIME_H              SEND:RECV    C1     S1    VER                     IP\n", "SERVER");
+        printf("%30s       TIME_R          RTT       TIME_I       TIME_H              SEND:RECV    C1     S1    VER                     IP\n", "SERVER");
 
-    do {
-        for (auto HostName : Config.HostNames) {
-            new ReachConnection(Registration, Configuration, HostName);
-            Results.WaitForActiveCount();
+    FILE* HostsFile = nullptr;
+    if (Config.OutHostsFile) {
+        HostsFile = fopen(Config.OutHostsFile, "w");
+        if (!HostsFile) { printf("Failed to open output file: %s\n", Config.OutHostsFile); return false; }
+        if (!Config.OutHostsJson) fputs(ReachLogCsvHeader, HostsFile);
+    }
+    FILE* LogFile = nullptr;
+    if (Config.OutLogFile) {
+        LogFile = ReachLogOpen(Config.OutLogFile, LogNames);
+        if (!LogFile) { printf("Failed to open log file (or not a quicreach log): %s\n", Config.OutLogFile); return false; }
+    }
+
+    if (Config.PrintStatistics || HostsFile || LogFile) {
+        // Enough room for a result from every connection that can be active at once.
+        auto Window = Config.Adaptive ? ADAPTIVE_MAX_WINDOW : Config.Parallel;
+        Writer.reset(new ReachWriter<ReachRecord>(std::bit_ceil(std::max<size_t>(1024, 2 * (size_t)Window))));
+        if (Config.PrintStatistics) Writer->AddSink(stdout, FormatStatsRow);
+        if (HostsFile) Writer->AddSink(HostsFile, Config.OutHostsJson ? FormatHostJson : FormatHostCsv, OUTPUT_FLUSH_INTERVAL_MS);
+        if (LogFile) Writer->AddSink(LogFile, FormatLogRecord, OUTPUT_FLUSH_INTERVAL_MS);
+        Writer->Start();
+    }
+
+    std::unique_ptr<ReachResolver> Resolver;
+    ReachCachingResolver* Cache = nullptr;
+    ReachStaticResolver* Mappings = nullptr;
+    if (Config.Resolvers && Config.Address.GetFamily() == QUIC_ADDRESS_FAMILY_UNSPEC) {
+        // The (blocking) system resolver honors the hosts file, search domains
+        // and per-interface DNS, so queries only go straight to a DNS server
+        // when one is asked for.
+        std::unique_ptr<ReachResolver> Lookups;
+        if (Config.ConfDns && !ReachDnsResolver::GetSystemServer(Config.DnsServer)) {
+            printf("No DNS server found in resolv.conf\n"); return false;
         }
+        if (Config.DnsServer.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC) {
+            auto DnsResolver = new ReachDnsResolver(Config.DnsServer, Config.Resolvers);
+            Lookups.reset(DnsResolver);
+            if (!DnsResolver->IsValid()) { printf("DNS resolver initialization failed!\n"); return false; }
+        } else {
+            Lookups.reset(new ReachSystemResolver(Config.Resolvers));
+        }
+        Cache = new ReachCachingResolver(std::move(Lookups));
+        Resolver.reset(Cache);
+        if (Config.DnsCacheFile) Cache->Load(Config.DnsCacheFile); // May not exist yet
+        if (!Config.Mappings.empty() || Config.HostsFile) {
+            Mappings = new ReachStaticResolver(std::move(Resolver));
+            Resolver.reset(Mappings);
+            for (auto Mapping : Config.Mappings) {
+                if (!Mappings->AddMapping(Mapping)) { printf("Invalid host mapping: %s\n", Mapping); return false; }
+            }
+            if (Config.HostsFile && !Mappings->LoadHostsFile(Config.HostsFile)) {
+                printf("Failed to open hosts file: %s\n", Config.HostsFile); return false;
+            }
+        }
+    }
 
-        Results.WaitForAll();
+    auto StartTime = std::chrono::steady_clock::now();
+    std::unique_ptr<ReachPacer> Pacer;
+    if (Config.Rate) Pacer.reset(new ReachPacer());
 
-        if (Config.Repeat) {
-#ifdef _WIN32
-            Sleep(Config.Repeat);
-#else
-            usleep(Config.Repeat * 1000);
-#endif
+    if (Config.Continuous) {
+        RunContinuous(Workers, Pacer.get(), Resolver.get());
+    } else {
+        RunRounds(Workers, Pacer.get(), Resolver.get(), Cache);
+    }
+
+    if (Results.Cancelled) {
+        // Abort everything still in flight, without waiting on the peers.
+        for (auto& Worker : Workers) {
+            Worker->Registration.Shutdown(QUIC_CONNECTION_SHUTDOWN_FLAG_SILENT, 0);
         }
+        Results.WaitForDrain();
+    }
 
-    } while (Config.Repeat);
+    if (Writer) Writer->Stop(); // Flush all results before the summary
+    if (HostsFile) fclose(HostsFile);
+    if (LogFile) fclose(LogFile);
 
     if (Config.PrintStatistics) {
-        if (Results.ReachableCount > 1) {
-            printf("\n");
-            printf("%4u domain(s) attempted\n", (uint32_t)Config.HostNames.size());
-            printf("%4u domain(s) reachable\n", Results.ReachableCount.load());
-            if (Results.MultiRttCount)
-                printf("%4u domain(s) required multiple round trips (*)\n", Results.MultiRttCount.load());
-            if (Results.TooMuchCount)
-                printf("%4u domain(s) exceeded amplification limits (!)\n", Results.TooMuchCount.load());
-            if (Results.WayTooMuchCount)
-                printf("%4u domain(s) well exceeded amplification limits (5x)\n", Results.WayTooMuchCount.load());
-            if (Results.RetryCount)
-                printf("%4u domain(s) sent RETRY packets (R)\n", Results.RetryCount.load());
-            if (Results.IPv6Count)
-                printf("%4u domain(s) used IPv6\n", Results.IPv6Count.load());
-            if (Results.Quicv2Count)
-                printf("%4u domain(s) used QUIC v2\n", Results.Quicv2Count.load());
+        if (Results.Get(ReachCounter::Reachable) > 1) {
+            PrintCounts(Results.HostCount);
+            if (Results.Duplicates || Results.Invalid)
+                printf("%4llu duplicate and %llu invalid hostname(s) skipped\n", (unsigned long long)Results.Duplicates, (unsigned long long)Results.Invalid);
+            auto Lookups = Results.Get(ReachCounter::Resolved) + Results.Get(ReachCounter::Unresolved);
+            if (Lookups) {
+                auto AverageUs = (uint32_t)(Results.Get(ReachCounter::ResolveTimeUs) / Lookups);
+                printf("%4llu domain(s) failed name resolution, %u.%03u ms average TIME_R\n",
+                    (unsigned long long)Results.Get(ReachCounter::Unresolved), AverageUs / 1000, AverageUs % 1000);
+                if (Mappings)
+                    printf("%4llu name(s) mapped by --resolve or --hosts\n", (unsigned long long)Mappings->Mapped);
+                PrintCacheUse("   ", Cache->Lookups, Cache->Hits, Cache->SavedUs);
+            }
+            if (Results.Get(ReachCounter::Raced))
+                printf("%4llu domain(s) raced IPv6 against IPv4, won by IPv6 %llu and IPv4 %llu time(s), IPv6 faster in %llu of %llu where both connected\n",
+                    (unsigned long long)Results.Get(ReachCounter::Raced), (unsigned long long)Results.Get(ReachCounter::RaceIPv6Won),
+                    (unsigned long long)Results.Get(ReachCounter::RaceIPv4Won), (unsigned long long)Results.Get(ReachCounter::RaceIPv6Faster),
+                    (unsigned long long)Results.Get(ReachCounter::RaceBoth));
+            if (Results.Get(ReachCounter::Hedged))
+                printf("%4llu domain(s) needed a hedged attempt, %llu won by the hedge (H)\n", (unsigned long long)Results.Get(ReachCounter::Hedged), (unsigned long long)Results.Get(ReachCounter::HedgeWon));
+            auto ElapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - StartTime).count();
+            printf("%4.1f handshake(s) per second, %llu scheduler wake up(s)\n",
+                ElapsedUs ? (double)(unsigned long long)Results.Get(ReachCounter::Reachable) * 1000000.0 / (double)ElapsedUs : 0.0,
+                (unsigned long long)Results.Gate.WakeupCount);
+            if (Pacer) Pacer->Print();
+            if (Config.Adaptive)
+                printf("%4u parallel connection(s) at the end of the run\n", Results.Controller.Window);
+            if (Workers.size() > 1)
+                for (const auto& Worker : Workers) Worker->Print((uint64_t)ElapsedUs);
         }
     }
 
+    if (Config.FanOut) AddressTable.Print(Config.PrintStatistics);
+
     if (Config.OutCsvFile) DumpResultsToFile();
+    if (Cache && Config.DnsCacheFile && !Cache->Save(Config.DnsCacheFile)) {
+        printf("Failed to write DNS cache file: %s\n", Config.DnsCacheFile);
+    }
 
-    return Config.RequireAll ? ((size_t)Results.ReachableCount == Config.HostNames.size()) : (Results.ReachableCount != 0);
+    return Config.RequireAll ? (Results.Get(ReachCounter::Reachable) == Results.HostCount) : (Results.Get(ReachCounter::Reachable) != 0);
 }
 
 int QUIC_CALL main(int argc, char **argv) {
 
-    if (!ParseConfig(argc, argv) || Config.HostNames.empty()) return 1;
+    if (!ParseConfig(argc, argv)) return 1;
+    if (Config.Merge) return MergeResults() ? 0 : 1;
+    if (Config.Targets.empty() && Config.TopBegin == Config.TopEnd && !Config.Input) return 1;
 
     MsQuic = new (std::nothrow) MsQuicApi();
     if (QUIC_FAILED(MsQuic->GetInitStatus())) {
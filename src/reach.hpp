@@ -0,0 +1,430 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    C++20 coroutine API for QUIC reachability probes. A probe is started with
+    'co_await Reach(HostName, Options)' and the awaiting coroutine is resumed
+    on the MsQuic worker thread that completes the connection, so no thread is
+    ever blocked waiting on a probe.
+
+--*/
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <msquic.hpp>
+
+// Runs callbacks at a given time on a dedicated thread. Can also be awaited
+// directly, to delay a coroutine without blocking a thread.
+class ReachTimer {
+public:
+    using Clock = std::chrono::steady_clock;
+    ReachTimer() : Thread([this]() { Run(); }) { }
+    ~ReachTimer() {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Stopping = true;
+        }
+        Event.notify_one();
+        Thread.join();
+    }
+    void Schedule(Clock::time_point Time, std::function<void()> Callback) {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Queue.push({Time, NextSequence++, std::move(Callback)});
+        }
+        Event.notify_one();
+    }
+    struct DelayAwaiter {
+        ReachTimer& Timer;
+        Clock::duration Delay;
+        bool await_ready() const noexcept { return Delay <= Clock::duration::zero(); }
+        void await_suspend(std::coroutine_handle<> Continuation) {
+            Timer.Schedule(Clock::now() + Delay, [Continuation]() { Continuation.resume(); });
+        }
+        void await_resume() const noexcept { }
+    };
+    DelayAwaiter Delay(Clock::duration Delay) { return {*this, Delay}; }
+private:
+    struct Entry {
+        Clock::time_point Time;
+        uint64_t Sequence;
+        std::function<void()> Callback;
+        bool operator>(const Entry& Other) const {
+            return Time != Other.Time ? Time > Other.Time : Sequence > Other.Sequence;
+        }
+    };
+    void Run() {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        while (true) {
+            if (Queue.empty()) {
+                if (Stopping) break;
+                Event.wait(Lock);
+                continue;
+            }
+            // Once stopping, everything left runs right away.
+            if (!Stopping && Event.wait_until(Lock, Queue.top().Time) != std::cv_status::timeout) continue;
+            if (!Stopping && Queue.top().Time > Clock::now()) continue;
+            auto Callback = Queue.top().Callback;
+            Queue.pop();
+            Lock.unlock();
+            Callback();
+            Lock.lock();
+        }
+    }
+    std::mutex Mutex;
+    std::condition_variable Event;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> Queue;
+    uint64_t NextSequence {0};
+    bool Stopping {false};
+    std::thread Thread;
+};
+
+// Per-probe options.
+struct ReachOptions {
+    const MsQuicRegistration* Registration {nullptr};
+    const MsQuicConfiguration* Configuration {nullptr};
+    uint16_t Port {443};
+    QuicAddr RemoteAddress;  // Optional, bypasses name resolution of the host name (still used for SNI)
+    QuicAddr SourceAddress;  // Optional
+    ReachTimer* Timer {nullptr};
+    uint32_t HedgeDelayMs {0}; // If set (requires Timer), start a second attempt if the first hasn't connected by then
+    QuicAddr AlternateAddress; // Optional (requires Timer), used by the second attempt, which then also starts as soon as the first fails
+};
+
+// Timing of one attempt of a probe.
+struct ReachAttempt {
+    bool Started {false};
+    bool Connected {false};
+    bool Cancelled {false}; // Shut down because the other attempt connected first
+    QUIC_ADDRESS_FAMILY Family {QUIC_ADDRESS_FAMILY_UNSPEC}; // Unspecified if the address was left to MsQuic
+    uint32_t StartUs {0};   // Relative to the start of the probe
+    uint32_t TimeUs {0};    // TIME_H if connected, otherwise how long it ran until it failed or was cancelled
+};
+
+// The outcome of a single probe.
+struct ReachResult {
+    bool Reachable {false};
+    bool TimedOut {false};
+    bool Hedged {false};   // A second (hedge) attempt was started
+    bool HedgeWon {false}; // The hedge attempt connected first
+    bool Raced {false};    // The attempts raced IPv6 against IPv4 (set by the caller)
+    ReachAttempt Attempts[2];
+    QUIC_STATUS Status {QUIC_STATUS_SUCCESS}; // Set if the connection could not be started
+    uint32_t Version {0};
+    QuicAddr RemoteAddr;
+    QUIC_STATISTICS_V2 Stats {};
+    uint32_t HandshakeTime() const { return (uint32_t)(Stats.TimingHandshakeFlightEnd - Stats.TimingStart); }
+    uint32_t InitialTime() const { return (uint32_t)(Stats.TimingInitialFlightEnd - Stats.TimingStart); }
+    double Amplification() const { return (double)Stats.RecvTotalBytes / (double)Stats.SendTotalBytes; }
+};
+
+struct ReachProbe;
+
+// A self-deleting connection for one attempt of a probe.
+struct ReachConnection : public MsQuicConnection {
+    ReachProbe* Probe;
+    uint32_t Attempt;
+    ReachResult* Result;
+    ReachConnection(
+        _In_ ReachProbe* Probe,
+        _In_ uint32_t Attempt,
+        _In_ ReachResult* Result,
+        _In_ const ReachOptions& Options
+    ) : MsQuicConnection(*Options.Registration, CleanUpAutoDelete, Callback), Probe(Probe), Attempt(Attempt), Result(Result) {
+        if (IsValid() && Options.RemoteAddress.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC) {
+            InitStatus = SetRemoteAddr(Options.RemoteAddress);
+        }
+        if (IsValid() && Options.SourceAddress.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC) {
+            InitStatus = SetLocalAddr(Options.SourceAddress);
+        }
+    }
+    static QUIC_STATUS QUIC_API Callback(
+        _In_ MsQuicConnection* _Connection,
+        _In_opt_ void* ,
+        _Inout_ QUIC_CONNECTION_EVENT* Event
+        ) noexcept;
+private:
+    void OnConnected() {
+        Result->Reachable = true;
+        GetStatistics(&Result->Stats);
+        GetRemoteAddr(Result->RemoteAddr);
+        uint32_t VersionLength = sizeof(Result->Version);
+        GetParam(QUIC_PARAM_CONN_QUIC_VERSION, &VersionLength, &Result->Version);
+    }
+};
+
+// Shared state for the attempts of a single probe. The awaiting coroutine is
+// resumed once every attempt that was started has completed; the first
+// attempt to connect is the result, and cancels the others.
+struct ReachProbe {
+    static constexpr uint32_t MaxAttempts = 2;
+    const char* HostName;
+    ReachOptions Options;
+    ReachResult* Out;
+    std::coroutine_handle<> Continuation;
+    std::atomic<uint32_t> RefCount {1};
+    std::mutex Mutex;
+    ReachConnection* Attempts[MaxAttempts] {};
+    ReachResult Results[MaxAttempts];
+    ReachTimer::Clock::time_point StartTimes[MaxAttempts];
+    ReachTimer::Clock::time_point EndTimes[MaxAttempts];
+    bool Cancelled[MaxAttempts] {};
+    uint32_t Started {0};
+    uint32_t Outstanding {0};
+    int32_t Winner {-1};
+    bool SecondClaimed {false};
+    bool Finished {false};
+
+    ReachProbe(const char* HostName, const ReachOptions& Options, ReachResult* Out, std::coroutine_handle<> Continuation) :
+        HostName(HostName), Options(Options), Out(Out), Continuation(Continuation) { }
+    void Release() { if (--RefCount == 0) delete this; }
+
+    bool HasAlternate() const { return Options.AlternateAddress.GetFamily() != QUIC_ADDRESS_FAMILY_UNSPEC; }
+
+    // Creates and starts the first attempt, returning false if it failed.
+    bool Start() {
+        auto Connection = new(std::nothrow) ReachConnection(this, 0, &Results[0], Options);
+        if (!Connection) { Out->Status = QUIC_STATUS_OUT_OF_MEMORY; return false; }
+        std::unique_lock<std::mutex> Lock(Mutex);
+        if (!StartAttempt(Connection)) {
+            Finished = true;
+            Out->Status = Connection->GetInitStatus();
+            Lock.unlock();
+            delete Connection; // No shutdown complete is delivered to an app-closed connection
+            return false;
+        }
+        // Only hedge an attempt that actually started. The lock keeps it from
+        // completing (and releasing the probe) before the timer holds a reference.
+        if (Options.Timer && Options.HedgeDelayMs) {
+            ++RefCount;
+            Options.Timer->Schedule(
+                ReachTimer::Clock::now() + std::chrono::milliseconds(Options.HedgeDelayMs),
+                [this]() { StartSecondAttempt(); Release(); });
+        }
+        return true;
+    }
+
+    // Called with the lock held.
+    bool StartAttempt(ReachConnection* Connection) {
+        if (Connection->IsValid()) {
+            Connection->InitStatus = Connection->Start(*Options.Configuration, HostName, Options.Port);
+        }
+        if (!Connection->IsValid()) return false;
+        Attempts[Connection->Attempt] = Connection;
+        StartTimes[Connection->Attempt] = ReachTimer::Clock::now();
+        ++Started;
+        ++Outstanding;
+        return true;
+    }
+
+    // Starts the second attempt (on the alternate address, if any), unless
+    // the probe has already been decided or the attempt was already started.
+    // Only called on the timer thread (from the hedge timer, or right after
+    // the first attempt failed), never from a connection callback.
+    void StartSecondAttempt() {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (Finished || Winner >= 0 || SecondClaimed) return;
+            SecondClaimed = true;
+            ++Outstanding; // Keeps the probe from completing until the attempt is started
+        }
+        // Connection creation blocks on the worker threads, so it must not
+        // happen under the lock.
+        auto AttemptOptions = Options;
+        if (HasAlternate()) AttemptOptions.RemoteAddress = Options.AlternateAddress;
+        auto Connection = new(std::nothrow) ReachConnection(this, 1, &Results[1], AttemptOptions);
+        bool Complete = false;
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            --Outstanding;
+            if (Connection && Winner < 0 && StartAttempt(Connection)) {
+                Connection = nullptr;
+            } else if (Outstanding == 0) {
+                Finished = true;
+                Complete = true;
+            }
+        }
+        delete Connection; // Not started (app-closed connections don't get shutdown complete)
+        if (Complete) OnComplete();
+    }
+
+    void OnConnected(ReachConnection* Connection) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        if (Winner >= 0) return;
+        Winner = (int32_t)Connection->Attempt;
+        for (auto Other : Attempts) {
+            if (Other && Other != Connection) {
+                Cancelled[Other->Attempt] = true;
+                Other->Shutdown(0, QUIC_CONNECTION_SHUTDOWN_FLAG_SILENT);
+            }
+        }
+    }
+
+    void OnShutdownComplete(ReachConnection* Connection) {
+        bool Failover;
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Attempts[Connection->Attempt] = nullptr;
+            EndTimes[Connection->Attempt] = ReachTimer::Clock::now();
+            if (--Outstanding != 0) return;
+            // Nothing connected, but there's another address to try.
+            Failover = Winner < 0 && !SecondClaimed && HasAlternate() && Options.Timer;
+            if (!Failover) Finished = true;
+        }
+        if (Failover) {
+            // Opening a connection blocks on the worker threads, so it can't
+            // be done from this callback; the timer thread does it instead.
+            ++RefCount;
+            Options.Timer->Schedule(ReachTimer::Clock::now(), [this]() { StartSecondAttempt(); Release(); });
+        } else {
+            OnComplete();
+        }
+    }
+
+    void OnComplete() {
+        *Out = Results[Winner >= 0 ? Winner : 0];
+        Out->Hedged = Started > 1;
+        Out->HedgeWon = Winner > 0;
+        for (uint32_t i = 0; i < Started; ++i) {
+            auto& Attempt = Out->Attempts[i];
+            Attempt.Started = true;
+            Attempt.Connected = Results[i].Reachable;
+            Attempt.Cancelled = Cancelled[i] && !Attempt.Connected;
+            Attempt.Family = (i == 1 && HasAlternate() ? Options.AlternateAddress : Options.RemoteAddress).GetFamily();
+            Attempt.StartUs = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(StartTimes[i] - StartTimes[0]).count();
+            Attempt.TimeUs = Attempt.Connected ? Results[i].HandshakeTime() :
+                (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(EndTimes[i] - StartTimes[i]).count();
+        }
+        Continuation.resume();
+        Release();
+    }
+};
+
+inline QUIC_STATUS QUIC_API ReachConnection::Callback(
+    _In_ MsQuicConnection* _Connection,
+    _In_opt_ void* ,
+    _Inout_ QUIC_CONNECTION_EVENT* Event
+    ) noexcept {
+    auto Connection = (ReachConnection*)_Connection;
+    if (Event->Type == QUIC_CONNECTION_EVENT_CONNECTED) {
+        Connection->OnConnected();
+        Connection->Probe->OnConnected(Connection);
+        Connection->Shutdown(0);
+    } else if (Event->Type == QUIC_CONNECTION_EVENT_SHUTDOWN_INITIATED_BY_TRANSPORT) {
+        Connection->Result->TimedOut = Event->SHUTDOWN_INITIATED_BY_TRANSPORT.Status == QUIC_STATUS_CONNECTION_IDLE;
+    } else if (Event->Type == QUIC_CONNECTION_EVENT_SHUTDOWN_COMPLETE) {
+        if (!Event->SHUTDOWN_COMPLETE.AppCloseInProgress) {
+            Connection->Probe->OnShutdownComplete(Connection); // The connection is deleted once this returns
+        }
+    } else if (Event->Type == QUIC_CONNECTION_EVENT_PEER_STREAM_STARTED) {
+        MsQuic->StreamClose(Event->PEER_STREAM_STARTED.Stream); // Shouldn't do this
+    }
+    return QUIC_STATUS_SUCCESS;
+}
+
+// Awaitable returned by Reach().
+struct ReachAwaiter {
+    const char* HostName;
+    ReachOptions Options;
+    ReachResult Result;
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> Continuation) noexcept {
+        auto Probe = new(std::nothrow) ReachProbe(HostName, Options, &Result, Continuation);
+        if (!Probe) {
+            Result.Status = QUIC_STATUS_OUT_OF_MEMORY;
+            return false;
+        }
+        if (!Probe->Start()) {
+            Probe->Release();
+            return false;
+        }
+        // The probe may already have completed (and resumed the awaiting
+        // coroutine on another thread), so 'this' may not be touched past
+        // this point.
+        return true;
+    }
+    ReachResult await_resume() noexcept { return std::move(Result); }
+};
+
+inline ReachAwaiter Reach(_In_z_ const char* HostName, _In_ const ReachOptions& Options) {
+    return ReachAwaiter{HostName, Options, {}};
+}
+
+template<typename T>
+struct ReachTaskValue {
+    std::optional<T> Value;
+    template<typename U> void return_value(U&& NewValue) { Value.emplace(std::forward<U>(NewValue)); }
+    T Take() { return std::move(*Value); }
+};
+
+template<>
+struct ReachTaskValue<void> {
+    void return_void() noexcept { }
+    void Take() noexcept { }
+};
+
+// A lazily started coroutine. It can either be awaited by another coroutine,
+// which resumes when it completes, or started detached with Start(), in which
+// case it cleans itself up when it completes.
+template<typename T = void>
+class ReachTask {
+public:
+    struct promise_type : ReachTaskValue<T> {
+        std::coroutine_handle<> Continuation;
+        bool Detached {false};
+        ReachTask get_return_object() noexcept { return ReachTask(Handle::from_promise(*this)); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> Self) noexcept {
+                auto& Promise = Self.promise();
+                if (Promise.Continuation) return Promise.Continuation;
+                if (Promise.Detached) Self.destroy();
+                return std::noop_coroutine();
+            }
+            void await_resume() const noexcept { }
+        };
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+    using Handle = std::coroutine_handle<promise_type>;
+
+    ReachTask(ReachTask&& Other) noexcept : Coroutine(std::exchange(Other.Coroutine, nullptr)) { }
+    ReachTask(const ReachTask&) = delete;
+    ReachTask& operator=(const ReachTask&) = delete;
+    ~ReachTask() { if (Coroutine) Coroutine.destroy(); }
+
+    // Runs the coroutine (on this thread until its first suspension) without
+    // anything awaiting it.
+    void Start() && {
+        auto Self = std::exchange(Coroutine, nullptr);
+        Self.promise().Detached = true;
+        Self.resume();
+    }
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> Continuation) noexcept {
+        Coroutine.promise().Continuation = Continuation;
+        return Coroutine;
+    }
+    T await_resume() { return Coroutine.promise().Take(); }
+
+private:
+    explicit ReachTask(Handle Coroutine) noexcept : Coroutine(Coroutine) { }
+    Handle Coroutine;
+};
@@ -0,0 +1,311 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Binary per-probe record log (--out-log), and the per-host CSV and JSON
+    Lines formats shared by --out-hosts and quicreach-convert.
+
+    A log is a ReachLogHeader followed by entries, appended as probes complete.
+    Each entry is a ReachLogEntry followed by Length bytes: either a host name
+    (the first time its host id is used) or a fixed-size ReachLogRecord. Values
+    are little-endian. Readers take the record size from each entry, so records
+    may grow new fields at the end without a new version.
+
+--*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#endif
+
+#define REACHLOG_VERSION            1
+
+const char ReachLogMagic[8] = {'Q', 'R', 'E', 'A', 'C', 'H', 'L', 'G'};
+
+struct ReachLogHeader {
+    char Magic[8];
+    uint32_t Version;
+    uint32_t Reserved;
+};
+
+enum ReachLogEntryType : uint16_t {
+    ReachLogEntryName = 1,   // A uint32_t host id, then the host name (not terminated)
+    ReachLogEntryRecord = 2, // A ReachLogRecord
+};
+
+struct ReachLogEntry {
+    uint16_t Type;
+    uint16_t Length;
+};
+
+enum ReachLogResult : uint8_t {
+    ReachLogReachable, ReachLogTimeout, ReachLogUnresolved, ReachLogError, ReachLogUnreachable,
+};
+const char* const ReachLogResultNames[] = {"reachable", "timeout", "unresolved", "error", "unreachable"};
+
+enum ReachLogResolution : uint8_t {
+    ReachLogNoLookup,        // Resolved by MsQuic, or an --ip address
+    ReachLogLookup, ReachLogCached, ReachLogMapped,
+};
+const char* const ReachLogResolutionNames[] = {"", "lookup", "cached", "mapped"};
+
+enum ReachLogFlag : uint16_t {
+    ReachLogRetry = 0x1, ReachLogMultiRtt = 0x2, ReachLogTooMuch = 0x4, ReachLogHedged = 0x8, ReachLogHedgeWon = 0x10,
+};
+
+// The result of one probe. The connection statistics are zero unless reachable.
+struct ReachLogRecord {
+    uint64_t StartTimeUs;   // Unix time the probe started
+    uint32_t ElapsedUs;     // Until its result
+    uint32_t HostId;
+    uint8_t Address[16];    // IPv4 addresses use the first 4 bytes
+    uint16_t Port;
+    uint8_t Family;         // 4, 6 or 0 (no address)
+    uint8_t Result;         // ReachLogResult
+    uint8_t Resolution;     // ReachLogResolution
+    uint8_t Reserved;
+    uint16_t Flags;         // ReachLogFlag
+    uint32_t Status;        // Why the connection couldn't be started, if it couldn't
+    uint32_t Version;       // QUIC version
+    uint32_t ResolveUs;
+    uint32_t RttUs;
+    uint32_t InitialUs;
+    uint32_t HandshakeUs;
+    uint32_t SendPackets;
+    uint32_t RecvPackets;
+    uint32_t SendBytes;
+    uint32_t RecvBytes;
+    uint32_t ClientFlight1;
+    uint32_t ServerFlight1;
+};
+static_assert(sizeof(ReachLogRecord) == 88, "The record layout is part of the file format");
+
+inline uint64_t ReachLogTimeUs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Reads the entries of a log, in order. A truncated last entry (from a run that
+// was killed mid-write) ends the log, at Offset.
+class ReachLogReader {
+public:
+    uint64_t Offset {0}; // End of the last complete entry
+    uint32_t HostId {0};
+    std::string Name;
+    ReachLogRecord Record {};
+    ReachLogReader(const char* FileName) {
+        File = fopen(FileName, "rb");
+        ReachLogHeader Header;
+        if (!File || fread(&Header, sizeof(Header), 1, File) != 1 ||
+            memcmp(Header.Magic, ReachLogMagic, sizeof(ReachLogMagic)) || Header.Version != REACHLOG_VERSION) {
+            return;
+        }
+        Offset = sizeof(Header);
+        Valid = true;
+    }
+    ~ReachLogReader() { if (File) fclose(File); }
+    bool IsValid() const { return Valid; }
+    // Returns the type of the next entry, after reading it into Name or
+    // Record, or 0 at the end of the log. Unknown entry types are skipped.
+    uint16_t Next() {
+        ReachLogEntry Entry;
+        while (Valid && fread(&Entry, sizeof(Entry), 1, File) == 1) {
+            if (fread(Payload, 1, Entry.Length, File) != Entry.Length) break;
+            Offset += sizeof(Entry) + Entry.Length;
+            if (Entry.Type == ReachLogEntryName && Entry.Length >= sizeof(HostId)) {
+                memcpy(&HostId, Payload, sizeof(HostId));
+                Name.assign(Payload + sizeof(HostId), Entry.Length - sizeof(HostId));
+                return Entry.Type;
+            }
+            if (Entry.Type == ReachLogEntryRecord) {
+                Record = {};
+                memcpy(&Record, Payload, Entry.Length < sizeof(Record) ? Entry.Length : sizeof(Record));
+                return Entry.Type;
+            }
+        }
+        return 0;
+    }
+private:
+    FILE* File {nullptr};
+    bool Valid {false};
+    char Payload[UINT16_MAX];
+};
+
+// Assigns host ids, which are written to the log, with the host name, the
+// first time they're used. Only the (case sensitive FNV-1a) hashes of the
+// names are kept, as in ReachHostSet.
+class ReachLogNames {
+public:
+    // Returns the id of a host name, and whether it is new.
+    uint32_t Find(const char* Name, bool& Added) {
+        auto [Entry, Inserted] = Ids.try_emplace(Hash(Name), NextId);
+        if ((Added = Inserted)) ++NextId;
+        return Entry->second;
+    }
+    void Load(uint32_t Id, const std::string& Name) {
+        Ids[Hash(Name.c_str())] = Id;
+        if (Id >= NextId) NextId = Id + 1;
+    }
+private:
+    static uint64_t Hash(const char* Name) {
+        uint64_t Hash = 0xcbf29ce484222325ull;
+        for (; *Name; ++Name) {
+            Hash ^= (uint8_t)*Name;
+            Hash *= 0x100000001b3ull;
+        }
+        return Hash;
+    }
+    std::unordered_map<uint64_t, uint32_t> Ids;
+    uint32_t NextId {0};
+};
+
+// Opens a log to append to, creating it if needed. The host names of an
+// existing log are loaded, so its host ids are kept, and a truncated last
+// entry is dropped. Returns null if the file isn't a log or can't be written.
+inline FILE* ReachLogOpen(const char* FileName, ReachLogNames& Names) {
+    std::error_code Error;
+    auto Size = std::filesystem::file_size(FileName, Error);
+    if (!Error && Size) {
+        uint64_t End;
+        {
+            std::unique_ptr<ReachLogReader> Reader(new ReachLogReader(FileName)); // Too large for the stack
+            if (!Reader->IsValid()) return nullptr;
+            uint16_t Type;
+            while ((Type = Reader->Next())) {
+                if (Type == ReachLogEntryName) Names.Load(Reader->HostId, Reader->Name);
+            }
+            End = Reader->Offset;
+        }
+        if (Size != End) {
+            std::filesystem::resize_file(FileName, End, Error);
+            if (Error) return nullptr;
+        }
+        return fopen(FileName, "ab");
+    }
+    auto File = fopen(FileName, "wb");
+    if (!File) return nullptr;
+    ReachLogHeader Header {};
+    memcpy(Header.Magic, ReachLogMagic, sizeof(ReachLogMagic));
+    Header.Version = REACHLOG_VERSION;
+    fwrite(&Header, sizeof(Header), 1, File);
+    return File;
+}
+
+// Writes a host name entry (if Name is set) and a record entry to a buffer,
+// returning the bytes written, or 0 if they don't fit.
+inline size_t ReachLogEncode(const ReachLogRecord& Record, const char* Name, char* Buffer, size_t Length) {
+    size_t NameLength = Name ? strlen(Name) : 0;
+    size_t Needed = (Name ? sizeof(ReachLogEntry) + sizeof(uint32_t) + NameLength : 0) + sizeof(ReachLogEntry) + sizeof(Record);
+    if (Needed > Length || NameLength > UINT16_MAX - sizeof(uint32_t)) return 0;
+    ReachLogEntry Entry;
+    if (Name) {
+        Entry = {ReachLogEntryName, (uint16_t)(sizeof(uint32_t) + NameLength)};
+        memcpy(Buffer, &Entry, sizeof(Entry)); Buffer += sizeof(Entry);
+        memcpy(Buffer, &Record.HostId, sizeof(uint32_t)); Buffer += sizeof(uint32_t);
+        memcpy(Buffer, Name, NameLength); Buffer += NameLength;
+    }
+    Entry = {ReachLogEntryRecord, (uint16_t)sizeof(Record)};
+    memcpy(Buffer, &Entry, sizeof(Entry)); Buffer += sizeof(Entry);
+    memcpy(Buffer, &Record, sizeof(Record));
+    return Needed;
+}
+
+const char ReachLogCsvHeader[] =
+    "StartTimeUs,ElapsedUs,HostName,Result,Address,Resolution,ResolveUs,RttUs,InitialUs,HandshakeUs,SendPackets,RecvPackets,"
+    "SendBytes,RecvBytes,Amplification,ClientFlight1,ServerFlight1,Version,Retry,MultiRtt,TooMuch,HedgeWon,Status\n";
+
+// The probed address, with its port if known, or an empty string if none.
+inline void ReachLogFormatAddress(const ReachLogRecord& Record, char* Buffer, size_t Length) {
+    *Buffer = '\0';
+    if (!Record.Family) return;
+    char Ip[INET6_ADDRSTRLEN] = "";
+    inet_ntop(Record.Family == 6 ? AF_INET6 : AF_INET, Record.Address, Ip, sizeof(Ip));
+    if (!Record.Port) snprintf(Buffer, Length, "%s", Ip);
+    else snprintf(Buffer, Length, Record.Family == 6 ? "[%s]:%u" : "%s:%u", Ip, Record.Port);
+}
+
+// Per-record values shared by the CSV and JSON Lines formats.
+struct ReachLogFields {
+    char HostName[512]; // Escaped
+    char Address[64];
+    const char* Result;
+    double Amplification;
+    ReachLogFields(const ReachLogRecord& Record, const char* Name, bool Json) {
+        Result = Record.Result < std::size(ReachLogResultNames) ? ReachLogResultNames[Record.Result] : "unknown";
+        Amplification = Record.SendBytes ? (double)Record.RecvBytes / (double)Record.SendBytes : 0.0;
+        ReachLogFormatAddress(Record, Address, sizeof(Address));
+        // Host names are normalized, but a target's ALPN may hold any character.
+        bool Quote = !Json && strpbrk(Name, ",\"");
+        size_t j = 0;
+        if (Quote) HostName[j++] = '"';
+        for (auto c = Name; *c && j < sizeof(HostName) - 3; ++c) {
+            if (*c == '"') HostName[j++] = Json ? '\\' : '"';
+            else if (Json && *c == '\\') HostName[j++] = '\\';
+            HostName[j++] = Json && (uint8_t)*c < 0x20 ? '?' : *c;
+        }
+        if (Quote) HostName[j++] = '"';
+        HostName[j] = '\0';
+    }
+};
+
+inline size_t ReachLogFormatCsv(const ReachLogRecord& Record, const char* Name, char* Buffer, size_t Length) {
+    ReachLogFields Fields(Record, Name, false);
+    char ResolveUs[16] = "";
+    if (Record.Resolution != ReachLogNoLookup) snprintf(ResolveUs, sizeof(ResolveUs), "%u", Record.ResolveUs);
+    int Written;
+    if (Record.Result == ReachLogReachable) {
+        Written = snprintf(Buffer, Length, "%llu,%u,%s,%s,%s,%s,%s,%u,%u,%u,%u,%u,%u,%u,%.2f,%u,%u,%u,%u,%u,%u,%u,0x%x\n",
+            (unsigned long long)Record.StartTimeUs, Record.ElapsedUs, Fields.HostName, Fields.Result, Fields.Address,
+            ReachLogResolutionNames[Record.Resolution & 3], ResolveUs, Record.RttUs, Record.InitialUs, Record.HandshakeUs,
+            Record.SendPackets, Record.RecvPackets, Record.SendBytes, Record.RecvBytes, Fields.Amplification,
+            Record.ClientFlight1, Record.ServerFlight1, Record.Version == 1 ? 1 : 2,
+            !!(Record.Flags & ReachLogRetry), !!(Record.Flags & ReachLogMultiRtt), !!(Record.Flags & ReachLogTooMuch),
+            !!(Record.Flags & ReachLogHedgeWon), Record.Status);
+    } else {
+        Written = snprintf(Buffer, Length, "%llu,%u,%s,%s,%s,%s,%s,,,,,,,,,,,,,,,,0x%x\n",
+            (unsigned long long)Record.StartTimeUs, Record.ElapsedUs, Fields.HostName, Fields.Result, Fields.Address,
+            ReachLogResolutionNames[Record.Resolution & 3], ResolveUs, Record.Status);
+    }
+    return Written < 0 ? 0 : ((size_t)Written < Length ? (size_t)Written : Length - 1);
+}
+
+inline size_t ReachLogFormatJson(const ReachLogRecord& Record, const char* Name, char* Buffer, size_t Length) {
+    ReachLogFields Fields(Record, Name, true);
+    size_t Used = 0; // Always leaves room for the terminator
+    auto Advance = [&](int Written) { if (Written > 0) Used = Used + (size_t)Written < Length ? Used + (size_t)Written : Length - 1; };
+    Advance(snprintf(Buffer, Length, "{\"StartTimeUs\":%llu,\"ElapsedUs\":%u,\"HostName\":\"%s\",\"Result\":\"%s\"",
+        (unsigned long long)Record.StartTimeUs, Record.ElapsedUs, Fields.HostName, Fields.Result));
+    if (*Fields.Address) Advance(snprintf(Buffer + Used, Length - Used, ",\"Address\":\"%s\"", Fields.Address));
+    if (Record.Resolution != ReachLogNoLookup) {
+        Advance(snprintf(Buffer + Used, Length - Used, ",\"Resolution\":\"%s\",\"ResolveUs\":%u",
+            ReachLogResolutionNames[Record.Resolution & 3], Record.ResolveUs));
+    }
+    if (Record.Result == ReachLogReachable) {
+        Advance(snprintf(Buffer + Used, Length - Used,
+            ",\"RttUs\":%u,\"InitialUs\":%u,\"HandshakeUs\":%u,\"SendPackets\":%u,\"RecvPackets\":%u,\"SendBytes\":%u,\"RecvBytes\":%u",
+            Record.RttUs, Record.InitialUs, Record.HandshakeUs, Record.SendPackets, Record.RecvPackets, Record.SendBytes, Record.RecvBytes));
+        Advance(snprintf(Buffer + Used, Length - Used,
+            ",\"Amplification\":%.2f,\"ClientFlight1\":%u,\"ServerFlight1\":%u,\"Version\":%u,\"Retry\":%s,\"MultiRtt\":%s,\"TooMuch\":%s,\"HedgeWon\":%s",
+            Fields.Amplification, Record.ClientFlight1, Record.ServerFlight1, Record.Version == 1 ? 1 : 2,
+            Record.Flags & ReachLogRetry ? "true" : "false", Record.Flags & ReachLogMultiRtt ? "true" : "false",
+            Record.Flags & ReachLogTooMuch ? "true" : "false", Record.Flags & ReachLogHedgeWon ? "true" : "false"));
+    }
+    Advance(snprintf(Buffer + Used, Length - Used, ",\"Status\":%u}\n", Record.Status));
+    return Used;
+}
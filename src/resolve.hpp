@@ -0,0 +1,455 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Name resolution stage that runs ahead of connection starts. Host names are
+    resolved with their own concurrency, and the resulting addresses are given
+    to MsQuic with the host name still used for SNI, so that a slow resolver
+    neither holds a connection slot nor counts against the handshake.
+
+--*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <msquic.hpp>
+#ifndef _WIN32
+#include <netdb.h>
+#endif
+#include "mapfile.hpp"
+
+#define RESOLVE_SYSTEM_TTL          60          // Seconds system resolver results are cached (it doesn't return TTLs)
+#define RESOLVE_MAX_ADDRESSES       8           // Addresses kept per host name
+
+// The outcome of resolving one host name.
+struct ReachResolution {
+    bool Attempted {false}; // Resolved by this stage (instead of by MsQuic)
+    bool Resolved {false};
+    bool Cached {false};    // Answered from the cache, without a lookup
+    bool Mapped {false};    // Given by a static mapping, without a lookup
+    QuicAddr Addresses[RESOLVE_MAX_ADDRESSES]; // In the resolver's order of preference
+    uint32_t AddressCount {0};
+    uint32_t TimeUs {0};
+    uint32_t Ttl {0};       // Seconds the addresses may be cached for
+    // The preferred address.
+    const QuicAddr& Address() const { return Addresses[0]; }
+    // Adds an address after the others, as the system resolver has already
+    // sorted them (RFC 6724). Extra addresses are dropped.
+    void Add(_In_ const QuicAddr& Address) {
+        if (AddressCount == RESOLVE_MAX_ADDRESSES) return;
+        Addresses[AddressCount++] = Address;
+        Resolved = true;
+    }
+    // The first address of the given family, if any.
+    const QuicAddr* Find(QUIC_ADDRESS_FAMILY Family) const {
+        for (uint32_t i = 0; i < AddressCount; ++i) {
+            if (Addresses[i].GetFamily() == Family) return &Addresses[i];
+        }
+        return nullptr;
+    }
+};
+
+// Host names are case-insensitive.
+inline std::string ReachHostKey(_In_reads_(Length) const char* HostName, size_t Length) {
+    std::string Key(HostName, Length);
+    for (auto& c : Key) c = (char)tolower((uint8_t)c);
+    return Key;
+}
+
+// A single outstanding lookup.
+//
+// The waiter may free the lookup as soon as it sees Done, so completion is
+// signaled on a counter that outlives every lookup, and the lookup itself isn't
+// touched after Done is set.
+struct ReachLookup {
+    std::string HostName; // A copy, as the caller's may not outlive the lookup
+    uint16_t Port;        // The port that will be connected to, for port specific mappings
+    ReachResolution Resolution;
+    std::atomic<bool> Done {false};
+    std::function<void(const ReachLookup&)> OnComplete; // Optional, called on the resolving thread
+    ReachLookup(_In_z_ const char* HostName, uint16_t Port) : HostName(HostName), Port(Port) { }
+    void Complete() {
+        if (OnComplete) OnComplete(*this);
+        Done.store(true); // Last access to the lookup
+        Completions.fetch_add(1);
+        Completions.notify_all();
+    }
+    const ReachResolution& Wait() {
+        while (true) {
+            auto Count = Completions.load();
+            if (Done.load()) break;
+            Completions.wait(Count); // Returns once any lookup completes after Count was read
+        }
+        return Resolution;
+    }
+private:
+    static inline std::atomic<uint32_t> Completions {0};
+};
+
+// Asynchronously resolves host names.
+class ReachResolver {
+public:
+    virtual ~ReachResolver() { }
+    // The number of lookups it can usefully work on at once.
+    virtual uint32_t Concurrency() const = 0;
+    // Queues a lookup. The caller owns it, and must wait for it to complete.
+    virtual void Start(_In_ ReachLookup* Lookup) = 0;
+    std::unique_ptr<ReachLookup> Resolve(_In_z_ const char* HostName, uint16_t Port) {
+        std::unique_ptr<ReachLookup> Lookup(new ReachLookup(HostName, Port));
+        Start(Lookup.get());
+        return Lookup;
+    }
+};
+
+// Resolves host names on a pool of threads using the (blocking) system resolver.
+class ReachSystemResolver : public ReachResolver {
+public:
+    ReachSystemResolver(uint32_t ThreadCount) {
+        for (uint32_t i = 0; i < ThreadCount; ++i) {
+            Threads.emplace_back([this]() { Run(); });
+        }
+    }
+    ~ReachSystemResolver() {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Stopping = true;
+        }
+        Event.notify_all();
+        for (auto& Thread : Threads) Thread.join();
+    }
+    uint32_t Concurrency() const override { return (uint32_t)Threads.size(); }
+    void Start(_In_ ReachLookup* Lookup) override {
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            Queue.push_back(Lookup);
+        }
+        Event.notify_one();
+    }
+private:
+    void Run() {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        while (true) {
+            Event.wait(Lock, [this]() { return Stopping || !Queue.empty(); });
+            if (Queue.empty()) break; // Stopping, with nothing left to resolve
+            auto Lookup = Queue.front();
+            Queue.pop_front();
+            Lock.unlock();
+            Lookup->Resolution = GetAddress(Lookup->HostName.c_str());
+            Lookup->Complete();
+            Lock.lock();
+        }
+    }
+    static ReachResolution GetAddress(_In_z_ const char* HostName) {
+        ReachResolution Resolution;
+        Resolution.Attempted = true;
+        auto Start = std::chrono::steady_clock::now();
+        struct addrinfo Hints = {};
+        Hints.ai_family = AF_UNSPEC;
+        Hints.ai_socktype = SOCK_DGRAM;
+        struct addrinfo* Info = nullptr;
+        if (getaddrinfo(HostName, nullptr, &Hints, &Info) == 0) {
+            for (auto Entry = Info; Entry; Entry = Entry->ai_next) {
+                QuicAddr Address;
+                if ((Entry->ai_family == AF_INET || Entry->ai_family == AF_INET6) &&
+                    Entry->ai_addrlen <= sizeof(Address.SockAddr)) {
+                    memcpy(&Address.SockAddr, Entry->ai_addr, Entry->ai_addrlen);
+                    Resolution.Add(Address);
+                }
+            }
+            freeaddrinfo(Info);
+            Resolution.Ttl = RESOLVE_SYSTEM_TTL;
+        }
+        Resolution.TimeUs = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - Start).count();
+        return Resolution;
+    }
+    std::mutex Mutex;
+    std::condition_variable Event;
+    std::deque<ReachLookup*> Queue;
+    bool Stopping {false};
+    std::vector<std::thread> Threads;
+};
+
+// Remembers addresses for their TTL, optionally across runs with a snapshot
+// file, in front of the resolver that does the actual lookups.
+class ReachCachingResolver : public ReachResolver {
+public:
+    ReachCachingResolver(std::unique_ptr<ReachResolver> Inner) : Inner(std::move(Inner)) { }
+    uint32_t Concurrency() const override { return Inner->Concurrency(); }
+    void Start(_In_ ReachLookup* Lookup) override {
+        ++Lookups;
+        if (Find(Lookup->HostName.c_str(), Lookup->Resolution)) {
+            ++Hits;
+            SavedUs += Lookup->Resolution.TimeUs;
+            Lookup->Resolution.Cached = true;
+            Lookup->Resolution.TimeUs = 0;
+            Lookup->Complete();
+            return;
+        }
+        Lookup->OnComplete = [this](const ReachLookup& Lookup) {
+            if (Lookup.Resolution.Resolved && Lookup.Resolution.Ttl) {
+                Insert(Lookup.HostName.c_str(), {Lookup.Resolution, Now() + Lookup.Resolution.Ttl});
+            }
+        };
+        Inner->Start(Lookup);
+    }
+
+    // Lookup statistics (scheduling thread only).
+    uint64_t Lookups {0};
+    uint64_t Hits {0};
+    uint64_t SavedUs {0}; // Sum of the original resolve times of the hits
+
+    // Snapshot file format: a magic string, then for each entry the expiry
+    // (seconds since the epoch), resolve time, address count, addresses (each
+    // a family of 4 or 6 and 16 address bytes) and the length prefixed host
+    // name, all in host byte order.
+    bool Load(_In_z_ const char* FileName) {
+        ReachMappedFile File(FileName);
+        if (!File.IsValid()) return false;
+        if (File.Size < sizeof(SnapshotMagic) || memcmp(File.Data, SnapshotMagic, sizeof(SnapshotMagic))) return false;
+        auto Data = (const uint8_t*)File.Data + sizeof(SnapshotMagic);
+        auto End = (const uint8_t*)File.Data + File.Size;
+        auto Time = Now();
+        while (Data + 13 <= End) {
+            Entry Entry;
+            memcpy(&Entry.Expiry, Data, 8);
+            memcpy(&Entry.Resolution.TimeUs, Data + 8, 4);
+            uint32_t Count = Data[12];
+            Data += 13;
+            if (Count > RESOLVE_MAX_ADDRESSES || Data + Count * 17 + 1 > End) break;
+            for (uint32_t i = 0; i < Count; ++i, Data += 17) {
+                QuicAddr Address;
+                if (Data[0] == 4) {
+                    Address.SetFamily(QUIC_ADDRESS_FAMILY_INET);
+                    memcpy(&Address.SockAddr.Ipv4.sin_addr, Data + 1, 4);
+                } else {
+                    Address.SetFamily(QUIC_ADDRESS_FAMILY_INET6);
+                    memcpy(&Address.SockAddr.Ipv6.sin6_addr, Data + 1, 16);
+                }
+                Entry.Resolution.Add(Address);
+            }
+            uint32_t NameLength = *Data++;
+            if (Data + NameLength > End) break;
+            if (Entry.Expiry > Time && Count) Entries[std::string((const char*)Data, NameLength)] = Entry;
+            Data += NameLength;
+        }
+        return true;
+    }
+    bool Save(_In_z_ const char* FileName) {
+        std::string TempName = std::string(FileName) + ".tmp";
+        FILE* File = fopen(TempName.c_str(), "wb");
+        if (!File) return false;
+        fwrite(SnapshotMagic, 1, sizeof(SnapshotMagic), File);
+        auto Time = Now();
+        std::lock_guard<std::mutex> Lock(Mutex);
+        for (const auto& [HostName, Entry] : Entries) {
+            if (Entry.Expiry <= Time || HostName.size() > 255) continue;
+            const auto& Resolution = Entry.Resolution;
+            uint8_t Data[13 + RESOLVE_MAX_ADDRESSES * 17 + 1] = {};
+            memcpy(Data, &Entry.Expiry, 8);
+            memcpy(Data + 8, &Resolution.TimeUs, 4);
+            Data[12] = (uint8_t)Resolution.AddressCount;
+            auto Address = Data + 13;
+            for (uint32_t i = 0; i < Resolution.AddressCount; ++i, Address += 17) {
+                if (Resolution.Addresses[i].GetFamily() == QUIC_ADDRESS_FAMILY_INET) {
+                    Address[0] = 4;
+                    memcpy(Address + 1, &Resolution.Addresses[i].SockAddr.Ipv4.sin_addr, 4);
+                } else {
+                    Address[0] = 6;
+                    memcpy(Address + 1, &Resolution.Addresses[i].SockAddr.Ipv6.sin6_addr, 16);
+                }
+            }
+            *Address++ = (uint8_t)HostName.size();
+            fwrite(Data, 1, (size_t)(Address - Data), File);
+            fwrite(HostName.data(), 1, HostName.size(), File);
+        }
+        bool Success = fclose(File) == 0;
+        if (!Success) return false;
+        // Replaces the old snapshot atomically, so a crash always leaves one.
+#ifdef _WIN32
+        return MoveFileExA(TempName.c_str(), FileName, MOVEFILE_REPLACE_EXISTING) != FALSE;
+#else
+        return rename(TempName.c_str(), FileName) == 0;
+#endif
+    }
+
+private:
+    static constexpr char SnapshotMagic[8] = {'Q', 'R', 'D', 'N', 'S', '0', '2', '\0'};
+    struct Entry {
+        ReachResolution Resolution;
+        int64_t Expiry {0};
+    };
+    static int64_t Now() {
+        return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+    bool Find(_In_z_ const char* HostName, _Out_ ReachResolution& Resolution) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        auto It = Entries.find(ReachHostKey(HostName, strlen(HostName)));
+        if (It == Entries.end()) return false;
+        auto Remaining = It->second.Expiry - Now();
+        if (Remaining <= 0) {
+            Entries.erase(It);
+            return false;
+        }
+        Resolution = It->second.Resolution;
+        Resolution.Attempted = true;
+        Resolution.Ttl = (uint32_t)Remaining;
+        return true;
+    }
+    void Insert(_In_z_ const char* HostName, const Entry& Entry) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Entries[ReachHostKey(HostName, strlen(HostName))] = Entry;
+    }
+    std::unique_ptr<ReachResolver> Inner;
+    std::mutex Mutex;
+    std::unordered_map<std::string, Entry> Entries;
+};
+
+// Answers from static host name to address mappings, given curl style or in
+// a hosts file, in front of the resolver used for all other host names.
+class ReachStaticResolver : public ReachResolver {
+public:
+    ReachStaticResolver(std::unique_ptr<ReachResolver> Inner) : Inner(std::move(Inner)) { }
+    uint32_t Concurrency() const override { return Inner->Concurrency(); }
+    void Start(_In_ ReachLookup* Lookup) override {
+        auto It = Entries.find(Key(Lookup->HostName.data(), Lookup->HostName.size(), Lookup->Port));
+        if (It == Entries.end()) It = Entries.find(Key(Lookup->HostName.data(), Lookup->HostName.size(), 0));
+        if (It == Entries.end()) {
+            Inner->Start(Lookup);
+            return;
+        }
+        ++Mapped;
+        Lookup->Resolution = It->second;
+        Lookup->Resolution.Attempted = true;
+        Lookup->Resolution.Mapped = true;
+        Lookup->Complete();
+    }
+
+    // Number of lookups answered by a mapping (scheduling thread only).
+    uint64_t Mapped {0};
+
+    bool IsEmpty() const { return Entries.empty(); }
+
+    // Adds a curl style '<host>:<port>:<address>[,<address>...]' mapping,
+    // which only applies to connections to the port (or to any port for '*').
+    // IPv6 addresses may be in brackets.
+    bool AddMapping(_In_z_ const char* Arg) {
+        auto PortStart = strchr(Arg, ':');
+        if (!PortStart || PortStart == Arg) return false;
+        auto AddressStart = strchr(PortStart + 1, ':');
+        if (!AddressStart) return false;
+        uint16_t Port = 0;
+        if (strncmp(PortStart + 1, "*:", 2)) {
+            auto Value = atoi(PortStart + 1);
+            if (Value <= 0 || Value > UINT16_MAX) return false;
+            Port = (uint16_t)Value;
+        }
+        std::string HostName(Arg, (size_t)(PortStart - Arg));
+        const char* Address = AddressStart + 1;
+        do {
+            auto End = strchr(Address, ',');
+            auto Length = End ? (size_t)(End - Address) : strlen(Address);
+            if (Length > 1 && Address[0] == '[' && Address[Length - 1] == ']') { ++Address; Length -= 2; }
+            if (!Add(HostName.data(), HostName.size(), Port, Address, Length)) return false;
+            Address = End ? End + 1 : nullptr;
+        } while (Address);
+        return true;
+    }
+
+    // Adds the mappings of a hosts file: lines of an address followed by the
+    // host names for it, with '#' starting a comment. Lines that don't start
+    // with an address are ignored, as they would be by the system resolver.
+    bool LoadHostsFile(_In_z_ const char* FileName) {
+        ReachMappedFile File(FileName);
+        if (!File.IsValid()) return false;
+        auto Data = File.Data, End = File.Data + File.Size;
+        while (Data < End) {
+            auto LineEnd = (const char*)memchr(Data, '\n', (size_t)(End - Data));
+            if (!LineEnd) LineEnd = End;
+            auto Comment = (const char*)memchr(Data, '#', (size_t)(LineEnd - Data));
+            auto Line = Data, Last = Comment ? Comment : LineEnd;
+            Data = LineEnd + 1;
+            const char* Address = nullptr;
+            size_t AddressLength = 0;
+            while (true) {
+                while (Line < Last && isspace((uint8_t)*Line)) ++Line;
+                if (Line == Last) break;
+                auto Token = Line;
+                while (Line < Last && !isspace((uint8_t)*Line)) ++Line;
+                if (!Address) {
+                    Address = Token;
+                    AddressLength = (size_t)(Line - Token);
+                } else if (!Add(Token, (size_t)(Line - Token), 0, Address, AddressLength)) {
+                    break; // Not an address
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    // Entries are keyed on the host name and port, with port 0 for any port.
+    static std::string Key(_In_reads_(HostNameLength) const char* HostName, size_t HostNameLength, uint16_t Port) {
+        return ReachHostKey(HostName, HostNameLength) + ":" + std::to_string(Port);
+    }
+    bool Add(
+        _In_reads_(HostNameLength) const char* HostName, size_t HostNameLength, uint16_t Port,
+        _In_reads_(AddressLength) const char* Address, size_t AddressLength
+        ) {
+        char AddressString[64];
+        if (!HostNameLength || AddressLength >= sizeof(AddressString)) return false;
+        memcpy(AddressString, Address, AddressLength);
+        AddressString[AddressLength] = '\0';
+        QuicAddr Addr;
+        if (!QuicAddrFromString(AddressString, 0, &Addr.SockAddr)) return false;
+        Entries[Key(HostName, HostNameLength, Port)].Add(Addr);
+        return true;
+    }
+    std::unique_ptr<ReachResolver> Inner;
+    std::unordered_map<std::string, ReachResolution> Entries; // Read-only once resolving starts
+};
+
+// Keeps lookups running a fixed distance ahead of the (single) scheduling
+// thread, which takes them back in the order they were queued.
+template<typename T>
+class ReachLookahead {
+public:
+    ReachLookahead(_In_opt_ ReachResolver* Resolver, size_t Depth) : Resolver(Resolver), Depth(Depth) { }
+    bool Full() const { return Pending.size() >= Depth; }
+    bool Empty() const { return Pending.empty(); }
+    void Push(const T& Item, _In_z_ const char* HostName, uint16_t Port) {
+        Pending.push_back({Item, Resolver ? Resolver->Resolve(HostName, Port) : nullptr});
+    }
+    const T& Front() const { return Pending.front().Item; }
+    // Removes the oldest item, waiting for its lookup to complete.
+    ReachResolution Pop() {
+        auto Entry = std::move(Pending.front());
+        Pending.pop_front();
+        return Entry.Lookup ? Entry.Lookup->Wait() : ReachResolution();
+    }
+    // Any lookups still outstanding must complete before they're freed.
+    ~ReachLookahead() {
+        for (auto& Entry : Pending) if (Entry.Lookup) Entry.Lookup->Wait();
+    }
+private:
+    struct Entry {
+        T Item;
+        std::unique_ptr<ReachLookup> Lookup;
+    };
+    ReachResolver* Resolver;
+    size_t Depth;
+    std::deque<Entry> Pending;
+};
@@ -0,0 +1,84 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Probe targets: a host name with an optional port, ALPN and continuous
+    probing interval, as given in the args or --input.
+
+--*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "normalize.hpp"
+
+struct ReachTarget {
+    std::string HostName;
+    uint32_t Interval {0}; // Per-host probe interval for continuous mode (0 = use --repeat)
+    uint16_t Port {0};     // 0 = use --port
+    std::string Alpn;      // Empty = use --alpn
+    // The host name, with the port and ALPN if they aren't the defaults.
+    std::string Name() const {
+        auto Name = Port && HostName.find(':') != std::string::npos ? "[" + HostName + "]" : HostName;
+        if (Port) Name += ":" + std::to_string(Port);
+        if (!Alpn.empty()) Name += "/" + Alpn;
+        return Name;
+    }
+};
+
+// Parses a target: a host name, optionally followed by ':<port>' (which needs
+// an IPv6 address to be in brackets), '/<alpn>', and an '@<ms>' suffix with its
+// own continuous probing interval. Returns false if the target isn't valid.
+inline bool ReachParseTarget(const char* Text, size_t Length, ReachTarget& Target) {
+    auto End = Text + Length;
+    Target.Interval = 0;
+    Target.Port = 0;
+    Target.Alpn.clear();
+    if (auto Interval = (const char*)memchr(Text, '@', Length)) {
+        Target.Interval = (uint32_t)atoi(std::string(Interval + 1, End).c_str());
+        End = Interval;
+    }
+    if (auto Alpn = (const char*)memchr(Text, '/', (size_t)(End - Text))) {
+        Target.Alpn.assign(Alpn + 1, End);
+        End = Alpn;
+    }
+    auto HostEnd = End;
+    const char* Port = nullptr;
+    if (Text < End && *Text == '[') {
+        auto Close = (const char*)memchr(Text, ']', (size_t)(End - Text));
+        if (!Close || (Close + 1 < End && Close[1] != ':')) return false;
+        if (Close + 1 < End) Port = Close + 2;
+        HostEnd = Close;
+        ++Text;
+    } else if (auto Colon = (const char*)memchr(Text, ':', (size_t)(End - Text));
+               Colon && !memchr(Colon + 1, ':', (size_t)(End - Colon - 1))) { // Not an IPv6 address
+        Port = Colon + 1;
+        HostEnd = Colon;
+    }
+    if (Port) {
+        auto Value = atoi(std::string(Port, End).c_str());
+        if (Value <= 0 || Value > UINT16_MAX) return false;
+        Target.Port = (uint16_t)Value;
+    }
+    Target.HostName.assign(Text, HostEnd);
+    return Text < HostEnd;
+}
+
+// Hashes a target like its host name, also covering the port and ALPN if they
+// aren't the defaults.
+inline uint64_t ReachHashTarget(const ReachTarget& Target) {
+    auto Hash = ReachHashHostName(Target.HostName.c_str());
+    if (!Target.Port && Target.Alpn.empty()) return Hash;
+    Hash = (Hash ^ Target.Port) * 0x100000001b3ull;
+    for (auto c : Target.Alpn) {
+        Hash ^= (uint8_t)c; // ALPNs are case sensitive
+        Hash *= 0x100000001b3ull;
+    }
+    return Hash;
+}
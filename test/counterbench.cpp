@@ -0,0 +1,93 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Benchmarks the per-thread result counters against the adjacent atomics
+    they replaced, with many threads recording results at once the way the
+    MsQuic worker threads do at high parallelism.
+
+--*/
+
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "counters.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+enum class BenchCounter {
+    Total, Reachable, TooMuch, WayTooMuch, MultiRtt, Retry, IPv6, Quicv2,
+    Count
+};
+
+// The original counters: next to each other, in one or two cache lines.
+struct AdjacentCounters {
+    std::atomic<uint32_t> Values[(size_t)BenchCounter::Count] {};
+    void Add(BenchCounter Counter) { Values[(size_t)Counter].fetch_add(1); }
+    uint64_t Get(BenchCounter Counter) const { return Values[(size_t)Counter].load(); }
+};
+
+struct ShardedCounters : ReachCounters<BenchCounter> {
+    void Add(BenchCounter Counter) { ReachCounters::Add(Counter); }
+};
+
+// Records Results results on each thread, with a mix of counters like that of
+// a scan, and returns the results recorded per second.
+template<typename CountersType>
+double Run(uint32_t ThreadCount, uint32_t Results) {
+    std::unique_ptr<CountersType> Counters(new CountersType); // Too large for the stack
+    std::atomic<uint32_t> Ready {0};
+    std::atomic<bool> Go {false};
+    std::vector<std::thread> Threads;
+    for (uint32_t i = 0; i < ThreadCount; ++i) {
+        Threads.emplace_back([&, i]() {
+            ++Ready;
+            while (!Go.load()) std::this_thread::yield();
+            for (uint32_t j = 0; j < Results; ++j) {
+                Counters->Add(BenchCounter::Total);
+                if ((j + i) % 4 == 0) continue; // Unreachable
+                Counters->Add(BenchCounter::Reachable);
+                if (j % 3 == 0) Counters->Add(BenchCounter::IPv6);
+                if (j % 16 == 0) Counters->Add(BenchCounter::MultiRtt);
+            }
+        });
+    }
+    while (Ready.load() != ThreadCount) std::this_thread::yield();
+    auto Start = Clock::now();
+    Go = true;
+    for (auto& Thread : Threads) Thread.join();
+    auto Elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - Start).count();
+    if (Counters->Get(BenchCounter::Total) != (uint64_t)ThreadCount * Results) {
+        printf("Lost counts!\n");
+        exit(1);
+    }
+    return (double)ThreadCount * Results * 1000000.0 / (double)(Elapsed ? Elapsed : 1);
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && (!strcmp(argv[1], "-?") || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))) {
+        printf("usage: counterbench [results_per_thread]\n");
+        return 1;
+    }
+    uint32_t Results = argc > 1 ? (uint32_t)atoi(argv[1]) : 2000000;
+    printf("%u result(s) per thread, %u hardware thread(s)\n\n", Results, std::thread::hardware_concurrency());
+
+    const uint32_t ThreadCounts[] = {1, 4, 16, 32, 64};
+    printf("%8s %20s %20s %8s\n", "THREADS", "ADJACENT RESULTS/S", "SHARDED RESULTS/S", "SPEEDUP");
+    for (auto ThreadCount : ThreadCounts) {
+        auto Old = Run<AdjacentCounters>(ThreadCount, Results);
+        auto New = Run<ShardedCounters>(ThreadCount, Results);
+        printf("%8u %20.0f %20.0f %7.1fx\n", ThreadCount, Old, New, New / Old);
+    }
+    return 0;
+}
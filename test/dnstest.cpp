@@ -0,0 +1,295 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Tests the stub DNS resolver against a fake name server on loopback, which
+    answers each test name in its own (sometimes broken) way: responses with
+    the wrong ID or question, truncated and NXDOMAIN responses, lost queries
+    and CNAME chains.
+
+--*/
+
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "dns.hpp"
+
+#define DNS_TYPE_CNAME          5
+#define DNS_RCODE_NXDOMAIN      3
+
+static uint32_t Failures = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); ++Failures; } } while (0)
+
+// A query as the fake server saw it.
+struct ReceivedQuery {
+    uint16_t Id;
+    uint16_t Type;
+};
+
+// Loopback name server that hands every query to a test specific handler.
+class FakeServer {
+public:
+    FakeServer() {
+        Socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        QuicAddr Loopback(QUIC_ADDRESS_FAMILY_INET);
+        Loopback.SockAddr.Ipv4.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t Length = sizeof(Loopback.SockAddr.Ipv4);
+        if (Socket == REACH_INVALID_SOCKET || !ReachSetNonBlocking(Socket) ||
+            bind(Socket, &Loopback.SockAddr.Ip, Length) != 0 ||
+            getsockname(Socket, &Loopback.SockAddr.Ip, &Length) != 0) {
+            return;
+        }
+        Address = Loopback;
+        Thread = std::thread([this]() { Run(); });
+    }
+    ~FakeServer() {
+        Stopping = true;
+        if (Thread.joinable()) Thread.join();
+        if (Socket != REACH_INVALID_SOCKET) ReachCloseSocket(Socket);
+    }
+    bool IsValid() const { return Thread.joinable(); }
+    QuicAddr Address;
+
+    // The queries received so far for the name.
+    std::vector<ReceivedQuery> Queries(_In_z_ const char* Name) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        return Received[Name];
+    }
+
+    // Builds a response to the query: its header and question, followed by
+    // the answer records.
+    struct Response {
+        uint8_t Packet[DNS_MAX_PACKET];
+        uint32_t Length;
+        uint16_t Answers {0};
+        Response(_In_reads_(QueryLength) const uint8_t* Query, uint32_t QueryLength, uint8_t RCode = 0) : Length(QueryLength) {
+            memcpy(Packet, Query, QueryLength);
+            Packet[2] |= 0x80; // QR
+            Packet[3] = 0x80 | RCode; // RA
+        }
+        void SetId(uint16_t Id) { Packet[0] = (uint8_t)(Id >> 8); Packet[1] = (uint8_t)Id; }
+        void SetTruncated() { Packet[2] |= 0x02; }
+        // Adds a record with a compression pointer to the name at the offset
+        // (12 is the question's name) and returns the offset of its data.
+        uint32_t Add(uint16_t NameOffset, uint16_t Type, uint32_t Ttl, _In_reads_(DataLength) const uint8_t* Data, uint16_t DataLength) {
+            uint8_t Record[12] = {
+                (uint8_t)(0xC0 | NameOffset >> 8), (uint8_t)NameOffset, (uint8_t)(Type >> 8), (uint8_t)Type, 0, DNS_CLASS_IN,
+                (uint8_t)(Ttl >> 24), (uint8_t)(Ttl >> 16), (uint8_t)(Ttl >> 8), (uint8_t)Ttl, (uint8_t)(DataLength >> 8), (uint8_t)DataLength};
+            memcpy(Packet + Length, Record, sizeof(Record));
+            memcpy(Packet + Length + sizeof(Record), Data, DataLength);
+            Length += sizeof(Record);
+            auto Offset = Length;
+            Length += DataLength;
+            ++Answers;
+            Packet[6] = (uint8_t)(Answers >> 8);
+            Packet[7] = (uint8_t)Answers;
+            return Offset;
+        }
+        uint32_t AddIpv4(uint16_t NameOffset, uint32_t Ttl, uint8_t LastByte) {
+            const uint8_t Data[4] = {192, 0, 2, LastByte};
+            return Add(NameOffset, DNS_TYPE_A, Ttl, Data, sizeof(Data));
+        }
+    };
+
+    void Send(_In_ const Response& Response) {
+        sendto(Socket, (const char*)Response.Packet, Response.Length, 0, &Client.SockAddr.Ip, sizeof(Client.SockAddr.Ipv4));
+    }
+
+private:
+    void Run() {
+        uint8_t Packet[DNS_MAX_PACKET];
+        pollfd Fd = {Socket, POLLIN, 0};
+        while (!Stopping) {
+            if (ReachPoll(&Fd, 1, 10) <= 0) continue;
+            socklen_t FromLength = sizeof(Client.SockAddr);
+            auto Length = recvfrom(Socket, (char*)Packet, sizeof(Packet), 0, &Client.SockAddr.Ip, &FromLength);
+            if (Length > 12) OnQuery(Packet, (uint32_t)Length);
+        }
+    }
+
+    void OnQuery(_In_reads_(Length) const uint8_t* Packet, uint32_t Length) {
+        // Decode the (uncompressed) question name.
+        std::string Name;
+        uint32_t Offset = 12;
+        while (Offset < Length && Packet[Offset]) {
+            if (!Name.empty()) Name += '.';
+            Name.append((const char*)Packet + Offset + 1, Packet[Offset]);
+            Offset += 1 + Packet[Offset];
+        }
+        if (Offset + 5 > Length) return;
+        ReceivedQuery Query = {(uint16_t)(Packet[0] << 8 | Packet[1]), (uint16_t)(Packet[Offset + 1] << 8 | Packet[Offset + 2])};
+        uint32_t Count;
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            auto& Queries = Received[Name];
+            Queries.push_back(Query);
+            Count = 0;
+            for (const auto& Previous : Queries) if (Previous.Type == Query.Type) ++Count;
+        }
+        Respond(Name, Query, Count, Packet, Offset + 5);
+    }
+
+    // Answers the Count'th query of its type for the name.
+    void Respond(const std::string& Name, const ReceivedQuery& Query, uint32_t Count, _In_reads_(Length) const uint8_t* Packet, uint32_t Length) {
+        if (Name == "id.test") {
+            if (Query.Type == DNS_TYPE_A) {
+                Response Stray(Packet, Length); // Another query's ID
+                Stray.SetId((uint16_t)(Query.Id + 1));
+                Stray.AddIpv4(12, 300, 66);
+                Send(Stray);
+                Response Other(Packet, Length); // Another question
+                Other.Packet[13] = 'x';
+                Other.AddIpv4(12, 300, 67);
+                Send(Other);
+                Response Answer(Packet, Length);
+                Answer.AddIpv4(12, 300, 1);
+                Send(Answer);
+            } else {
+                Send(Response(Packet, Length));
+            }
+        } else if (Name == "tc.test") {
+            Response Truncated(Packet, Length);
+            Truncated.SetTruncated();
+            if (Query.Type == DNS_TYPE_A) Truncated.AddIpv4(12, 300, 2);
+            Send(Truncated);
+        } else if (Name == "nx.test") {
+            Send(Response(Packet, Length, DNS_RCODE_NXDOMAIN));
+        } else if (Name == "retry.test") {
+            if (Count == 1) return; // The first query of each type is lost
+            Response Answer(Packet, Length);
+            if (Query.Type == DNS_TYPE_A) Answer.AddIpv4(12, 300, 3);
+            Send(Answer);
+        } else if (Name == "lost.test") {
+            return; // Every query is lost
+        } else if (Name == "cname.test") {
+            Response Answer(Packet, Length);
+            const uint8_t Target[] = {4, 'r', 'e', 'a', 'l', 4, 't', 'e', 's', 't', 0};
+            auto TargetOffset = Answer.Add(12, DNS_TYPE_CNAME, 30, Target, sizeof(Target));
+            if (Query.Type == DNS_TYPE_A) Answer.AddIpv4((uint16_t)TargetOffset, 300, 4);
+            Send(Answer);
+        }
+    }
+
+    ReachSocket Socket {REACH_INVALID_SOCKET};
+    QuicAddr Client;
+    std::thread Thread;
+    std::atomic<bool> Stopping {false};
+    std::mutex Mutex;
+    std::map<std::string, std::vector<ReceivedQuery>> Received;
+};
+
+static bool IsIpv4(_In_ const ReachResolution& Resolution, uint32_t Index, uint8_t LastByte) {
+    if (Index >= Resolution.AddressCount) return false;
+    const auto& Address = Resolution.Addresses[Index];
+    uint32_t Expected = htonl(0xC0000200 | LastByte);
+    return Address.GetFamily() == QUIC_ADDRESS_FAMILY_INET && Address.SockAddr.Ipv4.sin_addr.s_addr == Expected;
+}
+
+static uint32_t CountType(_In_ const std::vector<ReceivedQuery>& Queries, uint16_t Type) {
+    uint32_t Count = 0;
+    for (const auto& Query : Queries) if (Query.Type == Type) ++Count;
+    return Count;
+}
+
+int main() {
+#ifdef _WIN32
+    WSADATA WsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &WsaData) != 0) { printf("WSAStartup failed\n"); return 1; }
+#endif
+    FakeServer Server;
+    if (!Server.IsValid()) { printf("Fake server initialization failed\n"); return 1; }
+    ReachDnsResolver Resolver(Server.Address, 16);
+    if (!Resolver.IsValid()) { printf("DNS resolver initialization failed\n"); return 1; }
+
+    // All the lookups run at once, as they would in a scan.
+    const char* Names[] = {"id.test", "tc.test", "nx.test", "retry.test", "lost.test", "cname.test", "127.0.0.1"};
+    std::map<std::string, std::unique_ptr<ReachLookup>> Lookups;
+    for (auto Name : Names) Lookups[Name] = Resolver.Resolve(Name, 443);
+    for (auto& [Name, Lookup] : Lookups) Lookup->Wait();
+
+    // Responses are only accepted for the ID and question of the query.
+    {
+        const auto& Resolution = Lookups["id.test"]->Resolution;
+        CHECK(Resolution.Resolved);
+        CHECK(Resolution.AddressCount == 1);
+        CHECK(IsIpv4(Resolution, 0, 1));
+        CHECK(Resolution.Ttl == 300);
+        CHECK(Server.Queries("id.test").size() == 2);
+    }
+
+    // Truncated responses and errors complete the query without a retry.
+    {
+        const auto& Resolution = Lookups["tc.test"]->Resolution;
+        CHECK(Resolution.Attempted);
+        CHECK(!Resolution.Resolved);
+        CHECK(Resolution.AddressCount == 0);
+        CHECK(Resolution.Ttl == 0);
+        CHECK(Server.Queries("tc.test").size() == 2);
+    }
+    {
+        const auto& Resolution = Lookups["nx.test"]->Resolution;
+        CHECK(Resolution.Attempted);
+        CHECK(!Resolution.Resolved);
+        CHECK(Resolution.TimeUs < DNS_RETRY_MS * 1000);
+        CHECK(Server.Queries("nx.test").size() == 2);
+    }
+
+    // Lost queries are resent, each time with a new ID, until they run out of attempts.
+    {
+        const auto& Resolution = Lookups["retry.test"]->Resolution;
+        CHECK(Resolution.Resolved);
+        CHECK(IsIpv4(Resolution, 0, 3));
+        CHECK(Resolution.TimeUs >= DNS_RETRY_MS * 1000);
+        auto Queries = Server.Queries("retry.test");
+        CHECK(CountType(Queries, DNS_TYPE_A) == 2);
+        CHECK(CountType(Queries, DNS_TYPE_AAAA) == 2);
+        for (size_t i = 0; i < Queries.size(); ++i) {
+            for (size_t j = i + 1; j < Queries.size(); ++j) CHECK(Queries[i].Id != Queries[j].Id);
+        }
+    }
+    {
+        const auto& Resolution = Lookups["lost.test"]->Resolution;
+        CHECK(!Resolution.Resolved);
+        CHECK(Resolution.TimeUs >= (DNS_ATTEMPTS * DNS_RETRY_MS - 50) * 1000);
+        auto Queries = Server.Queries("lost.test");
+        CHECK(CountType(Queries, DNS_TYPE_A) == DNS_ATTEMPTS);
+        CHECK(CountType(Queries, DNS_TYPE_AAAA) == DNS_ATTEMPTS);
+    }
+
+    // The TTL of a CNAME answer limits the TTL of the addresses it leads to.
+    {
+        const auto& Resolution = Lookups["cname.test"]->Resolution;
+        CHECK(Resolution.Resolved);
+        CHECK(Resolution.AddressCount == 1);
+        CHECK(IsIpv4(Resolution, 0, 4));
+        CHECK(Resolution.Ttl == 30);
+    }
+
+    // Address literals aren't sent to the server at all.
+    {
+        const auto& Resolution = Lookups["127.0.0.1"]->Resolution;
+        CHECK(Resolution.Resolved);
+        CHECK(Resolution.AddressCount == 1);
+        CHECK(Server.Queries("127.0.0.1").empty());
+    }
+
+    if (Failures) {
+        printf("%u check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Benchmarks the admission gate against the mutex and condition variable
+    one it replaced. The scheduling thread starts simulated connections, up
+    to the parallel limit, and worker threads (standing in for the MsQuic
+    ones) complete each of them a fixed latency after it started. Reports the
+    handshakes per second and scheduling thread wake ups for each gate and
+    parallel limit.
+
+--*/
+
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "gate.hpp"
+
+#define BENCH_MAX_PARALLEL      8192
+
+using Clock = std::chrono::steady_clock;
+
+// The original gate: every completion takes the lock and wakes the waiter.
+struct MutexGate {
+    uint32_t ActiveCount {0};
+    uint64_t WakeupCount {0};
+    std::mutex Mutex;
+    std::condition_variable NotifyEvent;
+    void Inc() {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        ++ActiveCount;
+    }
+    void Dec() {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        --ActiveCount;
+        NotifyEvent.notify_all();
+    }
+    void WaitBelow(uint32_t Limit) {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        while (ActiveCount >= Limit) {
+            NotifyEvent.wait(Lock);
+            ++WakeupCount;
+        }
+    }
+};
+
+struct AtomicGate : ReachGate {
+    void WaitBelow(uint32_t Limit) {
+        Wait([Limit](uint32_t Count) { return Count < Limit; });
+    }
+};
+
+struct BenchResult {
+    double HandshakesPerSecond;
+    uint64_t Wakeups;
+};
+
+// Tickets are the started connections, claimed in order by the workers.
+template<typename GateType>
+BenchResult Run(uint32_t Parallel, uint32_t WorkerCount, std::chrono::microseconds Latency, std::chrono::milliseconds Duration) {
+    GateType Gate;
+    std::unique_ptr<Clock::time_point[]> StartTimes(new Clock::time_point[BENCH_MAX_PARALLEL * 2]);
+    std::atomic<uint64_t> Started {0};
+    std::atomic<uint64_t> Claimed {0};
+    std::atomic<bool> Stopping {false};
+
+    std::vector<std::thread> Workers;
+    for (uint32_t i = 0; i < WorkerCount; ++i) {
+        Workers.emplace_back([&]() {
+            while (!Stopping.load(std::memory_order_relaxed)) {
+                auto Ticket = Claimed.load();
+                if (Ticket == Started.load() || !Claimed.compare_exchange_weak(Ticket, Ticket + 1)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                auto Due = StartTimes[Ticket % (BENCH_MAX_PARALLEL * 2)] + Latency;
+                while (Clock::now() < Due) std::this_thread::yield();
+                Gate.Dec();
+            }
+        });
+    }
+
+    auto Start = Clock::now();
+    auto End = Start + Duration;
+    uint64_t Ticket = 0;
+    while (true) {
+        Gate.WaitBelow(Parallel);
+        auto Now = Clock::now();
+        if (Now >= End) break;
+        Gate.Inc();
+        StartTimes[Ticket % (BENCH_MAX_PARALLEL * 2)] = Now;
+        Started.store(++Ticket);
+    }
+    Gate.WaitBelow(1);
+    auto Elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - Start).count();
+    Stopping = true;
+    for (auto& Worker : Workers) Worker.join();
+    return {(double)Ticket * 1000000.0 / (double)Elapsed, Gate.WakeupCount};
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && (!strcmp(argv[1], "-?") || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))) {
+        printf("usage: gatebench [duration_ms] [latency_us] [workers]\n");
+        return 1;
+    }
+    std::chrono::milliseconds Duration(argc > 1 ? atoi(argv[1]) : 1000);
+    std::chrono::microseconds Latency(argc > 2 ? atoi(argv[2]) : 1000);
+    uint32_t WorkerCount = argc > 3 ? (uint32_t)atoi(argv[3]) : std::thread::hardware_concurrency() > 2 ? std::thread::hardware_concurrency() - 1 : 1;
+    printf("%u worker(s), %lld us handshake latency, %lld ms per run\n\n",
+        WorkerCount, (long long)Latency.count(), (long long)Duration.count());
+
+    const uint32_t ParallelLimits[] = {1, 64, 1024, BENCH_MAX_PARALLEL};
+    printf("%9s %16s %12s %16s %12s\n", "PARALLEL", "MUTEX HS/S", "WAKE UPS", "ATOMIC HS/S", "WAKE UPS");
+    for (auto Parallel : ParallelLimits) {
+        auto Old = Run<MutexGate>(Parallel, WorkerCount, Latency, Duration);
+        auto New = Run<AtomicGate>(Parallel, WorkerCount, Latency, Duration);
+        printf("%9u %16.1f %12llu %16.1f %12llu\n", Parallel,
+            Old.HandshakesPerSecond, (unsigned long long)Old.Wakeups,
+            New.HandshakesPerSecond, (unsigned long long)New.Wakeups);
+    }
+    return 0;
+}
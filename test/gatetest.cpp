@@ -0,0 +1,137 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Tests the admission gate, including completions that land while the
+    scheduling thread is between announcing it's about to wait and actually
+    blocking, which must not be lost.
+
+--*/
+
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "gate.hpp"
+
+static uint32_t Failures = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); ++Failures; } } while (0)
+
+using namespace std::chrono_literals;
+
+// Waits up to a couple of seconds for the flag, since a lost wake up would
+// otherwise hang the test instead of failing it.
+static bool WaitForFlag(const std::atomic<bool>& Flag) {
+    for (uint32_t i = 0; i < 200 && !Flag.load(); ++i) {
+        std::this_thread::sleep_for(10ms);
+    }
+    return Flag.load();
+}
+
+int main() {
+    // Nothing to wait for.
+    {
+        ReachGate Gate;
+        Gate.Wait([](uint32_t Count) { return Count == 0; });
+        CHECK(Gate.WakeupCount == 0);
+        CHECK(!Gate.Waiting.load());
+    }
+
+    // A completion lands after the waiter set Waiting but before it blocks,
+    // and a start brings the count back to the value the waiter then blocks
+    // on. The later completions must still wake it.
+    {
+        static ReachGate Gate; // Outlives the waiter if it hangs
+        Gate.ActiveCount = 2;
+        std::atomic<uint32_t> Checks {0};
+        std::atomic<bool> Blocking {false};
+        std::atomic<bool> Done {false};
+        std::thread Waiter([&]() {
+            Gate.Wait([&](uint32_t Count) {
+                if (++Checks == 2) { // The recheck, with Waiting set
+                    std::thread([&]() { Gate.Dec(); Gate.Inc(); }).join();
+                    Blocking = true;
+                }
+                return Count == 0;
+            });
+            Done = true;
+        });
+        CHECK(WaitForFlag(Blocking));
+        std::this_thread::sleep_for(50ms); // Let the waiter block
+        CHECK(!Done.load());
+        Gate.Dec();
+        Gate.Dec();
+        if (!WaitForFlag(Done)) {
+            printf("waiter never woke up (count=%u, waiting=%u)\n",
+                Gate.ActiveCount.load(), (uint32_t)Gate.Waiting.load());
+            Waiter.detach();
+            return 1;
+        }
+        Waiter.join();
+        CHECK(Gate.ActiveCount.load() == 0);
+        CHECK(!Gate.Waiting.load());
+    }
+
+    // Many rounds of starts completed by other threads, waiting for all of
+    // them each time, like a --repeat run.
+    {
+        static ReachGate Gate;
+        const uint32_t Rounds = 20000;
+        const uint32_t PerRound = 4;
+        std::atomic<uint32_t> Started {0};
+        std::atomic<uint32_t> Completed {0};
+        std::atomic<bool> Done {false};
+        std::vector<std::thread> Workers;
+        for (uint32_t i = 0; i < 2; ++i) {
+            Workers.emplace_back([&]() {
+                while (Completed.load() != Rounds * PerRound) {
+                    auto Ticket = Completed.load();
+                    if (Ticket == Started.load() || !Completed.compare_exchange_weak(Ticket, Ticket + 1)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    Gate.Dec();
+                }
+            });
+        }
+        std::thread Scheduler([&]() {
+            for (uint32_t i = 0; i < Rounds; ++i) {
+                for (uint32_t j = 0; j < PerRound; ++j) {
+                    Gate.Inc();
+                    ++Started;
+                }
+                Gate.Wait([](uint32_t Count) { return Count == 0; });
+            }
+            Done = true;
+        });
+        for (uint32_t i = 0; i < 1000 && !Done.load(); ++i) {
+            std::this_thread::sleep_for(10ms);
+        }
+        if (!Done.load()) {
+            printf("scheduler never woke up (count=%u, waiting=%u)\n",
+                Gate.ActiveCount.load(), (uint32_t)Gate.Waiting.load());
+            Scheduler.detach();
+            for (auto& Worker : Workers) Worker.detach();
+            return 1;
+        }
+        Scheduler.join();
+        for (auto& Worker : Workers) Worker.join();
+        CHECK(Gate.ActiveCount.load() == 0);
+    }
+
+    if (Failures) {
+        printf("%u check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
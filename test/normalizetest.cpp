@@ -0,0 +1,137 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Tests host name normalization: the punycode encoder against the RFC 3492
+    sample strings, case folding, trailing dots and invalid names, and that
+    the forms of a name that normalize the same are only probed once.
+
+--*/
+
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "normalize.hpp"
+
+static uint32_t Failures = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); ++Failures; } } while (0)
+
+// The samples of RFC 3492 section 7.1, except (H), whose encoding is longer
+// than a DNS label. The RFC's outputs also carry mixed-case annotations, which
+// the encoder doesn't produce, so its digits are all lowercase here.
+struct PunycodeSample {
+    const char* Name;
+    const char32_t* Input;
+    const char* Output;
+} const PunycodeSamples[] = {
+    {"(A) Arabic (Egyptian)", U"\u0644\u064A\u0647\u0645\u0627\u0628\u062A\u0643\u0644\u0645\u0648\u0634\u0639\u0631\u0628\u064A\u061F", "xn--egbpdaj6bu4bxfgehfvwxn"},
+    {"(B) Chinese (simplified)", U"\u4ED6\u4EEC\u4E3A\u4EC0\u4E48\u4E0D\u8BF4\u4E2D\u6587", "xn--ihqwcrb4cv8a8dqg056pqjye"},
+    {"(C) Chinese (traditional)", U"\u4ED6\u5011\u7232\u4EC0\u9EBD\u4E0D\u8AAA\u4E2D\u6587", "xn--ihqwctvzc91f659drss3x8bo0yb"},
+    {"(D) Czech", U"Pro\u010Dprost\u011Bnemluv\u00ED\u010Desky", "xn--Proprostnemluvesky-uyb24dma41a"},
+    {"(E) Hebrew", U"\u05DC\u05DE\u05D4\u05D4\u05DD\u05E4\u05E9\u05D5\u05D8\u05DC\u05D0\u05DE\u05D3\u05D1\u05E8\u05D9\u05DD\u05E2\u05D1\u05E8\u05D9\u05EA", "xn--4dbcagdahymbxekheh6e0a7fei0b"},
+    {"(F) Hindi (Devanagari)", U"\u092F\u0939\u0932\u094B\u0917\u0939\u093F\u0928\u094D\u0926\u0940\u0915\u094D\u092F\u094B\u0902\u0928\u0939\u0940\u0902\u092C\u094B\u0932\u0938\u0915\u0924\u0947\u0939\u0948\u0902", "xn--i1baa7eci9glrd9b2ae1bj0hfcgg6iyaf8o0a1dig0cd"},
+    {"(G) Japanese (kanji and hiragana)", U"\u306A\u305C\u307F\u3093\u306A\u65E5\u672C\u8A9E\u3092\u8A71\u3057\u3066\u304F\u308C\u306A\u3044\u306E\u304B", "xn--n8jok5ay5dzabd5bym9f0cm5685rrjetr6pdxa"},
+    {"(I) Russian (Cyrillic)", U"\u043F\u043E\u0447\u0435\u043C\u0443\u0436\u0435\u043E\u043D\u0438\u043D\u0435\u0433\u043E\u0432\u043E\u0440\u044F\u0442\u043F\u043E\u0440\u0443\u0441\u0441\u043A\u0438", "xn--b1abfaaepdrnnbgefbadotcwatmq2g4l"},
+    {"(J) Spanish", U"Porqu\u00E9nopuedensimplementehablarenEspa\u00F1ol", "xn--PorqunopuedensimplementehablarenEspaol-fmd56a"},
+    {"(K) Vietnamese", U"T\u1EA1isaoh\u1ECDkh\u00F4ngth\u1EC3ch\u1EC9n\u00F3iti\u1EBFngVi\u1EC7t", "xn--TisaohkhngthchnitingVit-kjcr8268qyxafd2f1b9g"},
+    {"(L) 3<nen>B<gumi><kinpachi><sensei>", U"3\u5E74B\u7D44\u91D1\u516B\u5148\u751F", "xn--3B-ww4c5e180e575a65lsy2b"},
+    {"(M) <amuro><namie>-with-SUPER-MONKEYS", U"\u5B89\u5BA4\u5948\u7F8E\u6075-with-SUPER-MONKEYS", "xn---with-SUPER-MONKEYS-pc58ag80a8qai00g7n9n"},
+    {"(N) Hello-Another-Way-<sorezore><no><basho>", U"Hello-Another-Way-\u305D\u308C\u305E\u308C\u306E\u5834\u6240", "xn--Hello-Another-Way--fc4qua05auwb3674vfr0b"},
+    {"(O) <hitotsu><yane><no><shita>2", U"\u3072\u3068\u3064\u5C4B\u6839\u306E\u4E0B2", "xn--2-u9tlzr9756bt3uc0v"},
+    {"(P) Maji<de>Koi<suru>5<byou><mae>", U"Maji\u3067Koi\u3059\u308B5\u79D2\u524D", "xn--MajiKoi5-783gue6qz075azm5e"},
+    {"(Q) <pafii>de<runba>", U"\u30D1\u30D5\u30A3\u30FCde\u30EB\u30F3\u30D0", "xn--de-jg4avhby1noc0d"},
+    {"(R) <sono><supiido><de>", U"\u305D\u306E\u30B9\u30D4\u30FC\u30C9\u3067", "xn--d9juau41awczczp"},
+    {"(S) -> $1.00 <-", U"-> $1.00 <-", "xn---> $1.00 <--"},
+};
+
+// Normalizes a copy of the name, returning "!" if it isn't valid.
+static std::string Normalize(const char* HostName) {
+    std::string Normalized(HostName);
+    return ReachNormalizeHostName(Normalized) ? Normalized : "!";
+}
+
+int main() {
+    for (const auto& Sample : PunycodeSamples) {
+        std::vector<uint32_t> Label;
+        for (auto c = Sample.Input; *c; ++c) Label.push_back((uint32_t)*c);
+        std::string Output;
+        if (!ReachPunycode(Label, Output) || Output != Sample.Output) {
+            printf("%s: got %s, expected %s\n", Sample.Name, Output.c_str(), Sample.Output);
+            ++Failures;
+        }
+    }
+
+    // ASCII names are only lowercased, without their trailing dot.
+    CHECK(Normalize("example.com") == "example.com");
+    CHECK(Normalize("WWW.Example.COM") == "www.example.com");
+    CHECK(Normalize("example.com.") == "example.com");
+    CHECK(Normalize("xn--bcher-kva.de") == "xn--bcher-kva.de");
+
+    // Internationalized labels are case folded, then punycoded. The IDNA full
+    // stops separate labels too.
+    CHECK(Normalize("B\xC3\xBC" "cher.Example.") == "xn--bcher-kva.example");
+    CHECK(Normalize("B\xC3\x9C" "CHER.de") == "xn--bcher-kva.de");
+    CHECK(Normalize("b\xC3\xBC" "cher\xE3\x80\x82" "de") == "xn--bcher-kva.de");
+    CHECK(Normalize("\xD0\x9F\xD0\xA0\xD0\x98\xD0\x9C\xD0\x95\xD0\xA0.\xD1\x80\xD1\x84") == "xn--e1afmkfd.xn--p1ai");
+
+    // Invalid names.
+    CHECK(Normalize("") == "!");
+    CHECK(Normalize(".") == "!");
+    CHECK(Normalize("a..b") == "!");
+    CHECK(Normalize(".example.com") == "!");
+    CHECK(Normalize("exa mple.com") == "!");
+    CHECK(Normalize("b\xC3") == "!");             // Truncated UTF-8
+    CHECK(Normalize("b\xC0\xBC" "cher.de") == "!"); // Overlong UTF-8
+    CHECK(Normalize((std::string(63, 'a') + ".com").c_str()) == std::string(63, 'a') + ".com");
+    CHECK(Normalize((std::string(64, 'a') + ".com").c_str()) == "!");
+    std::string Long;
+    while (Long.size() < HOST_MAX_LENGTH) Long += "abcdefghi.";
+    Long.resize(HOST_MAX_LENGTH);
+    CHECK(Normalize(Long.c_str()) == Long);
+    CHECK(Normalize((Long + "j").c_str()) == "!");
+
+    // Each form of a name is only probed once.
+    {
+        const char* Names[] = {
+            "example.com", "Example.COM", "example.com.", "EXAMPLE.COM.",
+            "b\xC3\xBC" "cher.de", "xn--bcher-kva.de", "B\xC3\x9C" "CHER.DE.", "XN--BCHER-KVA.DE",
+            "other.example",
+        };
+        ReachHostSet Seen;
+        uint32_t Unique = 0;
+        for (auto Name : Names) {
+            auto Normalized = Normalize(Name);
+            CHECK(Normalized != "!");
+            if (Seen.Insert(ReachHashHostName(Normalized.c_str()))) ++Unique;
+        }
+        CHECK(Unique == 3);
+        CHECK(Seen.Size() == 3);
+    }
+
+    // The set keeps every hash as it grows.
+    {
+        ReachHostSet Seen;
+        const uint64_t Count = 100000;
+        bool Inserted = true, Found = true;
+        for (uint64_t i = 1; i <= Count; ++i) Inserted &= Seen.Insert(i * 0x9E3779B97F4A7C15ull);
+        for (uint64_t i = 1; i <= Count; ++i) Found &= !Seen.Insert(i * 0x9E3779B97F4A7C15ull);
+        CHECK(Inserted);
+        CHECK(Found);
+        CHECK(Seen.Size() == Count);
+    }
+
+    if (Failures) {
+        printf("%u check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
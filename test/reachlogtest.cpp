@@ -0,0 +1,190 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Tests the binary per-probe log: records encoded for --out-log read back
+    the same, a truncated last entry (from a killed run) is dropped when the
+    log is read or reopened, and entries of other sizes and types are handled
+    as the format allows.
+
+--*/
+
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "reachlog.hpp"
+
+static uint32_t Failures = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); ++Failures; } } while (0)
+
+static ReachLogRecord MakeRecord(uint32_t HostId, uint32_t Seed) {
+    ReachLogRecord Record {};
+    Record.StartTimeUs = 1700000000000000ull + Seed;
+    Record.ElapsedUs = 1000 + Seed;
+    Record.HostId = HostId;
+    Record.Family = Seed % 2 ? 6 : 4;
+    for (uint8_t i = 0; i < (Record.Family == 6 ? 16 : 4); ++i) Record.Address[i] = (uint8_t)(Seed + i + 1);
+    Record.Port = 443;
+    Record.Result = ReachLogReachable;
+    Record.Resolution = ReachLogLookup;
+    Record.Flags = ReachLogMultiRtt;
+    Record.Version = 1;
+    Record.ResolveUs = 200 + Seed;
+    Record.RttUs = 5000;
+    Record.InitialUs = 2000;
+    Record.HandshakeUs = 12000 + Seed;
+    Record.SendPackets = 1;
+    Record.RecvPackets = 3;
+    Record.SendBytes = 1260;
+    Record.RecvBytes = 3000;
+    return Record;
+}
+
+// Appends a record for the host, with the host name entry the first time.
+static void Append(FILE* File, ReachLogNames& Names, const char* Name, uint32_t Seed, std::vector<ReachLogRecord>& Written) {
+    bool Added;
+    auto Record = MakeRecord(Names.Find(Name, Added), Seed);
+    char Buffer[512];
+    auto Length = ReachLogEncode(Record, Added ? Name : nullptr, Buffer, sizeof(Buffer));
+    CHECK(Length != 0);
+    fwrite(Buffer, 1, Length, File);
+    Written.push_back(Record);
+}
+
+// Reads a whole log, checking its records against those written, and returns
+// the end of its last complete entry.
+static uint64_t ReadBack(const char* FileName, const std::vector<ReachLogRecord>& Written, const std::vector<std::string>& Names) {
+    std::unique_ptr<ReachLogReader> Reader(new ReachLogReader(FileName)); // Too large for the stack
+    CHECK(Reader->IsValid());
+    std::vector<std::string> Read;
+    size_t Records = 0;
+    uint16_t Type;
+    while ((Type = Reader->Next())) {
+        if (Type == ReachLogEntryName) {
+            CHECK(Reader->HostId == Read.size()); // Ids are assigned in order
+            Read.push_back(Reader->Name);
+        } else if (Type == ReachLogEntryRecord) {
+            CHECK(Records < Written.size());
+            if (Records >= Written.size()) break;
+            CHECK(Reader->Record.HostId < Read.size()); // Named before first use
+            CHECK(!memcmp(&Reader->Record, &Written[Records], sizeof(ReachLogRecord)));
+            ++Records;
+        }
+    }
+    CHECK(Records == Written.size());
+    CHECK(Read == Names);
+    return Reader->Offset;
+}
+
+int main() {
+    auto Path = (std::filesystem::temp_directory_path() / "reachlogtest.bin").string();
+    auto FileName = Path.c_str();
+    std::filesystem::remove(FileName);
+
+    // A new log, with two hosts, one probed twice.
+    std::vector<ReachLogRecord> Written;
+    {
+        ReachLogNames Names;
+        auto File = ReachLogOpen(FileName, Names);
+        CHECK(File != nullptr);
+        if (!File) return 1;
+        Append(File, Names, "a.example", 1, Written);
+        Append(File, Names, "b.example:853/doq", 2, Written);
+        Append(File, Names, "a.example", 3, Written);
+        fclose(File);
+    }
+    auto Complete = ReadBack(FileName, Written, {"a.example", "b.example:853/doq"});
+    CHECK(Complete == std::filesystem::file_size(FileName));
+
+    // A record cut short, as by a killed run, ends the log where it starts.
+    {
+        char Buffer[512];
+        auto Length = ReachLogEncode(MakeRecord(0, 4), nullptr, Buffer, sizeof(Buffer));
+        auto File = fopen(FileName, "ab");
+        fwrite(Buffer, 1, Length - 10, File);
+        fclose(File);
+    }
+    CHECK(std::filesystem::file_size(FileName) > Complete);
+    CHECK(ReadBack(FileName, Written, {"a.example", "b.example:853/doq"}) == Complete);
+
+    // Reopening drops the truncated entry and keeps the host ids.
+    {
+        ReachLogNames Names;
+        auto File = ReachLogOpen(FileName, Names);
+        CHECK(File != nullptr);
+        if (!File) return 1;
+        CHECK(std::filesystem::file_size(FileName) == Complete);
+        bool Added;
+        CHECK(Names.Find("b.example:853/doq", Added) == 1);
+        CHECK(!Added);
+        Append(File, Names, "c.example", 5, Written);
+        CHECK(Written.back().HostId == 2);
+        Append(File, Names, "a.example", 6, Written);
+        CHECK(Written.back().HostId == 0);
+        fclose(File);
+    }
+    Complete = ReadBack(FileName, Written, {"a.example", "b.example:853/doq", "c.example"});
+    CHECK(Complete == std::filesystem::file_size(FileName));
+
+    // Unknown entries are skipped. Records from a newer writer may be longer,
+    // and those from an older one shorter, with the missing fields zero.
+    {
+        auto File = fopen(FileName, "ab");
+        char Payload[sizeof(ReachLogRecord) + 8] = {};
+        ReachLogEntry Entry = {99, 8};
+        fwrite(&Entry, sizeof(Entry), 1, File);
+        fwrite(Payload, 1, 8, File);
+        auto Record = MakeRecord(1, 7);
+        memcpy(Payload, &Record, sizeof(Record));
+        Entry = {ReachLogEntryRecord, (uint16_t)sizeof(Payload)};
+        fwrite(&Entry, sizeof(Entry), 1, File);
+        fwrite(Payload, 1, sizeof(Payload), File);
+        Entry = {ReachLogEntryRecord, (uint16_t)offsetof(ReachLogRecord, Flags)};
+        fwrite(&Entry, sizeof(Entry), 1, File);
+        fwrite(Payload, 1, Entry.Length, File);
+        fclose(File);
+        Written.push_back(Record);
+        memset((char*)&Record + offsetof(ReachLogRecord, Flags), 0, sizeof(Record) - offsetof(ReachLogRecord, Flags));
+        Written.push_back(Record);
+    }
+    CHECK(ReadBack(FileName, Written, {"a.example", "b.example:853/doq", "c.example"}) == std::filesystem::file_size(FileName));
+
+    // Entries that don't fit the buffer aren't written at all.
+    {
+        char Buffer[sizeof(ReachLogEntry) + sizeof(ReachLogRecord) + 4];
+        auto Record = MakeRecord(0, 8);
+        CHECK(ReachLogEncode(Record, nullptr, Buffer, sizeof(Buffer)) == sizeof(ReachLogEntry) + sizeof(ReachLogRecord));
+        CHECK(ReachLogEncode(Record, "a.example", Buffer, sizeof(Buffer)) == 0);
+    }
+
+    // Other files aren't taken for logs, nor appended to.
+    {
+        auto File = fopen(FileName, "wb");
+        fputs("HostName,Result\n", File);
+        fclose(File);
+        ReachLogNames Names;
+        CHECK(ReachLogOpen(FileName, Names) == nullptr);
+        std::unique_ptr<ReachLogReader> Reader(new ReachLogReader(FileName));
+        CHECK(!Reader->IsValid());
+        CHECK(Reader->Next() == 0);
+    }
+
+    std::filesystem::remove(FileName);
+    if (Failures) {
+        printf("%u check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Tests the parsing of targets (host, host:port, [IPv6]:port, /alpn and
+    @interval suffixes), their display names and their deduplication hashes.
+
+--*/
+
+#define _CRT_SECURE_NO_WARNINGS 1
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "target.hpp"
+
+static uint32_t Failures = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); ++Failures; } } while (0)
+
+struct TargetSample {
+    const char* Text;
+    const char* HostName;
+    uint16_t Port;
+    const char* Alpn;
+    uint32_t Interval;
+} const ValidTargets[] = {
+    {"example.com", "example.com", 0, "", 0},
+    {"example.com:853", "example.com", 853, "", 0},
+    {"example.com/doq", "example.com", 0, "doq", 0},
+    {"dns.example:853/doq", "dns.example", 853, "doq", 0},
+    {"example.com@5000", "example.com", 0, "", 5000},
+    {"example.com:8443/h3-29@250", "example.com", 8443, "h3-29", 250},
+    {"192.0.2.1:443", "192.0.2.1", 443, "", 0},
+    {"2001:db8::1", "2001:db8::1", 0, "", 0}, // A bare IPv6 address can't take a port
+    {"[2001:db8::1]", "2001:db8::1", 0, "", 0},
+    {"[2001:db8::1]:8443", "2001:db8::1", 8443, "", 0},
+    {"[2001:db8::1]:8443/doq", "2001:db8::1", 8443, "doq", 0},
+    {"[::1]/h3", "::1", 0, "h3", 0},
+    {"example.com:65535", "example.com", 65535, "", 0},
+};
+
+const char* InvalidTargets[] = {
+    "",
+    ":443",
+    "/doq",
+    "example.com:0",
+    "example.com:65536",
+    "example.com:abc",
+    "example.com:",
+    "[2001:db8::1",
+    "[2001:db8::1]8443",
+    "[]:443",
+};
+
+static bool Parse(const char* Text, ReachTarget& Target) {
+    return ReachParseTarget(Text, strlen(Text), Target);
+}
+
+int main() {
+    for (const auto& Sample : ValidTargets) {
+        ReachTarget Target;
+        if (!Parse(Sample.Text, Target) || Target.HostName != Sample.HostName || Target.Port != Sample.Port ||
+            Target.Alpn != Sample.Alpn || Target.Interval != Sample.Interval) {
+            printf("%s: parsed as %s port %u alpn '%s' interval %u\n", Sample.Text,
+                Target.HostName.c_str(), Target.Port, Target.Alpn.c_str(), Target.Interval);
+            ++Failures;
+        }
+    }
+    for (auto Text : InvalidTargets) {
+        ReachTarget Target;
+        if (Parse(Text, Target)) {
+            printf("'%s' parsed, but isn't valid\n", Text);
+            ++Failures;
+        }
+    }
+
+    // Only the given length is parsed, as for the comma separated args.
+    {
+        const char* Args = "a.example,b.example:853";
+        ReachTarget Target;
+        CHECK(ReachParseTarget(Args, 9, Target));
+        CHECK(Target.HostName == "a.example");
+        CHECK(Target.Port == 0);
+    }
+
+    // Earlier values don't carry over when a target is reused.
+    {
+        ReachTarget Target;
+        CHECK(Parse("example.com:853/doq@250", Target));
+        CHECK(Parse("example.org", Target));
+        CHECK(Target.Port == 0);
+        CHECK(Target.Alpn.empty());
+        CHECK(Target.Interval == 0);
+    }
+
+    // Display names bracket IPv6 addresses that have a port, and parse back
+    // to the same target.
+    {
+        const char* Names[] = {"example.com", "example.com:853/doq", "[2001:db8::1]:8443", "2001:db8::1/h3"};
+        for (auto Name : Names) {
+            ReachTarget Target, Again;
+            CHECK(Parse(Name, Target));
+            CHECK(Target.Name() == Name);
+            CHECK(Parse(Target.Name().c_str(), Again));
+            CHECK(Again.HostName == Target.HostName && Again.Port == Target.Port && Again.Alpn == Target.Alpn);
+        }
+    }
+
+    // Targets differing only in the host name's case are the same target, but
+    // a port or ALPN (which is case sensitive) makes a different one.
+    {
+        ReachTarget A, B;
+        auto Hash = [](const char* Text) { ReachTarget Target; Parse(Text, Target); return ReachHashTarget(Target); };
+        CHECK(Parse("example.com", A) && Parse("example.com", B));
+        CHECK(ReachHashTarget(A) == ReachHashTarget(B));
+        CHECK(Hash("example.com") == ReachHashHostName("example.com"));
+        CHECK(Hash("EXAMPLE.com:853") == Hash("example.com:853"));
+        CHECK(Hash("example.com:853") != Hash("example.com"));
+        CHECK(Hash("example.com:853") != Hash("example.com:8853"));
+        CHECK(Hash("example.com/doq") != Hash("example.com"));
+        CHECK(Hash("example.com/h3") != Hash("example.com/H3"));
+        CHECK(Hash("example.com:853/doq") != Hash("example.com/doq"));
+        CHECK(Hash("example.com@250") == Hash("example.com")); // The interval isn't part of the target
+    }
+
+    if (Failures) {
+        printf("%u check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}